@@ -28,11 +28,87 @@
 #include "ITC_Port.h"
 
 #include <stdbool.h>
+#include <string.h>
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+/* The shared read-only leaf Event with a 0 counter */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+const ITC_Event_t gt_ItcSharedEvent = {
+    NULL, NULL, NULL, 0, .u64_Hash = ITC_EVENT_SHARED_EVENT_HASH
+};
+#else
+const ITC_Event_t gt_ItcSharedEvent = { NULL, NULL, NULL, 0 };
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
 
 /******************************************************************************
  * Private functions
  ******************************************************************************/
 
+#if ITC_CONFIG_ENABLE_EVENT_HASH || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH ||   \
+    ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/**
+ * @brief Mix a value into an Event hash
+ *
+ * Uses the finaliser of the SplitMix64 generator, which is a bijection with
+ * good avalanche properties.
+ *
+ * @param u64_Hash The current hash
+ * @param u64_Value The value to mix in
+ * @return `uint64_t` The new hash
+ */
+static uint64_t mixEventHash(
+    uint64_t u64_Hash,
+    const uint64_t u64_Value
+)
+{
+    u64_Hash = (u64_Hash ^ u64_Value) + ITC_EVENT_HASH_GAMMA;
+    u64_Hash = (u64_Hash ^ (u64_Hash >> 30U)) * UINT64_C(0xBF58476D1CE4E5B9);
+    u64_Hash = (u64_Hash ^ (u64_Hash >> 27U)) * UINT64_C(0x94D049BB133111EB);
+
+    return u64_Hash ^ (u64_Hash >> 31U);
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH || ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/**
+ * @brief Calculate the Merkle hash of an Event subtree
+ *
+ * Mixes the kind (leaf or parent) and the counter of the subtree root with
+ * the memoised hashes of its children.
+ *
+ * @param pt_Event The root of the Event subtree
+ * @return `uint64_t` The hash of the Event subtree
+ */
+static uint64_t calcEventSubtreeHash(
+    const ITC_Event_t *const pt_Event
+)
+{
+    uint64_t u64_Hash;
+
+    u64_Hash = mixEventHash(
+        ITC_EVENT_HASH_SEED, (uint64_t)ITC_EVENT_IS_PARENT_EVENT(pt_Event));
+    u64_Hash = mixEventHash(u64_Hash, (uint64_t)pt_Event->t_Count);
+
+    /* Malformed nodes (e.g. from deserialisation) are hashed as leaves.
+     * They are rejected during validation anyway */
+    if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+    {
+        u64_Hash = mixEventHash(u64_Hash, pt_Event->pt_Left->u64_Hash);
+        u64_Hash = mixEventHash(u64_Hash, pt_Event->pt_Right->u64_Hash);
+    }
+
+    return u64_Hash;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 /**
  * @brief Validate an existing ITC Event
  *
@@ -69,12 +145,23 @@ static ITC_Status_t validateEvent(
          *  - The parent pointer must match pt_CurrentEventParent.
          *  - Must be a leaf or a valid parent node
          *  - Must be a normalised Event node (if the check is enabled)
+         *  - The memoised subtree maximum must match the one calculated
+         *    from the children (if enabled)
+         *  - The memoised subtree hash must match the one calculated
+         *    from the children (if enabled)
          */
         if (pt_CurrentEventParent != pt_Event->pt_Parent ||
             (!ITC_EVENT_IS_LEAF_EVENT(pt_Event) &&
              !ITC_EVENT_IS_VALID_PARENT(pt_Event)) ||
             (b_CheckIsNormalised &&
-             !ITC_EVENT_IS_NORMALISED_EVENT(pt_Event)))
+             !ITC_EVENT_IS_NORMALISED_EVENT(pt_Event))
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+            || pt_Event->t_Max != ITC_EVENT_CALC_SUBTREE_MAX(pt_Event)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+            || pt_Event->u64_Hash != calcEventSubtreeHash(pt_Event)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+            )
         {
             t_Status = ITC_STATUS_CORRUPT_EVENT;
         }
@@ -149,9 +236,15 @@ static ITC_Status_t newEvent(
     {
         /* Initialise members */
         pt_Alloc->t_Count = t_Count;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+        pt_Alloc->t_Max = t_Count;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
         pt_Alloc->pt_Parent = pt_Parent;
         pt_Alloc->pt_Left = NULL;
         pt_Alloc->pt_Right = NULL;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+        pt_Alloc->u64_Hash = calcEventSubtreeHash(pt_Alloc);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 
         /* Return the pointer to the allocated memory */
         *ppt_Event = pt_Alloc;
@@ -237,6 +330,16 @@ static ITC_Status_t cloneEvent(
         }
         else
         {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+            /* Both subtrees have been cloned. Copy the subtree maximum */
+            pt_CurrentEventClone->t_Max = pt_Event->t_Max;
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+            /* Both subtrees have been cloned. Copy the subtree hash */
+            pt_CurrentEventClone->u64_Hash = pt_Event->u64_Hash;
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
             /* Go up the tree */
             pt_Event = pt_Event->pt_Parent;
             pt_CurrentEventClone = pt_CurrentEventClone->pt_Parent;
@@ -329,6 +432,177 @@ static ITC_Status_t decEventCounter(
     return t_Status;
 }
 
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/**
+ * @brief Recalculate the memoised subtree summaries (maximum and/or hash) of
+ * a single Event node
+ *
+ * @note The summaries of the children must be up to date
+ *
+ * @param pt_Event The Event node to update
+ * @return `true` if any of the summaries changed. Otherwise `false`
+ */
+static bool updateEventNodeSummaries(
+    ITC_Event_t *const pt_Event
+)
+{
+    bool b_Changed = false;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+    ITC_Event_Counter_t t_Max;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    uint64_t u64_Hash;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+    /* The shared Event is read-only and always up to date */
+    if (!ITC_EVENT_IS_SHARED_EVENT(pt_Event))
+    {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+        /* Malformed nodes (e.g. from deserialisation) are rejected during
+         * validation. Only make sure not to dereference missing children */
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) ||
+            ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+        {
+            t_Max = ITC_EVENT_CALC_SUBTREE_MAX(pt_Event);
+        }
+        else
+        {
+            t_Max = pt_Event->t_Count;
+        }
+
+        b_Changed = (t_Max != pt_Event->t_Max);
+        pt_Event->t_Max = t_Max;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+        u64_Hash = calcEventSubtreeHash(pt_Event);
+
+        b_Changed = b_Changed || (u64_Hash != pt_Event->u64_Hash);
+        pt_Event->u64_Hash = u64_Hash;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+    }
+
+    return b_Changed;
+}
+
+/**
+ * @brief Recalculate the memoised subtree summaries along the path from a
+ * modified Event node up to the root
+ *
+ * Only the ancestors of the modified node can be affected. The walk stops
+ * as soon as the summaries of a node are unchanged, as then so are the
+ * summaries of all of its ancestors.
+ *
+ * @param pt_Event The modified Event node
+ * @param pt_RootEventParent The parent of the root of the Event tree
+ */
+static void updateEventPathSummaries(
+    ITC_Event_t *pt_Event,
+    const ITC_Event_t *const pt_RootEventParent
+)
+{
+    while (pt_Event != pt_RootEventParent &&
+           updateEventNodeSummaries(pt_Event))
+    {
+        pt_Event = pt_Event->pt_Parent;
+    }
+}
+
+/**
+ * @brief Recalculate the memoised subtree summaries (maximums and/or hashes)
+ * of a whole Event tree
+ *
+ * Only needed for Events built without going through the operations below
+ * (e.g. when decoding), as those keep the summaries up to date as they go.
+ * Performs a post-order traversal, so the children are always up to date
+ * before their parent is recalculated.
+ *
+ * @param pt_Event The Event to update
+ */
+static void updateEventSubtreeSummaries(
+    ITC_Event_t *pt_Event
+)
+{
+    const ITC_Event_t *pt_RootEventParent;
+
+    /* The shared Event is read-only and always up to date */
+    if (!ITC_EVENT_IS_SHARED_EVENT(pt_Event))
+    {
+        /* Remember the root parent Event as this might be a subtree */
+        pt_RootEventParent = pt_Event->pt_Parent;
+
+        /* Descend to the leftmost leaf */
+        while (pt_Event->pt_Left)
+        {
+            pt_Event = pt_Event->pt_Left;
+        }
+
+        while (pt_Event)
+        {
+            (void)updateEventNodeSummaries(pt_Event);
+
+            /* The whole tree has been updated */
+            if (pt_Event->pt_Parent == pt_RootEventParent)
+            {
+                pt_Event = NULL;
+            }
+            /* Update the right sibling subtree next */
+            else if (pt_Event->pt_Parent->pt_Left == pt_Event &&
+                     pt_Event->pt_Parent->pt_Right)
+            {
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+
+                while (pt_Event->pt_Left)
+                {
+                    pt_Event = pt_Event->pt_Left;
+                }
+            }
+            /* Both subtrees are up to date. Update the parent */
+            else
+            {
+                pt_Event = pt_Event->pt_Parent;
+            }
+        }
+    }
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+
+/**
+ * @brief Check whether no node of an Event subtree exceeds a given count
+ *
+ * Uses the memoised subtree maximum, so the subtree is not traversed.
+ * The minimum of a normalised Event is its root counter. Thus, comparing the
+ * maximum of one subtree against the root counter of another (normalised)
+ * subtree determines whether the first subtree is entirely `<=` the second.
+ *
+ * @note Saturated maximums are not reliable. For those `false` is returned,
+ * so the subtree gets explored and any overflow gets detected.
+ *
+ * @param pt_Event The Event subtree
+ * @param t_ParentsCount The event count from the root to the parent of
+ * `pt_Event`
+ * @param t_Count The count to check against
+ * @return `true` if `max(lift(pt_Event, t_ParentsCount)) <= t_Count`.
+ * Otherwise `false`
+ */
+static bool isEventSubtreeMaxLeq(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_Counter_t t_ParentsCount,
+    const ITC_Event_Counter_t t_Count
+)
+{
+    ITC_Event_Counter_t t_MaxCount = pt_Event->t_Max;
+
+    return (t_MaxCount != ((ITC_Event_Counter_t)~0) &&
+            incEventCounter(&t_MaxCount, t_ParentsCount) ==
+                ITC_STATUS_SUCCESS &&
+            t_MaxCount <= t_Count);
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+
 /**
  * @brief Given an event `(n, e1, e2)` performs:
  *     `(n, e1, e2) = (lift(n, m), sink(e1, m), sink(e2, m))`,
@@ -366,6 +640,16 @@ static ITC_Status_t liftSinkSinkEvent(
         /* Sink the right child */
         t_Status = decEventCounter(&pt_Event->pt_Right->t_Count, t_Count);
     }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Only the counters changed. The grandchildren are up to date */
+        (void)updateEventNodeSummaries(pt_Event->pt_Left);
+        (void)updateEventNodeSummaries(pt_Event->pt_Right);
+        (void)updateEventNodeSummaries(pt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 
     return t_Status;
 }
@@ -405,6 +689,14 @@ static ITC_Status_t liftDestroyDestroyEvent(
         /* Destroy the right leaf child */
         t_Status = ITC_Event_destroy(&pt_Event->pt_Right);
     }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The Event is now a leaf */
+        (void)updateEventNodeSummaries(pt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 
     return t_Status;
 }
@@ -518,6 +810,11 @@ static ITC_Status_t normEventE(
             /* pt_Event event is normalised. Nothing to do */
             else
             {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+                /* The children might have changed though */
+                (void)updateEventNodeSummaries(pt_Event);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
                 pt_Event = pt_Event->pt_Parent;
             }
         }
@@ -543,16 +840,24 @@ static ITC_Status_t normEventE(
  *    - If n1 <= n2:
  *         norm((n1, join(l1, lift(l2, n2 - n1)), join(r1, lift(r2, n2 - n1))))
  *
+ * The dual `meet(e1, e2)` (the pointwise minimum) follows the same rules,
+ * except for `meet(n1, n2) = min(n1, n2)`.
+ *
  * @param pt_Event1 The first Event
  * @param pt_Event2 The second Event
  * @param ppt_Event The new Event
+ * @param b_Normalise Whether to normalise the new Event. If `false` the `norm`
+ * step of the rules above is skipped
+ * @param b_Meet Whether to meet the Events instead of joining them
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t joinEventE(
     const ITC_Event_t *const pt_Event1,
     const ITC_Event_t *const pt_Event2,
-    ITC_Event_t **ppt_Event
+    ITC_Event_t **ppt_Event,
+    const bool b_Normalise,
+    const bool b_Meet
 )
 {
     ITC_Status_t t_Status; /* The current status */
@@ -591,14 +896,19 @@ static ITC_Status_t joinEventE(
            pt_CurrentEvent1 != pt_RootEvent1->pt_Parent &&
            pt_CurrentEvent2 != pt_RootEvent2->pt_Parent)
     {
-        /* join(n1, n2) = max(n1, n2) */
+        /* join(n1, n2) = max(n1, n2)
+         * meet(n1, n2) = min(n1, n2) */
         if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent1) &&
             ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent2))
         {
             t_Status = newEvent(
                 ppt_CurrentEvent,
                 pt_CurrentEventParent,
-                MAX(pt_CurrentEvent1->t_Count, pt_CurrentEvent2->t_Count));
+                (b_Meet)
+                    ? MIN(pt_CurrentEvent1->t_Count,
+                          pt_CurrentEvent2->t_Count)
+                    : MAX(pt_CurrentEvent1->t_Count,
+                          pt_CurrentEvent2->t_Count));
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
@@ -687,11 +997,21 @@ static ITC_Status_t joinEventE(
                      * always the smaller one due to the swap condition above.*/
                     (*ppt_CurrentEvent)->t_Count = pt_CurrentEvent2->t_Count;
 
-                    /* Normalise Event.
-                     * This may destroy all child nodes stored under
-                     * *ppt_CurrentEvent
-                     */
-                    t_Status = normEventE(*ppt_CurrentEvent);
+                    if (b_Normalise)
+                    {
+                        /* Normalise Event.
+                         * This may destroy all child nodes stored under
+                         * *ppt_CurrentEvent
+                         */
+                        t_Status = normEventE(*ppt_CurrentEvent);
+                    }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+                    else
+                    {
+                        /* ::normEventE() keeps the summaries up to date */
+                        (void)updateEventNodeSummaries(*ppt_CurrentEvent);
+                    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 
                     if (t_Status == ITC_STATUS_SUCCESS)
                     {
@@ -743,6 +1063,71 @@ static ITC_Status_t joinEventE(
     return t_Status;
 }
 
+/**
+ * @brief Push a pending `leq(e1, e2)` check onto an explicit traversal stack
+ *
+ * If the stack is full, it is moved to a heap buffer twice its size.
+ *
+ * @param pt_Stack The stack to push onto
+ * @param pt_Event1 The node of the first Event tree
+ * @param pt_Event2 The node of the second Event tree
+ * @param t_ParentsCountEvent1 The event count from the root to the parent of
+ * `pt_Event1`
+ * @param t_ParentsCountEvent2 The event count from the root to the parent of
+ * `pt_Event2`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t pushLeqFrame(
+    ITC_Event_LeqStack_t *pt_Stack,
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    const ITC_Event_Counter_t t_ParentsCountEvent1,
+    const ITC_Event_Counter_t t_ParentsCountEvent2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_LeqFrame_t *pt_Frames = NULL;
+
+    if (pt_Stack->u32_Top == pt_Stack->u32_Len)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&pt_Frames,
+            2 * pt_Stack->u32_Len * sizeof(ITC_Event_LeqFrame_t));
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            memcpy(
+                pt_Frames,
+                pt_Stack->pt_Frames,
+                pt_Stack->u32_Len * sizeof(ITC_Event_LeqFrame_t));
+
+            if (pt_Stack->pt_Frames != &pt_Stack->rt_FixedFrames[0])
+            {
+                t_Status = ITC_Port_free(pt_Stack->pt_Frames);
+            }
+
+            /* Switch to the new buffer even if freeing the old one failed,
+             * so the caller only has to free the latest buffer */
+            pt_Stack->pt_Frames = pt_Frames;
+            pt_Stack->u32_Len *= 2;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Stack->pt_Frames[pt_Stack->u32_Top].pt_Event1 = pt_Event1;
+        pt_Stack->pt_Frames[pt_Stack->u32_Top].pt_Event2 = pt_Event2;
+        pt_Stack->pt_Frames[pt_Stack->u32_Top].t_ParentsCountEvent1 =
+            t_ParentsCountEvent1;
+        pt_Stack->pt_Frames[pt_Stack->u32_Top].t_ParentsCountEvent2 =
+            t_ParentsCountEvent2;
+        pt_Stack->u32_Top++;
+    }
+
+    return t_Status;
+}
+
 /**
  * @brief Check if one Event is `<=` to another, fulfilling `leq(e1, e2)`
  * Rules:
@@ -753,6 +1138,11 @@ static ITC_Status_t joinEventE(
  *  - leq((n1, l1, r1), (n2, l2, r2)):
  *       n1 <= n2 && leq(lift(l1, n1), lift(l2, n2)) && leq(lift(r1, n1), lift(r2, n2))
  *
+ * The trees are traversed with an explicit stack of pending checks instead
+ * of climbing back up through the parent pointers. The stack is only moved
+ * to the heap if the trees are deeper than
+ * `ITC_EVENT_TRAVERSAL_STACK_FIXED_LEN`.
+ *
  * @param pt_Event1 The first Event
  * @param pt_Event2 The second Event
  * @param pb_IsLeq (out) `true` if `*pt_Event1 <= *pt_Event2`. Otherwise `false`
@@ -766,49 +1156,52 @@ static ITC_Status_t leqEventE(
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The free status */
 
-    const ITC_Event_t *pt_CurrentEvent1Parent;
-    const ITC_Event_t *pt_RootEvent1Parent;
-
-    /* Holds the event count from the root to the current parent node */
-    ITC_Event_Counter_t t_ParentsCountEvent1 = 0;
-    ITC_Event_Counter_t t_ParentsCountEvent2 = 0;
+    /* The pending checks */
+    ITC_Event_LeqStack_t t_Stack;
+    ITC_Event_LeqFrame_t t_Frame;
 
     /* Holds the total current event count
      * (pt_EventX->t_Count + t_ParentsCountEventX) */
     ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
     ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
 
-    /* Keeps track of how many descends have been skipped by pt_Event2 due
-     * to its tree branch being shallower than the one in pt_Event1 */
-    uint32_t u32_CurrentEvent2DescendSkips = 0;
+    /* The pt_Event2 nodes to check the children of pt_Event1 against */
+    const ITC_Event_t *pt_LeftEvent2;
+    const ITC_Event_t *pt_RightEvent2;
 
     /* Init flag */
     *pb_IsLeq = true;
 
-    /* Remember the root parent Event as this might be a subtree */
-    pt_RootEvent1Parent = pt_Event1->pt_Parent;
+    /* Init the stack */
+    t_Stack.pt_Frames = &t_Stack.rt_FixedFrames[0];
+    t_Stack.u32_Len = ITC_EVENT_TRAVERSAL_STACK_FIXED_LEN;
+    t_Stack.u32_Top = 0;
 
-    pt_CurrentEvent1Parent = pt_RootEvent1Parent;
+    t_Status = pushLeqFrame(&t_Stack, pt_Event1, pt_Event2, 0, 0);
 
     /* Perform a pre-order traversal.
      *
      * For `pt_Event1 <= pt_Event2` all `<=` checks must pass.
      * If a check fails - exit early */
-    while (t_Status == ITC_STATUS_SUCCESS && *pb_IsLeq && pt_Event1)
+    while (t_Status == ITC_STATUS_SUCCESS && *pb_IsLeq && t_Stack.u32_Top)
     {
+        t_Frame = t_Stack.pt_Frames[--t_Stack.u32_Top];
+
         /* Calculate the total current event count for both Event trees
          *
          * Essentially this is a `lift([lr]X, nX)` operation but
          * doesn't modify the original Event trees */
-        t_CurrentCountEvent1 = pt_Event1->t_Count;
-        t_Status = incEventCounter(&t_CurrentCountEvent1, t_ParentsCountEvent1);
+        t_CurrentCountEvent1 = t_Frame.pt_Event1->t_Count;
+        t_Status = incEventCounter(
+            &t_CurrentCountEvent1, t_Frame.t_ParentsCountEvent1);
 
         if (t_Status == ITC_STATUS_SUCCESS)
         {
-            t_CurrentCountEvent2 = pt_Event2->t_Count;
+            t_CurrentCountEvent2 = t_Frame.pt_Event2->t_Count;
             t_Status = incEventCounter(
-                &t_CurrentCountEvent2, t_ParentsCountEvent2);
+                &t_CurrentCountEvent2, t_Frame.t_ParentsCountEvent2);
         }
 
         if (t_Status == ITC_STATUS_SUCCESS)
@@ -816,151 +1209,489 @@ static ITC_Status_t leqEventE(
             /* n1 <= n2 */
             *pb_IsLeq = t_CurrentCountEvent1 <= t_CurrentCountEvent2;
 
-            if (*pb_IsLeq)
+            /* Valid parent ITC Event trees always have both left and right
+             * nodes. Thus, there is no need to check for the right one */
+            if (*pb_IsLeq && t_Frame.pt_Event1->pt_Left
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+                /* Skip subtrees which are entirely `<=` the current
+                 * pt_Event2 node, as there is nothing else to check in them */
+                && !isEventSubtreeMaxLeq(
+                    t_Frame.pt_Event1,
+                    t_Frame.t_ParentsCountEvent1,
+                    t_CurrentCountEvent2)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+                )
             {
-                /* Descend into left tree */
-                if (pt_Event1->pt_Left)
+                /* If pt_Event2 has children - descend down both trees.
+                 * Otherwise, keep checking the children of pt_Event1 against
+                 * the current pt_Event2 leaf */
+                if (t_Frame.pt_Event2->pt_Left)
                 {
-                    /* Increment the parent height */
-                    t_Status = incEventCounter(
-                        &t_ParentsCountEvent1, pt_Event1->t_Count);
-
-                    if (t_Status == ITC_STATUS_SUCCESS)
-                    {
-                        pt_Event1 = pt_Event1->pt_Left;
-
-                        /* If pt_Event2 has a left node - descend down */
-                        if (pt_Event2->pt_Left)
-                        {
-                            /* Increment the parent height */
-                            t_Status = incEventCounter(
-                                &t_ParentsCountEvent2,
-                                pt_Event2->t_Count);
-
-                            if (t_Status == ITC_STATUS_SUCCESS)
-                            {
-                                pt_Event2 = pt_Event2->pt_Left;
-                            }
-                        }
-                        /* Otherwise, keep track of how many times the descend
-                        * was skipped due to a shallow tree */
-                        else
-                        {
-                            u32_CurrentEvent2DescendSkips++;
-                        }
-                    }
+                    pt_LeftEvent2 = t_Frame.pt_Event2->pt_Left;
+                    pt_RightEvent2 = t_Frame.pt_Event2->pt_Right;
+                    t_Frame.t_ParentsCountEvent2 = t_CurrentCountEvent2;
                 }
-                /* Valid parent ITC Event trees always have both left and right
-                * nodes. Thus, there is no need to check if the current node
-                * doesn't have a left child but has a right one.
-                *
-                * Instead directly start backtracking up the tree */
                 else
                 {
-                    /* Get the current parent node */
-                    pt_CurrentEvent1Parent = pt_Event1->pt_Parent;
-
-                    /* Loop until the current node is no longer its
-                     * parent's right child node */
-                    while (t_Status == ITC_STATUS_SUCCESS &&
-                           pt_CurrentEvent1Parent != pt_RootEvent1Parent &&
-                           pt_CurrentEvent1Parent->pt_Right == pt_Event1)
-                    {
-                        pt_Event1 = pt_Event1->pt_Parent;
-                        pt_CurrentEvent1Parent =
-                            pt_CurrentEvent1Parent->pt_Parent;
-
-                        /* Decrement the parent height */
-                        t_Status = decEventCounter(
-                            &t_ParentsCountEvent1, pt_Event1->t_Count);
-
-                        if (t_Status == ITC_STATUS_SUCCESS)
-                        {
-                            /* Decrement the amount of skipped descends */
-                            if (u32_CurrentEvent2DescendSkips)
-                            {
-                                u32_CurrentEvent2DescendSkips--;
-                            }
-                            /* If no descends were skipped - start backtracking
-                            * up the pt_Event2 tree.
-                            * There is no need to check if the current pt_Event2
-                            * is it's parent's right child, because its descend
-                            * is tied to the descends of pt_Event1 */
-                            else
-                            {
-                                pt_Event2 = pt_Event2->pt_Parent;
-
-                                /* Decrement the parent height */
-                                t_Status = decEventCounter(
-                                    &t_ParentsCountEvent2,
-                                    pt_Event2->t_Count);
-                            }
-                        }
-                    }
+                    pt_LeftEvent2 = t_Frame.pt_Event2;
+                    pt_RightEvent2 = t_Frame.pt_Event2;
+                }
 
-                    /* There is a right subtree that has not been explored
-                    * yet */
-                    if (pt_CurrentEvent1Parent != pt_RootEvent1Parent)
-                    {
-                        /* Jump from the left node of the current parent to
-                         * right one */
-                        pt_Event1 = pt_CurrentEvent1Parent->pt_Right;
+                /* Push the right subtree first, so the left one is checked
+                 * first */
+                t_Status = pushLeqFrame(
+                    &t_Stack,
+                    t_Frame.pt_Event1->pt_Right,
+                    pt_RightEvent2,
+                    t_CurrentCountEvent1,
+                    t_Frame.t_ParentsCountEvent2);
 
-                        /* Do the same for pt_Event2 if it hasn't skipped
-                         * any descends due to its tree being shallow */
-                        if(!u32_CurrentEvent2DescendSkips)
-                        {
-                            pt_Event2 = pt_Event2->pt_Parent->pt_Right;
-                        }
-                    }
-                    /* The tree has been fully explored. Exit loop */
-                    else
-                    {
-                        pt_Event1 = NULL;
-                    }
+                if (t_Status == ITC_STATUS_SUCCESS)
+                {
+                    t_Status = pushLeqFrame(
+                        &t_Stack,
+                        t_Frame.pt_Event1->pt_Left,
+                        pt_LeftEvent2,
+                        t_CurrentCountEvent1,
+                        t_Frame.t_ParentsCountEvent2);
                 }
             }
         }
     }
 
+    /* Free the stack if it was moved to the heap */
+    if (t_Stack.pt_Frames != &t_Stack.rt_FixedFrames[0])
+    {
+        t_FreeStatus = ITC_Port_free(t_Stack.pt_Frames);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+    }
+
     return t_Status;
 }
 
 /**
- * @brief Maximise an Event fulfilling `max(e)`
+ * @brief Find where one Event exceeds another, fulfilling `diff(e1, e2)`
  * Rules:
- *  - max(n) = n
- *  - max(n, e1, e2) = n + max(max(e1), max(e2))
+ *  - diff(n1, n2) = n1 if n1 > n2. Otherwise 0
+ *  - diff(n1, (n2, l2, r2)) = diff((n1, 0, 0), (n2, l2, r2))
+ *  - diff((n1, l1, r1), n2) = diff((n1, l1, r1), (n2, 0, 0))
+ *  - diff((n1, l1, r1), (n2, l2, r2)):
+ *       norm((0, diff(lift(l1, n1), lift(l2, n2)),
+ *                diff(lift(r1, n1), lift(r2, n2))))
  *
- * The resulting Event is always a leaf Event
+ * I.e. the resulting Event holds the (absolute) counters of `e1` in the
+ * regions where `e1` exceeds `e2` and `0` everywhere else. Thus,
+ * `join(e2, diff(e1, e2)) == join(e1, e2)`.
  *
- * @param pt_Event The Event to maximise
+ * The same traversal also implements the other pointwise operations, which
+ * only differ in the leaf rule:
+ *  - `rebase(e1, e2)` (the pointwise subtraction of `e2` from `e1`), with
+ *    `rebase(n1, n2) = n1 - n2`. Thus, it is only defined if `e2 <= e1`
+ *  - `add(e1, e2)` (the pointwise sum of `e1` and `e2`), with
+ *    `add(n1, n2) = n1 + n2`. Thus, `add(rebase(e1, e2), e2) == e1`
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Event The new Event
+ * @param t_Op The pointwise operation to apply
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if rebasing and `pt_Event2` is
+ * not `<=` `pt_Event1`
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if adding overflows a counter
  */
-static ITC_Status_t maxEventE(
-    ITC_Event_t *pt_Event
+static ITC_Status_t diffEventE(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_PointwiseOp_t t_Op
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
-    ITC_Event_t *pt_RootEventParent;
+    ITC_Status_t t_Status; /* The current status */
 
-    /* Remember the parent as this might be a subtree */
-    pt_RootEventParent = pt_Event->pt_Parent;
+    ITC_Event_t *pt_CurrentEvent1 = NULL;
+    ITC_Event_t *pt_RootEvent1 = NULL;
+    ITC_Event_t *pt_CurrentEvent2 = NULL;
+    ITC_Event_t *pt_RootEvent2 = NULL;
 
-    while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
+    ITC_Event_t **ppt_CurrentEvent = ppt_Event;
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+
+    ITC_Event_Counter_t t_Count; /* The counter of the current leaf */
+
+    /* Init Event */
+    *ppt_CurrentEvent = NULL;
+
+    /* Clone the input events, as they will get modified during the
+     * traversal */
+    t_Status = cloneEvent(pt_Event1, &pt_CurrentEvent1, NULL);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        if (ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+        /* Save the root so it can be easily deallocated */
+        pt_RootEvent1 = pt_CurrentEvent1;
+
+        t_Status = cloneEvent(pt_Event2, &pt_CurrentEvent2, NULL);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            /* The Event is maximised. Nothing to do. */
-            pt_Event = pt_Event->pt_Parent;
+            pt_RootEvent2 = pt_CurrentEvent2;
         }
-        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Left))
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           pt_CurrentEvent1 != pt_RootEvent1->pt_Parent &&
+           pt_CurrentEvent2 != pt_RootEvent2->pt_Parent)
+    {
+        /* diff(n1, n2) = n1 if n1 > n2. Otherwise 0
+         * rebase(n1, n2) = n1 - n2
+         * add(n1, n2) = n1 + n2 */
+        if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent1) &&
+            ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent2))
         {
-            /* Explore left subtree */
-            pt_Event = pt_Event->pt_Left;
-        }
-        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Right))
+            t_Count = pt_CurrentEvent1->t_Count;
+
+            if (t_Op == ITC_EVENT_POINTWISE_OP_REBASE)
+            {
+                t_Status = decEventCounter(
+                    &t_Count, pt_CurrentEvent2->t_Count);
+            }
+            else if (t_Op == ITC_EVENT_POINTWISE_OP_ADD)
+            {
+                t_Status = incEventCounter(
+                    &t_Count, pt_CurrentEvent2->t_Count);
+            }
+            else if (t_Count <= pt_CurrentEvent2->t_Count)
+            {
+                t_Count = 0;
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newEvent(
+                    ppt_CurrentEvent, pt_CurrentEventParent, t_Count);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* Climb back to the parent node.
+                 * See ::joinEventE() for why the parent pointer is saved on
+                 * the stack */
+                ppt_CurrentEvent = &pt_CurrentEventParent;
+                pt_CurrentEvent1 = pt_CurrentEvent1->pt_Parent;
+                pt_CurrentEvent2 = pt_CurrentEvent2->pt_Parent;
+            }
+        }
+        /* diff((n1, l1, r1), (n2, l2, r2)):
+         *    norm((0, diff(lift(l1, n1), lift(l2, n2)),
+         *             diff(lift(r1, n1), lift(r2, n2))))
+         */
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent1) &&
+                 ITC_EVENT_IS_PARENT_EVENT(pt_CurrentEvent2))
+        {
+            /* Create the parent node.
+             * This might exist from a previous iteration. This is fine. */
+            if (!*ppt_CurrentEvent)
+            {
+                t_Status = newEvent(ppt_CurrentEvent, pt_CurrentEventParent, 0);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* Save the parent pointer on the stack */
+                pt_CurrentEventParent = *ppt_CurrentEvent;
+
+                /* Descend into left child */
+                if (!(*ppt_CurrentEvent)->pt_Left)
+                {
+                    ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+                    pt_CurrentEvent1 = pt_CurrentEvent1->pt_Left;
+                    pt_CurrentEvent2 = pt_CurrentEvent2->pt_Left;
+
+                    /* Make the counters absolute, so they can be compared
+                     * directly. This is `lift([lr]X, nX)` */
+                    t_Status = incEventCounter(
+                        &pt_CurrentEvent1->t_Count,
+                        pt_CurrentEvent1->pt_Parent->t_Count);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        t_Status = incEventCounter(
+                            &pt_CurrentEvent2->t_Count,
+                            pt_CurrentEvent2->pt_Parent->t_Count);
+                    }
+                }
+                /* Descend into right child */
+                else if (!(*ppt_CurrentEvent)->pt_Right)
+                {
+                    ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Right;
+                    pt_CurrentEvent1 = pt_CurrentEvent1->pt_Right;
+                    pt_CurrentEvent2 = pt_CurrentEvent2->pt_Right;
+
+                    t_Status = incEventCounter(
+                        &pt_CurrentEvent1->t_Count,
+                        pt_CurrentEvent1->pt_Parent->t_Count);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        t_Status = incEventCounter(
+                            &pt_CurrentEvent2->t_Count,
+                            pt_CurrentEvent2->pt_Parent->t_Count);
+                    }
+                }
+                else
+                {
+                    /* Normalise Event.
+                     * This may destroy all child nodes stored under
+                     * *ppt_CurrentEvent
+                     */
+                    t_Status = normEventE(*ppt_CurrentEvent);
+
+                    if (t_Status == ITC_STATUS_SUCCESS)
+                    {
+                        /* Save the parent pointer on the stack */
+                        pt_CurrentEventParent = (*ppt_CurrentEvent)->pt_Parent;
+
+                        /* Climb back to the parent node */
+                        ppt_CurrentEvent = &pt_CurrentEventParent;
+                        pt_CurrentEvent1 = pt_CurrentEvent1->pt_Parent;
+                        pt_CurrentEvent2 = pt_CurrentEvent2->pt_Parent;
+                    }
+                }
+            }
+        }
+        /* diff(n1, (n2, l2, r2)) = diff((n1, 0, 0), (n2, l2, r2)) */
+        else if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent1))
+        {
+            t_Status = createChildEventNodes(pt_CurrentEvent1, 0, 0);
+        }
+        /* diff((n1, l1, r1), n2) = diff((n1, l1, r1), (n2, 0, 0)) */
+        else
+        {
+            t_Status = createChildEventNodes(pt_CurrentEvent2, 0, 0);
+        }
+    }
+
+    /* Destroy the copied input events */
+    if (pt_RootEvent1)
+    {
+        /* There is nothing else to do if the destroy fails. */
+        (void)ITC_Event_destroy(&pt_RootEvent1);
+    }
+
+    if (pt_RootEvent2)
+    {
+        /* There is nothing else to do if the destroy fails. */
+        (void)ITC_Event_destroy(&pt_RootEvent2);
+    }
+
+    /* If something goes wrong during the traversal - the Event is invalid
+     * and must not be used. */
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the diff failed, rather than the destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Count the regions in which one Event exceeds another
+ *
+ * Performs the same lockstep pre-order traversal as ::leqEventE() but does
+ * not exit early and does not allocate the difference.
+ * The count is the number of leaves of the (unnormalised) `diff(e1, e2)`
+ * with a counter > 0. Thus, it is `0` only if `e1 <= e2` and is an upper
+ * bound of the number of such leaves in the normalised difference.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pu32_Regions (out) The number of regions in which `pt_Event1`
+ * exceeds `pt_Event2`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t countEventDiffRegions(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2,
+    uint32_t *pu32_Regions
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The free status */
+
+    /* The pending checks */
+    ITC_Event_LeqStack_t t_Stack;
+    ITC_Event_LeqFrame_t t_Frame;
+
+    /* Holds the total current event count
+     * (pt_EventX->t_Count + t_ParentsCountEventX) */
+    ITC_Event_Counter_t t_CurrentCountEvent1 = 0;
+    ITC_Event_Counter_t t_CurrentCountEvent2 = 0;
+
+    /* The pt_Event2 nodes to check the children of pt_Event1 against */
+    const ITC_Event_t *pt_LeftEvent2;
+    const ITC_Event_t *pt_RightEvent2;
+
+    /* Init the count */
+    *pu32_Regions = 0;
+
+    /* Init the stack */
+    t_Stack.pt_Frames = &t_Stack.rt_FixedFrames[0];
+    t_Stack.u32_Len = ITC_EVENT_TRAVERSAL_STACK_FIXED_LEN;
+    t_Stack.u32_Top = 0;
+
+    t_Status = pushLeqFrame(&t_Stack, pt_Event1, pt_Event2, 0, 0);
+
+    while (t_Status == ITC_STATUS_SUCCESS && t_Stack.u32_Top)
+    {
+        t_Frame = t_Stack.pt_Frames[--t_Stack.u32_Top];
+
+        t_CurrentCountEvent1 = t_Frame.pt_Event1->t_Count;
+        t_Status = incEventCounter(
+            &t_CurrentCountEvent1, t_Frame.t_ParentsCountEvent1);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_CurrentCountEvent2 = t_Frame.pt_Event2->t_Count;
+            t_Status = incEventCounter(
+                &t_CurrentCountEvent2, t_Frame.t_ParentsCountEvent2);
+        }
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into the children of pt_Event1 */
+        else if (t_Frame.pt_Event1->pt_Left
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+                 /* Skip subtrees which are entirely `<=` the current
+                  * pt_Event2 node, as they cannot exceed it anywhere */
+                 && !isEventSubtreeMaxLeq(
+                     t_Frame.pt_Event1,
+                     t_Frame.t_ParentsCountEvent1,
+                     t_CurrentCountEvent2)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+                 )
+        {
+            if (t_Frame.pt_Event2->pt_Left)
+            {
+                pt_LeftEvent2 = t_Frame.pt_Event2->pt_Left;
+                pt_RightEvent2 = t_Frame.pt_Event2->pt_Right;
+                t_Frame.t_ParentsCountEvent2 = t_CurrentCountEvent2;
+            }
+            else
+            {
+                pt_LeftEvent2 = t_Frame.pt_Event2;
+                pt_RightEvent2 = t_Frame.pt_Event2;
+            }
+
+            t_Status = pushLeqFrame(
+                &t_Stack,
+                t_Frame.pt_Event1->pt_Right,
+                pt_RightEvent2,
+                t_CurrentCountEvent1,
+                t_Frame.t_ParentsCountEvent2);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = pushLeqFrame(
+                    &t_Stack,
+                    t_Frame.pt_Event1->pt_Left,
+                    pt_LeftEvent2,
+                    t_CurrentCountEvent1,
+                    t_Frame.t_ParentsCountEvent2);
+            }
+        }
+        /* pt_Event1 is a leaf or a subtree entirely `<=` pt_Event2.
+         * The minimum of a normalised pt_Event2 is its root counter, so only
+         * descend into its children if pt_Event1 exceeds that */
+        else if (t_Frame.pt_Event1->pt_Left ||
+                 t_CurrentCountEvent1 <= t_CurrentCountEvent2)
+        {
+            /* Nothing to do */
+        }
+        else if (t_Frame.pt_Event2->pt_Left)
+        {
+            t_Status = pushLeqFrame(
+                &t_Stack,
+                t_Frame.pt_Event1,
+                t_Frame.pt_Event2->pt_Right,
+                t_Frame.t_ParentsCountEvent1,
+                t_CurrentCountEvent2);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = pushLeqFrame(
+                    &t_Stack,
+                    t_Frame.pt_Event1,
+                    t_Frame.pt_Event2->pt_Left,
+                    t_Frame.t_ParentsCountEvent1,
+                    t_CurrentCountEvent2);
+            }
+        }
+        /* Both are leaves and pt_Event1 exceeds pt_Event2 */
+        else
+        {
+            (*pu32_Regions)++;
+        }
+    }
+
+    /* Free the stack if it was moved to the heap */
+    if (t_Stack.pt_Frames != &t_Stack.rt_FixedFrames[0])
+    {
+        t_FreeStatus = ITC_Port_free(t_Stack.pt_Frames);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Maximise an Event fulfilling `max(e)`
+ * Rules:
+ *  - max(n) = n
+ *  - max(n, e1, e2) = n + max(max(e1), max(e2))
+ *
+ * The resulting Event is always a leaf Event
+ *
+ * @param pt_Event The Event to maximise
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t maxEventE(
+    ITC_Event_t *pt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    ITC_Event_t *pt_RootEventParent;
+
+    /* Remember the parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event != pt_RootEventParent)
+    {
+        if (ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+        {
+            /* The Event is maximised. Nothing to do. */
+            pt_Event = pt_Event->pt_Parent;
+        }
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Left))
+        {
+            /* Explore left subtree */
+            pt_Event = pt_Event->pt_Left;
+        }
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event->pt_Right))
         {
             /* Explore right subtree */
             pt_Event = pt_Event->pt_Right;
@@ -1008,7 +1739,7 @@ static ITC_Status_t fillEventE(
     ITC_Event_t *pt_CurrentEvent = *ppt_Event;
     /* Remember the root parents as these might be Event or ID subtrees */
     ITC_Event_t *pt_RootEventParent = (*ppt_Event)->pt_Parent;
-    ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
+    ITC_Id_t *pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
 
     /* The previously iterated ID subtree.
      * Used to keep track of which nodes have been explored */
@@ -1033,7 +1764,7 @@ static ITC_Status_t fillEventE(
                 pt_PrevId = pt_Id;
 
                 /* Nothing to inflate. Go up the tree */
-                pt_Id = pt_Id->pt_Parent;
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
                 pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
             }
             /* fill(1, e) = max(e) */
@@ -1048,7 +1779,7 @@ static ITC_Status_t fillEventE(
                 {
                     *pb_WasFilled = true;
 
-                    pt_Id = pt_Id->pt_Parent;
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                 }
             }
@@ -1089,6 +1820,10 @@ static ITC_Status_t fillEventE(
                         /* For a normalised Event: min((n, el, er)) = n */
                         pt_CurrentEvent->pt_Left->t_Count =
                             pt_CurrentEvent->pt_Right->t_Count;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+                        (void)updateEventNodeSummaries(
+                            pt_CurrentEvent->pt_Left);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 
                         *pb_WasFilled = true;
                     }
@@ -1102,7 +1837,7 @@ static ITC_Status_t fillEventE(
                         {
                             pt_PrevId = pt_Id;
 
-                            pt_Id = pt_Id->pt_Parent;
+                            pt_Id = ITC_ID_GET_PARENT(pt_Id);
                             pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                         }
                     }
@@ -1145,6 +1880,10 @@ static ITC_Status_t fillEventE(
                         /* For a normalised Event: min((n, el, er)) = n */
                         pt_CurrentEvent->pt_Right->t_Count =
                             pt_CurrentEvent->pt_Left->t_Count;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+                        (void)updateEventNodeSummaries(
+                            pt_CurrentEvent->pt_Right);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 
                         *pb_WasFilled = true;
                     }
@@ -1158,7 +1897,7 @@ static ITC_Status_t fillEventE(
                         {
                             pt_PrevId = pt_Id;
 
-                            pt_Id = pt_Id->pt_Parent;
+                            pt_Id = ITC_ID_GET_PARENT(pt_Id);
                             pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                         }
                     }
@@ -1194,7 +1933,7 @@ static ITC_Status_t fillEventE(
                     {
                         pt_PrevId = pt_Id;
 
-                        pt_Id = pt_Id->pt_Parent;
+                        pt_Id = ITC_ID_GET_PARENT(pt_Id);
                         pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                     }
                 }
@@ -1272,7 +2011,7 @@ static ITC_Status_t growEventE(
     ITC_Event_t *pt_CurrentEvent = *ppt_Event;
     /* Remember the root parents as these might be Event or ID subtrees */
     ITC_Event_t *pt_RootEventParent = (*ppt_Event)->pt_Parent;
-    ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
+    ITC_Id_t *pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
 
     /* The previously iterated ID subtree.
      * Used to keep track of which nodes have been explored */
@@ -1308,6 +2047,15 @@ static ITC_Status_t growEventE(
     /* Clone the event */
     t_Status = cloneEvent(*ppt_Event, &pt_ClonedEvent, pt_RootEventParent);
 
+    /* The shared Event is read-only. Grow the clone instead and keep the
+     * shared Event as the copy to fall back to on failure */
+    if (t_Status == ITC_STATUS_SUCCESS && ITC_EVENT_IS_SHARED_EVENT(*ppt_Event))
+    {
+        pt_CurrentEvent = pt_ClonedEvent;
+        pt_ClonedEvent = *ppt_Event;
+        *ppt_Event = pt_CurrentEvent;
+    }
+
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         while (t_Status == ITC_STATUS_SUCCESS &&
@@ -1320,7 +2068,7 @@ static ITC_Status_t growEventE(
             {
                 pt_PrevId = pt_Id;
 
-                pt_Id = pt_Id->pt_Parent;
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
                 pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
             }
             /* grow(1, n) or grow(i, n) */
@@ -1333,11 +2081,18 @@ static ITC_Status_t growEventE(
 
                     if (t_Status == ITC_STATUS_SUCCESS)
                     {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+                        /* This is the only node that gets incremented.
+                         * Update the path up to the root */
+                        updateEventPathSummaries(
+                            pt_CurrentEvent, pt_RootEventParent);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
                         pt_PrevId = pt_Id;
 
                         /* This case has no cost */
 
-                        pt_Id = pt_Id->pt_Parent;
+                        pt_Id = ITC_ID_GET_PARENT(pt_Id);
                         pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                     }
                 }
@@ -1381,7 +2136,7 @@ static ITC_Status_t growEventE(
 
                     u64_CostRight++;
 
-                    pt_Id = pt_Id->pt_Parent;
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                 }
             }
@@ -1405,7 +2160,7 @@ static ITC_Status_t growEventE(
 
                     u64_CostLeft++;
 
-                    pt_Id = pt_Id->pt_Parent;
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                 }
             }
@@ -1450,7 +2205,7 @@ static ITC_Status_t growEventE(
 
                     pt_PrevId = pt_Id;
 
-                    pt_Id = pt_Id->pt_Parent;
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
                 }
             }
@@ -1481,1000 +2236,4119 @@ static ITC_Status_t growEventE(
 }
 
 /**
- * @brief Serialise an Event counter in network-endian
+ * @brief Find the seed ID leaf where growing an Event costs the least under
+ * an exact grow policy
  *
- * @param t_Counter The counter to serialise
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * Walks the ID alongside the Event. Every seed ID leaf is a candidate. Growing
+ * there costs one level per ID node on its path and one expansion per ID node
+ * on its path below the Event leaf the path runs into. The cost of each
+ * candidate is a pair compared in lexicographic order:
+ *  - ::ITC_EVENT_GROW_POLICY_MIN_DEPTH: `(levels, expansions)`
+ *  - ::ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES: `(expansions, levels)`
+ *
+ * Ties go to the rightmost candidate, same as `cl >= cr` in `grow(i, e)`.
+ *
+ * @param pt_Event The Event to grow
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_GrowPolicy The grow policy
+ * @return `const ITC_Id_t *` The seed ID leaf to grow the Event at. `NULL` if
+ * the ID does not own any part of the interval
  */
-static ITC_Status_t eventCounterToNetwork(
-    ITC_Event_Counter_t t_Counter,
-    uint8_t *pu8_Buffer,
-    uint32_t *pu32_BufferSize
+static const ITC_Id_t *findEventGrowLeaf(
+    const ITC_Event_t *pt_Event,
+    const ITC_Id_t *pt_Id,
+    const ITC_Event_GrowPolicy_t t_GrowPolicy
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_Counter_t t_CounterCopy = t_Counter;
-    /* The number of bytes needed to serialise the counter */
-    uint32_t u32_BytesNeeded = 0;
-
-    /* Determine the bytes needed to serialise the counter */
-    do
+    /* Remember the root parent as this might be an ID subtree */
+    const ITC_Id_t *pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
+    /* The previously iterated ID subtree.
+     * Used to keep track of which nodes have been explored */
+    const ITC_Id_t *pt_PrevId = NULL;
+    const ITC_Id_t *pt_GrowLeafId = NULL;
+    uint64_t u64_GrowLeafCost = UINT64_MAX;
+    uint64_t u64_Cost;
+    /* The number of ID levels above the current ID node */
+    uint32_t u32_Levels = 0;
+    /* The number of ID levels between the current ID node and the Event leaf
+     * the current path runs into */
+    uint32_t u32_Expansions = 0;
+    /* Whether to descend into a child of the current ID node */
+    bool b_Descend;
+
+    while (pt_Id != pt_RootIdParent)
     {
-        t_CounterCopy >>= 8U;
-        u32_BytesNeeded++;
-    } while (t_CounterCopy != 0);
+        b_Descend = false;
 
-    if (u32_BytesNeeded > *pu32_BufferSize)
-    {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-    }
-    else
-    {
-        /* Serialise in network-endian */
-        for (uint32_t u32_I = u32_BytesNeeded; u32_I > 0; u32_I--)
+        if (ITC_ID_IS_LEAF_ID(pt_Id))
         {
-            pu8_Buffer[u32_I - 1] = (uint8_t)(t_Counter & 0xFFU);
-            t_Counter >>= 8U;
-        }
+            if (ITC_ID_IS_SEED_ID(pt_Id))
+            {
+                if (t_GrowPolicy == ITC_EVENT_GROW_POLICY_MIN_DEPTH)
+                {
+                    u64_Cost = ((uint64_t)u32_Levels << 32U) | u32_Expansions;
+                }
+                else
+                {
+                    u64_Cost = ((uint64_t)u32_Expansions << 32U) | u32_Levels;
+                }
 
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_BytesNeeded;
-    }
+                if (u64_Cost <= u64_GrowLeafCost)
+                {
+                    pt_GrowLeafId = pt_Id;
+                    u64_GrowLeafCost = u64_Cost;
+                }
+            }
+        }
+        /* Explore the left subtree first */
+        else if (pt_PrevId != pt_Id->pt_Left && pt_PrevId != pt_Id->pt_Right)
+        {
+            b_Descend = true;
+            pt_PrevId = pt_Id;
+            pt_Id = pt_Id->pt_Left;
+        }
+        /* Then the right subtree */
+        else if (pt_PrevId == pt_Id->pt_Left)
+        {
+            b_Descend = true;
+            pt_PrevId = pt_Id;
+            pt_Id = pt_Id->pt_Right;
+        }
 
-    return t_Status;
-}
+        if (b_Descend)
+        {
+            u32_Levels++;
 
-/**
- * @brief Deserialise an Event counter from network-endian
- *
- * @param pu8_Buffer The buffer holding the serialised data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param pt_Counter The pointer to the counter
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if
- * `u32_BufferSize > sizeof(ITC_Event_Counter_t)`
- */
-static ITC_Status_t eventCounterFromNetwork(
-    const uint8_t *pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    ITC_Event_Counter_t *pt_Counter
-)
-{
-    if (u32_BufferSize > sizeof(ITC_Event_Counter_t))
-    {
-        /* The counter size is not supported on this platform */
-        return ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
-    }
+            if (u32_Expansions > 0 || ITC_EVENT_IS_LEAF_EVENT(pt_Event))
+            {
+                u32_Expansions++;
+            }
+            else if (pt_Id == pt_PrevId->pt_Left)
+            {
+                pt_Event = pt_Event->pt_Left;
+            }
+            else
+            {
+                pt_Event = pt_Event->pt_Right;
+            }
+        }
+        /* Go back up the tree */
+        else
+        {
+            u32_Levels--;
 
-    /* Init the counter */
-    *pt_Counter = 0;
+            if (u32_Expansions > 0)
+            {
+                u32_Expansions--;
+            }
+            else
+            {
+                pt_Event = pt_Event->pt_Parent;
+            }
 
-    /* Deserialise from network-endian */
-    for (uint32_t u32_I = 0; u32_I < u32_BufferSize; u32_I++)
-    {
-        *pt_Counter <<= 8U;
-        *pt_Counter |= pu8_Buffer[u32_I];
+            pt_PrevId = pt_Id;
+            pt_Id = ITC_ID_GET_PARENT(pt_Id);
+        }
     }
 
-    return ITC_STATUS_SUCCESS;
+    return pt_GrowLeafId;
 }
 
 /**
- * @brief Serialise an existing ITC Event
+ * @brief Grow an Event at the seed ID leaf picked by an exact grow policy
  *
- * Data format:
- *  - Byte 0: The major component of the version of the `libitc` library used to
- *      serialise the data. Optional, can be ommitted.
- *  - Bytes (0 - 1) - N (see above): The Event tree.
- *    Each node of the Event tree is serialised in pre-order. I.e the root is
- *    serialised first, followed by the left child, then the right child. Each
- *    serialised node consists of:
- *    - Byte 0: The Event node header.
- *      Contains an `IS_PARENT` flag (bit 0), and the length of the encoded
- *      event counter (bits 1 - 4). See define ITC_SERDES_CREATE_EVENT_HEADER.
- *      If the node event counter is `0`, this length is also set to 0 and the
- *      next field (shown below) is ommitted. Bits 5 - 7 are reserved and always
- *      0.
- *    - Bytes 1 - 4: The node event count.
- *      Can be 0 - 4 bytes long. The length of this field is encoded in the
- *      Event header (see above). Serialised in network-endian. Optional,
- *      ommitted if the node event counter is 0.
+ * Expands the Event along the path to the leaf (if needed) and increments the
+ * Event node at its end. See ::findEventGrowLeaf().
  *
- * @param ppt_Event The pointer to the Event
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
- * the output.
+ * @param ppt_Event The Event to grow
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_GrowPolicy The grow policy
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t serialiseEvent(
-    const ITC_Event_t *pt_Event,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize,
-    const bool b_AddVersion
+static ITC_Status_t growEventWithPolicyE(
+    ITC_Event_t **ppt_Event,
+    const ITC_Id_t *pt_Id,
+    const ITC_Event_GrowPolicy_t t_GrowPolicy
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    /* The parent of the current Event */
-    const ITC_Event_t *pt_CurrentEventParent = NULL;
-    /* The parent of the root node */
-    const ITC_Event_t *pt_RootEventParent = NULL;
-    uint32_t u32_Offset = 0; /* The current offset */
-    uint32_t u32_CurrentEventCounterSize;
+    /* Clone of `*ppt_Event` - modifications will be done on the cloned event */
+    ITC_Event_t *pt_ClonedEvent = NULL;
+    ITC_Event_t *pt_CurrentEvent = *ppt_Event;
+    const ITC_Id_t *pt_GrowLeafId;
+    const ITC_Id_t *pt_ChildId;
 
-    /* Remember the root parent as this might be a subtree */
-    pt_RootEventParent = pt_Event->pt_Parent;
+    pt_GrowLeafId = findEventGrowLeaf(*ppt_Event, pt_Id, t_GrowPolicy);
 
-    if (b_AddVersion)
+    /* Clone the event */
+    if (pt_GrowLeafId)
     {
-        /* Prepend the lib version (provided by build system c args) */
-        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+        t_Status = cloneEvent(
+            *ppt_Event, &pt_ClonedEvent, (*ppt_Event)->pt_Parent);
+    }
 
-        /* Increment offset */
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    /* The shared Event is read-only. Grow the clone instead and keep the
+     * shared Event as the copy to fall back to on failure */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        pt_GrowLeafId &&
+        ITC_EVENT_IS_SHARED_EVENT(*ppt_Event))
+    {
+        pt_CurrentEvent = pt_ClonedEvent;
+        pt_ClonedEvent = *ppt_Event;
+        *ppt_Event = pt_CurrentEvent;
     }
 
-    /* Perform a pre-order traversal */
-    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           pt_GrowLeafId &&
+           pt_Id != pt_GrowLeafId)
     {
-        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
+        /* Find the child of the current ID node on the path to the leaf */
+        pt_ChildId = pt_GrowLeafId;
+
+        while (ITC_ID_GET_PARENT(pt_ChildId) != pt_Id)
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            pt_ChildId = ITC_ID_GET_PARENT(pt_ChildId);
         }
-        /* Serialise the Event counter */
-        else if (pt_Event->t_Count > 0)
-        {
-            /* Calculate the remaining space in the buffer, while leaving space
-             * for the header */
-            u32_CurrentEventCounterSize =
-                *pu32_BufferSize - (u32_Offset + sizeof(ITC_SerDes_Header_t));
 
-            /* Serialise the event counter */
-            t_Status = eventCounterToNetwork(
-                pt_Event->t_Count,
-                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
-                &u32_CurrentEventCounterSize);
-        }
-        /* Special case - the Event counter is 0, nothing to serialise */
-        else
+        /* grow(i, n) = (e', c + N), where (e', c) = grow(i, (n, 0, 0)) */
+        if (ITC_EVENT_IS_LEAF_EVENT(pt_CurrentEvent))
         {
-            u32_CurrentEventCounterSize = 0;
+            t_Status = createChildEventNodes(pt_CurrentEvent, 0, 0);
         }
 
         if (t_Status == ITC_STATUS_SUCCESS)
         {
-            /* Create the header */
-            pu8_Buffer[u32_Offset] = ITC_SERDES_CREATE_EVENT_HEADER(
-                ITC_EVENT_IS_PARENT_EVENT(pt_Event),
-                u32_CurrentEventCounterSize);
-
-            /* Increment the offset */
-            u32_Offset +=
-                sizeof(ITC_SerDes_Header_t) + u32_CurrentEventCounterSize;
-
-            /* Descend into left tree */
-            if (pt_Event->pt_Left)
+            if (pt_ChildId == pt_Id->pt_Left)
             {
-                pt_Event = pt_Event->pt_Left;
+                pt_CurrentEvent = pt_CurrentEvent->pt_Left;
             }
-            /* Valid parent ITC Event trees always have both left and right
-            * nodes. Thus, there is no need to check if the current node
-            * doesn't have a left child but has a right one.
-            *
-            * Instead directly start backtracking up the tree */
             else
             {
-                /* Remember the parent */
-                pt_CurrentEventParent = pt_Event->pt_Parent;
-
-                /* Loop until the current element is no longer reachable
-                * through the parent's right child */
-                while (pt_CurrentEventParent != pt_RootEventParent &&
-                    pt_CurrentEventParent->pt_Right == pt_Event)
-                {
-                    pt_Event = pt_Event->pt_Parent;
-                    pt_CurrentEventParent =
-                        pt_CurrentEventParent->pt_Parent;
-                }
-
-                /* There is a right subtree that has not been explored yet*/
-                if (pt_CurrentEventParent != pt_RootEventParent)
-                {
-                    pt_Event = pt_CurrentEventParent->pt_Right;
-                }
-                else
-                {
-                    pt_Event = NULL;
-                }
+                pt_CurrentEvent = pt_CurrentEvent->pt_Right;
             }
+
+            pt_Id = pt_ChildId;
         }
     }
 
+    /* grow(1, n) = (n + 1, 0) */
+    if (t_Status == ITC_STATUS_SUCCESS && pt_GrowLeafId)
+    {
+        t_Status = incEventCounter(&pt_CurrentEvent->t_Count, 1);
+    }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+    if (t_Status == ITC_STATUS_SUCCESS && pt_GrowLeafId)
+    {
+        /* Only the path to the grown node changed */
+        updateEventPathSummaries(pt_CurrentEvent, (*ppt_Event)->pt_Parent);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        /* Destroy the cloned Event
+         * Ignore return statuses. There is nothing else to do if the
+         * destroy fails. Also it is more important to convey that the
+         * overall grow operation succeeded */
+        (void)ITC_Event_destroy(&pt_ClonedEvent);
+    }
+    else
+    {
+        /* Destroy the original Event
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey why the grow operation
+         * failed */
+        (void)ITC_Event_destroy(ppt_Event);
+
+        /* Replace the original event with the clone */
+        *ppt_Event = pt_ClonedEvent;
     }
 
     return t_Status;
 }
 
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
 /**
- * @brief Serialise an Event counter to ASCII string
+ * @brief Allocate a new Event following the interval ownership of an ID
  *
- * This function intentionally avoids using `sprintf` to improve portability
- * and efficiency.
+ * The intervals owned by the ID are set to `t_Count`, all others to `0`. The
+ * resulting Event mirrors the shape of the ID and is not normalised.
  *
- * @warning The resulting string is NOT NULL terminated.
- * @param t_Count The event counter
- * @param pc_Buffer The buffer where to write the data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_Count The event counter of the owned intervals
+ * @param ppt_Event (out) The pointer to the new Event
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t eventCounterToString(
-    ITC_Event_Counter_t t_Count,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+static ITC_Status_t newEventFromIdOwnership(
+    const ITC_Id_t *pt_Id,
+    const ITC_Event_Counter_t t_Count,
+    ITC_Event_t **ppt_Event
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
-    uint32_t u32_Offset = 0;
-    char c_Tmp = 0;
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Id_t *pt_RootIdParent; /* The parent of the root */
+    ITC_Event_t *pt_CurrentEvent = NULL;
+    ITC_Event_t **ppt_NewEvent = NULL; /* The next Event to allocate */
+    const ITC_Id_t *pt_NewId = NULL; /* The ID of the next Event */
+    ITC_Event_Counter_t t_NewCount;
+
+    /* Remember the parent of the root as this might be a subree */
+    pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
+
+    /* Start with the root */
+    ppt_NewEvent = ppt_Event;
+    pt_NewId = pt_Id;
 
     do
     {
-        /* Check there is space left in the buffer */
-        if (u32_Offset >= *pu32_BufferSize)
+        /* Only leaves can own their interval */
+        t_NewCount = 0;
+
+        if (ITC_ID_IS_OWNER(pt_NewId))
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            t_NewCount = t_Count;
         }
-        else
+
+        t_Status = newEvent(ppt_NewEvent, pt_CurrentEvent, t_NewCount);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            /* Serialise the next digit */
-            pc_Buffer[u32_Offset] = '0' + (char)(t_Count % 10);
-            t_Count /= 10;
-            u32_Offset++;
+            /* Descend into the new Event */
+            pt_Id = pt_NewId;
+            pt_CurrentEvent = *ppt_NewEvent;
+            ppt_NewEvent = NULL;
         }
-    } while (t_Status == ITC_STATUS_SUCCESS && t_Count);
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Reverse the string to get the final output */
-        for (uint32_t u32_I = u32_Offset - 1;
-             u32_I > (u32_Offset - 1) / 2;
-             u32_I--)
+        while (t_Status == ITC_STATUS_SUCCESS &&
+               !ppt_NewEvent &&
+               pt_Id != pt_RootIdParent)
         {
-            c_Tmp = pc_Buffer[u32_I];
-            pc_Buffer[u32_I] = pc_Buffer[u32_Offset - 1 - u32_I];
-            pc_Buffer[u32_Offset - 1 - u32_I] = c_Tmp;
+            if (ITC_ID_GET_LEFT(pt_Id) && !pt_CurrentEvent->pt_Left)
+            {
+                /* Allocate left subtree */
+                ppt_NewEvent = &pt_CurrentEvent->pt_Left;
+                pt_NewId = pt_Id->pt_Left;
+            }
+            else if (ITC_ID_GET_RIGHT(pt_Id) && !pt_CurrentEvent->pt_Right)
+            {
+                /* Allocate right subtree */
+                ppt_NewEvent = &pt_CurrentEvent->pt_Right;
+                pt_NewId = pt_Id->pt_Right;
+            }
+            else
+            {
+                /* Go up the tree */
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+            }
         }
-
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
     }
+    while (t_Status == ITC_STATUS_SUCCESS && ppt_NewEvent);
 
-    return t_Status;
-}
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the allocation failed, rather than the destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
 
+    return t_Status;
+}
 
 /**
- * @brief Serialise an existing ITC Event to ASCII string
+ * @brief Serialise an Event counter in network-endian
  *
- * @note The output buffer is always NULL-terminated
- * @param ppt_Event The pointer to the Event
- * @param pc_Buffer The buffer to hold the serialised data
+ * @param t_Counter The counter to serialise
+ * @param pu8_Buffer The buffer to hold the serialised data. If NULL, only the
+ * size of the serialised counter is calculated
  * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes (including the NULL termination byte).
+ * of the data inside the buffer in bytes.
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t serialiseEventToString(
-    const ITC_Event_t *pt_Event,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+static ITC_Status_t eventCounterToNetwork(
+    ITC_Event_Counter_t t_Counter,
+    uint8_t *pu8_Buffer,
+    uint32_t *pu32_BufferSize
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    /* The current Event node */
-    const ITC_Event_t *pt_CurrentEventParent = NULL;
-    /* The root parent */
-    const ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
-    uint32_t u32_Offset = 0;
-    /* The size of the stringified current node event counter */
-    uint32_t u32_EventCounterSize = 0;
+    ITC_Event_Counter_t t_CounterCopy = t_Counter;
+    /* The number of bytes needed to serialise the counter */
+    uint32_t u32_BytesNeeded = 0;
 
-    /* Ensure there is at least space for the NULL termination */
-    if (*pu32_BufferSize < 1)
+    /* Determine the bytes needed to serialise the counter */
+    do
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
+        t_CounterCopy >>= 8U;
+        u32_BytesNeeded++;
+    } while (t_CounterCopy != 0);
 
-    /* Perform a pre-order traversal */
-    while (t_Status == ITC_STATUS_SUCCESS && pt_Event)
+    if (u32_BytesNeeded > *pu32_BufferSize)
     {
-        /* Check there is space left in the buffer, taking into account the
-         * NULL termination byte and bracket */
-        if (u32_Offset >= (*pu32_BufferSize - 1))
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        /* Serialise in network-endian */
+        for (uint32_t u32_I = u32_BytesNeeded; pu8_Buffer && u32_I > 0; u32_I--)
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            pu8_Buffer[u32_I - 1] = (uint8_t)(t_Counter & 0xFFU);
+            t_Counter >>= 8U;
         }
 
-        if (t_Status == ITC_STATUS_SUCCESS && ITC_EVENT_IS_PARENT_EVENT(pt_Event))
-        {
-            /* Open a bracket to signify a parent node */
-            pc_Buffer[u32_Offset] = '(';
-            /* Increment the offset */
-            u32_Offset++;
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_BytesNeeded;
+    }
 
-            /* Check there is space left in the buffer, taking into account the
-             * NULL termination byte and at least 1 digit event counter */
-             if (u32_Offset >= (*pu32_BufferSize - 1))
-             {
-                 t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-             }
-        }
+    return t_Status;
+}
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Calculate the space left in the buffer, taking into account the
-             * NULL termination byte */
-            u32_EventCounterSize = *pu32_BufferSize - u32_Offset - 1;
+/**
+ * @brief Deserialise an Event counter from network-endian
+ *
+ * @param pu8_Buffer The buffer holding the serialised data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pt_Counter The pointer to the counter
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE` if
+ * `u32_BufferSize > sizeof(ITC_Event_Counter_t)`
+ */
+static ITC_Status_t eventCounterFromNetwork(
+    const uint8_t *pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_Counter_t *pt_Counter
+)
+{
+    if (u32_BufferSize > sizeof(ITC_Event_Counter_t))
+    {
+        /* The counter size is not supported on this platform */
+        return ITC_STATUS_EVENT_UNSUPPORTED_COUNTER_SIZE;
+    }
 
-            /* Serialise the current node event counter */
-            t_Status = eventCounterToString(
-                pt_Event->t_Count,
-                &pc_Buffer[u32_Offset],
-                &u32_EventCounterSize);
-        }
+    /* Init the counter */
+    *pt_Counter = 0;
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Increment the offset */
-            u32_Offset += u32_EventCounterSize;
+    /* Deserialise from network-endian */
+    for (uint32_t u32_I = 0; u32_I < u32_BufferSize; u32_I++)
+    {
+        *pt_Counter <<= 8U;
+        *pt_Counter |= pu8_Buffer[u32_I];
+    }
 
-            /* If this is a parent, check there is space left in the buffer,
-             * taking into account the NULL termination byte, and the space for
-             * the extra comma and space */
-            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
-                u32_Offset >= (*pu32_BufferSize - 2))
-            {
-                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-            }
+    return ITC_STATUS_SUCCESS;
+}
+
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+/**
+ * @brief Get the child through which an Event path continues
+ *
+ * An Event path node is a parent node with a 0 counter, which has a leaf 0
+ * Event as one of its children and any other Event as the other one.
+ * I.e. `(0, 0, e)` or `(0, e, 0)`.
+ *
+ * @param pt_Event The Event node
+ * @return `const ITC_Event_t *` The other child or `NULL` if `pt_Event` is not
+ * a path node
+ */
+static const ITC_Event_t *getEventPathContinuation(
+    const ITC_Event_t *const pt_Event
+)
+{
+    const ITC_Event_t *pt_Continuation = NULL;
+
+    if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) && pt_Event->t_Count == 0)
+    {
+        if (ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Left) &&
+            pt_Event->pt_Left->t_Count == 0 &&
+            !(ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Right) &&
+              pt_Event->pt_Right->t_Count == 0))
+        {
+            pt_Continuation = pt_Event->pt_Right;
+        }
+        else if (ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Right) &&
+                 pt_Event->pt_Right->t_Count == 0 &&
+                 !(ITC_EVENT_IS_LEAF_EVENT(pt_Event->pt_Left) &&
+                   pt_Event->pt_Left->t_Count == 0))
+        {
+            pt_Continuation = pt_Event->pt_Left;
+        }
+        else
+        {
+            /* Nothing to do */
         }
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
+    return pt_Continuation;
+}
+
+/**
+ * @brief Check whether an Event node is serialised as part of a path
+ *
+ * Only chains of at least `ITC_SERDES_PATH_MIN_LEN` path nodes are
+ * serialised as paths.
+ *
+ * @param pt_Event The Event node
+ * @param pt_RootEventParent The parent of the root of the serialised
+ * (sub)tree
+ * @return `true` if the node is part of a serialised path
+ */
+static bool isSerialisedEventPathNode(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_t *const pt_RootEventParent
+)
+{
+    const ITC_Event_t *pt_Continuation = getEventPathContinuation(pt_Event);
+
+    return pt_Continuation &&
+           (getEventPathContinuation(pt_Continuation) ||
+            (pt_Event->pt_Parent != pt_RootEventParent &&
+             getEventPathContinuation(pt_Event->pt_Parent) == pt_Event));
+}
+
+/**
+ * @brief Check whether serialising an Event produces at least one path
+ *
+ * @param pt_Event The Event
+ * @return `true` if any part of the Event is serialised as a path
+ */
+static bool hasSerialisedEventPath(
+    const ITC_Event_t *pt_Event
+)
+{
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
+    bool b_HasPath = false;
+
+    /* Perform a pre-order traversal until the first path is found */
+    while (pt_Event && !b_HasPath)
+    {
+        b_HasPath = isSerialisedEventPathNode(pt_Event, pt_RootEventParent);
+
+        /* Descend into left tree */
+        if (pt_Event->pt_Left)
         {
-            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
-            {
-                /* Add a comma to separete the current node counter from
-                 * its children */
-                pc_Buffer[u32_Offset] = ',';
-                /* Increment the offset */
-                u32_Offset++;
+            pt_Event = pt_Event->pt_Left;
+        }
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentEventParent = pt_Event->pt_Parent;
 
-                /* Add space between the current node counter and child nodes */
-                pc_Buffer[u32_Offset] = ' ';
-                /* Increment the offset */
-                u32_Offset++;
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentEventParent != pt_RootEventParent &&
+                   pt_CurrentEventParent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+                pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
             }
 
-            /* Descend into left tree */
-            if (pt_Event->pt_Left)
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentEventParent != pt_RootEventParent)
             {
-                /* Remember the parent address */
-                pt_CurrentEventParent = pt_Event;
-
-                pt_Event = pt_Event->pt_Left;
+                pt_Event = pt_CurrentEventParent->pt_Right;
             }
-            /* Valid parent ITC Event trees always have both left and right
-             * nodes. Thus, there is no need to check if the current node
-             * doesn't have a left child but has a right one.
-             *
-             * Instead directly start backtracking up the tree */
             else
             {
-                /* Loop until the current element is no longer reachable
-                 * through the parent's right child */
-                while (t_Status == ITC_STATUS_SUCCESS &&
-                       pt_CurrentEventParent != pt_RootEventParent &&
-                       pt_CurrentEventParent->pt_Right == pt_Event)
-                {
-                    pt_Event = pt_Event->pt_Parent;
-                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
-
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte and bracket */
-                    if (u32_Offset >= (*pu32_BufferSize - 1))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Close the current parent node bracket */
-                        pc_Buffer[u32_Offset] = ')';
-                        /* Increment the offset */
-                        u32_Offset++;
-                    }
-                }
-
-                /* There is a right subtree that has not been explored yet */
-                if (t_Status == ITC_STATUS_SUCCESS &&
-                    pt_CurrentEventParent != pt_RootEventParent)
-                {
-                    pt_Event = pt_CurrentEventParent->pt_Right;
-
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte, comma and space */
-                    if (u32_Offset >= (*pu32_BufferSize - 2))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Add a comma to signify the start of a new node */
-                        pc_Buffer[u32_Offset] = ',';
-                        /* Increment the offset */
-                        u32_Offset++;
-
-                        /* Add space between nodes */
-                        pc_Buffer[u32_Offset] = ' ';
-                        /* Increment the offset */
-                        u32_Offset++;
-                    }
-                }
-                else
-                {
-                    pt_Event = NULL;
-                }
+                pt_Event = NULL;
             }
         }
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
-    {
-        /* Ensure the string is always NULL-termiated */
+    return b_HasPath;
+}
+
+/**
+ * @brief Serialise a chain of Event path nodes as a single path
+ *
+ * See ::ITC_SERDES_PATH_EVENT_HEADER for the data format.
+ *
+ * @param ppt_Event (in) The first node of the path. (out) The node following
+ * the serialised path
+ * @param pu8_Buffer The buffer to hold the serialised data. If NULL, only the
+ * offset is advanced
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param pu32_Offset (in) The offset to serialise the path at. (out) The
+ * offset following the serialised path
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEventPath(
+    const ITC_Event_t **ppt_Event,
+    uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    uint32_t *const pu32_Offset
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Event_t *pt_Event = *ppt_Event;
+    uint8_t *pu8_Bitmap;
+    uint32_t u32_PathSize;
+    uint8_t u8_PathLen = 0;
+
+    /* Find the length of the path */
+    while (u8_PathLen < ITC_SERDES_PATH_MAX_LEN &&
+           getEventPathContinuation(pt_Event))
+    {
+        pt_Event = getEventPathContinuation(pt_Event);
+        u8_PathLen++;
+    }
+
+    u32_PathSize = sizeof(ITC_SerDes_Header_t) + ITC_SERDES_PATH_LEN_LEN +
+                   ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen);
+
+    if ((*pu32_Offset + u32_PathSize) > u32_BufferSize)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else if (!pu8_Buffer)
+    {
+        *ppt_Event = pt_Event;
+        *pu32_Offset += u32_PathSize;
+    }
+    else
+    {
+        pu8_Buffer[*pu32_Offset] = ITC_SERDES_PATH_EVENT_HEADER;
+        pu8_Buffer[*pu32_Offset + sizeof(ITC_SerDes_Header_t)] = u8_PathLen;
+
+        pu8_Bitmap = &pu8_Buffer[
+            *pu32_Offset + sizeof(ITC_SerDes_Header_t) +
+            ITC_SERDES_PATH_LEN_LEN];
+        memset(pu8_Bitmap, 0, ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen));
+
+        /* Create the bitmap */
+        pt_Event = *ppt_Event;
+        for (uint8_t u8_I = 0; u8_I < u8_PathLen; u8_I++)
+        {
+            if (getEventPathContinuation(pt_Event) == pt_Event->pt_Right)
+            {
+                ITC_SERDES_PATH_SET_BIT(pu8_Bitmap, u8_I);
+            }
+
+            pt_Event = getEventPathContinuation(pt_Event);
+        }
+
+        *ppt_Event = pt_Event;
+        *pu32_Offset += u32_PathSize;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an Event path
+ *
+ * See ::ITC_SERDES_PATH_EVENT_HEADER for the data format.
+ *
+ * @param pu8_Buffer The buffer holding the serialised path, excluding its
+ * header
+ * @param u32_BufferSize The size of the remaining data in the buffer in bytes
+ * @param ppt_Event The pointer to where the path should be attached
+ * @param pt_Parent The parent of the path. Otherwise NULL
+ * @param ppt_LastPathNode (out) The last node of the path. Its non-zero child
+ * is left unallocated
+ * @param pu32_PathSize (out) The size of the serialised path in bytes,
+ * excluding its header
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t deserialiseEventPath(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Event_t **ppt_Event,
+    ITC_Event_t *pt_Parent,
+    ITC_Event_t **ppt_LastPathNode,
+    uint32_t *const pu32_PathSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const uint8_t *pu8_Bitmap = &pu8_Buffer[ITC_SERDES_PATH_LEN_LEN];
+    uint8_t u8_PathLen = 0;
+
+    /* The path must be followed by at least one more node */
+    if (u32_BufferSize <= ITC_SERDES_PATH_LEN_LEN ||
+        pu8_Buffer[0] == 0 ||
+        (ITC_SERDES_PATH_LEN_LEN + ITC_SERDES_PATH_BITMAP_LEN(pu8_Buffer[0])) >=
+            u32_BufferSize)
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+    else
+    {
+        u8_PathLen = pu8_Buffer[0];
+    }
+
+    for (uint8_t u8_I = 0;
+         u8_I < u8_PathLen && t_Status == ITC_STATUS_SUCCESS;
+         u8_I++)
+    {
+        t_Status = newEvent(ppt_Event, pt_Parent, 0);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_Parent = *ppt_Event;
+
+            /* Allocate the 0 child and continue through the other one */
+            if (ITC_SERDES_PATH_GET_BIT(pu8_Bitmap, u8_I))
+            {
+                t_Status = newEvent(&pt_Parent->pt_Left, pt_Parent, 0);
+                ppt_Event = &pt_Parent->pt_Right;
+            }
+            else
+            {
+                t_Status = newEvent(&pt_Parent->pt_Right, pt_Parent, 0);
+                ppt_Event = &pt_Parent->pt_Left;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *ppt_LastPathNode = pt_Parent;
+        *pu32_PathSize =
+            ITC_SERDES_PATH_LEN_LEN + ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+/**
+ * @brief Serialise an existing ITC Event
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data. Optional, can be ommitted.
+ *  - Bytes (0 - 1) - N (see above): The Event tree.
+ *    Each node of the Event tree is serialised in pre-order. I.e the root is
+ *    serialised first, followed by the left child, then the right child. Each
+ *    serialised node consists of:
+ *    - Byte 0: The Event node header.
+ *      Contains an `IS_PARENT` flag (bit 0), and the length of the encoded
+ *      event counter (bits 1 - 4). See define ITC_SERDES_CREATE_EVENT_HEADER.
+ *      If the node event counter is `0`, this length is also set to 0 and the
+ *      next field (shown below) is ommitted. Bits 5 - 7 are reserved and always
+ *      0, except for ITC_SERDES_PATH_EVENT_HEADER (if
+ *      `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is enabled), which is followed
+ *      by the length and bitmap of the path instead of an event counter.
+ *    - Bytes 1 - 4: The node event count.
+ *      Can be 0 - 4 bytes long. The length of this field is encoded in the
+ *      Event header (see above). Serialised in network-endian. Optional,
+ *      ommitted if the node event counter is 0.
+ *
+ * @param ppt_Event The pointer to the Event
+ * @param pu8_Buffer The buffer to hold the serialised data. If NULL, nothing
+ * is written and only the size of the serialised data is calculated
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
+ * the output.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEvent(
+    const ITC_Event_t *pt_Event,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The parent of the current Event */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The parent of the root node */
+    const ITC_Event_t *pt_RootEventParent = NULL;
+    uint32_t u32_Offset = 0; /* The current offset */
+    uint32_t u32_CurrentEventCounterSize;
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    if (b_AddVersion)
+    {
+        if (pu8_Buffer)
+        {
+            /* Prepend the lib version (provided by build system c args) */
+            pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
+        }
+
+        /* Increment offset */
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    /* Perform a pre-order traversal */
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+        /* Serialise any paths starting at the current node. Then continue
+         * with the node following them */
+        while (t_Status == ITC_STATUS_SUCCESS &&
+               isSerialisedEventPathNode(pt_Event, pt_RootEventParent))
+        {
+            t_Status = serialiseEventPath(
+                &pt_Event, pu8_Buffer, *pu32_BufferSize, &u32_Offset);
+        }
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        else if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        /* Serialise the Event counter */
+        else if (pt_Event->t_Count > 0)
+        {
+            /* Calculate the remaining space in the buffer, while leaving space
+             * for the header */
+            u32_CurrentEventCounterSize =
+                *pu32_BufferSize - (u32_Offset + sizeof(ITC_SerDes_Header_t));
+
+            /* Serialise the event counter */
+            t_Status = eventCounterToNetwork(
+                pt_Event->t_Count,
+                (pu8_Buffer)
+                    ? &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)]
+                    : NULL,
+                &u32_CurrentEventCounterSize);
+        }
+        /* Special case - the Event counter is 0, nothing to serialise */
+        else
+        {
+            u32_CurrentEventCounterSize = 0;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            if (pu8_Buffer)
+            {
+                /* Create the header */
+                pu8_Buffer[u32_Offset] = ITC_SERDES_CREATE_EVENT_HEADER(
+                    ITC_EVENT_IS_PARENT_EVENT(pt_Event),
+                    u32_CurrentEventCounterSize);
+            }
+
+            /* Increment the offset */
+            u32_Offset +=
+                sizeof(ITC_SerDes_Header_t) + u32_CurrentEventCounterSize;
+
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* Valid parent ITC Event trees always have both left and right
+            * nodes. Thus, there is no need to check if the current node
+            * doesn't have a left child but has a right one.
+            *
+            * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Remember the parent */
+                pt_CurrentEventParent = pt_Event->pt_Parent;
+
+                /* Loop until the current element is no longer reachable
+                * through the parent's right child. The 0 children of
+                * serialised paths are already part of the path */
+                while (pt_CurrentEventParent != pt_RootEventParent &&
+                    (pt_CurrentEventParent->pt_Right == pt_Event
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+                     || isSerialisedEventPathNode(
+                            pt_CurrentEventParent, pt_RootEventParent)
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+                     ))
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent =
+                        pt_CurrentEventParent->pt_Parent;
+                }
+
+                /* There is a right subtree that has not been explored yet*/
+                if (pt_CurrentEventParent != pt_RootEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Serialise an Event counter to ASCII string
+ *
+ * This function intentionally avoids using `sprintf` to improve portability
+ * and efficiency.
+ *
+ * @warning The resulting string is NOT NULL terminated.
+ * @param t_Count The event counter
+ * @param pc_Buffer The buffer where to write the data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t eventCounterToString(
+    ITC_Event_Counter_t t_Count,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
+    uint32_t u32_Offset = 0;
+    char c_Tmp = 0;
+
+    do
+    {
+        /* Check there is space left in the buffer */
+        if (u32_Offset >= *pu32_BufferSize)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        else
+        {
+            /* Serialise the next digit */
+            pc_Buffer[u32_Offset] = '0' + (char)(t_Count % 10);
+            t_Count /= 10;
+            u32_Offset++;
+        }
+    } while (t_Status == ITC_STATUS_SUCCESS && t_Count);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Reverse the string to get the final output */
+        for (uint32_t u32_I = u32_Offset - 1;
+             u32_I > (u32_Offset - 1) / 2;
+             u32_I--)
+        {
+            c_Tmp = pc_Buffer[u32_I];
+            pc_Buffer[u32_I] = pc_Buffer[u32_Offset - 1 - u32_I];
+            pc_Buffer[u32_Offset - 1 - u32_I] = c_Tmp;
+        }
+
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+
+/**
+ * @brief Serialise an existing ITC Event to ASCII string
+ *
+ * @note The output buffer is always NULL-terminated
+ * @param ppt_Event The pointer to the Event
+ * @param pc_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes (including the NULL termination byte).
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseEventToString(
+    const ITC_Event_t *pt_Event,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The current Event node */
+    const ITC_Event_t *pt_CurrentEventParent = NULL;
+    /* The root parent */
+    const ITC_Event_t *pt_RootEventParent = pt_Event->pt_Parent;
+    uint32_t u32_Offset = 0;
+    /* The size of the stringified current node event counter */
+    uint32_t u32_EventCounterSize = 0;
+
+    /* Ensure there is at least space for the NULL termination */
+    if (*pu32_BufferSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Event)
+    {
+        /* Check there is space left in the buffer, taking into account the
+         * NULL termination byte and bracket */
+        if (u32_Offset >= (*pu32_BufferSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS && ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Open a bracket to signify a parent node */
+            pc_Buffer[u32_Offset] = '(';
+            /* Increment the offset */
+            u32_Offset++;
+
+            /* Check there is space left in the buffer, taking into account the
+             * NULL termination byte and at least 1 digit event counter */
+             if (u32_Offset >= (*pu32_BufferSize - 1))
+             {
+                 t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+             }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Calculate the space left in the buffer, taking into account the
+             * NULL termination byte */
+            u32_EventCounterSize = *pu32_BufferSize - u32_Offset - 1;
+
+            /* Serialise the current node event counter */
+            t_Status = eventCounterToString(
+                pt_Event->t_Count,
+                &pc_Buffer[u32_Offset],
+                &u32_EventCounterSize);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += u32_EventCounterSize;
+
+            /* If this is a parent, check there is space left in the buffer,
+             * taking into account the NULL termination byte, and the space for
+             * the extra comma and space */
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
+                u32_Offset >= (*pu32_BufferSize - 2))
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+            {
+                /* Add a comma to separete the current node counter from
+                 * its children */
+                pc_Buffer[u32_Offset] = ',';
+                /* Increment the offset */
+                u32_Offset++;
+
+                /* Add space between the current node counter and child nodes */
+                pc_Buffer[u32_Offset] = ' ';
+                /* Increment the offset */
+                u32_Offset++;
+            }
+
+            /* Descend into left tree */
+            if (pt_Event->pt_Left)
+            {
+                /* Remember the parent address */
+                pt_CurrentEventParent = pt_Event;
+
+                pt_Event = pt_Event->pt_Left;
+            }
+            /* Valid parent ITC Event trees always have both left and right
+             * nodes. Thus, there is no need to check if the current node
+             * doesn't have a left child but has a right one.
+             *
+             * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentEventParent != pt_RootEventParent &&
+                       pt_CurrentEventParent->pt_Right == pt_Event)
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte and bracket */
+                    if (u32_Offset >= (*pu32_BufferSize - 1))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Close the current parent node bracket */
+                        pc_Buffer[u32_Offset] = ')';
+                        /* Increment the offset */
+                        u32_Offset++;
+                    }
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_CurrentEventParent != pt_RootEventParent)
+                {
+                    pt_Event = pt_CurrentEventParent->pt_Right;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte, comma and space */
+                    if (u32_Offset >= (*pu32_BufferSize - 2))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Add a comma to signify the start of a new node */
+                        pc_Buffer[u32_Offset] = ',';
+                        /* Increment the offset */
+                        u32_Offset++;
+
+                        /* Add space between nodes */
+                        pc_Buffer[u32_Offset] = ' ';
+                        /* Increment the offset */
+                        u32_Offset++;
+                    }
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Ensure the string is always NULL-termiated */
         pc_Buffer[u32_Offset] = '\0';
         u32_Offset++;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+
+/**
+ * @brief Deserialise an ITC Event
+ *
+ * For the expected data format see ::serialiseEvent()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Event data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @param ppt_Event The pointer to the deserialised Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
+ */
+static ITC_Status_t deserialiseEvent(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = NULL; /* The current Event */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    uint32_t u32_Offset = 0; /* The current offset */
+    uint32_t u32_CounterLen; /* The serialised Event counter length */
+    uint32_t u32_NextHeaderOffset; /* Used for serialisation data validation */
+    bool b_IsParent;
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    bool b_IsPath = false;
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+    *ppt_Event = NULL;
+    ppt_CurrentEvent = ppt_Event;
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (b_HasVersion)
+    {
+        if (pu8_Buffer[u32_Offset] != ITC_VERSION_MAJOR)
+        {
+            t_Status = ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
+        }
+
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+        b_IsPath = pu8_Buffer[u32_Offset] == ITC_SERDES_PATH_EVENT_HEADER;
+
+        /* Deserialise an Event path. The length and bitmap of the path take
+         * the place of the event counter */
+        if (b_IsPath)
+        {
+            b_IsParent = false;
+
+            t_Status = deserialiseEventPath(
+                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
+                u32_BufferSize - u32_Offset - sizeof(ITC_SerDes_Header_t),
+                ppt_CurrentEvent,
+                pt_CurrentEventParent,
+                &pt_CurrentEventParent,
+                &u32_CounterLen);
+        }
+        else
+#else
+        /* Event paths cannot be deserialised by this build */
+        if (pu8_Buffer[u32_Offset] == ITC_SERDES_PATH_EVENT_HEADER)
+        {
+            t_Status = ITC_STATUS_SERDES_UNSUPPORTED_FORMAT;
+        }
+        else
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+        /* Unknown node header value */
+        if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+        else
+        {
+            /* Get the node type */
+            b_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
+
+            /* Get the serialised Event counter length */
+            u32_CounterLen =
+                ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
+
+            /* Calculate the offset of the next node header */
+            u32_NextHeaderOffset =
+                u32_Offset + u32_CounterLen + sizeof(ITC_SerDes_Header_t);
+
+            /* Check for serialisation data validity:
+             * - Check there is enough data left in the buffer to deserialise
+             *   the current node
+             * - Check the last serialised node is not a parent
+             */
+            if ((u32_NextHeaderOffset > u32_BufferSize) ||
+                (b_IsParent && u32_NextHeaderOffset == u32_BufferSize))
+            {
+                t_Status = ITC_STATUS_CORRUPT_EVENT;
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+            && !b_IsPath
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+            )
+        {
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+            /* A root leaf with a 0 counter is the shared Event */
+            if (!pt_CurrentEventParent && !b_IsParent && u32_CounterLen == 0)
+            {
+                *ppt_CurrentEvent =
+                    ITC_EVENT_SHARED_EVENT_PTR(gt_ItcSharedEvent);
+            }
+            else
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+            {
+                /* Create a new node */
+                t_Status = newEvent(ppt_CurrentEvent, pt_CurrentEventParent, 0);
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+            /* Special case - if the counter length is 0, then the
+             * serialised Event had an Event counter == 0 */
+            if (u32_CounterLen > 0
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+                && !b_IsPath
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+                )
+            {
+                /* Deserialise the event counter */
+                t_Status = eventCounterFromNetwork(
+                    &pu8_Buffer[u32_Offset],
+                    u32_CounterLen,
+                    &(*ppt_CurrentEvent)->t_Count);
+
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Increment the offset */
+            u32_Offset += u32_CounterLen;
+
+            /* If the current header was a parent - descend into left child */
+            if (b_IsParent)
+            {
+                pt_CurrentEventParent = *ppt_CurrentEvent;
+                ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+            }
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+            /* If the current header was a path - descend into the unallocated
+             * child of the last path node */
+            else if (b_IsPath)
+            {
+                ppt_CurrentEvent = (pt_CurrentEventParent->pt_Left)
+                                       ? &pt_CurrentEventParent->pt_Right
+                                       : &pt_CurrentEventParent->pt_Left;
+            }
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+            /* If the current header was a leaf - find the first unallocated
+             * right child node or error out if there isn't one */
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentEventParent && pt_CurrentEventParent->pt_Right)
+                {
+                    ppt_CurrentEvent = &pt_CurrentEventParent;
+                    pt_CurrentEventParent = (*ppt_CurrentEvent)->pt_Parent;
+                }
+
+                /* Descend into the unallocated right child of the parent */
+                if (pt_CurrentEventParent)
+                {
+                    ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
+                }
+                /* There aren't any unallocated right child nodes in the tree.
+                 *
+                 * Usually this would signal the end of the loop as the only
+                 * time this should happen is when the full input buffer has
+                 * been deserialised (i.e.`u32_Offset == u32_BufferSize`),
+                 * since the tree is serialised in a pre-order traversal fasion.
+                 *
+                 * However, if the input buffer is malformed in some way it is
+                 * possible that there are elements in it that havent't been
+                 * deserialised yet (i.e. `u32_Offset < u32_BufferSize`).
+                 *
+                 * This should be treated as error as otherwise the user might
+                 * not get the expected (or full) Event tree. */
+                else if (u32_Offset < u32_BufferSize)
+                {
+                    t_Status = ITC_STATUS_CORRUPT_EVENT;
+                }
+                else
+                {
+                    /* Nothing to do */
+                }
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+        /* The subtree summaries are not part of the serialised data */
+        updateEventSubtreeSummaries(*ppt_Event);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+        /* Check the deserialised Event is valid */
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+
+/**
+ * @brief Convert an ITC Event tree into a dense Event array
+ *
+ * Performs a pre-order traversal, while keeping track of the level and index
+ * (within the level) of the current node, as well as the sum of the counters
+ * of all of its ancestors. Right children always have odd indices.
+ *
+ * @param pt_Event The Event to convert
+ * @param pt_Array (out) The Event array
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the Event is deeper than
+ * `ITC_CONFIG_EVENT_ARRAY_DEPTH`
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the total number of events of
+ * a subinterval does not fit in an `ITC_Event_Counter_t`
+ */
+static ITC_Status_t eventToArray(
+    const ITC_Event_t *pt_Event,
+    ITC_Event_Array_t *const pt_Array
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t t_Base = 0; /* The sum of the ancestor counters */
+    ITC_Event_Counter_t t_Count; /* The total count of the current leaf */
+    uint32_t u32_Level = 0; /* The level of the current node */
+    uint32_t u32_Index = 0; /* The index of the current node in its level */
+    uint32_t u32_Len; /* The number of subintervals under the current node */
+
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* The smallest subintervals cannot be split any further */
+            if (u32_Level == ITC_CONFIG_EVENT_ARRAY_DEPTH)
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            else
+            {
+                t_Status = incEventCounter(&t_Base, pt_Event->t_Count);
+            }
+
+            /* Descend into left tree */
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                pt_Event = pt_Event->pt_Left;
+                u32_Level++;
+                u32_Index <<= 1U;
+            }
+        }
+        else
+        {
+            t_Count = t_Base;
+            t_Status = incEventCounter(&t_Count, pt_Event->t_Count);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                u32_Len = (uint32_t)ITC_EVENT_ARRAY_LEN >> u32_Level;
+
+                for (uint32_t u32_I = u32_Index * u32_Len;
+                     u32_I < (u32_Index + 1U) * u32_Len;
+                     u32_I++)
+                {
+                    pt_Array->rt_Counters[u32_I] = t_Count;
+                }
+
+                /* Loop until the current node is no longer a right child */
+                while (u32_Level > 0 && (u32_Index & 1U))
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    t_Base -= pt_Event->t_Count;
+                    u32_Level--;
+                    u32_Index >>= 1U;
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (u32_Level > 0)
+                {
+                    pt_Event = pt_Event->pt_Parent->pt_Right;
+                    u32_Index++;
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Allocate a new normalised ITC Event tree from a dense Event array
+ *
+ * Each node gets the minimum of its range of subintervals (minus the counters
+ * of its ancestors). Ranges holding a single value become leaf nodes.
+ *
+ * @param pt_Array The Event array
+ * @param ppt_Event (out) The Event tree
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newEventFromArray(
+    const ITC_Event_Array_t *const pt_Array,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = ppt_Event; /* The current Event */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    ITC_Event_Counter_t t_Base = 0; /* The sum of the ancestor counters */
+    ITC_Event_Counter_t t_Min; /* The minimum of the current range */
+    ITC_Event_Counter_t t_Max; /* The maximum of the current range */
+    uint32_t u32_Level = 0; /* The level of the current node */
+    uint32_t u32_Index = 0; /* The index of the current node in its level */
+    uint32_t u32_Len; /* The number of subintervals under the current node */
+
+    *ppt_Event = NULL;
+
+    while (ppt_CurrentEvent && t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_Len = (uint32_t)ITC_EVENT_ARRAY_LEN >> u32_Level;
+        t_Min = pt_Array->rt_Counters[u32_Index * u32_Len];
+        t_Max = t_Min;
+
+        for (uint32_t u32_I = u32_Index * u32_Len + 1U;
+             u32_I < (u32_Index + 1U) * u32_Len;
+             u32_I++)
+        {
+            t_Min = MIN(t_Min, pt_Array->rt_Counters[u32_I]);
+            t_Max = MAX(t_Max, pt_Array->rt_Counters[u32_I]);
+        }
+
+        t_Status = newEvent(
+            ppt_CurrentEvent, pt_CurrentEventParent, t_Min - t_Base);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into left tree */
+        else if (t_Min != t_Max)
+        {
+            t_Base = t_Min;
+            pt_CurrentEventParent = *ppt_CurrentEvent;
+            ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+            u32_Level++;
+            u32_Index <<= 1U;
+        }
+        else
+        {
+            /* Loop until the current node is no longer a right child */
+            while (u32_Level > 0 && (u32_Index & 1U))
+            {
+                t_Base -= pt_CurrentEventParent->t_Count;
+                pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+                u32_Level--;
+                u32_Index >>= 1U;
+            }
+
+            /* Descend into the unallocated right child of the parent */
+            if (u32_Level > 0)
+            {
+                ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
+                u32_Index++;
+            }
+            else
+            {
+                ppt_CurrentEvent = NULL;
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the conversion failed, rather than the
+         * destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    else
+    {
+        updateEventSubtreeSummaries(*ppt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+    return t_Status;
+}
+
+/**
+ * @brief Join two dense Event arrays, fulfilling `join(e1, e2)`
+ *
+ * @param pt_Array (in) The first Event array. (out) The joined Event array
+ * @param pt_OtherArray The second Event array
+ */
+static void joinEventArray(
+    ITC_Event_Array_t *const pt_Array,
+    const ITC_Event_Array_t *const pt_OtherArray
+)
+{
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        pt_Array->rt_Counters[u32_I] = MAX(
+            pt_Array->rt_Counters[u32_I], pt_OtherArray->rt_Counters[u32_I]);
+    }
+}
+
+/**
+ * @brief Check if a dense Event array is `<=` to another one
+ *
+ * Does not stop at the first mismatch, so the loop has no data-dependent
+ * branches and can be vectorised.
+ *
+ * @param pt_Array1 The first Event array
+ * @param pt_Array2 The second Event array
+ * @return `true` if `*pt_Array1 <= *pt_Array2`. Otherwise `false`
+ */
+static bool leqEventArray(
+    const ITC_Event_Array_t *const pt_Array1,
+    const ITC_Event_Array_t *const pt_Array2
+)
+{
+    bool b_IsLeq = true;
+
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        b_IsLeq &=
+            (pt_Array1->rt_Counters[u32_I] <= pt_Array2->rt_Counters[u32_I]);
+    }
+
+    return b_IsLeq;
+}
+
+/**
+ * @brief Meet two dense Event arrays, fulfilling `meet(e1, e2)`
+ *
+ * @param pt_Array (in) The first Event array. (out) The met Event array
+ * @param pt_OtherArray The second Event array
+ */
+static void meetEventArray(
+    ITC_Event_Array_t *const pt_Array,
+    const ITC_Event_Array_t *const pt_OtherArray
+)
+{
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        pt_Array->rt_Counters[u32_I] = MIN(
+            pt_Array->rt_Counters[u32_I], pt_OtherArray->rt_Counters[u32_I]);
+    }
+}
+
+/**
+ * @brief Check if an Event tree is dense enough to be processed as an array
+ *
+ * Performs a pre-order traversal counting the leaves, which stops as soon as
+ * the Event turns out to be deeper than `ITC_CONFIG_EVENT_ARRAY_DEPTH`.
+ * Does not allocate any memory.
+ *
+ * @param pt_Event The Event
+ * @return `true` if the Event fits into an array and is at least
+ * `ITC_CONFIG_EVENT_ARRAY_FILL_PERCENT` full. Otherwise `false`
+ */
+static bool isEventArrayDense(
+    const ITC_Event_t *pt_Event
+)
+{
+    bool b_IsTooDeep = false;
+    uint32_t u32_Leaves = 0; /* The number of leaves */
+    uint32_t u32_Level = 0; /* The level of the current node */
+    const ITC_Event_t *const pt_RootEvent = pt_Event;
+
+    while (pt_Event && !b_IsTooDeep)
+    {
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* The smallest subintervals cannot be split any further */
+            b_IsTooDeep = (u32_Level == ITC_CONFIG_EVENT_ARRAY_DEPTH);
+
+            /* Descend into left tree */
+            pt_Event = pt_Event->pt_Left;
+            u32_Level++;
+        }
+        else
+        {
+            u32_Leaves++;
+
+            /* Loop until the current node is no longer a right child */
+            while (pt_Event != pt_RootEvent &&
+                   pt_Event->pt_Parent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+                u32_Level--;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Event != pt_RootEvent)
+            {
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+            }
+            else
+            {
+                pt_Event = NULL;
+            }
+        }
+    }
+
+    return !b_IsTooDeep &&
+           ((uint64_t)u32_Leaves * 100U >=
+            (uint64_t)ITC_EVENT_ARRAY_LEN * ITC_CONFIG_EVENT_ARRAY_FILL_PERCENT);
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+
+/**
+ * @brief Join or meet two normalised Events into a new normalised Event
+ *
+ * Uses the dense array form (see ::ITC_Event_toArray()) if one of the Events
+ * is dense enough and both of them fit into an array. Then the join or meet
+ * is an element-wise loop, and the Events are only traversed to be converted,
+ * instead of being cloned and traversed in lockstep.
+ * Otherwise, falls back to ::joinEventE().
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Event The new Event
+ * @param b_Meet Whether to meet the Events instead of joining them
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinEventAdaptiveE(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event,
+    const bool b_Meet
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    bool b_IsDone = false; /* Whether the array form was used */
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+    /* The Event arrays. Kept off the stack, as they can be large */
+    ITC_Event_Array_t *pt_Arrays = NULL;
+
+    if (isEventArrayDense(pt_Event1) || isEventArrayDense(pt_Event2))
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&pt_Arrays, 2 * sizeof(ITC_Event_Array_t));
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = eventToArray(pt_Event1, &pt_Arrays[0]);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = eventToArray(pt_Event2, &pt_Arrays[1]);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            if (b_Meet)
+            {
+                meetEventArray(&pt_Arrays[0], &pt_Arrays[1]);
+            }
+            else
+            {
+                joinEventArray(&pt_Arrays[0], &pt_Arrays[1]);
+            }
+
+            t_Status = newEventFromArray(&pt_Arrays[0], ppt_Event);
+            b_IsDone = true;
+        }
+        /* The other Event is too deep. Use its tree instead */
+        else if (t_Status == ITC_STATUS_INSUFFICIENT_RESOURCES && pt_Arrays)
+        {
+            t_Status = ITC_STATUS_SUCCESS;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if (pt_Arrays)
+        {
+            /* There is nothing else to do if the free fails. Also it is more
+             * important to convey the result of the join */
+            (void)ITC_Port_free(pt_Arrays);
+        }
+    }
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsDone)
+    {
+        t_Status = joinEventE(pt_Event1, pt_Event2, ppt_Event, true, b_Meet);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+
+/**
+ * @brief Validate an existing step function ITC Event
+ *
+ * The steps must be sorted, the first one must start at `0` and adjacent
+ * steps must have different counts.
+ *
+ * @param pt_Steps The step function Event to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateEventSteps(
+    const ITC_Event_Steps_t *const pt_Steps
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Steps || !pt_Steps->pt_Steps)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* The step function must cover the whole Event interval */
+    else if (!pt_Steps->u32_Length || pt_Steps->pt_Steps[0].u64_Start)
+    {
+        t_Status = ITC_STATUS_CORRUPT_EVENT;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    for (uint32_t u32_I = 1;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < pt_Steps->u32_Length;
+         u32_I++)
+    {
+        if (pt_Steps->pt_Steps[u32_I].u64_Start <=
+                pt_Steps->pt_Steps[u32_I - 1].u64_Start ||
+            pt_Steps->pt_Steps[u32_I].u64_Start >= ITC_EVENT_STEPS_END ||
+            pt_Steps->pt_Steps[u32_I].t_Count ==
+                pt_Steps->pt_Steps[u32_I - 1].t_Count)
+        {
+            t_Status = ITC_STATUS_CORRUPT_EVENT;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Allocate the steps of a step function ITC Event
+ *
+ * @param pt_Steps (out) The step function Event. Its length is set to 0
+ * @param u32_Capacity The number of steps to allocate. Must be `> 0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newEventSteps(
+    ITC_Event_Steps_t *const pt_Steps,
+    const uint32_t u32_Capacity
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    pt_Steps->u32_Length = 0;
+
+    t_Status = ITC_Port_malloc(
+        (void **)&pt_Steps->pt_Steps, u32_Capacity * sizeof(ITC_Event_Step_t));
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* Sanitise pointer */
+        pt_Steps->pt_Steps = NULL;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deallocate the steps of a step function ITC Event
+ *
+ * @param pt_Steps The step function Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t destroyEventSteps(
+    ITC_Event_Steps_t *const pt_Steps
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Steps->pt_Steps)
+    {
+        t_Status = ITC_Port_free(pt_Steps->pt_Steps);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Steps->pt_Steps = NULL;
+        pt_Steps->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Append a step to a step function ITC Event
+ *
+ * Coalesces the new step with the last one if their counts match, so the
+ * step function stays normalised.
+ *
+ * @param pt_Steps The step function Event. Must have enough capacity for one
+ * more step
+ * @param u64_Start The start of the step. Must be after the start of the last
+ * step
+ * @param t_Count The total number of events witnessed by the step
+ */
+static void appendEventStep(
+    ITC_Event_Steps_t *const pt_Steps,
+    const uint64_t u64_Start,
+    const ITC_Event_Counter_t t_Count
+)
+{
+    if (!pt_Steps->u32_Length ||
+        pt_Steps->pt_Steps[pt_Steps->u32_Length - 1].t_Count != t_Count)
+    {
+        pt_Steps->pt_Steps[pt_Steps->u32_Length].u64_Start = u64_Start;
+        pt_Steps->pt_Steps[pt_Steps->u32_Length].t_Count = t_Count;
+        pt_Steps->u32_Length++;
+    }
+}
+
+/**
+ * @brief Collect the steps of an ITC Event tree
+ *
+ * Performs a pre-order traversal, while keeping track of the depth and
+ * position (within the level) of the current node, as well as the sum of the
+ * counters of all of its ancestors. Thus, the leaves are visited in ascending
+ * order. Right children always have odd positions.
+ *
+ * @param pt_Event The Event
+ * @param pt_Steps (out) The step function Event. Must have enough capacity for
+ * all leaves of the Event. If `NULL`, the leaves are only counted
+ * @param pu32_LeafCount (out) The number of leaves of the Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the Event is deeper than
+ * `ITC_EVENT_STEPS_MAX_DEPTH`
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if the total number of events of
+ * a leaf does not fit in an `ITC_Event_Counter_t`
+ */
+static ITC_Status_t collectEventSteps(
+    const ITC_Event_t *pt_Event,
+    ITC_Event_Steps_t *const pt_Steps,
+    uint32_t *const pu32_LeafCount
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_Counter_t t_Base = 0; /* The sum of the ancestor counters */
+    ITC_Event_Counter_t t_Count; /* The total count of the current leaf */
+    uint32_t u32_Depth = 0; /* The depth of the current node */
+    uint64_t u64_Position = 0; /* The position of the current node */
+
+    *pu32_LeafCount = 0;
+
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* The smallest subintervals cannot be split any further */
+            if (u32_Depth == ITC_EVENT_STEPS_MAX_DEPTH)
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            else
+            {
+                t_Status = incEventCounter(&t_Base, pt_Event->t_Count);
+            }
+
+            /* Descend into left tree */
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                pt_Event = pt_Event->pt_Left;
+                u32_Depth++;
+                u64_Position <<= 1U;
+            }
+        }
+        else
+        {
+            t_Count = t_Base;
+            t_Status = incEventCounter(&t_Count, pt_Event->t_Count);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                if (pt_Steps)
+                {
+                    appendEventStep(
+                        pt_Steps,
+                        u64_Position << (ITC_EVENT_STEPS_MAX_DEPTH - u32_Depth),
+                        t_Count);
+                }
+
+                (*pu32_LeafCount)++;
+
+                /* Loop until the current node is no longer a right child */
+                while (u32_Depth > 0 && (u64_Position & 1U))
+                {
+                    pt_Event = pt_Event->pt_Parent;
+                    t_Base -= pt_Event->t_Count;
+                    u32_Depth--;
+                    u64_Position >>= 1U;
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (u32_Depth > 0)
+                {
+                    pt_Event = pt_Event->pt_Parent->pt_Right;
+                    u64_Position++;
+                }
+                else
+                {
+                    pt_Event = NULL;
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Convert an ITC Event tree into a step function Event
+ *
+ * @param pt_Event The Event to convert
+ * @param pt_Steps (out) The step function Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t eventToSteps(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Steps_t *const pt_Steps
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint32_t u32_LeafCount;
+
+    pt_Steps->pt_Steps = NULL;
+    pt_Steps->u32_Length = 0;
+
+    /* Count the leaves first, so only a single allocation is needed */
+    t_Status = collectEventSteps(pt_Event, NULL, &u32_LeafCount);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newEventSteps(pt_Steps, u32_LeafCount);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = collectEventSteps(pt_Event, pt_Steps, &u32_LeafCount);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. */
+        (void)destroyEventSteps(pt_Steps);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Allocate a new normalised ITC Event tree from a step function Event
+ *
+ * Performs a pre-order traversal of the Event tree being built. Each node
+ * gets the minimum of the steps overlapping its subinterval (minus the
+ * counters of its ancestors). Subintervals overlapping a single step become
+ * leaf nodes.
+ *
+ * @param pt_Steps The step function Event
+ * @param ppt_Event (out) The Event tree
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newEventFromSteps(
+    const ITC_Event_Steps_t *const pt_Steps,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t **ppt_CurrentEvent = ppt_Event; /* The current Event */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    ITC_Event_Counter_t t_Base = 0; /* The sum of the ancestor counters */
+    ITC_Event_Counter_t t_Min; /* The minimum of the current subinterval */
+    uint32_t u32_First = 0; /* The first step of the current subinterval */
+    uint32_t u32_Last; /* The last step of the current subinterval */
+    uint32_t u32_Depth = 0; /* The depth of the current node */
+    uint64_t u64_Position = 0; /* The position of the current node */
+    uint64_t u64_Start; /* The start of the current subinterval */
+    uint64_t u64_End; /* The end of the current subinterval */
+
+    *ppt_Event = NULL;
+
+    while (ppt_CurrentEvent && t_Status == ITC_STATUS_SUCCESS)
+    {
+        u64_Start = u64_Position << (ITC_EVENT_STEPS_MAX_DEPTH - u32_Depth);
+        u64_End = u64_Start +
+                  (UINT64_C(1) << (ITC_EVENT_STEPS_MAX_DEPTH - u32_Depth));
+
+        /* Subintervals are visited in ascending order. Skip the steps
+         * ending before the current one */
+        while (ITC_EVENT_STEPS_GET_END(pt_Steps, u32_First) <= u64_Start)
+        {
+            u32_First++;
+        }
+
+        t_Min = pt_Steps->pt_Steps[u32_First].t_Count;
+        u32_Last = u32_First;
+
+        while (ITC_EVENT_STEPS_GET_END(pt_Steps, u32_Last) < u64_End)
+        {
+            u32_Last++;
+            t_Min = MIN(t_Min, pt_Steps->pt_Steps[u32_Last].t_Count);
+        }
+
+        t_Status = newEvent(
+            ppt_CurrentEvent, pt_CurrentEventParent, t_Min - t_Base);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into left tree */
+        else if (u32_First != u32_Last)
+        {
+            t_Base = t_Min;
+            pt_CurrentEventParent = *ppt_CurrentEvent;
+            ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
+            u32_Depth++;
+            u64_Position <<= 1U;
+        }
+        else
+        {
+            /* Loop until the current node is no longer a right child */
+            while (u32_Depth > 0 && (u64_Position & 1U))
+            {
+                t_Base -= pt_CurrentEventParent->t_Count;
+                pt_CurrentEventParent = pt_CurrentEventParent->pt_Parent;
+                u32_Depth--;
+                u64_Position >>= 1U;
+            }
+
+            /* Descend into the unallocated right child of the parent */
+            if (u32_Depth > 0)
+            {
+                ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
+                u64_Position++;
+            }
+            else
+            {
+                ppt_CurrentEvent = NULL;
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the conversion failed, rather than the
+         * destroy */
+        (void)ITC_Event_destroy(ppt_Event);
+    }
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    else
+    {
+        updateEventSubtreeSummaries(*ppt_Event);
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+    return t_Status;
+}
+
+/**
+ * @brief Join two step function Events, fulfilling `join(e1, e2)`
+ *
+ * Merges the breakpoints of both step functions, taking the pointwise
+ * maximum of their counts and coalescing equal adjacent steps.
+ *
+ * @param pt_Steps1 The first step function Event
+ * @param pt_Steps2 The second step function Event
+ * @param pt_Steps (out) The joined step function Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinEventSteps(
+    const ITC_Event_Steps_t *const pt_Steps1,
+    const ITC_Event_Steps_t *const pt_Steps2,
+    ITC_Event_Steps_t *const pt_Steps
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_I1 = 0;
+    uint32_t u32_I2 = 0;
+    uint64_t u64_Start = 0; /* The start of the current merged step */
+    uint64_t u64_End1;
+    uint64_t u64_End2;
+
+    pt_Steps->pt_Steps = NULL;
+    pt_Steps->u32_Length = 0;
+
+    if (pt_Steps1->u32_Length > UINT32_MAX - pt_Steps2->u32_Length)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        t_Status = newEventSteps(
+            pt_Steps, pt_Steps1->u32_Length + pt_Steps2->u32_Length);
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && u64_Start < ITC_EVENT_STEPS_END)
+    {
+        appendEventStep(
+            pt_Steps,
+            u64_Start,
+            MAX(pt_Steps1->pt_Steps[u32_I1].t_Count,
+                pt_Steps2->pt_Steps[u32_I2].t_Count));
+
+        u64_End1 = ITC_EVENT_STEPS_GET_END(pt_Steps1, u32_I1);
+        u64_End2 = ITC_EVENT_STEPS_GET_END(pt_Steps2, u32_I2);
+        u64_Start = MIN(u64_End1, u64_End2);
+
+        /* Move on to the next step of each function that has ended */
+        u32_I1 += (u64_End1 == u64_Start && u64_Start < ITC_EVENT_STEPS_END);
+        u32_I2 += (u64_End2 == u64_Start && u64_Start < ITC_EVENT_STEPS_END);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check if a step function Event is `<=` to another one
+ *
+ * Performs a merge scan of the breakpoints of both step functions.
+ *
+ * @param pt_Steps1 The first step function Event
+ * @param pt_Steps2 The second step function Event
+ * @return `true` if `*pt_Steps1 <= *pt_Steps2`. Otherwise `false`
+ */
+static bool leqEventSteps(
+    const ITC_Event_Steps_t *const pt_Steps1,
+    const ITC_Event_Steps_t *const pt_Steps2
+)
+{
+    bool b_IsLeq = true;
+    uint32_t u32_I1 = 0;
+    uint32_t u32_I2 = 0;
+    uint64_t u64_Start = 0; /* The start of the current merged step */
+    uint64_t u64_End1;
+    uint64_t u64_End2;
+
+    while (b_IsLeq && u64_Start < ITC_EVENT_STEPS_END)
+    {
+        b_IsLeq = (pt_Steps1->pt_Steps[u32_I1].t_Count <=
+                   pt_Steps2->pt_Steps[u32_I2].t_Count);
+
+        u64_End1 = ITC_EVENT_STEPS_GET_END(pt_Steps1, u32_I1);
+        u64_End2 = ITC_EVENT_STEPS_GET_END(pt_Steps2, u32_I2);
+        u64_Start = MIN(u64_End1, u64_End2);
+
+        /* Move on to the next step of each function that has ended */
+        u32_I1 += (u64_End1 == u64_Start && u64_Start < ITC_EVENT_STEPS_END);
+        u32_I2 += (u64_End2 == u64_Start && u64_Start < ITC_EVENT_STEPS_END);
+    }
+
+    return b_IsLeq;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
+#if (ITC_CONFIG_ENABLE_EVENT_HASH && !ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH) || \
+    ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/**
+ * @brief Calculate the structural hash of an Event tree
+ *
+ * Performs a pre-order traversal, mixing the kind (leaf or parent) and the
+ * counter of every node into the hash. Since the kind of each node is part of
+ * the hash, the pre-order sequence unambiguously describes the tree.
+ *
+ * @param pt_Event The Event to hash
+ * @return `uint64_t` The hash of the Event
+ */
+static uint64_t hashEvent(
+    const ITC_Event_t *pt_Event
+)
+{
+    uint64_t u64_Hash = ITC_EVENT_HASH_SEED;
+    const ITC_Event_t *pt_RootEventParent;
+
+    /* Remember the root parent Event as this might be a subtree */
+    pt_RootEventParent = pt_Event->pt_Parent;
+
+    while (pt_Event)
+    {
+        u64_Hash = mixEventHash(
+            u64_Hash, (uint64_t)ITC_EVENT_IS_PARENT_EVENT(pt_Event));
+        u64_Hash = mixEventHash(u64_Hash, (uint64_t)pt_Event->t_Count);
+
+        /* Descend into left tree */
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            pt_Event = pt_Event->pt_Left;
+        }
+        else
+        {
+            /* Loop until the current node is no longer a right child */
+            while (pt_Event->pt_Parent != pt_RootEventParent &&
+                   pt_Event->pt_Parent->pt_Right == pt_Event)
+            {
+                pt_Event = pt_Event->pt_Parent;
+            }
+
+            /* There is a right subtree that has not been hashed yet */
+            if (pt_Event->pt_Parent != pt_RootEventParent)
+            {
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+            }
+            else
+            {
+                pt_Event = NULL;
+            }
+        }
+    }
+
+    return u64_Hash;
+}
+
+#endif /* (ITC_CONFIG_ENABLE_EVENT_HASH && !ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH) || ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/**
+ * @brief Append the hash of an Event subtree to a list of subtree hashes
+ *
+ * @param pt_Event The root of the Event subtree
+ * @param u64_Index The index of the subtree root within its level
+ * @param u8_Level The level of the subtree root
+ * @param pt_Hashes The list of subtree hashes
+ * @param u32_Capacity The number of elements the list can hold
+ * @param pu32_Length (in) The number of elements in the list. (out) The
+ * number of elements in the list, including the new one
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the list is full
+ */
+static ITC_Status_t appendEventSubtreeHash(
+    const ITC_Event_t *const pt_Event,
+    const uint64_t u64_Index,
+    const uint8_t u8_Level,
+    ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_Capacity,
+    uint32_t *const pu32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (*pu32_Length >= u32_Capacity)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        pt_Hashes[*pu32_Length].u64_Hash = pt_Event->u64_Hash;
+        pt_Hashes[*pu32_Length].u64_Index = u64_Index;
+        pt_Hashes[*pu32_Length].u8_Level = u8_Level;
+        pt_Hashes[*pu32_Length].b_IsLeaf = ITC_EVENT_IS_LEAF_EVENT(pt_Event);
+        (*pu32_Length)++;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the Event subtree at a given position
+ *
+ * If the tree is not deep enough, the leaf covering the position is returned
+ * instead.
+ *
+ * @param pt_Event The Event to search
+ * @param u64_Index The index of the subtree root within its level
+ * @param u8_Level The level of the subtree root
+ * @param pu8_FoundLevel (out) The level of the returned subtree root
+ * @return `const ITC_Event_t *` The found Event subtree
+ */
+static const ITC_Event_t *findEventSubtree(
+    const ITC_Event_t *pt_Event,
+    const uint64_t u64_Index,
+    const uint8_t u8_Level,
+    uint8_t *const pu8_FoundLevel
+)
+{
+    uint8_t u8_CurrentLevel = 0; /* The level of the current node */
+
+    while (u8_CurrentLevel < u8_Level && ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+    {
+        u8_CurrentLevel++;
+
+        /* Each bit of the index (MSB first) selects the next child */
+        if ((u64_Index >> (u8_Level - u8_CurrentLevel)) & 1U)
+        {
+            pt_Event = pt_Event->pt_Right;
+        }
+        else
+        {
+            pt_Event = pt_Event->pt_Left;
+        }
+    }
+
+    *pu8_FoundLevel = u8_CurrentLevel;
+
+    return pt_Event;
+}
+
+/**
+ * @brief Skip the descendants of a subtree hash in a pre-order list of
+ * subtree hashes
+ *
+ * @param pt_Hashes The list of subtree hashes
+ * @param u32_Length The number of elements in the list
+ * @param u32_Index The index of the subtree hash in the list
+ * @return `uint32_t` The index of the next subtree hash in the list, which is
+ * not a descendant of the given one
+ */
+static uint32_t skipEventSubtreeHashDescendants(
+    const ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_Length,
+    uint32_t u32_Index
+)
+{
+    const uint8_t u8_Level = pt_Hashes[u32_Index].u8_Level;
+
+    u32_Index++;
+
+    while (u32_Index < u32_Length && pt_Hashes[u32_Index].u8_Level > u8_Level)
+    {
+        u32_Index++;
+    }
+
+    return u32_Index;
+}
+
+/**
+ * @brief Collect the hashes of the subtrees of an Event down to a given level
+ *
+ * Performs a pre-order traversal, while keeping track of the level and index
+ * (within the level) of the current node. Right children always have odd
+ * indices.
+ *
+ * @param pt_Event The Event
+ * @param u8_MaxLevel The deepest level to collect the subtree hashes of
+ * @param pt_Hashes (out) The subtree hashes in pre-order
+ * @param pu32_Length (in) The number of elements `pt_Hashes` can hold.
+ * (out) The number of collected subtree hashes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Hashes` is not big
+ * enough
+ */
+static ITC_Status_t getEventSubtreeHashes(
+    const ITC_Event_t *pt_Event,
+    const uint8_t u8_MaxLevel,
+    ITC_Event_SubtreeHash_t *const pt_Hashes,
+    uint32_t *const pu32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Length = 0; /* The number of collected subtree hashes */
+    uint64_t u64_Index = 0; /* The index of the current node in its level */
+    uint8_t u8_Level = 0; /* The level of the current node */
+
+    while (pt_Event && t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = appendEventSubtreeHash(
+            pt_Event,
+            u64_Index,
+            u8_Level,
+            pt_Hashes,
+            *pu32_Length,
+            &u32_Length);
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into left tree */
+        else if (ITC_EVENT_IS_PARENT_EVENT(pt_Event) &&
+                 u8_Level < u8_MaxLevel)
+        {
+            pt_Event = pt_Event->pt_Left;
+            u8_Level++;
+            u64_Index <<= 1U;
+        }
+        else
+        {
+            /* Loop until the current node is no longer a right child */
+            while (u8_Level > 0 && (u64_Index & 1U))
+            {
+                pt_Event = pt_Event->pt_Parent;
+                u8_Level--;
+                u64_Index >>= 1U;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (u8_Level > 0)
+            {
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+                u64_Index++;
+            }
+            else
+            {
+                pt_Event = NULL;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_Length = u32_Length;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the subtrees of an Event, which differ from a pre-order list of
+ * (remote) subtree hashes
+ *
+ * Only descends into the subtrees whose hashes differ. The subtrees of the
+ * remote list with matching hashes are skipped along with their descendants.
+ *
+ * @param pt_Event The Event
+ * @param pt_Hashes The subtree hashes to compare against in pre-order
+ * @param u32_HashesLength The number of elements in `pt_Hashes`
+ * @param pt_Diffs (out) The hashes of the differing subtrees of the Event
+ * @param pu32_DiffsLength (in) The number of elements `pt_Diffs` can hold.
+ * (out) The number of differing subtrees
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Diffs` is not big enough
+ */
+static ITC_Status_t diffEventSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_HashesLength,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Length = 0; /* The number of differing subtrees */
+    uint32_t u32_I = 0; /* The index of the current remote subtree hash */
+    const ITC_Event_SubtreeHash_t *pt_Hash; /* The current remote hash */
+    const ITC_Event_t *pt_Subtree; /* The local subtree at its position */
+    uint8_t u8_Level; /* The level of `pt_Subtree` */
+    uint64_t u64_Index; /* The index of `pt_Subtree` within its level */
+
+    while (u32_I < u32_HashesLength && t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Hash = &pt_Hashes[u32_I];
+        pt_Subtree = findEventSubtree(
+            pt_Event, pt_Hash->u64_Index, pt_Hash->u8_Level, &u8_Level);
+        u64_Index = pt_Hash->u64_Index >> (pt_Hash->u8_Level - u8_Level);
+
+        /* The subtrees match. Skip the remote descendants */
+        if (u8_Level == pt_Hash->u8_Level &&
+            pt_Subtree->u64_Hash == pt_Hash->u64_Hash)
+        {
+            u32_I = skipEventSubtreeHashDescendants(
+                pt_Hashes, u32_HashesLength, u32_I);
+        }
+        /* Both subtrees continue further down, and so does the remote list.
+         * Descend into the remote children */
+        else if (u8_Level == pt_Hash->u8_Level &&
+                 ITC_EVENT_IS_PARENT_EVENT(pt_Subtree) &&
+                 !pt_Hash->b_IsLeaf &&
+                 u32_I + 1U < u32_HashesLength &&
+                 pt_Hashes[u32_I + 1U].u8_Level > pt_Hash->u8_Level)
+        {
+            u32_I++;
+        }
+        /* This is as far as the subtrees can be compared.
+         * If the local subtree is a leaf covering several remote subtrees,
+         * it might have already been reported */
+        else
+        {
+            if (u32_Length == 0 ||
+                pt_Diffs[u32_Length - 1].u8_Level != u8_Level ||
+                pt_Diffs[u32_Length - 1].u64_Index != u64_Index)
+            {
+                t_Status = appendEventSubtreeHash(
+                    pt_Subtree,
+                    u64_Index,
+                    u8_Level,
+                    pt_Diffs,
+                    *pu32_DiffsLength,
+                    &u32_Length);
+            }
+
+            u32_I = skipEventSubtreeHashDescendants(
+                pt_Hashes, u32_HashesLength, u32_I);
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_DiffsLength = u32_Length;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the subtrees of an Event, which differ from another Event
+ *
+ * Performs a pre-order traversal of both Events in lockstep, only descending
+ * into subtrees whose hashes differ, while keeping track of the level and
+ * index (within the level) of the current nodes. Right children always have
+ * odd indices.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pt_Diffs (out) The hashes of the differing subtrees of `pt_Event1`
+ * @param pu32_DiffsLength (in) The number of elements `pt_Diffs` can hold.
+ * (out) The number of differing subtrees
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Diffs` is not big enough
+ */
+static ITC_Status_t diffEventSubtrees(
+    const ITC_Event_t *pt_Event1,
+    const ITC_Event_t *pt_Event2,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Length = 0; /* The number of differing subtrees */
+    uint64_t u64_Index = 0; /* The index of the current nodes in their level */
+    uint8_t u8_Level = 0; /* The level of the current nodes */
+
+    while (pt_Event1 && t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Descend into both left trees. A different counter affects the
+         * whole subtree, so there is no point in descending any further */
+        if (pt_Event1->u64_Hash != pt_Event2->u64_Hash &&
+            ITC_EVENT_IS_PARENT_EVENT(pt_Event1) &&
+            ITC_EVENT_IS_PARENT_EVENT(pt_Event2) &&
+            pt_Event1->t_Count == pt_Event2->t_Count &&
+            u8_Level < ITC_EVENT_SUBTREE_HASH_MAX_LEVEL)
+        {
+            pt_Event1 = pt_Event1->pt_Left;
+            pt_Event2 = pt_Event2->pt_Left;
+            u8_Level++;
+            u64_Index <<= 1U;
+        }
+        else
+        {
+            if (pt_Event1->u64_Hash != pt_Event2->u64_Hash)
+            {
+                t_Status = appendEventSubtreeHash(
+                    pt_Event1,
+                    u64_Index,
+                    u8_Level,
+                    pt_Diffs,
+                    *pu32_DiffsLength,
+                    &u32_Length);
+            }
+
+            /* Loop until the current nodes are no longer right children */
+            while (u8_Level > 0 && (u64_Index & 1U))
+            {
+                pt_Event1 = pt_Event1->pt_Parent;
+                pt_Event2 = pt_Event2->pt_Parent;
+                u8_Level--;
+                u64_Index >>= 1U;
+            }
+
+            /* There are right subtrees that have not been explored yet */
+            if (u8_Level > 0)
+            {
+                pt_Event1 = pt_Event1->pt_Parent->pt_Right;
+                pt_Event2 = pt_Event2->pt_Parent->pt_Right;
+                u64_Index++;
+            }
+            else
+            {
+                pt_Event1 = NULL;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu32_DiffsLength = u32_Length;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Validate a pre-order list of subtree hashes
+ *
+ * @param pt_Hashes The list of subtree hashes
+ * @param u32_Length The number of elements in the list
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateEventSubtreeHashes(
+    const ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_I = 0;
+
+    if (!pt_Hashes && u32_Length > 0)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    while (u32_I < u32_Length && t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The index must fit in its level */
+        if (pt_Hashes[u32_I].u8_Level > ITC_EVENT_SUBTREE_HASH_MAX_LEVEL ||
+            (pt_Hashes[u32_I].u64_Index >> pt_Hashes[u32_I].u8_Level) != 0)
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+        }
+
+        u32_I++;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+/**
+ * @brief Add an Event node to the current path sum of an Event traversal
+ *
+ * Once the path sum saturates, it is left as it was until the traversal
+ * leaves the node that caused it to saturate.
+ *
+ * @param pt_Event The Event node entered
+ * @param u32_Depth The depth of `pt_Event`
+ * @param pt_PathSum The sum of the counters from the root to the parent of
+ * `pt_Event`
+ * @param pu32_SaturatedDepth The depth of the node which saturated the path
+ * sum. `0` if the path sum has not saturated
+ */
+static void enterEventPathNode(
+    const ITC_Event_t *const pt_Event,
+    const uint32_t u32_Depth,
+    ITC_Event_Counter_t *const pt_PathSum,
+    uint32_t *const pu32_SaturatedDepth
+)
+{
+    if (!*pu32_SaturatedDepth)
+    {
+        if (incEventCounter(pt_PathSum, pt_Event->t_Count) !=
+            ITC_STATUS_SUCCESS)
+        {
+            *pu32_SaturatedDepth = u32_Depth;
+        }
+    }
+}
+
+/**
+ * @brief Remove an Event node from the current path sum of an Event traversal
+ *
+ * Reverts ::enterEventPathNode()
+ *
+ * @param pt_Event The Event node left
+ * @param u32_Depth The depth of `pt_Event`
+ * @param pt_PathSum The sum of the counters from the root to `pt_Event`
+ * @param pu32_SaturatedDepth The depth of the node which saturated the path
+ * sum. `0` if the path sum has not saturated
+ */
+static void leaveEventPathNode(
+    const ITC_Event_t *const pt_Event,
+    const uint32_t u32_Depth,
+    ITC_Event_Counter_t *const pt_PathSum,
+    uint32_t *const pu32_SaturatedDepth
+)
+{
+    if (*pu32_SaturatedDepth == u32_Depth)
+    {
+        /* The node was never added to the path sum */
+        *pu32_SaturatedDepth = 0;
+    }
+    else if (!*pu32_SaturatedDepth)
+    {
+        *pt_PathSum -= pt_Event->t_Count;
+    }
+}
+
+/**
+ * @brief Calculate the shape metrics of an Event
+ *
+ * Performs a pre-order traversal, while keeping track of the depth of the
+ * current node and the sum of the counters on the path to it.
+ *
+ * @param pt_Event The Event
+ * @param pt_Metrics (out) The Event metrics
+ */
+static void calcEventMetrics(
+    const ITC_Event_t *pt_Event,
+    ITC_Event_Metrics_t *const pt_Metrics
+)
+{
+    const ITC_Event_t *const pt_RootEvent = pt_Event;
+    /* The sum of the counters from the root to the current node */
+    ITC_Event_Counter_t t_PathSum = pt_Event->t_Count;
+    uint32_t u32_SaturatedDepth = 0;
+    uint32_t u32_Depth = 0;
+
+    pt_Metrics->u32_Nodes = 0;
+    pt_Metrics->u32_Depth = 0;
+    pt_Metrics->t_Max = 0;
+    pt_Metrics->t_Total = 0;
+
+    while (pt_Event)
+    {
+        pt_Metrics->u32_Nodes++;
+        pt_Metrics->u32_Depth = MAX(pt_Metrics->u32_Depth, u32_Depth);
+
+        if (incEventCounter(&pt_Metrics->t_Total, pt_Event->t_Count) !=
+            ITC_STATUS_SUCCESS)
+        {
+            pt_Metrics->t_Total = (ITC_Event_Counter_t)~0;
+        }
+
+        if (ITC_EVENT_IS_PARENT_EVENT(pt_Event))
+        {
+            /* Descend into left tree */
+            pt_Event = pt_Event->pt_Left;
+            u32_Depth++;
+
+            enterEventPathNode(
+                pt_Event, u32_Depth, &t_PathSum, &u32_SaturatedDepth);
+        }
+        else
+        {
+            /* For a leaf: max(e) is the sum of the path to it */
+            pt_Metrics->t_Max = u32_SaturatedDepth
+                ? (ITC_Event_Counter_t)~0
+                : MAX(pt_Metrics->t_Max, t_PathSum);
+
+            /* Loop until the current node is no longer a right child */
+            while (pt_Event != pt_RootEvent &&
+                   pt_Event == pt_Event->pt_Parent->pt_Right)
+            {
+                leaveEventPathNode(
+                    pt_Event, u32_Depth, &t_PathSum, &u32_SaturatedDepth);
+
+                pt_Event = pt_Event->pt_Parent;
+                u32_Depth--;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Event != pt_RootEvent)
+            {
+                leaveEventPathNode(
+                    pt_Event, u32_Depth, &t_PathSum, &u32_SaturatedDepth);
+
+                pt_Event = pt_Event->pt_Parent->pt_Right;
+
+                enterEventPathNode(
+                    pt_Event, u32_Depth, &t_PathSum, &u32_SaturatedDepth);
+            }
+            else
+            {
+                pt_Event = NULL;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC Event and initialise it
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_new(
+    ITC_Event_t **ppt_Event
+)
+{
+    if (!ppt_Event)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newEvent(ppt_Event, NULL, 0);
+}
+
+/******************************************************************************
+ * Get the shared read-only leaf Event with a 0 counter
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_newShared(
+    ITC_Event_t **ppt_Event
+)
+{
+    if (!ppt_Event)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    *ppt_Event = ITC_EVENT_SHARED_EVENT_PTR(gt_ItcSharedEvent);
+
+    return ITC_STATUS_SUCCESS;
+#else
+    return newEvent(ppt_Event, NULL, 0);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+}
+
+/******************************************************************************
+ * Free an allocated ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_destroy(
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    ITC_Event_t *pt_CurrentEvent = NULL; /* The current element */
+    ITC_Event_t *pt_CurrentEventParent = NULL;
+    ITC_Event_t *pt_RootEventParent = NULL;
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* The shared Event is never freed */
+    else if (*ppt_Event && !ITC_EVENT_IS_SHARED_EVENT(*ppt_Event))
+    {
+        pt_CurrentEvent = *ppt_Event;
+        /* Remember the parent as this might be a subtree */
+        pt_RootEventParent = pt_CurrentEvent->pt_Parent;
+
+        /* Keep trying to free elements even if some frees fail */
+        while(pt_CurrentEvent && pt_CurrentEvent != pt_RootEventParent)
+        {
+            /* Advance into left subtree */
+            if(pt_CurrentEvent->pt_Left)
+            {
+                pt_CurrentEvent = pt_CurrentEvent->pt_Left;
+            }
+            /* Advance into right subtree */
+            else if(pt_CurrentEvent->pt_Right)
+            {
+                pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+            }
+            else
+            {
+                /* Remember the parent element */
+                pt_CurrentEventParent = pt_CurrentEvent->pt_Parent;
+
+                if(pt_CurrentEventParent)
+                {
+                    /* Remove the current element address from the parent */
+                    if(pt_CurrentEventParent->pt_Left == pt_CurrentEvent)
+                    {
+                        pt_CurrentEventParent->pt_Left = NULL;
+                    }
+                    else
+                    {
+                        pt_CurrentEventParent->pt_Right = NULL;
+                    }
+                }
+
+                /* Free the current element */
+                t_FreeStatus = ITC_Port_free(pt_CurrentEvent);
+
+                /* Return last error */
+                if (t_FreeStatus != ITC_STATUS_SUCCESS)
+                {
+                    t_Status = t_FreeStatus;
+                }
+
+                /* Go up the tree */
+                pt_CurrentEvent = pt_CurrentEventParent;
+            }
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Sanitize the freed pointer regardless of the exit status */
+        *ppt_Event = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Clone an existing ITC Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_clone(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_t **ppt_ClonedEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_ClonedEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+        /* The shared Event is read-only, so there is no need to copy it */
+        if (ITC_EVENT_IS_SHARED_EVENT(pt_Event))
+        {
+            *ppt_ClonedEvent = ITC_EVENT_SHARED_EVENT_PTR(*pt_Event);
+        }
+        else
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+        {
+            t_Status = cloneEvent(pt_Event, ppt_ClonedEvent, NULL);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_validate(
+    const ITC_Event_t *const pt_Event
+)
+{
+    return validateEvent(pt_Event, true);
+}
+
+/******************************************************************************
+ * Join two existing Events into a single Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_join(
+    ITC_Event_t **ppt_Event,
+    ITC_Event_t **ppt_OtherEvent
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_JoinedEvent;
+
+    if (!ppt_Event || !ppt_OtherEvent)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_OtherEvent, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = joinEventAdaptiveE(
+            *ppt_Event, *ppt_OtherEvent, &pt_JoinedEvent, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* XXX: Save the parent pointer in case the original Event was a subtree.
+         * This makes no sense from a functional point of view, especially
+         * since `validateEvent` should fail if a subtree is passed in.
+         * However, if that somehow fails and a subtree is joined, the new Event
+         * will lose the reference to the original Event subtree's parent nodes,
+         * which would lead to a memory leak. */
+        pt_JoinedEvent->pt_Parent = (*ppt_Event)->pt_Parent;
+
+        /* Destroy the old Events
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall join
+         * operation was successful */
+        (void)ITC_Event_destroy(ppt_Event);
+        (void)ITC_Event_destroy(ppt_OtherEvent);
+
+        /* Return the joined Event */
+        *ppt_Event = pt_JoinedEvent;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Join two Events similar to ::ITC_Event_join() but do not modify the source Events
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_joinConst(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = joinEventAdaptiveE(pt_Event1, pt_Event2, ppt_Event, false);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Meet two Events
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_meet(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = joinEventAdaptiveE(pt_Event1, pt_Event2, ppt_Event, true);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Meet multiple Events
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_meetMany(
+    const ITC_Event_t *const *const ppt_Events,
+    const uint32_t u32_EventsLength,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_MetEvent = NULL; /* The Events met so far */
+    ITC_Event_t *pt_NextMetEvent = NULL;
+    uint32_t u32_I = 0;
+
+    if (!ppt_Events || !u32_EventsLength || !ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_EventsLength)
+    {
+        t_Status = validateEvent(ppt_Events[u32_I], true);
+        u32_I++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = cloneEvent(ppt_Events[0], &pt_MetEvent, NULL);
+        u32_I = 1;
+    }
+
+    /* Meet the Events one by one.
+     * Once the result is a `0` leaf it cannot get any smaller, so there is
+     * no need to look at the remaining Events */
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_I < u32_EventsLength &&
+           !(ITC_EVENT_IS_LEAF_EVENT(pt_MetEvent) && pt_MetEvent->t_Count == 0))
+    {
+        t_Status = joinEventAdaptiveE(
+            pt_MetEvent, ppt_Events[u32_I], &pt_NextMetEvent, true);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it is
+             * more important to convey the result of the meet */
+            (void)ITC_Event_destroy(&pt_MetEvent);
+            pt_MetEvent = pt_NextMetEvent;
+        }
+
+        u32_I++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *ppt_Event = pt_MetEvent;
+    }
+    else if (pt_MetEvent)
+    {
+        /* There is nothing else to do if the destroy fails */
+        (void)ITC_Event_destroy(&pt_MetEvent);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Rebase an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_rebase(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_Base
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_RebasedEvent = NULL;
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Base, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = diffEventE(
+            *ppt_Event,
+            pt_Base,
+            &pt_RebasedEvent,
+            ITC_EVENT_POINTWISE_OP_REBASE);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the rebase was successful */
+        (void)ITC_Event_destroy(ppt_Event);
+
+        /* Return the rebased Event */
+        *ppt_Event = pt_RebasedEvent;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Add an Event to another
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_add(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_Addend
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_SummedEvent = NULL;
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Addend, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = diffEventE(
+            *ppt_Event,
+            pt_Addend,
+            &pt_SummedEvent,
+            ITC_EVENT_POINTWISE_OP_ADD);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the addition was successful */
+        (void)ITC_Event_destroy(ppt_Event);
+
+        /* Return the summed Event */
+        *ppt_Event = pt_SummedEvent;
+    }
+
+    return t_Status;
+}
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/******************************************************************************
+ * Chain the identity of a rebase base
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_chainRebaseBaseId(
+    const ITC_Event_t *const pt_Base,
+    const uint64_t u64_BaseId,
+    uint64_t *pu64_BaseId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pu64_BaseId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Only normalised Events are canonical */
+        t_Status = validateEvent(pt_Base, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Always use the flat structural hash, so the ID does not depend on
+         * whether the subtree hashes are enabled */
+        *pu64_BaseId = mixEventHash(u64_BaseId, hashEvent(pt_Base));
+
+        /* `0` is reserved for Events which were never rebased */
+        if (*pu64_BaseId == 0)
+        {
+            *pu64_BaseId = 1;
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+/******************************************************************************
+ * Get the shape metrics of an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_getMetrics(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Metrics_t *const pt_Metrics
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pt_Metrics)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        calcEventMetrics(pt_Event, pt_Metrics);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/******************************************************************************
+ * Join two Events similar to ::ITC_Event_joinConst() but do not normalise the
+ * result
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_joinConstUnnormalised(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = joinEventE(pt_Event1, pt_Event2, ppt_Event, false, false);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+/******************************************************************************
+ * Check if an Event is `less than or equal` (`<=`) to another Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_leq(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    bool *pb_IsLeq
+
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pb_IsLeq)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check if `pt_Event1 <= pt_Event2` */
+        t_Status = leqEventE(pt_Event1, pt_Event2, pb_IsLeq);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Find where an Event exceeds another Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_diff(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Diff
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Diff)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = diffEventE(
+            pt_Event1, pt_Event2, ppt_Diff, ITC_EVENT_POINTWISE_OP_DIFF);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Count the regions in which an Event exceeds another Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_diffRegions(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    uint32_t *pu32_Regions
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pu32_Regions)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = countEventDiffRegions(pt_Event1, pt_Event2, pu32_Regions);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Fill an Event
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_fill(
+    ITC_Event_t **ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    bool *pb_WasFilled
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pb_WasFilled || !ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the ID */
+        t_Status = ITC_Id_validate(pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = fillEventE(ppt_Event, pt_Id, pb_WasFilled);
     }
 
     return t_Status;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+/******************************************************************************
+ * Grow an Event
+ ******************************************************************************/
 
+ITC_Status_t ITC_Event_grow(
+    ITC_Event_t **ppt_Event,
+    const ITC_Id_t *const pt_Id
+)
+{
+    return ITC_Event_growWithPolicy(
+        ppt_Event,
+        pt_Id,
+        (ITC_Event_GrowPolicy_t)ITC_CONFIG_EVENT_GROW_POLICY);
+}
 
-/**
- * @brief Deserialise an ITC Event
- *
- * For the expected data format see ::serialiseEvent()
- *
- * @param pu8_Buffer The buffer holding the serialised Event data
- * @param u32_BufferSize The size of the buffer in bytes
- * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
- * serialised input
- * @param ppt_Event The pointer to the deserialised Event
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- */
-static ITC_Status_t deserialiseEvent(
-    const uint8_t *const pu8_Buffer,
-    const uint32_t u32_BufferSize,
-    const bool b_HasVersion,
-    ITC_Event_t **ppt_Event
+/******************************************************************************
+ * Grow an Event using the given grow policy
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_growWithPolicy(
+    ITC_Event_t **ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_GrowPolicy_t t_GrowPolicy
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_t **ppt_CurrentEvent = NULL; /* The current Event */
-    ITC_Event_t *pt_CurrentEventParent = NULL;
-    uint32_t u32_Offset = 0; /* The current offset */
-    uint32_t u32_CounterLen; /* The serialised Event counter length */
-    uint32_t u32_NextHeaderOffset; /* Used for serialisation data validation */
-    bool b_IsParent;
 
-    *ppt_Event = NULL;
-    ppt_CurrentEvent = ppt_Event;
+    if (!ppt_Event ||
+        (t_GrowPolicy != ITC_EVENT_GROW_POLICY_MIN_SIZE &&
+         t_GrowPolicy != ITC_EVENT_GROW_POLICY_MIN_DEPTH &&
+         t_GrowPolicy != ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-    /* If input contains a version check it matches the current lib version
-     * (provided by build system c args) */
-    if (b_HasVersion)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        if (pu8_Buffer[u32_Offset] != ITC_VERSION_MAJOR)
-        {
-            t_Status = ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
-        }
+        t_Status = validateEvent(*ppt_Event, true);
+    }
 
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the ID */
+        t_Status = ITC_Id_validate(pt_Id);
     }
 
-    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Unknown node header value */
-        if (pu8_Buffer[u32_Offset] & ~ITC_SERDES_EVENT_HEADER_MASK)
+        if (t_GrowPolicy == ITC_EVENT_GROW_POLICY_MIN_SIZE)
         {
-            t_Status = ITC_STATUS_CORRUPT_EVENT;
+            t_Status = growEventE(ppt_Event, pt_Id);
         }
         else
         {
-            /* Get the node type */
-            b_IsParent = ITC_SERDES_EVENT_GET_IS_PARENT(pu8_Buffer[u32_Offset]);
+            t_Status = growEventWithPolicyE(ppt_Event, pt_Id, t_GrowPolicy);
+        }
+    }
 
-            /* Get the serialised Event counter length */
-            u32_CounterLen =
-                ITC_SERDES_EVENT_GET_COUNTER_LEN(pu8_Buffer[u32_Offset]);
+    return t_Status;
+}
 
-            /* Calculate the offset of the next node header */
-            u32_NextHeaderOffset =
-                u32_Offset + u32_CounterLen + sizeof(ITC_SerDes_Header_t);
+/******************************************************************************
+ * Join the intervals of an Event owned by an ID into another Event
+ ******************************************************************************/
 
-            /* Check for serialisation data validity:
-             * - Check there is enough data left in the buffer to deserialise
-             *   the current node
-             * - Check the last serialised node is not a parent
-             */
-            if ((u32_NextHeaderOffset > u32_BufferSize) ||
-                (b_IsParent && u32_NextHeaderOffset == u32_BufferSize))
-            {
-                t_Status = ITC_STATUS_CORRUPT_EVENT;
-            }
-        }
+ITC_Status_t ITC_Event_joinOwned(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_OtherEvent,
+    const ITC_Id_t *const pt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* The largest event counter (`~0`) in the owned intervals, `0` elsewhere */
+    ITC_Event_t *pt_MaskEvent = NULL;
+    /* `pt_OtherEvent` restricted to the owned intervals */
+    ITC_Event_t *pt_OwnedEvent = NULL;
+    ITC_Event_t *pt_JoinedEvent;
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Create a new node */
-            t_Status = newEvent(ppt_CurrentEvent, pt_CurrentEventParent, 0);
-        }
+    if (!ppt_Event)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Increment the offset */
-            u32_Offset += sizeof(ITC_SerDes_Header_t);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(*ppt_Event, true);
+    }
 
-            /* Special case - if the counter length is 0, then the
-             * serialised Event had an Event counter == 0 */
-            if (u32_CounterLen > 0)
-            {
-                /* Deserialise the event counter */
-                t_Status = eventCounterFromNetwork(
-                    &pu8_Buffer[u32_Offset],
-                    u32_CounterLen,
-                    &(*ppt_CurrentEvent)->t_Count);
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_OtherEvent, true);
+    }
 
-            }
-        }
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Validate the ID */
+        t_Status = ITC_Id_validate(pt_Id);
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
-        {
-            /* Increment the offset */
-            u32_Offset += u32_CounterLen;
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newEventFromIdOwnership(
+            pt_Id, (ITC_Event_Counter_t)~0, &pt_MaskEvent);
+    }
 
-            /* If the current header was a parent - descend into left child */
-            if (b_IsParent)
-            {
-                pt_CurrentEventParent = *ppt_CurrentEvent;
-                ppt_CurrentEvent = &(*ppt_CurrentEvent)->pt_Left;
-            }
-            /* If the current header was a leaf - find the first unallocated
-             * right child node or error out if there isn't one */
-            else
-            {
-                /* Backtrack the tree until an unallocated right child is found
-                 * or there are no more parent nodes */
-                while (pt_CurrentEventParent && pt_CurrentEventParent->pt_Right)
-                {
-                    ppt_CurrentEvent = &pt_CurrentEventParent;
-                    pt_CurrentEventParent = (*ppt_CurrentEvent)->pt_Parent;
-                }
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = normEventE(pt_MaskEvent);
+    }
 
-                /* Descend into the unallocated right child of the parent */
-                if (pt_CurrentEventParent)
-                {
-                    ppt_CurrentEvent = &pt_CurrentEventParent->pt_Right;
-                }
-                /* There aren't any unallocated right child nodes in the tree.
-                 *
-                 * Usually this would signal the end of the loop as the only
-                 * time this should happen is when the full input buffer has
-                 * been deserialised (i.e.`u32_Offset == u32_BufferSize`),
-                 * since the tree is serialised in a pre-order traversal fasion.
-                 *
-                 * However, if the input buffer is malformed in some way it is
-                 * possible that there are elements in it that havent't been
-                 * deserialised yet (i.e. `u32_Offset < u32_BufferSize`).
-                 *
-                 * This should be treated as error as otherwise the user might
-                 * not get the expected (or full) Event tree. */
-                else if (u32_Offset < u32_BufferSize)
-                {
-                    t_Status = ITC_STATUS_CORRUPT_EVENT;
-                }
-                else
-                {
-                    /* Nothing to do */
-                }
-            }
-        }
+    /* Restrict the other Event to the owned intervals.
+     * meet(e, ~0) = e and meet(e, 0) = 0 */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = joinEventAdaptiveE(
+            pt_OtherEvent, pt_MaskEvent, &pt_OwnedEvent, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Check the deserialised Event is valid */
-        t_Status = validateEvent(*ppt_Event, true);
+        t_Status = joinEventAdaptiveE(
+            *ppt_Event, pt_OwnedEvent, &pt_JoinedEvent, false);
     }
 
-    if (t_Status != ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* There is nothing else to do if the destroy fails. Also it is more
-         * important to convey the deserialisation failed, rather than the
-         * destroy */
+        /* Destroy the old Event
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall join
+         * operation was successful */
         (void)ITC_Event_destroy(ppt_Event);
+
+        /* Return the joined Event */
+        *ppt_Event = pt_JoinedEvent;
     }
 
+    /* There is nothing else to do if the destroy fails */
+    (void)ITC_Event_destroy(&pt_MaskEvent);
+    (void)ITC_Event_destroy(&pt_OwnedEvent);
+
     return t_Status;
 }
 
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+
 /******************************************************************************
- * Public functions
+ * Convert an existing ITC Event into a dense Event array
  ******************************************************************************/
 
+ITC_Status_t ITC_Event_toArray(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Array_t *const pt_Array
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Array)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = eventToArray(pt_Event, pt_Array);
+    }
+
+    return t_Status;
+}
+
 /******************************************************************************
- * Allocate a new ITC Event and initialise it
+ * Allocate a new ITC Event from a dense Event array
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_new(
+ITC_Status_t ITC_Event_newFromArray(
+    const ITC_Event_Array_t *const pt_Array,
     ITC_Event_t **ppt_Event
 )
 {
-    if (!ppt_Event)
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Array || !ppt_Event)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = newEventFromArray(pt_Array, ppt_Event);
     }
 
-    return newEvent(ppt_Event, NULL, 0);
+    return t_Status;
 }
 
 /******************************************************************************
- * Free an allocated ITC Event
+ * Join two dense Event arrays
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_joinArray(
+    ITC_Event_Array_t *const pt_Array,
+    const ITC_Event_Array_t *const pt_OtherArray
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Array || !pt_OtherArray)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        joinEventArray(pt_Array, pt_OtherArray);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check if a dense Event array is `less than or equal` (`<=`) to another one
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_destroy(
-    ITC_Event_t **ppt_Event
+ITC_Status_t ITC_Event_leqArray(
+    const ITC_Event_Array_t *const pt_Array1,
+    const ITC_Event_Array_t *const pt_Array2,
+    bool *pb_IsLeq
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
-    ITC_Event_t *pt_CurrentEvent = NULL; /* The current element */
-    ITC_Event_t *pt_CurrentEventParent = NULL;
-    ITC_Event_t *pt_RootEventParent = NULL;
 
-    if (!ppt_Event)
+    if (!pt_Array1 || !pt_Array2 || !pb_IsLeq)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else if (*ppt_Event)
+    else
     {
-        pt_CurrentEvent = *ppt_Event;
-        /* Remember the parent as this might be a subtree */
-        pt_RootEventParent = pt_CurrentEvent->pt_Parent;
+        *pb_IsLeq = leqEventArray(pt_Array1, pt_Array2);
+    }
 
-        /* Keep trying to free elements even if some frees fail */
-        while(pt_CurrentEvent && pt_CurrentEvent != pt_RootEventParent)
-        {
-            /* Advance into left subtree */
-            if(pt_CurrentEvent->pt_Left)
-            {
-                pt_CurrentEvent = pt_CurrentEvent->pt_Left;
-            }
-            /* Advance into right subtree */
-            else if(pt_CurrentEvent->pt_Right)
-            {
-                pt_CurrentEvent = pt_CurrentEvent->pt_Right;
-            }
-            else
-            {
-                /* Remember the parent element */
-                pt_CurrentEventParent = pt_CurrentEvent->pt_Parent;
+    return t_Status;
+}
 
-                if(pt_CurrentEventParent)
-                {
-                    /* Remove the current element address from the parent */
-                    if(pt_CurrentEventParent->pt_Left == pt_CurrentEvent)
-                    {
-                        pt_CurrentEventParent->pt_Left = NULL;
-                    }
-                    else
-                    {
-                        pt_CurrentEventParent->pt_Right = NULL;
-                    }
-                }
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
 
-                /* Free the current element */
-                t_FreeStatus = ITC_Port_free(pt_CurrentEvent);
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
 
-                /* Return last error */
-                if (t_FreeStatus != ITC_STATUS_SUCCESS)
-                {
-                    t_Status = t_FreeStatus;
-                }
+/******************************************************************************
+ * Convert an existing ITC Event into a step function Event
+ ******************************************************************************/
 
-                /* Go up the tree */
-                pt_CurrentEvent = pt_CurrentEventParent;
-            }
-        }
+ITC_Status_t ITC_Event_toSteps(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Steps_t *const pt_Steps
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Steps)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else
+
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Nothing to do */
+        t_Status = validateEvent(pt_Event, true);
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Sanitize the freed pointer regardless of the exit status */
-        *ppt_Event = NULL;
+        t_Status = eventToSteps(pt_Event, pt_Steps);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Clone an existing ITC Event
+ * Allocate a new ITC Event from a step function Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_clone(
-    const ITC_Event_t *const pt_Event,
-    ITC_Event_t **ppt_ClonedEvent
+ITC_Status_t ITC_Event_newFromSteps(
+    const ITC_Event_Steps_t *const pt_Steps,
+    ITC_Event_t **ppt_Event
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_ClonedEvent)
+    if (!ppt_Event)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event, true);
+        t_Status = validateEventSteps(pt_Steps);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = cloneEvent(pt_Event, ppt_ClonedEvent, NULL);
+        t_Status = newEventFromSteps(pt_Steps, ppt_Event);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Validate an Event
+ * Free an allocated step function Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_validate(
-    const ITC_Event_t *const pt_Event
+ITC_Status_t ITC_Event_destroySteps(
+    ITC_Event_Steps_t *const pt_Steps
 )
 {
-    return validateEvent(pt_Event, true);
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Steps)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = destroyEventSteps(pt_Steps);
+    }
+
+    return t_Status;
 }
 
 /******************************************************************************
- * Join two existing Events into a single Event
+ * Join two step function Events
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_join(
-    ITC_Event_t **ppt_Event,
-    ITC_Event_t **ppt_OtherEvent
+ITC_Status_t ITC_Event_joinSteps(
+    const ITC_Event_Steps_t *const pt_Steps1,
+    const ITC_Event_Steps_t *const pt_Steps2,
+    ITC_Event_Steps_t *const pt_Steps
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Event_t *pt_JoinedEvent;
 
-    if (!ppt_Event || !ppt_OtherEvent)
+    if (!pt_Steps || pt_Steps == pt_Steps1 || pt_Steps == pt_Steps2)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(*ppt_Event, true);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateEvent(*ppt_OtherEvent, true);
+        t_Status = validateEventSteps(pt_Steps1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = joinEventE(*ppt_Event, *ppt_OtherEvent, &pt_JoinedEvent);
+        t_Status = validateEventSteps(pt_Steps2);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* XXX: Save the parent pointer in case the original Event was a subtree.
-         * This makes no sense from a functional point of view, especially
-         * since `validateEvent` should fail if a subtree is passed in.
-         * However, if that somehow fails and a subtree is joined, the new Event
-         * will lose the reference to the original Event subtree's parent nodes,
-         * which would lead to a memory leak. */
-        pt_JoinedEvent->pt_Parent = (*ppt_Event)->pt_Parent;
-
-        /* Destroy the old Events
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall join
-         * operation was successful */
-        (void)ITC_Event_destroy(ppt_Event);
-        (void)ITC_Event_destroy(ppt_OtherEvent);
-
-        /* Return the joined Event */
-        *ppt_Event = pt_JoinedEvent;
+        t_Status = joinEventSteps(pt_Steps1, pt_Steps2, pt_Steps);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Join two Events similar to ::ITC_Event_join() but do not modify the source Events
+ * Check if a step function Event is `less than or equal` (`<=`) to another one
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_joinConst(
-    const ITC_Event_t *const pt_Event1,
-    const ITC_Event_t *const pt_Event2,
-    ITC_Event_t **ppt_Event
+ITC_Status_t ITC_Event_leqSteps(
+    const ITC_Event_Steps_t *const pt_Steps1,
+    const ITC_Event_Steps_t *const pt_Steps2,
+    bool *pb_IsLeq
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Event)
+    if (!pb_IsLeq)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event1, true);
+        t_Status = validateEventSteps(pt_Steps1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event2, true);
+        t_Status = validateEventSteps(pt_Steps2);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = joinEventE(pt_Event1, pt_Event2, ppt_Event);
+        *pb_IsLeq = leqEventSteps(pt_Steps1, pt_Steps2);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
 /******************************************************************************
- * Check if an Event is `less than or equal` (`<=`) to another Event
+ * Calculate the structural hash of an Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_leq(
-    const ITC_Event_t *const pt_Event1,
-    const ITC_Event_t *const pt_Event2,
-    bool *pb_IsLeq
-
+ITC_Status_t ITC_Event_hash(
+    const ITC_Event_t *const pt_Event,
+    uint64_t *pu64_Hash
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!pb_IsLeq)
+    if (!pu64_Hash)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event1, true);
+        /* Only normalised Events are canonical */
+        t_Status = validateEvent(pt_Event, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(pt_Event2, true);
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+        /* The Merkle hash of the root is already memoised */
+        *pu64_Hash = pt_Event->u64_Hash;
+#else
+        *pu64_Hash = hashEvent(pt_Event);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/******************************************************************************
+ * Get the hashes of the subtrees of an Event down to a given level
+ ******************************************************************************/
+
+ITC_Status_t ITC_Event_getSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const uint8_t u8_MaxLevel,
+    ITC_Event_SubtreeHash_t *const pt_Hashes,
+    uint32_t *const pu32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Hashes || !pu32_Length ||
+        u8_MaxLevel > ITC_EVENT_SUBTREE_HASH_MAX_LEVEL)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Check if `pt_Event1 <= pt_Event2` */
-        t_Status = leqEventE(pt_Event1, pt_Event2, pb_IsLeq);
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = getEventSubtreeHashes(
+            pt_Event, u8_MaxLevel, pt_Hashes, pu32_Length);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Fill an Event
+ * Find the subtrees of an Event, which differ from a list of subtree hashes
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_fill(
-    ITC_Event_t **ppt_Event,
-    const ITC_Id_t *const pt_Id,
-    bool *pb_WasFilled
+ITC_Status_t ITC_Event_diffSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_HashesLength,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!pb_WasFilled || !ppt_Event)
+    if (!pt_Diffs || !pu32_DiffsLength)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(*ppt_Event, true);
+        t_Status = validateEventSubtreeHashes(pt_Hashes, u32_HashesLength);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Validate the ID */
-        t_Status = ITC_Id_validate(pt_Id);
+        t_Status = validateEvent(pt_Event, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = fillEventE(ppt_Event, pt_Id, pb_WasFilled);
+        t_Status = diffEventSubtreeHashes(
+            pt_Event, pt_Hashes, u32_HashesLength, pt_Diffs, pu32_DiffsLength);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Grow an Event
+ * Find the subtrees of an Event, which differ from another Event
  ******************************************************************************/
 
-ITC_Status_t ITC_Event_grow(
-    ITC_Event_t **ppt_Event,
-    const ITC_Id_t *const pt_Id
+ITC_Status_t ITC_Event_diffSubtrees(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Event)
+    if (!pt_Diffs || !pu32_DiffsLength)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateEvent(*ppt_Event, true);
+        t_Status = validateEvent(pt_Event1, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Validate the ID */
-        t_Status = ITC_Id_validate(pt_Id);
+        t_Status = validateEvent(pt_Event2, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = growEventE(ppt_Event, pt_Id);
+        t_Status = diffEventSubtrees(
+            pt_Event1, pt_Event2, pt_Diffs, pu32_DiffsLength);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 /******************************************************************************
  * Serialise an existing ITC Event
  ******************************************************************************/
@@ -2509,6 +6383,69 @@ ITC_Status_t ITC_SerDes_Util_serialiseEvent(
     return t_Status;
 }
 
+/******************************************************************************
+ * Calculate the size of a serialised ITC Event without serialising it
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_getSerialisedEventSize(
+    const ITC_Event_t *const pt_Event,
+    const bool b_AddVersion,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pu32_Size)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Measure without a buffer. Nothing is written, so any size fits */
+        *pu32_Size = UINT32_MAX;
+        t_Status = serialiseEvent(pt_Event, NULL, pu32_Size, b_AddVersion);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+/******************************************************************************
+ * Check whether a serialised ITC Event is path-compressed
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_isEventPathCompressed(
+    const ITC_Event_t *const pt_Event,
+    bool *const pb_IsPathCompressed
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pb_IsPathCompressed)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateEvent(pt_Event, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pb_IsPathCompressed = hasSerialisedEventPath(pt_Event);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
 /******************************************************************************
  * Deserialise an ITC Event
  ******************************************************************************/
@@ -2620,7 +6557,7 @@ ITC_Status_t ITC_SerDes_deserialiseEvent(
 
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
-#if IS_UNIT_TEST_BUILD
+#if IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH
 
 /******************************************************************************
  * Normalise an Event
@@ -2642,6 +6579,24 @@ ITC_Status_t ITC_Event_normalise(
     return t_Status;
 }
 
+#endif /* IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if IS_UNIT_TEST_BUILD
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/******************************************************************************
+ * Calculate the Merkle hash of an Event subtree
+ ******************************************************************************/
+
+uint64_t ITC_Event_calcSubtreeHash(
+    const ITC_Event_t *const pt_Event
+)
+{
+    return calcEventSubtreeHash(pt_Event);
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 /******************************************************************************
  * Maximise an Event
  ******************************************************************************/
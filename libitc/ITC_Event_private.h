@@ -13,6 +13,8 @@
 #include "ITC_Event.h"
 #include "ITC_Status.h"
 
+#include <stdint.h>
+
 
 /******************************************************************************
  * Defines
@@ -59,4 +61,142 @@
     (((pt_Event)->pt_Left->t_Count == 0) ||                                    \
     ((pt_Event)->pt_Right->t_Count == 0))))
 
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+
+/** Adds two event counters, saturating instead of overflowing
+ * @note Non-idempotent expressions, such as `myVar++` or `myVar--` will
+ * execute multiple times and can cause undefined behaviour
+*/
+#define ITC_EVENT_SATURATING_ADD(a, b)                                         \
+    (((b) > (((ITC_Event_Counter_t)~0) - (a))) ? ((ITC_Event_Counter_t)~0)     \
+                                               : ((a) + (b)))
+
+/** Calculates `max(e)` of the given `ITC_Event_t` from the memoised
+ * maximums of its children */
+#define ITC_EVENT_CALC_SUBTREE_MAX(pt_Event)                                   \
+    (ITC_EVENT_IS_LEAF_EVENT(pt_Event)                                         \
+         ? (pt_Event)->t_Count                                                 \
+         : ITC_EVENT_SATURATING_ADD(                                           \
+               (pt_Event)->t_Count,                                            \
+               MAX((pt_Event)->pt_Left->t_Max, (pt_Event)->pt_Right->t_Max)))
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+
+/** Checks whether the given `ITC_Event_t` is the shared read-only leaf Event.
+ * Such an Event is statically allocated and must never be modified or freed */
+#define ITC_EVENT_IS_SHARED_EVENT(pt_Event)                                    \
+    ((pt_Event) == &gt_ItcSharedEvent)
+
+/** Get a modifiable pointer to the shared read-only Event.
+ * See ::ITC_ID_SHARED_ID_PTR() */
+#define ITC_EVENT_SHARED_EVENT_PTR(t_SharedEvent)                              \
+    ((ITC_Event_t *)(uintptr_t)&(t_SharedEvent))
+
+#else
+
+/** Checks whether the given `ITC_Event_t` is the shared read-only leaf Event.
+ * There is none, so this is never the case */
+#define ITC_EVENT_IS_SHARED_EVENT(pt_Event)                             (false)
+
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+
+/** The maximum depth of an Event tree, which can be converted to an
+ * `ITC_Event_Steps_t`. Keeps the step starts within a `uint64_t` */
+#define ITC_EVENT_STEPS_MAX_DEPTH                                          (63U)
+
+/** The end of the Event interval in units of `2^-ITC_EVENT_STEPS_MAX_DEPTH` */
+#define ITC_EVENT_STEPS_END           (UINT64_C(1) << ITC_EVENT_STEPS_MAX_DEPTH)
+
+/** Get the end of a step of an `ITC_Event_Steps_t` */
+#define ITC_EVENT_STEPS_GET_END(pt_Function, u32_Index)                        \
+    (((u32_Index) + 1U < (pt_Function)->u32_Length)                            \
+         ? (pt_Function)->pt_Steps[(u32_Index) + 1U].u64_Start                 \
+         : ITC_EVENT_STEPS_END)
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
+#if ITC_CONFIG_ENABLE_EVENT_HASH || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH ||   \
+    ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/** The initial value of an Event hash (the first 64 bits of `frac(sqrt(2))`) */
+#define ITC_EVENT_HASH_SEED                       (UINT64_C(0x6A09E667F3BCC908))
+
+/** The odd constant added to the hash state before mixing in a value
+ * (the 64-bit golden ratio). Keeps the state away from the `0` fixed point */
+#define ITC_EVENT_HASH_GAMMA                      (UINT64_C(0x9E3779B97F4A7C15))
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH || ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/** The subtree hash of a leaf Event with a 0 counter, i.e. the hash of the
+ * shared read-only Event. See ::calcEventSubtreeHash() */
+#define ITC_EVENT_SHARED_EVENT_HASH               (UINT64_C(0xC217AC478E5D0150))
+
+/** The deepest level an `ITC_Event_SubtreeHash_t` can identify a subtree at.
+ * Keeps the subtree indices within a `uint64_t` */
+#define ITC_EVENT_SUBTREE_HASH_MAX_LEVEL                                   (63U)
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+/** The number of frames an explicit Event traversal stack can hold before it
+ * has to be moved to the heap. Normalised Event trees are rarely deeper */
+#define ITC_EVENT_TRAVERSAL_STACK_FIXED_LEN                                 (16)
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+/** The shared read-only leaf Event with a 0 counter.
+ * See ::ITC_Event_newShared() */
+extern const ITC_Event_t gt_ItcSharedEvent;
+
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+
+/******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/* The pointwise operation ::diffEventE() applies to the absolute counters */
+typedef enum
+{
+    /* `diff(n1, n2) = n1` if `n1 > n2`. Otherwise `0` */
+    ITC_EVENT_POINTWISE_OP_DIFF = 0,
+    /* `rebase(n1, n2) = n1 - n2` */
+    ITC_EVENT_POINTWISE_OP_REBASE = 1,
+    /* `add(n1, n2) = n1 + n2` */
+    ITC_EVENT_POINTWISE_OP_ADD = 2,
+} ITC_Event_PointwiseOp_t;
+
+/* A pending `leq(e1, e2)` check on an explicit traversal stack */
+typedef struct
+{
+    /** The current node of the first Event tree */
+    const ITC_Event_t *pt_Event1;
+    /** The current node of the second Event tree */
+    const ITC_Event_t *pt_Event2;
+    /** The event count from the root to the parent of `pt_Event1` */
+    ITC_Event_Counter_t t_ParentsCountEvent1;
+    /** The event count from the root to the parent of `pt_Event2` */
+    ITC_Event_Counter_t t_ParentsCountEvent2;
+} ITC_Event_LeqFrame_t;
+
+/* An explicit `leq` traversal stack, which starts out in a fixed size buffer
+ * and is moved to the heap only if the Event trees are unusually deep */
+typedef struct
+{
+    /** The frames. Points to either `rt_FixedFrames` or a heap buffer */
+    ITC_Event_LeqFrame_t *pt_Frames;
+    /** The capacity of `pt_Frames` */
+    uint32_t u32_Len;
+    /** The number of frames currently on the stack */
+    uint32_t u32_Top;
+    /** The initial fixed size buffer */
+    ITC_Event_LeqFrame_t rt_FixedFrames[ITC_EVENT_TRAVERSAL_STACK_FIXED_LEN];
+} ITC_Event_LeqStack_t;
+
 #endif /* ITC_EVENT_PRIVATE_H_ */
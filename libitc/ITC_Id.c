@@ -26,6 +26,31 @@
 #include "ITC_Port.h"
 
 #include <stdbool.h>
+#include <string.h>
+
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+
+/* The shared read-only NULL ID (0) */
+const ITC_Id_t gt_ItcSharedNullId = { NULL, NULL, 0 };
+
+/* The shared read-only seed ID (1) */
+const ITC_Id_t gt_ItcSharedSeedId = { NULL, NULL, ITC_ID_OWNER_FLAG };
+
+#else
+
+/* The shared read-only NULL ID (0) */
+const ITC_Id_t gt_ItcSharedNullId = { NULL, NULL, NULL, false };
+
+/* The shared read-only seed ID (1) */
+const ITC_Id_t gt_ItcSharedSeedId = { NULL, NULL, NULL, true };
+
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
 
 /******************************************************************************
  * Private functions
@@ -54,7 +79,7 @@ static ITC_Status_t validateId(
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
     /* Subtrees are considered invalid when coming through the public API */
-    else if (pt_Id->pt_Parent)
+    else if (ITC_ID_GET_PARENT(pt_Id))
     {
         t_Status = ITC_STATUS_CORRUPT_ID;
     }
@@ -67,7 +92,7 @@ static ITC_Status_t validateId(
          *  - Must be a leaf or a valid parent node
          *  - Must be a normalised ID node (if the check is enabled)
          */
-        if (pt_CurrentIdParent != pt_Id->pt_Parent ||
+        if (pt_CurrentIdParent != ITC_ID_GET_PARENT(pt_Id) ||
             (!ITC_ID_IS_LEAF_ID(pt_Id) &&
              !ITC_ID_IS_VALID_PARENT(pt_Id)) ||
             (b_CheckIsNormalised && !ITC_ID_IS_NORMALISED_ID(pt_Id)))
@@ -77,7 +102,7 @@ static ITC_Status_t validateId(
         else
         {
             /* Descend into left tree */
-            if (pt_Id->pt_Left)
+            if (ITC_ID_GET_LEFT(pt_Id))
             {
                 /* Remember the parent address */
                 pt_CurrentIdParent = pt_Id;
@@ -89,7 +114,7 @@ static ITC_Status_t validateId(
              * left subtree, which makes the tree invalid. Usually this will
              * be caught in the `if` at the beginning of the loop, but do check
              * again just in case */
-            else if (pt_Id->pt_Right)
+            else if (ITC_ID_GET_RIGHT(pt_Id))
             {
                 t_Status = ITC_STATUS_CORRUPT_ID;
             }
@@ -100,8 +125,8 @@ static ITC_Status_t validateId(
                 while (pt_CurrentIdParent &&
                        pt_CurrentIdParent->pt_Right == pt_Id)
                 {
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                    pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentIdParent);
                 }
 
                 /* There is a right subtree that has not been explored yet */
@@ -143,8 +168,8 @@ static ITC_Status_t newId(
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         /* Initialise members */
-        pt_Alloc->b_IsOwner = b_IsOwner;
-        pt_Alloc->pt_Parent = pt_Parent;
+        ITC_ID_SET_OWNER(pt_Alloc, b_IsOwner);
+        ITC_ID_SET_PARENT(pt_Alloc, pt_Parent);
         pt_Alloc->pt_Left = NULL;
         pt_Alloc->pt_Right = NULL;
 
@@ -160,6 +185,77 @@ static ITC_Status_t newId(
     return t_Status;
 }
 
+/**
+ * @brief Create a new ITC leaf ID as a child of an existing ID node
+ *
+ * If ::ITC_CONFIG_USE_COMPACT_ID_NODES is enabled, the leaf is stored as a
+ * tagged leaf ID in the child slot of its parent and no memory is allocated.
+ * Otherwise, this is the same as ::newId().
+ *
+ * @param ppt_Id (out) The pointer to the new ID. Must be the address of one of
+ * the children of `pt_Parent`
+ * @param pt_Parent The pointer to the parent ID in the tree
+ * @param b_IsOwner Whether the ID owns its interval or not.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newChildLeafId(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t *const pt_Parent,
+    const bool b_IsOwner
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    *ppt_Id = ITC_ID_NEW_TAGGED_LEAF(
+        pt_Parent, ppt_Id == &pt_Parent->pt_Right, b_IsOwner);
+
+    t_Status = ITC_STATUS_SUCCESS;
+#else
+    t_Status = newId(ppt_Id, pt_Parent, b_IsOwner);
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+
+    return t_Status;
+}
+
+/**
+ * @brief Create a new ITC leaf ID
+ *
+ * Same as ::newChildLeafId() if the leaf has a parent. Otherwise, the leaf is
+ * allocated with ::newId().
+ *
+ * @param ppt_Id (out) The pointer to the new ID. If `pt_Parent != NULL` this
+ * must be the address of one of its children
+ * @param pt_Parent The pointer to the parent ID in the tree. Otherwise NULL.
+ * @param b_IsOwner Whether the ID owns its interval or not.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newLeafId(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t *const pt_Parent,
+    const bool b_IsOwner
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    if (pt_Parent)
+    {
+        t_Status = newChildLeafId(ppt_Id, pt_Parent, b_IsOwner);
+    }
+    else
+    {
+        t_Status = newId(ppt_Id, NULL, b_IsOwner);
+    }
+#else
+    t_Status = newId(ppt_Id, pt_Parent, b_IsOwner);
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+
+    return t_Status;
+}
+
 /**
  * @brief Clone an existing ITC ID
  *
@@ -184,11 +280,19 @@ static ITC_Status_t cloneId(
     /* Init clone pointer */
     *ppt_ClonedId = NULL;
     /* Remember the parent of the root as this might be a subree */
-    pt_RootIdParent = pt_Id->pt_Parent;
+    pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
 
     /* Allocate the root */
-    t_Status = newId(
-        ppt_ClonedId, pt_ParentId, pt_Id->b_IsOwner);
+    if (ITC_ID_IS_LEAF_ID(pt_Id))
+    {
+        t_Status = newLeafId(
+            ppt_ClonedId, pt_ParentId, ITC_ID_IS_OWNER(pt_Id));
+    }
+    else
+    {
+        t_Status = newId(
+            ppt_ClonedId, pt_ParentId, ITC_ID_IS_OWNER(pt_Id));
+    }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -199,13 +303,25 @@ static ITC_Status_t cloneId(
     while(t_Status == ITC_STATUS_SUCCESS &&
             pt_Id != pt_RootIdParent)
     {
-        if (pt_Id->pt_Left && !pt_CurrentIdClone->pt_Left)
+        /* Leafs are never descended from, so `pt_CurrentIdClone` can only be
+         * a tagged leaf ID when there is nothing left to allocate for it */
+        if (ITC_ID_GET_LEFT(pt_Id) && !pt_CurrentIdClone->pt_Left)
         {
             /* Allocate left subtree */
-            t_Status = newId(
-                &pt_CurrentIdClone->pt_Left,
-                pt_CurrentIdClone,
-                pt_Id->pt_Left->b_IsOwner);
+            if (ITC_ID_IS_LEAF_ID(pt_Id->pt_Left))
+            {
+                t_Status = newChildLeafId(
+                    &pt_CurrentIdClone->pt_Left,
+                    pt_CurrentIdClone,
+                    ITC_ID_IS_OWNER(pt_Id->pt_Left));
+            }
+            else
+            {
+                t_Status = newId(
+                    &pt_CurrentIdClone->pt_Left,
+                    pt_CurrentIdClone,
+                    ITC_ID_IS_OWNER(pt_Id->pt_Left));
+            }
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
@@ -214,13 +330,23 @@ static ITC_Status_t cloneId(
                 pt_CurrentIdClone = pt_CurrentIdClone->pt_Left;
             }
         }
-        else if (pt_Id->pt_Right && !pt_CurrentIdClone->pt_Right)
+        else if (ITC_ID_GET_RIGHT(pt_Id) && !pt_CurrentIdClone->pt_Right)
         {
             /* Allocate right subtree */
-            t_Status = newId(
-                &pt_CurrentIdClone->pt_Right,
-                pt_CurrentIdClone,
-                pt_Id->pt_Right->b_IsOwner);
+            if (ITC_ID_IS_LEAF_ID(pt_Id->pt_Right))
+            {
+                t_Status = newChildLeafId(
+                    &pt_CurrentIdClone->pt_Right,
+                    pt_CurrentIdClone,
+                    ITC_ID_IS_OWNER(pt_Id->pt_Right));
+            }
+            else
+            {
+                t_Status = newId(
+                    &pt_CurrentIdClone->pt_Right,
+                    pt_CurrentIdClone,
+                    ITC_ID_IS_OWNER(pt_Id->pt_Right));
+            }
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
@@ -232,8 +358,8 @@ static ITC_Status_t cloneId(
         else
         {
             /* Go up the tree */
-            pt_Id = pt_Id->pt_Parent;
-            pt_CurrentIdClone = pt_CurrentIdClone->pt_Parent;
+            pt_Id = ITC_ID_GET_PARENT(pt_Id);
+            pt_CurrentIdClone = ITC_ID_GET_PARENT(pt_CurrentIdClone);
         }
     }
 
@@ -254,6 +380,10 @@ static ITC_Status_t cloneId(
  * Rules:
  *  - split(0) = (0, 0)`
  *
+ * @note If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is enabled and both IDs are roots
+ * (i.e. have no parents) they are set to the shared NULL ID and no memory is
+ * allocated.
+ *
  * @param ppt_Id1 (out) The first ID
  * @param pt_ParentId1 The parent of ID1. Otherwise NULL
  * @param ppt_Id2 (out) The second ID
@@ -273,11 +403,24 @@ static ITC_Status_t splitId0(
     *ppt_Id1 = NULL;
     *ppt_Id2 = NULL;
 
-    t_Status = newId(ppt_Id1, pt_ParentId1, false);
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    /* Root NULL IDs don't need their own nodes */
+    if (!pt_ParentId1 && !pt_ParentId2)
+    {
+        *ppt_Id1 = ITC_ID_SHARED_ID_PTR(gt_ItcSharedNullId);
+        *ppt_Id2 = ITC_ID_SHARED_ID_PTR(gt_ItcSharedNullId);
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+        t_Status = ITC_STATUS_SUCCESS;
+    }
+    else
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
     {
-        t_Status = newId(ppt_Id2, pt_ParentId2, false);
+        t_Status = newLeafId(ppt_Id1, pt_ParentId1, false);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = newLeafId(ppt_Id2, pt_ParentId2, false);
+        }
     }
 
     return t_Status;
@@ -288,59 +431,182 @@ static ITC_Status_t splitId0(
  * Rules
  *  - split(1) = ((1, 0), (0, 1))`
  *
+ * For a weighted split the second ID receives the rightmost
+ * `u32_Numerator / 2^u8_DenominatorLog2` of the seed interval and the first ID
+ * receives the rest. The fraction is expected to be reduced (i.e. an odd
+ * numerator). Each bit of the numerator adds one level to both IDs, so
+ * splitting with `1 / 2^1` is the regular `split(1)`.
+ *
  * @param ppt_Id1 (out) The first ID
  * @param pt_ParentId1 The parent of ID1. Otherwise NULL
  * @param ppt_Id2 (out) The second ID
  * @param pt_ParentId2 The parent of ID2. Otherwise NULL
+ * @param u32_Numerator The numerator of the share of the second ID
+ * @param u8_DenominatorLog2 The log2 of the denominator of the share of the
+ * second ID
  * @return ITC_Status_t
  */
 static ITC_Status_t splitId1(
     ITC_Id_t **ppt_Id1,
     ITC_Id_t *const pt_ParentId1,
     ITC_Id_t **ppt_Id2,
-    ITC_Id_t *const pt_ParentId2
+    ITC_Id_t *const pt_ParentId2,
+    uint32_t u32_Numerator,
+    uint8_t u8_DenominatorLog2
 )
 {
     ITC_Status_t t_Status; /* The current status */
+    /* Whether the second ID owns the right half of the current interval */
+    bool b_IsRightOwned;
 
     /* Init IDs */
     *ppt_Id1 = NULL;
     *ppt_Id2 = NULL;
 
-    /* Allocate the first root */
+    /* Allocate the roots */
     t_Status = newId(ppt_Id1, pt_ParentId1, false);
 
-    /* Allocate the children for the first root: (1, 0) */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newId(&(*ppt_Id1)->pt_Left, *ppt_Id1, true);
+        t_Status = newId(ppt_Id2, pt_ParentId2, false);
     }
-    if (t_Status == ITC_STATUS_SUCCESS)
+
+    /* Consume the share of the second ID one bit at a time. If the share is
+     * at least half of the current interval, the second ID owns the right
+     * half and the rest of its share is carved out of the left half.
+     * Otherwise, the first ID owns the left half and the share is carved out
+     * of the right half */
+    while (t_Status == ITC_STATUS_SUCCESS && u8_DenominatorLog2 > 1)
     {
-        t_Status = newId(&(*ppt_Id1)->pt_Right, *ppt_Id1, false);
+        u8_DenominatorLog2--;
+        b_IsRightOwned = (u32_Numerator >> u8_DenominatorLog2) != 0;
+        u32_Numerator &= ~((uint32_t)1 << u8_DenominatorLog2);
+
+        /* The half that is still shared is split further, so it needs its
+         * own nodes. The other half is a leaf */
+        if (b_IsRightOwned)
+        {
+            t_Status = newId(&(*ppt_Id1)->pt_Left, *ppt_Id1, false);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newChildLeafId(
+                    &(*ppt_Id1)->pt_Right, *ppt_Id1, false);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newId(&(*ppt_Id2)->pt_Left, *ppt_Id2, false);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newChildLeafId(
+                    &(*ppt_Id2)->pt_Right, *ppt_Id2, true);
+            }
+        }
+        else
+        {
+            t_Status = newChildLeafId(&(*ppt_Id1)->pt_Left, *ppt_Id1, true);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newId(&(*ppt_Id1)->pt_Right, *ppt_Id1, false);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newChildLeafId(
+                    &(*ppt_Id2)->pt_Left, *ppt_Id2, false);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = newId(&(*ppt_Id2)->pt_Right, *ppt_Id2, false);
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Descend into the half that is still shared */
+            if (b_IsRightOwned)
+            {
+                ppt_Id1 = &(*ppt_Id1)->pt_Left;
+                ppt_Id2 = &(*ppt_Id2)->pt_Left;
+            }
+            else
+            {
+                ppt_Id1 = &(*ppt_Id1)->pt_Right;
+                ppt_Id2 = &(*ppt_Id2)->pt_Right;
+            }
+        }
     }
 
-    /* Allocate the second root */
+    /* Allocate the children for the first root: (1, 0) */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newId(ppt_Id2, pt_ParentId2, false);
+        t_Status = newChildLeafId(&(*ppt_Id1)->pt_Left, *ppt_Id1, true);
+    }
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newChildLeafId(&(*ppt_Id1)->pt_Right, *ppt_Id1, false);
     }
 
     /* Allocate the children for the second root: (0, 1) */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newId(&(*ppt_Id2)->pt_Left, *ppt_Id2, false);
+        t_Status = newChildLeafId(&(*ppt_Id2)->pt_Left, *ppt_Id2, false);
     }
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newId(&(*ppt_Id2)->pt_Right, *ppt_Id2, true);
+        t_Status = newChildLeafId(&(*ppt_Id2)->pt_Right, *ppt_Id2, true);
     }
 
     return t_Status;
 }
 
 /**
- * @brief Splits an ID into 2 new IDs fulfilling `split(i)`
+ * @brief Validate and reduce the share of the second ID in a weighted split
+ *
+ * The share is the dyadic fraction `*pu32_Numerator / 2^*pu8_DenominatorLog2`.
+ * It must be strictly between 0 and 1. On success it is reduced to an odd
+ * numerator, so the split IDs are no deeper than needed.
+ *
+ * @param pu32_Numerator (in) The numerator. (out) The reduced numerator
+ * @param pu8_DenominatorLog2 (in) The log2 of the denominator. (out) The log2
+ * of the reduced denominator
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the share is not in the (0, 1) range
+ */
+static ITC_Status_t reduceSplitWeight(
+    uint32_t *const pu32_Numerator,
+    uint8_t *const pu8_DenominatorLog2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (*pu8_DenominatorLog2 < 1 ||
+        *pu8_DenominatorLog2 >= (sizeof(uint32_t) * 8) ||
+        *pu32_Numerator == 0 ||
+        *pu32_Numerator >= ((uint32_t)1 << *pu8_DenominatorLog2))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        while ((*pu32_Numerator & 1) == 0)
+        {
+            *pu32_Numerator >>= 1;
+            (*pu8_DenominatorLog2)--;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Splits an ID into 2 new IDs fulfilling a weighted `split(i)`
  * Rules:
  *  - split(0) = (0, 0)
  *  - split(1) = ((1, 0), (0, 1))
@@ -348,16 +614,25 @@ static ITC_Status_t splitId1(
  *  - split((i, 0)) = ((i1, 0), (i2, 0)), where (i1, i2) = split(i)
  *  - split((i1, i2)) = ((i1, 0), (0, i2))
  *
+ * The weight only changes `split(1)`, which gives the second ID the rightmost
+ * `u32_Numerator / 2^u8_DenominatorLog2` of the seed interval (see
+ * ::splitId1()). The resulting IDs are normalised.
+ *
  * @param pt_Id The existing ID
  * @param ppt_Id1 The first ID
  * @param ppt_Id2 The second ID
+ * @param u32_Numerator The reduced numerator of the share of the second ID
+ * @param u8_DenominatorLog2 The log2 of the reduced denominator of the share
+ * of the second ID
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t splitIdI(
+static ITC_Status_t splitIdWeightedI(
     const ITC_Id_t *pt_Id,
     ITC_Id_t **ppt_Id1,
-    ITC_Id_t **ppt_Id2
+    ITC_Id_t **ppt_Id2,
+    const uint32_t u32_Numerator,
+    const uint8_t u8_DenominatorLog2
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
@@ -370,7 +645,7 @@ static ITC_Status_t splitIdI(
     const ITC_Id_t *pt_CurrentIdParent;
 
     /* Remember the parent of the root as this might be a subtree */
-    pt_CurrentIdParent = pt_Id->pt_Parent;
+    pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_Id);
 
     /* Init the new IDs */
     *ppt_CurrentId1 = NULL;
@@ -389,7 +664,7 @@ static ITC_Status_t splitIdI(
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
-                pt_Id = pt_Id->pt_Parent;
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
             }
         }
         /* split(1) = ((1, 0), (0, 1)) */
@@ -399,11 +674,13 @@ static ITC_Status_t splitIdI(
                 ppt_CurrentId1,
                 pt_ParentCurrentId1,
                 ppt_CurrentId2,
-                pt_ParentCurrentId2);
+                pt_ParentCurrentId2,
+                u32_Numerator,
+                u8_DenominatorLog2);
 
             if (t_Status == ITC_STATUS_SUCCESS)
             {
-                pt_Id = pt_Id->pt_Parent;
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
             }
         }
         /* split(0, i), split(i, 0), split(i1, i2) */
@@ -437,14 +714,14 @@ static ITC_Status_t splitIdI(
                     if (ITC_ID_IS_LEAF_ID(*ppt_CurrentId1) &&
                         ITC_ID_IS_LEAF_ID(*ppt_CurrentId2))
                     {
-                        t_Status = newId(
+                        t_Status = newChildLeafId(
                             &(*ppt_CurrentId1)->pt_Left,
                             *ppt_CurrentId1,
                             false);
 
                         if(t_Status == ITC_STATUS_SUCCESS)
                         {
-                            t_Status = newId(
+                            t_Status = newChildLeafId(
                                 &(*ppt_CurrentId2)->pt_Left,
                                 *ppt_CurrentId2,
                                 false);
@@ -471,7 +748,7 @@ static ITC_Status_t splitIdI(
                      */
                     else
                     {
-                        pt_Id = pt_Id->pt_Parent;
+                        pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     }
                 }
                 /* split((i, 0)) = ((i1, 0), (i2, 0)), where (i1, i2) = split(i)
@@ -484,14 +761,14 @@ static ITC_Status_t splitIdI(
                     if (ITC_ID_IS_LEAF_ID(*ppt_CurrentId1) &&
                         ITC_ID_IS_LEAF_ID(*ppt_CurrentId2))
                     {
-                        t_Status = newId(
+                        t_Status = newChildLeafId(
                             &(*ppt_CurrentId1)->pt_Right,
                             *ppt_CurrentId1,
                             false);
 
                         if(t_Status == ITC_STATUS_SUCCESS)
                         {
-                            t_Status = newId(
+                            t_Status = newChildLeafId(
                                 &(*ppt_CurrentId2)->pt_Right,
                                 *ppt_CurrentId2,
                                 false);
@@ -518,13 +795,13 @@ static ITC_Status_t splitIdI(
                      */
                     else
                     {
-                        pt_Id = pt_Id->pt_Parent;
+                        pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     }
                 }
                 /* split((i1, i2)) = ((i1, 0), (0, i2)) */
                 else
                 {
-                    t_Status = newId(
+                    t_Status = newChildLeafId(
                         &(*ppt_CurrentId1)->pt_Right,
                         *ppt_CurrentId1,
                         false);
@@ -539,7 +816,7 @@ static ITC_Status_t splitIdI(
 
                     if (t_Status == ITC_STATUS_SUCCESS)
                     {
-                        t_Status = newId(
+                        t_Status = newChildLeafId(
                             &(*ppt_CurrentId2)->pt_Left,
                             *ppt_CurrentId2,
                             false);
@@ -555,7 +832,7 @@ static ITC_Status_t splitIdI(
 
                     if (t_Status == ITC_STATUS_SUCCESS)
                     {
-                        pt_Id = pt_Id->pt_Parent;
+                        pt_Id = ITC_ID_GET_PARENT(pt_Id);
                     }
                 }
             }
@@ -575,25 +852,53 @@ static ITC_Status_t splitIdI(
     return t_Status;
 }
 
+/**
+ * @brief Splits an ID into 2 new IDs fulfilling `split(i)`
+ * Same as ::splitIdWeightedI() with an even weight
+ *
+ * @param pt_Id The existing ID
+ * @param ppt_Id1 The first ID
+ * @param ppt_Id2 The second ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t splitIdI(
+    const ITC_Id_t *pt_Id,
+    ITC_Id_t **ppt_Id1,
+    ITC_Id_t **ppt_Id2
+)
+{
+    return splitIdWeightedI(pt_Id, ppt_Id1, ppt_Id2, 1, 1);
+}
+
 /**
  * @brief Normalise a (1, 1) or (0, 0) ID
  *
  * @note It is assumed the child ID nodes are leafs, have not bee freed and
  * and have the same ownership - i.e (1, 1) or (0, 0)
  *
- * @param pt_Id The ID on which to perform the operation
- * children
+ * If ::ITC_CONFIG_USE_COMPACT_ID_NODES is enabled and the ID has a parent,
+ * the ID node is freed and replaced with a tagged leaf ID in its parent.
+ *
+ * @param ppt_Id (in) The ID on which to perform the operation. (out) The
+ * normalised ID
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t normId11Or00(
-    ITC_Id_t *pt_Id
+    ITC_Id_t **ppt_Id
 )
 {
     ITC_Status_t t_Status; /* The current status */
+    ITC_Id_t *pt_Id = *ppt_Id; /* The ID node */
+    /* Whether the normalised ID owns its interval */
+    const bool b_IsOwner = ITC_ID_IS_OWNER(pt_Id->pt_Left);
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    ITC_Id_t *pt_Parent = ITC_ID_GET_PARENT(pt_Id); /* The parent ID node */
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
 
     /* Update the ownership */
-    pt_Id->b_IsOwner = pt_Id->pt_Left->b_IsOwner;
+    ITC_ID_SET_OWNER(pt_Id, b_IsOwner);
 
     /* Destroy the left leaf child */
     t_Status = ITC_Id_destroy(&pt_Id->pt_Left);
@@ -604,6 +909,27 @@ static ITC_Status_t normId11Or00(
         t_Status = ITC_Id_destroy(&pt_Id->pt_Right);
     }
 
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    /* Hold the normalised leaf in its parent instead */
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Parent)
+    {
+        if (pt_Parent->pt_Left == pt_Id)
+        {
+            pt_Parent->pt_Left =
+                ITC_ID_NEW_TAGGED_LEAF(pt_Parent, false, b_IsOwner);
+            *ppt_Id = pt_Parent->pt_Left;
+        }
+        else
+        {
+            pt_Parent->pt_Right =
+                ITC_ID_NEW_TAGGED_LEAF(pt_Parent, true, b_IsOwner);
+            *ppt_Id = pt_Parent->pt_Right;
+        }
+
+        t_Status = ITC_Port_free(pt_Id);
+    }
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+
     return t_Status;
 }
 
@@ -615,21 +941,23 @@ static ITC_Status_t normId11Or00(
  *  - norm(1, 1) = 1
  *  - norm(i) = i
  *
- * @param pt_Id The ID to normalise
+ * @param ppt_Id (in) The ID to normalise. (out) The normalised ID. This only
+ * changes if the ID is a subtree, which is replaced with a tagged leaf ID
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t normIdI(
-    ITC_Id_t *pt_Id
+    ITC_Id_t **ppt_Id
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_Id = *ppt_Id; /* The current ID */
 
     /* Remember the parent as this might be a subtree */
-    const ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent;
+    const ITC_Id_t *pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
 
     /* Start from the left most child */
-    while (pt_Id->pt_Left)
+    while (ITC_ID_GET_LEFT(pt_Id))
     {
         pt_Id = pt_Id->pt_Left;
     }
@@ -638,20 +966,20 @@ static ITC_Status_t normIdI(
     while(t_Status == ITC_STATUS_SUCCESS && pt_Id)
     {
         /* If pt_Id is the root node (no parent) - break */
-        if(pt_Id->pt_Parent == pt_RootIdParent)
+        if(ITC_ID_GET_PARENT(pt_Id) == pt_RootIdParent)
         {
             pt_Id = NULL;
         }
         /* If pt_Id is the right child of its parent */
-        else if (pt_Id->pt_Parent->pt_Right == pt_Id)
+        else if (ITC_ID_GET_PARENT(pt_Id)->pt_Right == pt_Id)
         {
-            pt_Id = pt_Id->pt_Parent;
+            pt_Id = ITC_ID_GET_PARENT(pt_Id);
         }
         /* Current pt_Id is the left child of its parent */
         else
         {
             /* Go to the right child of the pt_Id parent */
-            pt_Id = pt_Id->pt_Parent->pt_Right;
+            pt_Id = ITC_ID_GET_PARENT(pt_Id)->pt_Right;
 
             /* Find the left most node */
             while (pt_Id && ITC_ID_IS_PARENT_ID(pt_Id))
@@ -665,7 +993,16 @@ static ITC_Status_t normIdI(
         /* norm(1, 1) = 1 or norm(0, 0) = 0 */
         if (ITC_ID_IS_SEED_SEED_ID(pt_Id) || ITC_ID_IS_NULL_NULL_ID(pt_Id))
         {
-            t_Status = normId11Or00(pt_Id);
+            /* The root of the subtree might get replaced */
+            if (ITC_ID_GET_PARENT(pt_Id) == pt_RootIdParent)
+            {
+                t_Status = normId11Or00(ppt_Id);
+                pt_Id = *ppt_Id;
+            }
+            else
+            {
+                t_Status = normId11Or00(&pt_Id);
+            }
         }
     }
 
@@ -682,13 +1019,16 @@ static ITC_Status_t normIdI(
  * @param pt_Id1 The first ID
  * @param pt_Id2 The second ID
  * @param ppt_Id The new ID
+ * @param b_Normalise Whether to normalise the new ID. If `false` the `norm`
+ * step of the rules above is skipped
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
 static ITC_Status_t sumIdI(
     const ITC_Id_t *pt_Id1,
     const ITC_Id_t *pt_Id2,
-    ITC_Id_t **ppt_Id
+    ITC_Id_t **ppt_Id,
+    const bool b_Normalise
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
@@ -702,8 +1042,8 @@ static ITC_Status_t sumIdI(
     *ppt_CurrentId = NULL;
 
     /* Remember the root parent as this might be a subtree */
-    pt_RootId1Parent = pt_Id1->pt_Parent;
-    pt_RootId2Parent = pt_Id2->pt_Parent;
+    pt_RootId1Parent = ITC_ID_GET_PARENT(pt_Id1);
+    pt_RootId2Parent = ITC_ID_GET_PARENT(pt_Id2);
 
     while(t_Status == ITC_STATUS_SUCCESS &&
           pt_Id1 != pt_RootId1Parent &&
@@ -745,21 +1085,24 @@ static ITC_Status_t sumIdI(
                 /* Normalise ID and climb back to parent */
                 else
                 {
-                    /* Normalise ID.
-                    * This may destroy all child nodes stored under
-                    * *ppt_CurrentId
-                    */
-                    t_Status = normIdI(*ppt_CurrentId);
+                    if (b_Normalise)
+                    {
+                        /* Normalise ID.
+                         * This may destroy all child nodes stored under
+                         * *ppt_CurrentId or replace it with a tagged leaf ID
+                         */
+                        t_Status = normIdI(ppt_CurrentId);
+                    }
 
                     if (t_Status == ITC_STATUS_SUCCESS)
                     {
                         /* Save the parent pointer on the stack */
-                        pt_CurrentIdParent = (*ppt_CurrentId)->pt_Parent;
+                        pt_CurrentIdParent = ITC_ID_GET_PARENT(*ppt_CurrentId);
 
                         /* Climb back to the parent node */
                         ppt_CurrentId = &pt_CurrentIdParent;
-                        pt_Id1 = pt_Id1->pt_Parent;
-                        pt_Id2 = pt_Id2->pt_Parent;
+                        pt_Id1 = ITC_ID_GET_PARENT(pt_Id1);
+                        pt_Id2 = ITC_ID_GET_PARENT(pt_Id2);
                     }
                 }
             }
@@ -774,13 +1117,13 @@ static ITC_Status_t sumIdI(
             {
                 /* Climb back to the parent node
                 * Use the parent pointer saved on the stack instead of
-                * `(*ppt_CurrentId)->pt_Parent` as that will be the child
+                * the parent of `*ppt_CurrentId` as that will be the child
                 * element on the next iteration and may get destroyed by
                 * `normIdI`
                 */
                 ppt_CurrentId = &pt_CurrentIdParent;
-                pt_Id1 = pt_Id1->pt_Parent;
-                pt_Id2 = pt_Id2->pt_Parent;
+                pt_Id1 = ITC_ID_GET_PARENT(pt_Id1);
+                pt_Id2 = ITC_ID_GET_PARENT(pt_Id2);
             }
         }
         /* sum(i, 0) = i */
@@ -794,13 +1137,13 @@ static ITC_Status_t sumIdI(
             {
                 /* Climb back to the parent node
                 * Use the parent pointer saved on the stack instead of
-                * `(*ppt_CurrentId)->pt_Parent` as that will be the child
+                * the parent of `*ppt_CurrentId` as that will be the child
                 * element on the next iteration and may get destroyed by
                 * `normIdI`
                 */
                 ppt_CurrentId = &pt_CurrentIdParent;
-                pt_Id1 = pt_Id1->pt_Parent;
-                pt_Id2 = pt_Id2->pt_Parent;
+                pt_Id1 = ITC_ID_GET_PARENT(pt_Id1);
+                pt_Id2 = ITC_ID_GET_PARENT(pt_Id2);
             }
         }
         else
@@ -822,739 +1165,3307 @@ static ITC_Status_t sumIdI(
 }
 
 /**
- * @brief Serialise an existing ITC Id
+ * @brief Split an ID into a balanced set of parts
  *
- * Data format:
- *  - Byte 0: The major component of the version of the `libitc` library used to
- *      serialise the data. Optional, can be ommitted.
- *  - Bytes (0 - 1) - N (see above): The ID tree.
- *    Each node of the ID tree is serialised in pre-order. I.e the root is
- *    serialised first, followed by the left child, then the right child. Each
- *    node consists of a 1-byte header.
- *    See:
- *    - define ITC_SERDES_PARENT_ID_HEADER
- *    - define ITC_SERDES_SEED_ID_HEADER
- *    - define ITC_SERDES_NULL_ID_HEADER
- *    Any other header value is invalid.
+ * The ID is halved recursively, giving the extra part of an odd split to the
+ * left half, until it is split into `u32_PartsCount` parts. Each part is at
+ * most `ceil(log2(u32_PartsCount))` levels deeper than the ID.
  *
- * @param ppt_Id The pointer to the Id
- * @param pu8_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
- * the output.
- * of the data inside the buffer in bytes.
+ * @note The ID is taken over and becomes one of the parts. On failure all
+ * parts, including the ID, are deallocated.
+ *
+ * @param pt_Id The ID to split
+ * @param u32_PartsCount The number of parts to split the ID into
+ * @param ppt_Ids (out) The parts of the ID, counting from the left
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
  */
-static ITC_Status_t serialiseId(
-    const ITC_Id_t *pt_Id,
-    uint8_t *const pu8_Buffer,
-    uint32_t *const pu32_BufferSize,
-    const bool b_AddVersion
+static ITC_Status_t splitIdN(
+    ITC_Id_t *const pt_Id,
+    const uint32_t u32_PartsCount,
+    ITC_Id_t **ppt_Ids
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
-    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
-    uint32_t u32_Offset = 0; /* The current offset */
-
-    /* Remember the root parent as this might be a subtree */
-    pt_RootIdParent = pt_Id->pt_Parent;
-
-    if (b_AddVersion)
+    ITC_Id_t *pt_LeftId;
+    /* The start of the current subinterval of the balanced split */
+    uint32_t u32_Start;
+    /* The number of parts in the current subinterval of the balanced split */
+    uint32_t u32_Count;
+    /* The number of parts in the left half of the current subinterval */
+    uint32_t u32_LeftCount;
+    uint32_t u32_I;
+
+    for (u32_I = 1; u32_I < u32_PartsCount; u32_I++)
     {
-        /* Prepend the lib version (provided by build system c args) */
-        pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
-
-        /* Increment offset */
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
+        ppt_Ids[u32_I] = NULL;
     }
 
-    /* Perform a pre-order traversal */
-    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
+    /* The first part starts out owning the whole ID */
+    ppt_Ids[0] = pt_Id;
+    u32_I = 0;
+
+    /* Split the ID in place. When it is reached, each part owns the largest
+     * subinterval of the balanced split that starts with it. Keep handing the
+     * right half of it over to the part the right half starts with, until the
+     * part owns a single subinterval */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_PartsCount)
     {
-        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
-        {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-        }
-        else
-        {
-            /* Create the header */
-            pu8_Buffer[u32_Offset] =
-                (ITC_ID_IS_LEAF_ID(pt_Id))
-                    ? ((pt_Id->b_IsOwner) ? ITC_SERDES_SEED_ID_HEADER
-                                          : ITC_SERDES_NULL_ID_HEADER)
-                    : ITC_SERDES_PARENT_ID_HEADER;
+        u32_Start = 0;
+        u32_Count = u32_PartsCount;
 
-            /* Increment the offset */
-            u32_Offset += sizeof(ITC_SerDes_Header_t);
+        /* Find the largest subinterval starting with the part */
+        while (u32_Start != u32_I)
+        {
+            u32_LeftCount = u32_Count - (u32_Count / 2);
 
-            /* Descend into left tree */
-            if (pt_Id->pt_Left)
+            if (u32_I < u32_Start + u32_LeftCount)
             {
-                pt_Id = pt_Id->pt_Left;
+                u32_Count = u32_LeftCount;
             }
-            /* Valid parent ITC ID trees always have both left and right
-            * nodes. Thus, there is no need to check if the current node
-            * doesn't have a left child but has a right one.
-            *
-            * Instead directly start backtracking up the tree */
             else
             {
-                /* Remember the parent */
-                pt_CurrentIdParent = pt_Id->pt_Parent;
+                u32_Start += u32_LeftCount;
+                u32_Count -= u32_LeftCount;
+            }
+        }
 
-                /* Loop until the current element is no longer reachable
-                * through the parent's right child */
-                while (pt_CurrentIdParent != pt_RootIdParent &&
-                    pt_CurrentIdParent->pt_Right == pt_Id)
-                {
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
-                }
+        while (t_Status == ITC_STATUS_SUCCESS && u32_Count > 1)
+        {
+            u32_LeftCount = u32_Count - (u32_Count / 2);
 
-                /* There is a right subtree that has not been explored yet */
-                if (pt_CurrentIdParent != pt_RootIdParent)
-                {
-                    pt_Id = pt_CurrentIdParent->pt_Right;
-                }
-                else
-                {
-                    pt_Id = NULL;
-                }
+            t_Status = splitIdI(
+                ppt_Ids[u32_I], &pt_LeftId, &ppt_Ids[u32_I + u32_LeftCount]);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* There is nothing else to do if the destroy fails. Also it
+                 * is more important to convey the result of the split */
+                (void)ITC_Id_destroy(&ppt_Ids[u32_I]);
+                ppt_Ids[u32_I] = pt_LeftId;
             }
+
+            u32_Count = u32_LeftCount;
         }
+
+        u32_I++;
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status != ITC_STATUS_SUCCESS)
     {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the original reason for the failure */
+        for (u32_I = 0; u32_I < u32_PartsCount; u32_I++)
+        {
+            (void)ITC_Id_destroy(&ppt_Ids[u32_I]);
+        }
     }
 
     return t_Status;
 }
 
-#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
-
 /**
- * @brief Serialise an existing ITC Id to ASCII string
+ * @brief Check whether two IDs have the same tree
  *
- * @param ppt_Id The pointer to the Id
- * @param pc_Buffer The buffer to hold the serialised data
- * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
- * of the data inside the buffer in bytes.
- * @return `ITC_Status_t` The status of the operation
- * @retval `ITC_STATUS_SUCCESS` on success
- * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ * Performs a lockstep pre-order traversal, which stops at the first node
+ * where the trees differ.
+ *
+ * @param pt_Id1 The first ID
+ * @param pt_Id2 The second ID
+ * @return `true` if the IDs are equal. Otherwise `false`
  */
-static ITC_Status_t serialiseIdToString(
-    const ITC_Id_t *pt_Id,
-    char *const pc_Buffer,
-    uint32_t *const pu32_BufferSize
+static bool isIdEqual(
+    const ITC_Id_t *pt_Id1,
+    const ITC_Id_t *pt_Id2
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The current ID node */
-    const ITC_Id_t *pt_RootIdParent = pt_Id->pt_Parent; /* The root parent */
-    uint32_t u32_Offset = 0;
-
-    /* Ensure there is at least space for the NULL termination */
-    if (*pu32_BufferSize < 1)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
+    bool b_IsEqual = true;
+    /* Save the root so the traversal does not climb past it */
+    const ITC_Id_t *const pt_RootId1 = pt_Id1;
 
-    /* Perform a pre-order traversal */
-    while (t_Status == ITC_STATUS_SUCCESS && pt_Id)
+    while (b_IsEqual && pt_Id1)
     {
-        /* Check there is space left in the buffer, taking into account the
-         * NULL termination byte and opening bracket/ownership indicator */
-        if (u32_Offset >= (*pu32_BufferSize - 1))
+        if ((ITC_ID_IS_LEAF_ID(pt_Id1) != ITC_ID_IS_LEAF_ID(pt_Id2)) ||
+            (!ITC_ID_IS_OWNER(pt_Id1) != !ITC_ID_IS_OWNER(pt_Id2)))
         {
-            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            b_IsEqual = false;
+        }
+        /* Descend into left tree */
+        else if (ITC_ID_GET_LEFT(pt_Id1))
+        {
+            pt_Id1 = pt_Id1->pt_Left;
+            pt_Id2 = pt_Id2->pt_Left;
         }
         else
         {
-            if (ITC_ID_IS_PARENT_ID(pt_Id))
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child. The trees are equal up to
+             * this node, so both can be climbed in lockstep */
+            while (pt_Id1 != pt_RootId1 &&
+                   ITC_ID_GET_PARENT(pt_Id1)->pt_Right == pt_Id1)
             {
-                /* Open a bracket to signify a parent node */
-                pc_Buffer[u32_Offset] = '(';
+                pt_Id1 = ITC_ID_GET_PARENT(pt_Id1);
+                pt_Id2 = ITC_ID_GET_PARENT(pt_Id2);
             }
-            else if (pt_Id->b_IsOwner)
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Id1 != pt_RootId1)
             {
-                pc_Buffer[u32_Offset] = '1';
+                pt_Id1 = ITC_ID_GET_PARENT(pt_Id1)->pt_Right;
+                pt_Id2 = ITC_ID_GET_PARENT(pt_Id2)->pt_Right;
             }
             else
             {
-                pc_Buffer[u32_Offset] = '0';
+                pt_Id1 = NULL;
             }
+        }
+    }
 
-            /* Increment offset */
-            u32_Offset++;
+    return b_IsEqual;
+}
 
-            /* Descend into left tree */
-            if (pt_Id->pt_Left)
-            {
-                /* Remember the parent address */
-                pt_CurrentIdParent = pt_Id;
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
 
-                pt_Id = pt_Id->pt_Left;
-            }
-            /* Valid parent ITC Id trees always have both left and right
-             * nodes. Thus, there is no need to check if the current node
-             * doesn't have a left child but has a right one.
-             *
-             * Instead directly start backtracking up the tree */
-            else
-            {
-                /* Loop until the current element is no longer reachable
-                 * through the parent's right child */
-                while (t_Status == ITC_STATUS_SUCCESS &&
-                       pt_CurrentIdParent != pt_RootIdParent &&
-                       pt_CurrentIdParent->pt_Right == pt_Id)
-                {
-                    pt_Id = pt_Id->pt_Parent;
-                    pt_CurrentIdParent = pt_CurrentIdParent->pt_Parent;
+/**
+ * @brief Get the child through which an ID path continues
+ *
+ * An ID path node is a parent node, which has a leaf null ID as one of its
+ * children and a non-null ID as the other one. I.e. `(0, i)` or `(i, 0)`.
+ *
+ * @param pt_Id The ID node
+ * @return `const ITC_Id_t *` The non-null child or `NULL` if `pt_Id` is not
+ * a path node
+ */
+static const ITC_Id_t *getIdPathContinuation(
+    const ITC_Id_t *const pt_Id
+)
+{
+    const ITC_Id_t *pt_Continuation = NULL;
 
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte and bracket */
-                    if (u32_Offset >= (*pu32_BufferSize - 1))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Close the current parent node bracket */
-                        pc_Buffer[u32_Offset] = ')';
-                        u32_Offset++;
-                    }
-                }
+    if (ITC_ID_IS_PARENT_ID(pt_Id))
+    {
+        if (ITC_ID_IS_NULL_ID(pt_Id->pt_Left) &&
+            !ITC_ID_IS_NULL_ID(pt_Id->pt_Right))
+        {
+            pt_Continuation = pt_Id->pt_Right;
+        }
+        else if (ITC_ID_IS_NULL_ID(pt_Id->pt_Right) &&
+                 !ITC_ID_IS_NULL_ID(pt_Id->pt_Left))
+        {
+            pt_Continuation = pt_Id->pt_Left;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
 
-                /* There is a right subtree that has not been explored yet */
-                if (t_Status == ITC_STATUS_SUCCESS &&
-                    pt_CurrentIdParent != pt_RootIdParent)
-                {
-                    pt_Id = pt_CurrentIdParent->pt_Right;
+    return pt_Continuation;
+}
 
-                    /* Check there is space left in the buffer, taking into
-                     * account the NULL termination byte, comma and space */
-                    if (u32_Offset >= (*pu32_BufferSize - 2))
-                    {
-                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
-                    }
-                    else
-                    {
-                        /* Add a comma to signify the start of a new node */
-                        pc_Buffer[u32_Offset] = ',';
-                        u32_Offset++;
+/**
+ * @brief Check whether an ID node is serialised as part of a path
+ *
+ * Only chains of at least `ITC_SERDES_PATH_MIN_LEN` path nodes are
+ * serialised as paths.
+ *
+ * @param pt_Id The ID node
+ * @param pt_RootIdParent The parent of the root of the serialised (sub)tree
+ * @return `true` if the node is part of a serialised path
+ */
+static bool isSerialisedIdPathNode(
+    const ITC_Id_t *const pt_Id,
+    const ITC_Id_t *const pt_RootIdParent
+)
+{
+    const ITC_Id_t *pt_Continuation = getIdPathContinuation(pt_Id);
 
-                        /* Add a space between nodes */
-                        pc_Buffer[u32_Offset] = ' ';
-                        u32_Offset++;
-                    }
-                }
-                else
-                {
-                    pt_Id = NULL;
-                }
-            }
-        }
-    }
+    return pt_Continuation &&
+           (getIdPathContinuation(pt_Continuation) ||
+            (ITC_ID_GET_PARENT(pt_Id) != pt_RootIdParent &&
+             getIdPathContinuation(ITC_ID_GET_PARENT(pt_Id)) == pt_Id));
+}
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+/**
+ * @brief Check whether serialising an ID produces at least one path
+ *
+ * @param pt_Id The ID
+ * @return `true` if any part of the ID is serialised as a path
+ */
+static bool hasSerialisedIdPath(
+    const ITC_Id_t *pt_Id
+)
+{
+    /* The parent of the current ID */
+    const ITC_Id_t *pt_CurrentIdParent = NULL;
+    /* The parent of the root node */
+    const ITC_Id_t *pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
+    bool b_HasPath = false;
+
+    /* Perform a pre-order traversal until the first path is found */
+    while (pt_Id && !b_HasPath)
     {
-        /* Ensure the string is always NULL-termiated */
-        pc_Buffer[u32_Offset] = '\0';
-        u32_Offset++;
-    }
+        b_HasPath = isSerialisedIdPathNode(pt_Id, pt_RootIdParent);
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* Return the size of the data in the buffer */
-        *pu32_BufferSize = u32_Offset;
+        /* Descend into left tree */
+        if (ITC_ID_GET_LEFT(pt_Id))
+        {
+            pt_Id = pt_Id->pt_Left;
+        }
+        else
+        {
+            /* Remember the parent */
+            pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_Id);
+
+            /* Loop until the current element is no longer reachable
+             * through the parent's right child */
+            while (pt_CurrentIdParent != pt_RootIdParent &&
+                   pt_CurrentIdParent->pt_Right == pt_Id)
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentIdParent);
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_CurrentIdParent != pt_RootIdParent)
+            {
+                pt_Id = pt_CurrentIdParent->pt_Right;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
     }
 
-    return t_Status;
+    return b_HasPath;
 }
 
-#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
-
 /**
- * @brief Deserialise an ITC Id
+ * @brief Serialise a chain of ID path nodes as a single path
  *
- * For the expected data format see ::serialiseId()
+ * See ::ITC_SERDES_PATH_ID_HEADER for the data format.
  *
- * @param pu8_Buffer The buffer holding the serialised Id data
+ * @param ppt_Id (in) The first node of the path. (out) The node following
+ * the serialised path
+ * @param pu8_Buffer The buffer to hold the serialised data. If NULL, only the
+ * offset is advanced
  * @param u32_BufferSize The size of the buffer in bytes
- * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
- * serialised input
- * @param ppt_Id The pointer to the deserialised Id
+ * @param pu32_Offset (in) The offset to serialise the path at. (out) The
+ * offset following the serialised path
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
  */
-static ITC_Status_t deserialiseId(
-    const uint8_t *const pu8_Buffer,
+static ITC_Status_t serialiseIdPath(
+    const ITC_Id_t **ppt_Id,
+    uint8_t *const pu8_Buffer,
     const uint32_t u32_BufferSize,
-    const bool b_HasVersion,
-    ITC_Id_t **ppt_Id
+    uint32_t *const pu32_Offset
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t **ppt_CurrentId = NULL; /* The current ID */
-    ITC_Id_t *pt_CurrentIdParent = NULL;
-    uint32_t u32_Offset = 0; /* The current offset */
+    const ITC_Id_t *pt_Id = *ppt_Id;
+    uint8_t *pu8_Bitmap;
+    uint32_t u32_PathSize;
+    uint8_t u8_PathLen = 0;
 
-    *ppt_Id = NULL;
-    ppt_CurrentId = ppt_Id;
+    /* Find the length of the path */
+    while (u8_PathLen < ITC_SERDES_PATH_MAX_LEN && getIdPathContinuation(pt_Id))
+    {
+        pt_Id = getIdPathContinuation(pt_Id);
+        u8_PathLen++;
+    }
 
-    /* If input contains a version check it matches the current lib version
-     * (provided by build system c args) */
-    if (b_HasVersion)
+    u32_PathSize = sizeof(ITC_SerDes_Header_t) + ITC_SERDES_PATH_LEN_LEN +
+                   ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen);
+
+    if ((*pu32_Offset + u32_PathSize) > u32_BufferSize)
     {
-        if (pu8_Buffer[u32_Offset] != ITC_VERSION_MAJOR)
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else if (!pu8_Buffer)
+    {
+        *ppt_Id = pt_Id;
+        *pu32_Offset += u32_PathSize;
+    }
+    else
+    {
+        pu8_Buffer[*pu32_Offset] = ITC_SERDES_PATH_ID_HEADER;
+        pu8_Buffer[*pu32_Offset + sizeof(ITC_SerDes_Header_t)] = u8_PathLen;
+
+        pu8_Bitmap = &pu8_Buffer[
+            *pu32_Offset + sizeof(ITC_SerDes_Header_t) +
+            ITC_SERDES_PATH_LEN_LEN];
+        memset(pu8_Bitmap, 0, ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen));
+
+        /* Create the bitmap */
+        pt_Id = *ppt_Id;
+        for (uint8_t u8_I = 0; u8_I < u8_PathLen; u8_I++)
         {
-            t_Status = ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
+            if (getIdPathContinuation(pt_Id) == pt_Id->pt_Right)
+            {
+                ITC_SERDES_PATH_SET_BIT(pu8_Bitmap, u8_I);
+            }
+
+            pt_Id = getIdPathContinuation(pt_Id);
         }
 
-        u32_Offset += ITC_VERSION_MAJOR_LEN;
+        *ppt_Id = pt_Id;
+        *pu32_Offset += u32_PathSize;
     }
 
-    /* The last serialised node cannot be a parent */
-    if (t_Status == ITC_STATUS_SUCCESS &&
-        pu8_Buffer[u32_BufferSize - 1] == ITC_SERDES_PARENT_ID_HEADER)
+    return t_Status;
+}
+
+/**
+ * @brief Deserialise an ID path
+ *
+ * See ::ITC_SERDES_PATH_ID_HEADER for the data format.
+ *
+ * @param pu8_Buffer The buffer holding the serialised path, excluding its
+ * header
+ * @param u32_BufferSize The size of the remaining data in the buffer in bytes
+ * @param ppt_Id The pointer to where the path should be attached
+ * @param pt_Parent The parent of the path. Otherwise NULL
+ * @param ppt_LastPathNode (out) The last node of the path. Its non-null child
+ * is left unallocated
+ * @param pu32_PathSize (out) The size of the serialised path in bytes,
+ * excluding its header
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t deserialiseIdPath(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t *pt_Parent,
+    ITC_Id_t **ppt_LastPathNode,
+    uint32_t *const pu32_PathSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const uint8_t *pu8_Bitmap = &pu8_Buffer[ITC_SERDES_PATH_LEN_LEN];
+    uint8_t u8_PathLen = 0;
+
+    /* The path must be followed by at least one more node */
+    if (u32_BufferSize <= ITC_SERDES_PATH_LEN_LEN ||
+        pu8_Buffer[0] == 0 ||
+        (ITC_SERDES_PATH_LEN_LEN + ITC_SERDES_PATH_BITMAP_LEN(pu8_Buffer[0])) >=
+            u32_BufferSize)
     {
         t_Status = ITC_STATUS_CORRUPT_ID;
     }
+    else
+    {
+        u8_PathLen = pu8_Buffer[0];
+    }
 
-    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    for (uint8_t u8_I = 0;
+         u8_I < u8_PathLen && t_Status == ITC_STATUS_SUCCESS;
+         u8_I++)
     {
-        /* Deserialise a parent ID node */
-        if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        t_Status = newId(ppt_Id, pt_Parent, false);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
         {
-            t_Status = newId(ppt_CurrentId, pt_CurrentIdParent, false);
+            pt_Parent = *ppt_Id;
+
+            /* Allocate the null child and continue through the other one */
+            if (ITC_SERDES_PATH_GET_BIT(pu8_Bitmap, u8_I))
+            {
+                t_Status = newChildLeafId(
+                    &pt_Parent->pt_Left, pt_Parent, false);
+                ppt_Id = &pt_Parent->pt_Right;
+            }
+            else
+            {
+                t_Status = newChildLeafId(
+                    &pt_Parent->pt_Right, pt_Parent, false);
+                ppt_Id = &pt_Parent->pt_Left;
+            }
         }
-        /* Deserialise a leaf ID node */
-        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
-                 pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *ppt_LastPathNode = pt_Parent;
+        *pu32_PathSize =
+            ITC_SERDES_PATH_LEN_LEN + ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+/**
+ * @brief Serialise an existing ITC Id
+ *
+ * Data format:
+ *  - Byte 0: The major component of the version of the `libitc` library used to
+ *      serialise the data. Optional, can be ommitted.
+ *  - Bytes (0 - 1) - N (see above): The ID tree.
+ *    Each node of the ID tree is serialised in pre-order. I.e the root is
+ *    serialised first, followed by the left child, then the right child. Each
+ *    node consists of a 1-byte header.
+ *    See:
+ *    - define ITC_SERDES_PARENT_ID_HEADER
+ *    - define ITC_SERDES_SEED_ID_HEADER
+ *    - define ITC_SERDES_NULL_ID_HEADER
+ *    - define ITC_SERDES_PATH_ID_HEADER (if
+ *      `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is enabled)
+ *    Any other header value is invalid.
+ *
+ * @param ppt_Id The pointer to the Id
+ * @param pu8_Buffer The buffer to hold the serialised data. If NULL, nothing
+ * is written and only the size of the serialised data is calculated
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @param b_AddVersion Whether to prepend the value of `ITC_VERSION_MAJOR` to
+ * the output.
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t serialiseId(
+    const ITC_Id_t *pt_Id,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize,
+    const bool b_AddVersion
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The parent of the current ID*/
+    const ITC_Id_t *pt_RootIdParent = NULL; /* The parent of the root node */
+    uint32_t u32_Offset = 0; /* The current offset */
+
+    /* Remember the root parent as this might be a subtree */
+    pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
+
+    if (b_AddVersion)
+    {
+        if (pu8_Buffer)
         {
-            t_Status = newId(
-                ppt_CurrentId,
-                pt_CurrentIdParent,
-                (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER) ? false
-                                                                      : true);
+            /* Prepend the lib version (provided by build system c args) */
+            pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
         }
-        /* Unknown node header value */
-        else
+
+        /* Increment offset */
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    /* Perform a pre-order traversal */
+    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) > *pu32_BufferSize)
         {
-            t_Status = ITC_STATUS_CORRUPT_ID;
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
         }
-
-        if (t_Status == ITC_STATUS_SUCCESS)
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+        /* Serialise the whole path and continue from the node following it */
+        else if (isSerialisedIdPathNode(pt_Id, pt_RootIdParent))
         {
-            /* Get ready for the next header:
-             *
-             * - If the current header was a parent - descend into left child
-             * - If the current header was a leaf - find the first unallocated
-             *   right child node
-             */
-            if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+            t_Status = serialiseIdPath(
+                &pt_Id, pu8_Buffer, *pu32_BufferSize, &u32_Offset);
+        }
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+        else
+        {
+            if (pu8_Buffer)
             {
-                pt_CurrentIdParent = *ppt_CurrentId;
-                ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+                /* Create the header */
+                pu8_Buffer[u32_Offset] =
+                    (ITC_ID_IS_LEAF_ID(pt_Id))
+                        ? (ITC_ID_IS_OWNER(pt_Id) ? ITC_SERDES_SEED_ID_HEADER
+                                                  : ITC_SERDES_NULL_ID_HEADER)
+                        : ITC_SERDES_PARENT_ID_HEADER;
+            }
+
+            /* Increment the offset */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+            /* Descend into left tree */
+            if (ITC_ID_GET_LEFT(pt_Id))
+            {
+                pt_Id = pt_Id->pt_Left;
             }
+            /* Valid parent ITC ID trees always have both left and right
+            * nodes. Thus, there is no need to check if the current node
+            * doesn't have a left child but has a right one.
+            *
+            * Instead directly start backtracking up the tree */
             else
             {
-                /* Backtrack the tree until an unallocated right child is found
-                 * or there are no more parent nodes */
-                while (pt_CurrentIdParent && pt_CurrentIdParent->pt_Right)
-                {
-                    ppt_CurrentId = &pt_CurrentIdParent;
-                    pt_CurrentIdParent = (*ppt_CurrentId)->pt_Parent;
-                }
+                /* Remember the parent */
+                pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_Id);
 
-                /* Descend into the unallocated right child of the parent */
-                if (pt_CurrentIdParent)
+                /* Loop until the current element is no longer reachable
+                * through the parent's right child. The null children of
+                * serialised paths are already part of the path */
+                while (pt_CurrentIdParent != pt_RootIdParent &&
+                    (pt_CurrentIdParent->pt_Right == pt_Id
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+                     || isSerialisedIdPathNode(
+                            pt_CurrentIdParent, pt_RootIdParent)
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+                     ))
                 {
-                    ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                    pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentIdParent);
                 }
-                /* There aren't any unallocated right child nodes in the tree.
-                 *
-                 * Usually this would signal the end of the loop as the only
-                 * time this should happen is when the full input buffer has
-                 * been deserialised (i.e.`u32_NextOffset == u32_BufferSize`),
-                 * since the tree is serialised in a pre-order traversal fasion.
-                 *
-                 * However, if the input buffer is malformed in some way it is
-                 * possible that there are elements in it that havent't been
-                 * deserialised yet (i.e. `u32_NextOffset < u32_BufferSize`).
-                 *
-                 * This should be treated as error as otherwise the user might
-                 * not get the expected (or full) ID tree. */
-                else if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) <
-                         u32_BufferSize)
+
+                /* There is a right subtree that has not been explored yet */
+                if (pt_CurrentIdParent != pt_RootIdParent)
                 {
-                    t_Status = ITC_STATUS_CORRUPT_ID;
+                    pt_Id = pt_CurrentIdParent->pt_Right;
                 }
                 else
                 {
-                    /* Nothing to do */
+                    pt_Id = NULL;
                 }
             }
-
-            /* Get the next header */
-            u32_Offset += sizeof(ITC_SerDes_Header_t);
         }
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Check the deserialised ID is valid */
-        t_Status = validateId(*ppt_Id, true);
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
+
+/**
+ * @brief Serialise an existing ITC Id to ASCII string
+ *
+ * @param ppt_Id The pointer to the Id
+ * @param pc_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+static ITC_Status_t serialiseIdToString(
+    const ITC_Id_t *pt_Id,
+    char *const pc_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_t *pt_CurrentIdParent = NULL; /* The current ID node */
+    /* The root parent */
+    const ITC_Id_t *pt_RootIdParent = ITC_ID_GET_PARENT(pt_Id);
+    uint32_t u32_Offset = 0;
+
+    /* Ensure there is at least space for the NULL termination */
+    if (*pu32_BufferSize < 1)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Perform a pre-order traversal */
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Id)
+    {
+        /* Check there is space left in the buffer, taking into account the
+         * NULL termination byte and opening bracket/ownership indicator */
+        if (u32_Offset >= (*pu32_BufferSize - 1))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        else
+        {
+            if (ITC_ID_IS_PARENT_ID(pt_Id))
+            {
+                /* Open a bracket to signify a parent node */
+                pc_Buffer[u32_Offset] = '(';
+            }
+            else if (ITC_ID_IS_OWNER(pt_Id))
+            {
+                pc_Buffer[u32_Offset] = '1';
+            }
+            else
+            {
+                pc_Buffer[u32_Offset] = '0';
+            }
+
+            /* Increment offset */
+            u32_Offset++;
+
+            /* Descend into left tree */
+            if (ITC_ID_GET_LEFT(pt_Id))
+            {
+                /* Remember the parent address */
+                pt_CurrentIdParent = pt_Id;
+
+                pt_Id = pt_Id->pt_Left;
+            }
+            /* Valid parent ITC Id trees always have both left and right
+             * nodes. Thus, there is no need to check if the current node
+             * doesn't have a left child but has a right one.
+             *
+             * Instead directly start backtracking up the tree */
+            else
+            {
+                /* Loop until the current element is no longer reachable
+                 * through the parent's right child */
+                while (t_Status == ITC_STATUS_SUCCESS &&
+                       pt_CurrentIdParent != pt_RootIdParent &&
+                       pt_CurrentIdParent->pt_Right == pt_Id)
+                {
+                    pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                    pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentIdParent);
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte and bracket */
+                    if (u32_Offset >= (*pu32_BufferSize - 1))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Close the current parent node bracket */
+                        pc_Buffer[u32_Offset] = ')';
+                        u32_Offset++;
+                    }
+                }
+
+                /* There is a right subtree that has not been explored yet */
+                if (t_Status == ITC_STATUS_SUCCESS &&
+                    pt_CurrentIdParent != pt_RootIdParent)
+                {
+                    pt_Id = pt_CurrentIdParent->pt_Right;
+
+                    /* Check there is space left in the buffer, taking into
+                     * account the NULL termination byte, comma and space */
+                    if (u32_Offset >= (*pu32_BufferSize - 2))
+                    {
+                        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+                    }
+                    else
+                    {
+                        /* Add a comma to signify the start of a new node */
+                        pc_Buffer[u32_Offset] = ',';
+                        u32_Offset++;
+
+                        /* Add a space between nodes */
+                        pc_Buffer[u32_Offset] = ' ';
+                        u32_Offset++;
+                    }
+                }
+                else
+                {
+                    pt_Id = NULL;
+                }
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Ensure the string is always NULL-termiated */
+        pc_Buffer[u32_Offset] = '\0';
+        u32_Offset++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the size of the data in the buffer */
+        *pu32_BufferSize = u32_Offset;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API */
+
+/**
+ * @brief Deserialise an ITC Id
+ *
+ * For the expected data format see ::serialiseId()
+ *
+ * @param pu8_Buffer The buffer holding the serialised Id data
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param b_HasVersion Whether the `ITC_VERSION_MAJOR` field is present in the
+ * serialised input
+ * @param ppt_Id The pointer to the deserialised Id
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is path-compressed
+ * but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
+ */
+static ITC_Status_t deserialiseId(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    const bool b_HasVersion,
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_CurrentId = NULL; /* The current ID */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    uint32_t u32_Offset = 0; /* The current offset */
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    uint32_t u32_PathSize = 0; /* The size of a serialised path */
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+    *ppt_Id = NULL;
+    ppt_CurrentId = ppt_Id;
+
+    /* If input contains a version check it matches the current lib version
+     * (provided by build system c args) */
+    if (b_HasVersion)
+    {
+        if (pu8_Buffer[u32_Offset] != ITC_VERSION_MAJOR)
+        {
+            t_Status = ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION;
+        }
+
+        u32_Offset += ITC_VERSION_MAJOR_LEN;
+    }
+
+    /* The last serialised node cannot be a parent */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        pu8_Buffer[u32_BufferSize - 1] == ITC_SERDES_PARENT_ID_HEADER)
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+
+    while (u32_Offset < u32_BufferSize && t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Deserialise a parent ID node */
+        if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+        {
+            t_Status = newId(ppt_CurrentId, pt_CurrentIdParent, false);
+        }
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+        /* Deserialise a root leaf ID node. Use the shared leaf IDs as
+         * there is nothing else to attach to the tree */
+        else if (!pt_CurrentIdParent &&
+                 (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
+                  pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER))
+        {
+            *ppt_CurrentId =
+                (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER)
+                    ? ITC_ID_SHARED_ID_PTR(gt_ItcSharedNullId)
+                    : ITC_ID_SHARED_ID_PTR(gt_ItcSharedSeedId);
+        }
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+        /* Deserialise a leaf ID node */
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER ||
+                 pu8_Buffer[u32_Offset] == ITC_SERDES_SEED_ID_HEADER)
+        {
+            t_Status = newLeafId(
+                ppt_CurrentId,
+                pt_CurrentIdParent,
+                (pu8_Buffer[u32_Offset] == ITC_SERDES_NULL_ID_HEADER) ? false
+                                                                      : true);
+        }
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+        /* Deserialise an ID path */
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_PATH_ID_HEADER)
+        {
+            t_Status = deserialiseIdPath(
+                &pu8_Buffer[u32_Offset + sizeof(ITC_SerDes_Header_t)],
+                u32_BufferSize - u32_Offset - sizeof(ITC_SerDes_Header_t),
+                ppt_CurrentId,
+                pt_CurrentIdParent,
+                &pt_CurrentIdParent,
+                &u32_PathSize);
+        }
+#else
+        /* ID paths cannot be deserialised by this build */
+        else if (pu8_Buffer[u32_Offset] == ITC_SERDES_PATH_ID_HEADER)
+        {
+            t_Status = ITC_STATUS_SERDES_UNSUPPORTED_FORMAT;
+        }
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+        /* Unknown node header value */
+        else
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Get ready for the next header:
+             *
+             * - If the current header was a parent - descend into left child
+             * - If the current header was a leaf - find the first unallocated
+             *   right child node
+             */
+            if (pu8_Buffer[u32_Offset] == ITC_SERDES_PARENT_ID_HEADER)
+            {
+                pt_CurrentIdParent = *ppt_CurrentId;
+                ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+            }
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+            /* If the current header was a path - descend into the unallocated
+             * child of the last path node */
+            else if (pu8_Buffer[u32_Offset] == ITC_SERDES_PATH_ID_HEADER)
+            {
+                ppt_CurrentId = (pt_CurrentIdParent->pt_Left)
+                                    ? &pt_CurrentIdParent->pt_Right
+                                    : &pt_CurrentIdParent->pt_Left;
+
+                /* Skip the path length and bitmap */
+                u32_Offset += u32_PathSize;
+            }
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+            else
+            {
+                /* Backtrack the tree until an unallocated right child is found
+                 * or there are no more parent nodes */
+                while (pt_CurrentIdParent && pt_CurrentIdParent->pt_Right)
+                {
+                    ppt_CurrentId = &pt_CurrentIdParent;
+                    pt_CurrentIdParent = ITC_ID_GET_PARENT(*ppt_CurrentId);
+                }
+
+                /* Descend into the unallocated right child of the parent */
+                if (pt_CurrentIdParent)
+                {
+                    ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                }
+                /* There aren't any unallocated right child nodes in the tree.
+                 *
+                 * Usually this would signal the end of the loop as the only
+                 * time this should happen is when the full input buffer has
+                 * been deserialised (i.e.`u32_NextOffset == u32_BufferSize`),
+                 * since the tree is serialised in a pre-order traversal fasion.
+                 *
+                 * However, if the input buffer is malformed in some way it is
+                 * possible that there are elements in it that havent't been
+                 * deserialised yet (i.e. `u32_NextOffset < u32_BufferSize`).
+                 *
+                 * This should be treated as error as otherwise the user might
+                 * not get the expected (or full) ID tree. */
+                else if ((u32_Offset + sizeof(ITC_SerDes_Header_t)) <
+                         u32_BufferSize)
+                {
+                    t_Status = ITC_STATUS_CORRUPT_ID;
+                }
+                else
+                {
+                    /* Nothing to do */
+                }
+            }
+
+            /* Get the next header */
+            u32_Offset += sizeof(ITC_SerDes_Header_t);
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Check the deserialised ID is valid */
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the deserialisation failed, rather than the
+         * destroy */
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+
+/**
+ * @brief Validate an existing bitmap ITC ID
+ *
+ * @param pt_Bitmap The bitmap ID to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateIdBitmap(
+    const ITC_Id_Bitmap_t *const pt_Bitmap
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Bitmap)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    /* Bitmaps shorter than a word must not use the rest of it */
+    else if (pt_Bitmap->ru64_Words[0] &
+             ~ITC_ID_BITMAP_RANGE_MASK(0U, (uint32_t)ITC_ID_BITMAP_LEN))
+    {
+        t_Status = ITC_STATUS_CORRUPT_ID;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Check whether a dyadic range of a bitmap ID is (not) owned
+ *
+ * @param pt_Bitmap The bitmap ID
+ * @param u32_Start The first subinterval of the range
+ * @param u32_Len The number of subintervals in the range. Must be a power of 2
+ * and `u32_Start` must be a multiple of it
+ * @param pb_IsNull (out) Whether none of the range is owned
+ * @param pb_IsSeed (out) Whether all of the range is owned
+ */
+static void getIdBitmapRangeOwnership(
+    const ITC_Id_Bitmap_t *const pt_Bitmap,
+    const uint32_t u32_Start,
+    const uint32_t u32_Len,
+    bool *const pb_IsNull,
+    bool *const pb_IsSeed
+)
+{
+    const uint64_t u64_Mask = ITC_ID_BITMAP_RANGE_MASK(u32_Start, u32_Len);
+    uint64_t u64_Any = 0;
+    uint64_t u64_All = u64_Mask;
+
+    for (uint32_t u32_I = ITC_ID_BITMAP_RANGE_START_WORD(u32_Start);
+         u32_I < ITC_ID_BITMAP_RANGE_END_WORD(u32_Start, u32_Len);
+         u32_I++)
+    {
+        u64_Any |= pt_Bitmap->ru64_Words[u32_I] & u64_Mask;
+        u64_All &= pt_Bitmap->ru64_Words[u32_I];
+    }
+
+    *pb_IsNull = !u64_Any;
+    *pb_IsSeed = (u64_All == u64_Mask);
+}
+
+/**
+ * @brief Move the ownership of a dyadic range from one bitmap ID to another
+ *
+ * @param pt_Bitmap The bitmap ID to move the range from. If `NULL`, the range
+ * is only marked as owned in `pt_OtherBitmap`
+ * @param pt_OtherBitmap The bitmap ID to move the range to
+ * @param u32_Start The first subinterval of the range
+ * @param u32_Len The number of subintervals in the range. Must be a power of 2
+ * and `u32_Start` must be a multiple of it
+ */
+static void moveIdBitmapRange(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_Bitmap_t *const pt_OtherBitmap,
+    const uint32_t u32_Start,
+    const uint32_t u32_Len
+)
+{
+    const uint64_t u64_Mask = ITC_ID_BITMAP_RANGE_MASK(u32_Start, u32_Len);
+
+    for (uint32_t u32_I = ITC_ID_BITMAP_RANGE_START_WORD(u32_Start);
+         u32_I < ITC_ID_BITMAP_RANGE_END_WORD(u32_Start, u32_Len);
+         u32_I++)
+    {
+        if (pt_Bitmap)
+        {
+            pt_OtherBitmap->ru64_Words[u32_I] |=
+                pt_Bitmap->ru64_Words[u32_I] & u64_Mask;
+            pt_Bitmap->ru64_Words[u32_I] &= ~u64_Mask;
+        }
+        else
+        {
+            pt_OtherBitmap->ru64_Words[u32_I] |= u64_Mask;
+        }
+    }
+}
+
+/**
+ * @brief Convert an ITC ID tree into a bitmap ID
+ *
+ * Performs a pre-order traversal, while keeping track of the level and index
+ * (within the level) of the current node. Right children always have odd
+ * indices.
+ *
+ * @param pt_Id The ID to convert
+ * @param pt_Bitmap (out) The bitmap ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID is deeper than
+ * `ITC_CONFIG_ID_BITMAP_DEPTH`
+ */
+static ITC_Status_t idToBitmap(
+    const ITC_Id_t *pt_Id,
+    ITC_Id_Bitmap_t *const pt_Bitmap
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Level = 0; /* The level of the current node */
+    uint32_t u32_Index = 0; /* The index of the current node in its level */
+    uint32_t u32_Len; /* The number of subintervals under the current node */
+
+    memset(pt_Bitmap, 0, sizeof(*pt_Bitmap));
+
+    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (ITC_ID_IS_PARENT_ID(pt_Id))
+        {
+            /* The smallest subintervals cannot be split any further */
+            if (u32_Level == ITC_CONFIG_ID_BITMAP_DEPTH)
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            /* Descend into left tree */
+            else
+            {
+                pt_Id = pt_Id->pt_Left;
+                u32_Level++;
+                u32_Index <<= 1U;
+            }
+        }
+        else
+        {
+            if (ITC_ID_IS_OWNER(pt_Id))
+            {
+                u32_Len = (uint32_t)ITC_ID_BITMAP_LEN >> u32_Level;
+                moveIdBitmapRange(
+                    NULL, pt_Bitmap, u32_Index * u32_Len, u32_Len);
+            }
+
+            /* Loop until the current node is no longer a right child */
+            while (u32_Level > 0 && (u32_Index & 1U))
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                u32_Level--;
+                u32_Index >>= 1U;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (u32_Level > 0)
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id)->pt_Right;
+                u32_Index++;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Allocate a new normalised ITC ID tree from a bitmap ID
+ *
+ * @param pt_Bitmap The bitmap ID
+ * @param ppt_Id (out) The ID tree
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newIdFromBitmap(
+    const ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_CurrentId = ppt_Id; /* The current ID */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    uint32_t u32_Level = 0; /* The level of the current node */
+    uint32_t u32_Index = 0; /* The index of the current node in its level */
+    uint32_t u32_Len; /* The number of subintervals under the current node */
+    bool b_IsNull;
+    bool b_IsSeed;
+
+    *ppt_Id = NULL;
+
+    while (ppt_CurrentId && t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_Len = (uint32_t)ITC_ID_BITMAP_LEN >> u32_Level;
+
+        getIdBitmapRangeOwnership(
+            pt_Bitmap, u32_Index * u32_Len, u32_Len, &b_IsNull, &b_IsSeed);
+
+        /* Only partially owned ranges need a parent node. A single
+         * subinterval is always either owned or not */
+        if (!b_IsNull && !b_IsSeed)
+        {
+            t_Status = newId(ppt_CurrentId, pt_CurrentIdParent, false);
+        }
+        else
+        {
+            t_Status = newLeafId(ppt_CurrentId, pt_CurrentIdParent, b_IsSeed);
+        }
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into left tree */
+        else if (!b_IsNull && !b_IsSeed)
+        {
+            pt_CurrentIdParent = *ppt_CurrentId;
+            ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+            u32_Level++;
+            u32_Index <<= 1U;
+        }
+        else
+        {
+            /* Loop until the current node is no longer a right child */
+            while (u32_Level > 0 && (u32_Index & 1U))
+            {
+                pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentIdParent);
+                u32_Level--;
+                u32_Index >>= 1U;
+            }
+
+            /* Descend into the unallocated right child of the parent */
+            if (u32_Level > 0)
+            {
+                ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                u32_Index++;
+            }
+            else
+            {
+                ppt_CurrentId = NULL;
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the conversion failed, rather than the
+         * destroy */
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Split a bitmap ID
+ *
+ * Follows the same rules as ::splitIdI(). I.e. descends into the only owned
+ * half of the range until both halves are (partially) owned or the whole
+ * range is owned and then gives away the right half.
+ *
+ * @param pt_Bitmap (in) The bitmap ID to split. (out) The first half
+ * @param pt_OtherBitmap (out) The second half
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a single subinterval needs to
+ * be split
+ */
+static ITC_Status_t splitIdBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_Bitmap_t *const pt_OtherBitmap
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_Start = 0; /* The first subinterval of the current range */
+    uint32_t u32_Len = (uint32_t)ITC_ID_BITMAP_LEN; /* The range length */
+    bool b_IsSplit = false;
+    bool b_IsNull;
+    bool b_IsSeed;
+
+    memset(pt_OtherBitmap, 0, sizeof(*pt_OtherBitmap));
+
+    while (!b_IsSplit && t_Status == ITC_STATUS_SUCCESS)
+    {
+        getIdBitmapRangeOwnership(
+            pt_Bitmap, u32_Start, u32_Len, &b_IsNull, &b_IsSeed);
+
+        /* split(0) = (0, 0) */
+        if (b_IsNull)
+        {
+            b_IsSplit = true;
+        }
+        /* The smallest subintervals cannot be split any further */
+        else if (b_IsSeed && u32_Len == 1)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        else
+        {
+            u32_Len >>= 1U;
+
+            /* Check whether the left half is owned */
+            getIdBitmapRangeOwnership(
+                pt_Bitmap, u32_Start, u32_Len, &b_IsNull, &b_IsSeed);
+
+            /* split((0, i)) = ((0, i1), (0, i2)) */
+            if (b_IsNull)
+            {
+                u32_Start += u32_Len;
+            }
+            else
+            {
+                /* Check whether the right half is owned */
+                getIdBitmapRangeOwnership(
+                    pt_Bitmap,
+                    u32_Start + u32_Len,
+                    u32_Len,
+                    &b_IsNull,
+                    &b_IsSeed);
+
+                /* split((i, 0)) = ((i1, 0), (i2, 0)) */
+                if (b_IsNull)
+                {
+                    /* Nothing to do */
+                }
+                /* split(1) = ((1, 0), (0, 1))
+                 * split((i1, i2)) = ((i1, 0), (0, i2)) */
+                else
+                {
+                    moveIdBitmapRange(
+                        pt_Bitmap,
+                        pt_OtherBitmap,
+                        u32_Start + u32_Len,
+                        u32_Len);
+                    b_IsSplit = true;
+                }
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Sum two bitmap IDs
+ *
+ * @param pt_Bitmap (in) The first bitmap ID. (out) The summed bitmap ID
+ * @param pt_OtherBitmap The second bitmap ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the IDs overlap
+ */
+static ITC_Status_t sumIdBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    const ITC_Id_Bitmap_t *const pt_OtherBitmap
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint64_t u64_Overlap = 0;
+
+    for (uint32_t u32_I = 0; u32_I < ITC_ID_BITMAP_WORDS; u32_I++)
+    {
+        u64_Overlap |=
+            pt_Bitmap->ru64_Words[u32_I] & pt_OtherBitmap->ru64_Words[u32_I];
+    }
+
+    if (u64_Overlap)
+    {
+        t_Status = ITC_STATUS_OVERLAPPING_ID_INTERVAL;
+    }
+    else
+    {
+        for (uint32_t u32_I = 0; u32_I < ITC_ID_BITMAP_WORDS; u32_I++)
+        {
+            pt_Bitmap->ru64_Words[u32_I] |= pt_OtherBitmap->ru64_Words[u32_I];
+        }
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+/**
+ * @brief Allocate the subintervals of a sorted dyadic interval ITC ID
+ *
+ * @param pt_Intervals (out) The interval ID. Its length is set to 0
+ * @param u32_Capacity The number of subintervals to allocate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newIdIntervals(
+    ITC_Id_Intervals_t *const pt_Intervals,
+    const uint32_t u32_Capacity
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    pt_Intervals->pt_Intervals = NULL;
+    pt_Intervals->u32_Length = 0;
+
+    /* The null ID does not own any subintervals */
+    if (u32_Capacity > 0)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&pt_Intervals->pt_Intervals,
+            u32_Capacity * sizeof(ITC_Id_Interval_t));
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Sanitise pointer */
+            pt_Intervals->pt_Intervals = NULL;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Deallocate the subintervals of a sorted dyadic interval ITC ID
+ *
+ * @param pt_Intervals The interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t destroyIdIntervals(
+    ITC_Id_Intervals_t *const pt_Intervals
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Intervals->pt_Intervals)
+    {
+        t_Status = ITC_Port_free(pt_Intervals->pt_Intervals);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Intervals->pt_Intervals = NULL;
+        pt_Intervals->u32_Length = 0;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Append a subinterval to a sorted dyadic interval ITC ID
+ *
+ * Coalesces the new subinterval with its preceding siblings, so the interval
+ * ID stays normalised.
+ *
+ * @param pt_Intervals The interval ID. Must have enough capacity for one more
+ * subinterval
+ * @param pt_Interval The subinterval to append. Must not start before the end
+ * of the last subinterval of the interval ID
+ */
+static void appendIdInterval(
+    ITC_Id_Intervals_t *const pt_Intervals,
+    const ITC_Id_Interval_t *const pt_Interval
+)
+{
+    ITC_Id_Interval_t *pt_Last;
+
+    pt_Intervals->pt_Intervals[pt_Intervals->u32_Length++] = *pt_Interval;
+    pt_Last = &pt_Intervals->pt_Intervals[pt_Intervals->u32_Length - 1];
+
+    /* norm((1, 1)) = 1 */
+    while (pt_Intervals->u32_Length > 1 &&
+           ITC_ID_INTERVALS_ARE_SIBLINGS(pt_Last - 1, pt_Last))
+    {
+        pt_Last--;
+        pt_Last->u8_Depth--;
+        pt_Last->u64_Position >>= 1U;
+        pt_Intervals->u32_Length--;
+    }
+}
+
+/**
+ * @brief Collect the owned subintervals of an ITC ID tree
+ *
+ * Performs a pre-order traversal, while keeping track of the level and index
+ * (within the level) of the current node. Thus, the owned subintervals are
+ * visited in ascending order. Right children always have odd indices.
+ *
+ * @param pt_Id The ID
+ * @param pt_Intervals (out) The interval ID. Must have enough capacity for
+ * all owned subintervals. If `NULL`, the owned subintervals are only counted
+ * @param pu32_Length (out) The number of owned subintervals
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID is deeper than
+ * `ITC_ID_INTERVAL_MAX_DEPTH`
+ */
+static ITC_Status_t collectIdIntervals(
+    const ITC_Id_t *pt_Id,
+    ITC_Id_Intervals_t *const pt_Intervals,
+    uint32_t *const pu32_Length
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_Interval_t t_Interval = { 0 }; /* The current node interval */
+
+    *pu32_Length = 0;
+
+    while (pt_Id && t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (ITC_ID_IS_PARENT_ID(pt_Id))
+        {
+            /* The smallest subintervals cannot be split any further */
+            if (t_Interval.u8_Depth == ITC_ID_INTERVAL_MAX_DEPTH)
+            {
+                t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+            }
+            /* Descend into left tree */
+            else
+            {
+                pt_Id = pt_Id->pt_Left;
+                t_Interval.u8_Depth++;
+                t_Interval.u64_Position <<= 1U;
+            }
+        }
+        else
+        {
+            if (ITC_ID_IS_OWNER(pt_Id))
+            {
+                if (pt_Intervals)
+                {
+                    appendIdInterval(pt_Intervals, &t_Interval);
+                }
+
+                (*pu32_Length)++;
+            }
+
+            /* Loop until the current node is no longer a right child */
+            while (t_Interval.u8_Depth > 0 && (t_Interval.u64_Position & 1U))
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                t_Interval.u8_Depth--;
+                t_Interval.u64_Position >>= 1U;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (t_Interval.u8_Depth > 0)
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id)->pt_Right;
+                t_Interval.u64_Position++;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Convert an ITC ID tree into a sorted dyadic interval ID
+ *
+ * @param pt_Id The ID to convert
+ * @param pt_Intervals (out) The interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t idToIntervals(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Intervals_t *const pt_Intervals
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint32_t u32_Length;
+
+    /* Count the owned subintervals first, so only a single allocation is
+     * needed */
+    t_Status = collectIdIntervals(pt_Id, NULL, &u32_Length);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newIdIntervals(pt_Intervals, u32_Length);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = collectIdIntervals(pt_Id, pt_Intervals, &u32_Length);
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. */
+        (void)destroyIdIntervals(pt_Intervals);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Allocate a new normalised ITC ID tree from a sorted dyadic interval
+ * ID
+ *
+ * Performs a pre-order traversal of the ID tree being built, while consuming
+ * the owned subintervals in ascending order. A node is a seed ID if it
+ * matches the next subinterval, a parent if it contains it and a null ID
+ * otherwise.
+ *
+ * @param pt_Intervals The interval ID
+ * @param ppt_Id (out) The ID tree
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t newIdFromIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_CurrentId = ppt_Id; /* The current ID */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    ITC_Id_Interval_t t_Interval = { 0 }; /* The current node interval */
+    const ITC_Id_Interval_t *pt_Next; /* The next owned subinterval */
+    uint32_t u32_Next = 0; /* The index of the next owned subinterval */
+    bool b_IsSeed;
+    bool b_IsParent;
+
+    *ppt_Id = NULL;
+
+    while (ppt_CurrentId && t_Status == ITC_STATUS_SUCCESS)
+    {
+        b_IsSeed = false;
+        b_IsParent = false;
+
+        if (u32_Next < pt_Intervals->u32_Length)
+        {
+            pt_Next = &pt_Intervals->pt_Intervals[u32_Next];
+            b_IsSeed = (pt_Next->u8_Depth == t_Interval.u8_Depth &&
+                        pt_Next->u64_Position == t_Interval.u64_Position);
+            b_IsParent =
+                (pt_Next->u8_Depth > t_Interval.u8_Depth &&
+                 (pt_Next->u64_Position >>
+                  (pt_Next->u8_Depth - t_Interval.u8_Depth)) ==
+                     t_Interval.u64_Position);
+        }
+
+        if (b_IsParent)
+        {
+            t_Status = newId(ppt_CurrentId, pt_CurrentIdParent, false);
+        }
+        else
+        {
+            t_Status = newLeafId(ppt_CurrentId, pt_CurrentIdParent, b_IsSeed);
+        }
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            /* Nothing to do */
+        }
+        /* Descend into left tree */
+        else if (b_IsParent)
+        {
+            pt_CurrentIdParent = *ppt_CurrentId;
+            ppt_CurrentId = &(*ppt_CurrentId)->pt_Left;
+            t_Interval.u8_Depth++;
+            t_Interval.u64_Position <<= 1U;
+        }
+        else
+        {
+            if (b_IsSeed)
+            {
+                u32_Next++;
+            }
+
+            /* Loop until the current node is no longer a right child */
+            while (t_Interval.u8_Depth > 0 && (t_Interval.u64_Position & 1U))
+            {
+                pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentIdParent);
+                t_Interval.u8_Depth--;
+                t_Interval.u64_Position >>= 1U;
+            }
+
+            /* Descend into the unallocated right child of the parent */
+            if (t_Interval.u8_Depth > 0)
+            {
+                ppt_CurrentId = &pt_CurrentIdParent->pt_Right;
+                t_Interval.u64_Position++;
+            }
+            else
+            {
+                ppt_CurrentId = NULL;
+            }
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the conversion failed, rather than the
+         * destroy */
+        (void)ITC_Id_destroy(ppt_Id);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Find the next subinterval of a sorted dyadic interval ID in order of
+ * decreasing size
+ *
+ * Subintervals of the same size are visited in ascending order.
+ *
+ * @param pt_Intervals The interval ID
+ * @param pu8_Depth (in) The depth to start searching from. (out) The depth of
+ * the found subinterval. Larger than `ITC_ID_INTERVAL_MAX_DEPTH` if there is
+ * none
+ * @param pu32_Index (in) The index to start searching from. (out) The index of
+ * the found subinterval
+ */
+static void findIdIntervalBySize(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    uint8_t *const pu8_Depth,
+    uint32_t *const pu32_Index
+)
+{
+    while (*pu8_Depth <= ITC_ID_INTERVAL_MAX_DEPTH &&
+           (*pu32_Index >= pt_Intervals->u32_Length ||
+            pt_Intervals->pt_Intervals[*pu32_Index].u8_Depth != *pu8_Depth))
+    {
+        /* Move on to the next smaller size */
+        if (*pu32_Index >= pt_Intervals->u32_Length)
+        {
+            (*pu8_Depth)++;
+            *pu32_Index = 0;
+        }
+        else
+        {
+            (*pu32_Index)++;
+        }
+    }
+}
+
+/**
+ * @brief Allocate the owned fraction of an ID within the sum of a set of IDs
+ *
+ * The owned fraction of every ID is broken down into dyadic pieces (the set
+ * bits of its measure). The pieces of all IDs are handed out from the largest
+ * to the smallest, with ties going to the earlier ID. The subintervals of the
+ * sum are filled up from the largest to the smallest, with ties going to the
+ * leftmost one. Since all sizes are powers of 2, each piece becomes a single
+ * aligned subinterval of the same size. Only a piece larger than all remaining
+ * subintervals of the sum is spread over several of them. E.g. if the sum is
+ * a seed ID, owned fractions of `1/2`, `1/4`, `1/8` and `1/8` end up as single
+ * subintervals no deeper than `3`.
+ *
+ * @param pt_SumIntervals The sum of the IDs
+ * @param pu64_Measures The owned fraction of each ID in units of the smallest
+ * possible subinterval. Must add up to the owned fraction of the sum
+ * @param u32_IdsLength The number of IDs
+ * @param u32_IdIndex The index of the ID to allocate the fraction of
+ * @param pt_Intervals (out) The interval ID of the ID. Must have room for
+ * `ITC_ID_INTERVAL_MAX_DEPTH + 1 + pt_SumIntervals->u32_Length` subintervals
+ */
+static void allocRebalancedIdIntervals(
+    const ITC_Id_Intervals_t *const pt_SumIntervals,
+    const uint64_t *const pu64_Measures,
+    const uint32_t u32_IdsLength,
+    const uint32_t u32_IdIndex,
+    ITC_Id_Intervals_t *const pt_Intervals
+)
+{
+    /* The current subinterval of the sum */
+    uint8_t u8_SumDepth = 0;
+    uint32_t u32_SumIndex = 0;
+    /* The part of the current subinterval of the sum already handed out */
+    uint64_t u64_SumOffset = 0;
+    /* The part of the current piece not handed out yet */
+    uint64_t u64_PieceLeft;
+    /* The part of the current piece handed out from the current subinterval */
+    uint64_t u64_ChunkSize;
+    ITC_Id_Interval_t t_Chunk;
+    uint32_t u32_Level = ITC_ID_INTERVAL_MAX_DEPTH + 1;
+    uint32_t u32_Length;
+    uint32_t u32_I;
+    uint32_t u32_J;
+
+    pt_Intervals->u32_Length = 0;
+
+    findIdIntervalBySize(pt_SumIntervals, &u8_SumDepth, &u32_SumIndex);
+
+    /* Hand out the pieces from the largest to the smallest */
+    while (u32_Level > 0)
+    {
+        u32_Level--;
+
+        for (u32_I = 0; u32_I < u32_IdsLength; u32_I++)
+        {
+            u64_PieceLeft = pu64_Measures[u32_I] & (UINT64_C(1) << u32_Level);
+
+            while (u64_PieceLeft > 0)
+            {
+                u64_ChunkSize =
+                    (UINT64_C(1) << (ITC_ID_INTERVAL_MAX_DEPTH - u8_SumDepth)) -
+                    u64_SumOffset;
+
+                if (u64_ChunkSize > u64_PieceLeft)
+                {
+                    u64_ChunkSize = u64_PieceLeft;
+                }
+
+                if (u32_I == u32_IdIndex)
+                {
+                    t_Chunk.u8_Depth = ITC_ID_INTERVAL_MAX_DEPTH;
+
+                    while ((UINT64_C(1) << (ITC_ID_INTERVAL_MAX_DEPTH -
+                                            t_Chunk.u8_Depth)) < u64_ChunkSize)
+                    {
+                        t_Chunk.u8_Depth--;
+                    }
+
+                    t_Chunk.u64_Position =
+                        (ITC_ID_INTERVAL_START(
+                             &pt_SumIntervals->pt_Intervals[u32_SumIndex]) +
+                         u64_SumOffset) >>
+                        (ITC_ID_INTERVAL_MAX_DEPTH - t_Chunk.u8_Depth);
+
+                    pt_Intervals->pt_Intervals[pt_Intervals->u32_Length++] =
+                        t_Chunk;
+                }
+
+                u64_PieceLeft -= u64_ChunkSize;
+                u64_SumOffset += u64_ChunkSize;
+
+                /* Move on to the next subinterval of the sum once full */
+                if (u64_SumOffset ==
+                    (UINT64_C(1) << (ITC_ID_INTERVAL_MAX_DEPTH - u8_SumDepth)))
+                {
+                    u64_SumOffset = 0;
+                    u32_SumIndex++;
+                    findIdIntervalBySize(
+                        pt_SumIntervals, &u8_SumDepth, &u32_SumIndex);
+                }
+            }
+        }
+    }
+
+    /* Sort the subintervals in ascending order */
+    for (u32_I = 1; u32_I < pt_Intervals->u32_Length; u32_I++)
+    {
+        t_Chunk = pt_Intervals->pt_Intervals[u32_I];
+        u32_J = u32_I;
+
+        while (u32_J > 0 &&
+               ITC_ID_INTERVAL_START(&pt_Intervals->pt_Intervals[u32_J - 1]) >
+                   ITC_ID_INTERVAL_START(&t_Chunk))
+        {
+            pt_Intervals->pt_Intervals[u32_J] =
+                pt_Intervals->pt_Intervals[u32_J - 1];
+            u32_J--;
+        }
+
+        pt_Intervals->pt_Intervals[u32_J] = t_Chunk;
+    }
+
+    /* Coalesce the siblings in place. Appending never overtakes reading */
+    u32_Length = pt_Intervals->u32_Length;
+    pt_Intervals->u32_Length = 0;
+
+    for (u32_I = 0; u32_I < u32_Length; u32_I++)
+    {
+        appendIdInterval(pt_Intervals, &pt_Intervals->pt_Intervals[u32_I]);
+    }
+}
+
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+
+/**
+ * @brief Validate an existing sorted dyadic interval ITC ID
+ *
+ * The subintervals must be valid, sorted, non-overlapping and must not
+ * contain any siblings, which could be coalesced into their parent.
+ *
+ * @param pt_Intervals The interval ID to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateIdIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_Interval_t *pt_Interval;
+    const ITC_Id_Interval_t *pt_PrevInterval = NULL;
+
+    if (!pt_Intervals ||
+        (pt_Intervals->u32_Length && !pt_Intervals->pt_Intervals))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    for (uint32_t u32_I = 0;
+         t_Status == ITC_STATUS_SUCCESS && u32_I < pt_Intervals->u32_Length;
+         u32_I++)
+    {
+        pt_Interval = &pt_Intervals->pt_Intervals[u32_I];
+
+        if (pt_Interval->u8_Depth > ITC_ID_INTERVAL_MAX_DEPTH ||
+            (pt_Interval->u64_Position >> pt_Interval->u8_Depth))
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+        else if (pt_PrevInterval &&
+                 (ITC_ID_INTERVAL_END(pt_PrevInterval) >
+                      ITC_ID_INTERVAL_START(pt_Interval) ||
+                  ITC_ID_INTERVALS_ARE_SIBLINGS(pt_PrevInterval, pt_Interval)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_ID;
+        }
+        else
+        {
+            pt_PrevInterval = pt_Interval;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Split a sorted dyadic interval ID
+ *
+ * Follows the same rules as ::splitIdI(). The recursion stops at the
+ * smallest subinterval containing all owned subintervals. If it is owned as a
+ * whole, its two halves are given away. Otherwise, the owned subintervals in
+ * its left half are given to the first ID and the rest - to the second one.
+ *
+ * @param pt_Intervals The interval ID to split
+ * @param pt_Intervals1 (out) The first half
+ * @param pt_Intervals2 (out) The second half
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID owns a single
+ * subinterval of `ITC_ID_INTERVAL_MAX_DEPTH` depth
+ */
+static ITC_Status_t splitIdIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_Intervals_t *const pt_Intervals1,
+    ITC_Id_Intervals_t *const pt_Intervals2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_Interval_t *pt_First = pt_Intervals->pt_Intervals;
+    const ITC_Id_Interval_t *pt_Last;
+    ITC_Id_Interval_t t_Ancestor; /* The smallest common ancestor */
+    uint64_t u64_LastPosition;
+    uint32_t u32_Split = 0; /* The first subinterval to give away */
+
+    pt_Intervals1->pt_Intervals = NULL;
+    pt_Intervals1->u32_Length = 0;
+    pt_Intervals2->pt_Intervals = NULL;
+    pt_Intervals2->u32_Length = 0;
+
+    /* split(0) = (0, 0) */
+    if (pt_Intervals->u32_Length == 0)
+    {
+        /* Nothing to do */
+    }
+    /* split(1) = ((1, 0), (0, 1)) */
+    else if (pt_Intervals->u32_Length == 1)
+    {
+        if (pt_First->u8_Depth == ITC_ID_INTERVAL_MAX_DEPTH)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = newIdIntervals(pt_Intervals1, 1);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = newIdIntervals(pt_Intervals2, 1);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Ancestor.u8_Depth = pt_First->u8_Depth + 1U;
+            t_Ancestor.u64_Position = pt_First->u64_Position << 1U;
+            appendIdInterval(pt_Intervals1, &t_Ancestor);
+            t_Ancestor.u64_Position++;
+            appendIdInterval(pt_Intervals2, &t_Ancestor);
+        }
+    }
+    /* split((0, i)) = ((0, i1), (0, i2))
+     * split((i, 0)) = ((i1, 0), (i2, 0))
+     * split((i1, i2)) = ((i1, 0), (0, i2)) */
+    else
+    {
+        pt_Last = &pt_Intervals->pt_Intervals[pt_Intervals->u32_Length - 1];
+
+        /* Find the smallest subinterval containing both the first and the
+         * last owned subintervals */
+        t_Ancestor.u8_Depth = (pt_First->u8_Depth < pt_Last->u8_Depth)
+                                  ? pt_First->u8_Depth
+                                  : pt_Last->u8_Depth;
+        t_Ancestor.u64_Position =
+            pt_First->u64_Position >>
+            (pt_First->u8_Depth - t_Ancestor.u8_Depth);
+        u64_LastPosition =
+            pt_Last->u64_Position >> (pt_Last->u8_Depth - t_Ancestor.u8_Depth);
+
+        while (t_Ancestor.u64_Position != u64_LastPosition)
+        {
+            t_Ancestor.u8_Depth--;
+            t_Ancestor.u64_Position >>= 1U;
+            u64_LastPosition >>= 1U;
+        }
+
+        /* Find the first subinterval in the right half of the ancestor. Both
+         * halves are guaranteed to be (partially) owned */
+        while (!((pt_First[u32_Split].u64_Position >>
+                  (pt_First[u32_Split].u8_Depth - t_Ancestor.u8_Depth - 1U)) &
+                 1U))
+        {
+            u32_Split++;
+        }
+
+        t_Status = newIdIntervals(pt_Intervals1, u32_Split);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = newIdIntervals(
+                pt_Intervals2, pt_Intervals->u32_Length - u32_Split);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            memcpy(
+                pt_Intervals1->pt_Intervals,
+                pt_First,
+                u32_Split * sizeof(ITC_Id_Interval_t));
+            pt_Intervals1->u32_Length = u32_Split;
+            memcpy(
+                pt_Intervals2->pt_Intervals,
+                &pt_First[u32_Split],
+                (pt_Intervals->u32_Length - u32_Split) *
+                    sizeof(ITC_Id_Interval_t));
+            pt_Intervals2->u32_Length = pt_Intervals->u32_Length - u32_Split;
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. */
+        (void)destroyIdIntervals(pt_Intervals1);
+        (void)destroyIdIntervals(pt_Intervals2);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Sum two sorted dyadic interval IDs
+ *
+ * Merges the two sorted arrays of owned subintervals, while coalescing
+ * siblings, so the result is always normalised.
+ *
+ * @param pt_Intervals1 The first interval ID
+ * @param pt_Intervals2 The second interval ID
+ * @param pt_Intervals (out) The summed interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the IDs overlap
+ */
+static ITC_Status_t sumIdIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals1,
+    const ITC_Id_Intervals_t *const pt_Intervals2,
+    ITC_Id_Intervals_t *const pt_Intervals
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    const ITC_Id_Interval_t *pt_Next; /* The next subinterval to merge */
+    uint32_t u32_I1 = 0;
+    uint32_t u32_I2 = 0;
+
+    if (pt_Intervals1->u32_Length > UINT32_MAX - pt_Intervals2->u32_Length)
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+    else
+    {
+        t_Status = newIdIntervals(
+            pt_Intervals,
+            pt_Intervals1->u32_Length + pt_Intervals2->u32_Length);
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           (u32_I1 < pt_Intervals1->u32_Length ||
+            u32_I2 < pt_Intervals2->u32_Length))
+    {
+        if (u32_I2 == pt_Intervals2->u32_Length ||
+            (u32_I1 < pt_Intervals1->u32_Length &&
+             ITC_ID_INTERVAL_START(&pt_Intervals1->pt_Intervals[u32_I1]) <
+                 ITC_ID_INTERVAL_START(&pt_Intervals2->pt_Intervals[u32_I2])))
+        {
+            pt_Next = &pt_Intervals1->pt_Intervals[u32_I1++];
+        }
+        else
+        {
+            pt_Next = &pt_Intervals2->pt_Intervals[u32_I2++];
+        }
+
+        /* Both inputs are sorted, so the next subinterval can only ever
+         * overlap with the last merged one */
+        if (pt_Intervals->u32_Length > 0 &&
+            ITC_ID_INTERVAL_END(
+                &pt_Intervals->pt_Intervals[pt_Intervals->u32_Length - 1]) >
+                ITC_ID_INTERVAL_START(pt_Next))
+        {
+            t_Status = ITC_STATUS_OVERLAPPING_ID_INTERVAL;
+        }
+        else
+        {
+            appendIdInterval(pt_Intervals, pt_Next);
+        }
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. */
+        (void)destroyIdIntervals(pt_Intervals);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+
+/**
+ * @brief Calculate the shape and ownership metrics of an ID
+ *
+ * Performs a pre-order traversal, while keeping track of the depth of the
+ * current node.
+ *
+ * @param pt_Id The ID
+ * @param pt_Metrics (out) The ID metrics
+ */
+static void calcIdMetrics(
+    const ITC_Id_t *pt_Id,
+    ITC_Id_Metrics_t *const pt_Metrics
+)
+{
+    const ITC_Id_t *const pt_RootId = pt_Id;
+    uint32_t u32_Depth = 0;
+
+    pt_Metrics->u64_OwnedNumerator = 0;
+    pt_Metrics->u8_OwnedDenominatorLog2 = ITC_ID_METRICS_MAX_DENOMINATOR_LOG2;
+    pt_Metrics->u32_Depth = 0;
+    pt_Metrics->u32_Leaves = 0;
+
+    while (pt_Id)
+    {
+        if (ITC_ID_IS_PARENT_ID(pt_Id))
+        {
+            /* Descend into left tree */
+            pt_Id = pt_Id->pt_Left;
+            u32_Depth++;
+        }
+        else
+        {
+            pt_Metrics->u32_Leaves++;
+
+            if (u32_Depth > pt_Metrics->u32_Depth)
+            {
+                pt_Metrics->u32_Depth = u32_Depth;
+            }
+
+            /* Subintervals smaller than the largest denominator are rounded
+             * down */
+            if (ITC_ID_IS_OWNER(pt_Id) &&
+                u32_Depth <= ITC_ID_METRICS_MAX_DENOMINATOR_LOG2)
+            {
+                pt_Metrics->u64_OwnedNumerator +=
+                    (uint64_t)1U
+                    << (ITC_ID_METRICS_MAX_DENOMINATOR_LOG2 - u32_Depth);
+            }
+
+            /* Loop until the current node is no longer a right child */
+            while (pt_Id != pt_RootId &&
+                   pt_Id == ITC_ID_GET_PARENT(pt_Id)->pt_Right)
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id);
+                u32_Depth--;
+            }
+
+            /* There is a right subtree that has not been explored yet */
+            if (pt_Id != pt_RootId)
+            {
+                pt_Id = ITC_ID_GET_PARENT(pt_Id)->pt_Right;
+            }
+            else
+            {
+                pt_Id = NULL;
+            }
+        }
+    }
+
+    /* Reduce the owned fraction */
+    while (pt_Metrics->u8_OwnedDenominatorLog2 > 0 &&
+           !(pt_Metrics->u64_OwnedNumerator & 1U))
+    {
+        pt_Metrics->u64_OwnedNumerator >>= 1U;
+        pt_Metrics->u8_OwnedDenominatorLog2--;
+    }
+}
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC ID and initialise it as a seed ID (1)
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newSeed(
+    ITC_Id_t **ppt_Id
+)
+{
+    if (!ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newId(ppt_Id, NULL, true);
+}
+
+/******************************************************************************
+ * Allocate a new ITC ID and initialise it as a null ID (0)
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newNull(
+    ITC_Id_t **ppt_Id
+)
+{
+    if (!ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newId(ppt_Id, NULL, false);
+}
+
+/******************************************************************************
+ * Get the shared read-only seed ID (1)
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newSharedSeed(
+    ITC_Id_t **ppt_Id
+)
+{
+    if (!ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    *ppt_Id = ITC_ID_SHARED_ID_PTR(gt_ItcSharedSeedId);
+
+    return ITC_STATUS_SUCCESS;
+#else
+    return newId(ppt_Id, NULL, true);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+}
+
+/******************************************************************************
+ * Get the shared read-only null ID (0)
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newSharedNull(
+    ITC_Id_t **ppt_Id
+)
+{
+    if (!ppt_Id)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    *ppt_Id = ITC_ID_SHARED_ID_PTR(gt_ItcSharedNullId);
+
+    return ITC_STATUS_SUCCESS;
+#else
+    return newId(ppt_Id, NULL, false);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+}
+
+/******************************************************************************
+ * Free an allocated ITC ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_destroy(
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    ITC_Id_t *pt_CurrentId = NULL; /* The current element */
+    ITC_Id_t *pt_CurrentIdParent = NULL;
+    ITC_Id_t *pt_RootIdParent = NULL;
+
+    if (!ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    /* Tagged leaf IDs have nothing to free. Only remove them from the
+     * parent */
+    else if (ITC_ID_IS_TAGGED_LEAF(*ppt_Id))
+    {
+        pt_CurrentIdParent = ITC_ID_GET_PARENT(*ppt_Id);
+
+        if(pt_CurrentIdParent->pt_Left == *ppt_Id)
+        {
+            pt_CurrentIdParent->pt_Left = NULL;
+        }
+        else if(pt_CurrentIdParent->pt_Right == *ppt_Id)
+        {
+            pt_CurrentIdParent->pt_Right = NULL;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+    /* Shared IDs are never freed */
+    else if (*ppt_Id && !ITC_ID_IS_SHARED_ID(*ppt_Id))
+    {
+        pt_CurrentId = *ppt_Id;
+        /* Remember the parent as this might be a subtree */
+        pt_RootIdParent = ITC_ID_GET_PARENT(pt_CurrentId);
+
+        /* Keep trying to free elements even if some frees fail */
+        while(pt_CurrentId && pt_CurrentId != pt_RootIdParent)
+        {
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+            /* Drop any tagged leaf IDs instead of descending into them */
+            if(ITC_ID_IS_TAGGED_LEAF(pt_CurrentId->pt_Left))
+            {
+                pt_CurrentId->pt_Left = NULL;
+            }
+            if(ITC_ID_IS_TAGGED_LEAF(pt_CurrentId->pt_Right))
+            {
+                pt_CurrentId->pt_Right = NULL;
+            }
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+
+            /* Advance into left subtree */
+            if(pt_CurrentId->pt_Left)
+            {
+                pt_CurrentId = pt_CurrentId->pt_Left;
+            }
+            /* Advance into right subtree */
+            else if(pt_CurrentId->pt_Right)
+            {
+                pt_CurrentId = pt_CurrentId->pt_Right;
+            }
+            else
+            {
+                /* Remember the parent element */
+                pt_CurrentIdParent = ITC_ID_GET_PARENT(pt_CurrentId);
+
+                if(pt_CurrentIdParent)
+                {
+                    /* Remove the current element address from the parent */
+                    if(pt_CurrentIdParent->pt_Left == pt_CurrentId)
+                    {
+                        pt_CurrentIdParent->pt_Left = NULL;
+                    }
+                    else
+                    {
+                        pt_CurrentIdParent->pt_Right = NULL;
+                    }
+                }
+
+                /* Free the current element */
+                t_FreeStatus = ITC_Port_free(pt_CurrentId);
+
+                /* Return last error */
+                if (t_FreeStatus != ITC_STATUS_SUCCESS)
+                {
+                    t_Status = t_FreeStatus;
+                }
+
+                /* Go up the tree */
+                pt_CurrentId = pt_CurrentIdParent;
+            }
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    {
+        /* Sanitize the freed pointer regardless of the exit status */
+        *ppt_Id = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Clone an existing ITC ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_clone(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **ppt_ClonedId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_ClonedId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+        /* Shared IDs are read-only, so there is no need to copy them */
+        if (ITC_ID_IS_SHARED_ID(pt_Id))
+        {
+            *ppt_ClonedId = ITC_ID_SHARED_ID_PTR(*pt_Id);
+        }
+        else
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+        {
+            t_Status = cloneId(pt_Id, ppt_ClonedId, NULL);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate an ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_validate(
+    const ITC_Id_t *const pt_Id
+)
+{
+    return validateId(pt_Id, true);
+}
+
+/******************************************************************************
+ * Split an existing ITC ID into two distinct (non-overlaping) ITC IDs
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_split(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t **ppt_OtherId
+)
+{
+    return ITC_Id_splitWeighted(ppt_Id, ppt_OtherId, 1, 1);
+}
+
+/******************************************************************************
+ * Split an existing ITC ID into two distinct ITC IDs with uneven shares
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitWeighted(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t **ppt_OtherId,
+    uint32_t u32_Numerator,
+    uint8_t u8_DenominatorLog2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_NewId = NULL;
+
+    if (!ppt_Id || !ppt_OtherId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = reduceSplitWeight(&u32_Numerator, &u8_DenominatorLog2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = splitIdWeightedI(
+            *ppt_Id,
+            &pt_NewId,
+            ppt_OtherId,
+            u32_Numerator,
+            u8_DenominatorLog2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* XXX: Save the parent pointer in case the original ID was a subtree.
+         * This makes no sense from a functional point of view, especially
+         * since `validateId` should fail if a subtree is passed in. However,
+         * if that somehow fails and a subtree is split, the new Id will lose
+         * the reference to the original Id subtree's parent nodes, which
+         * would lead to a memory leak.
+         * Shared IDs are read-only and must never be attached to a tree. */
+        if (!ITC_ID_IS_SHARED_ID(pt_NewId))
+        {
+            ITC_ID_SET_PARENT(pt_NewId, ITC_ID_GET_PARENT(*ppt_Id));
+        }
+
+        /* Destroy the old ID.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall sum
+         * operation was successful */
+        (void)ITC_Id_destroy(ppt_Id);
+
+        /* Return the first half of the split ID */
+        *ppt_Id = pt_NewId;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Sum two existing IDs into a single ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sum(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t **ppt_OtherId
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SummedId = NULL;
+
+    if (!ppt_Id || !ppt_OtherId)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(*ppt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(*ppt_OtherId, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = sumIdI(*ppt_Id, *ppt_OtherId, &pt_SummedId, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* XXX: Save the parent pointer in case the original ID was a subtree.
+         * This makes no sense from a functional point of view, especially
+         * since `validateId` should fail if a subtree is passed in. However,
+         * if that somehow fails and a subtree is summed, the new Id will lose
+         * the reference to the original Id subtree's parent nodes, which
+         * would lead to a memory leak. */
+        ITC_ID_SET_PARENT(pt_SummedId, ITC_ID_GET_PARENT(*ppt_Id));
+
+        /* Destroy the old IDs.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall sum
+         * operation was successful */
+        (void)ITC_Id_destroy(ppt_Id);
+        (void)ITC_Id_destroy(ppt_OtherId);
+
+        /* Return the summed ID */
+        *ppt_Id = pt_SummedId;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Allocate a new ID owning one part of a balanced split of the seed ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_newBalanced(
+    const uint32_t u32_PartIndex,
+    const uint32_t u32_PartsCount,
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_RootId = NULL;
+    ITC_Id_t *pt_ParentId = NULL;
+    /* The node of the current (sub)interval */
+    ITC_Id_t **ppt_CurrentId = &pt_RootId;
+    /* The index of the part within the current (sub)interval */
+    uint32_t u32_Index = u32_PartIndex;
+    /* The number of parts the current (sub)interval is split into */
+    uint32_t u32_Count = u32_PartsCount;
+    /* The number of parts in the left half of the current (sub)interval */
+    uint32_t u32_LeftCount;
+
+    if (!ppt_Id || u32_PartIndex >= u32_PartsCount)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    /* Build the path from the root to the part. All other subtrees hang off
+     * it as null leaves */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_Count > 1)
+    {
+        u32_LeftCount = u32_Count - (u32_Count / 2);
+
+        t_Status = newId(ppt_CurrentId, pt_ParentId, false);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_ParentId = *ppt_CurrentId;
+
+            if (u32_Index < u32_LeftCount)
+            {
+                t_Status = newChildLeafId(
+                    &pt_ParentId->pt_Right, pt_ParentId, false);
+
+                ppt_CurrentId = &pt_ParentId->pt_Left;
+                u32_Count = u32_LeftCount;
+            }
+            else
+            {
+                t_Status = newChildLeafId(
+                    &pt_ParentId->pt_Left, pt_ParentId, false);
+
+                ppt_CurrentId = &pt_ParentId->pt_Right;
+                u32_Index -= u32_LeftCount;
+                u32_Count -= u32_LeftCount;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The part itself */
+        t_Status = newLeafId(ppt_CurrentId, pt_ParentId, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *ppt_Id = pt_RootId;
+    }
+    else if (pt_RootId)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the original reason for the failure */
+        (void)ITC_Id_destroy(&pt_RootId);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Rebalance a set of IDs
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_rebalance(
+    ITC_Id_t **ppt_Ids,
+    const uint32_t u32_IdsLength
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_RebalancedIds = NULL;
+    uint32_t u32_I;
+
+    if (!ppt_Ids || !u32_IdsLength)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&ppt_RebalancedIds, u32_IdsLength * sizeof(ITC_Id_t *));
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_rebalanceConst(
+            (const ITC_Id_t *const *)ppt_Ids, u32_IdsLength, ppt_RebalancedIds);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        for (u32_I = 0; u32_I < u32_IdsLength; u32_I++)
+        {
+            /* Destroy the old ID.
+             * Ignore return statuses. There is nothing else to do if the
+             * destroy fails. Also it is more important to convey that the
+             * overall rebalance operation was successful */
+            (void)ITC_Id_destroy(&ppt_Ids[u32_I]);
+
+            ppt_Ids[u32_I] = ppt_RebalancedIds[u32_I];
+        }
+    }
+
+    if (ppt_RebalancedIds)
+    {
+        /* There is nothing else to do if the free fails */
+        (void)ITC_Port_free(ppt_RebalancedIds);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Get the shape and ownership metrics of an ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_getMetrics(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Metrics_t *const pt_Metrics
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pt_Metrics)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        calcIdMetrics(pt_Id, pt_Metrics);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Split an ID similar to ::ITC_Id_split() but do not modify the source ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitConst(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **ppt_Id1,
+    ITC_Id_t **ppt_Id2
+)
+{
+    return ITC_Id_splitWeightedConst(pt_Id, ppt_Id1, ppt_Id2, 1, 1);
+}
+
+/******************************************************************************
+ * Split an ID similar to ::ITC_Id_splitWeighted() but do not modify the source
+ * ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitWeightedConst(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **ppt_Id1,
+    ITC_Id_t **ppt_Id2,
+    uint32_t u32_Numerator,
+    uint8_t u8_DenominatorLog2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Id1 || !ppt_Id2)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = reduceSplitWeight(&u32_Numerator, &u8_DenominatorLog2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = splitIdWeightedI(
+            pt_Id, ppt_Id1, ppt_Id2, u32_Numerator, u8_DenominatorLog2);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Sum two IDs similar to ::ITC_Id_sum() but do not modify the source IDs
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sumConst(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = sumIdI(pt_Id1, pt_Id2, ppt_Id, true);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Rebalance IDs similar to ::ITC_Id_rebalance() but do not modify the source
+ * IDs
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_rebalanceConst(
+    const ITC_Id_t *const *const ppt_Ids,
+    const uint32_t u32_IdsLength,
+    ITC_Id_t **ppt_RebalancedIds
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SumId = NULL; /* The sum of the IDs */
+    ITC_Id_t *pt_NextSumId = NULL;
+    ITC_Id_Intervals_t t_SumIntervals = { NULL, 0 };
+    /* The interval ID of the current rebalanced ID */
+    ITC_Id_Intervals_t t_Intervals = { NULL, 0 };
+    /* The owned fraction of each ID in units of the smallest possible
+     * subinterval */
+    uint64_t *pu64_Measures = NULL;
+    uint64_t u64_MeasuresSum = 0;
+    uint64_t u64_SumMeasure = 0;
+    ITC_Id_Metrics_t t_Metrics;
+    uint32_t u32_I = 0;
+
+    if (!ppt_Ids || !u32_IdsLength || !ppt_RebalancedIds)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_IdsLength)
+    {
+        t_Status = validateId(ppt_Ids[u32_I], true);
+        u32_I++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = cloneId(ppt_Ids[0], &pt_SumId, NULL);
+        u32_I = 1;
+    }
+
+    /* Sum the IDs one by one */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_IdsLength)
+    {
+        t_Status = sumIdI(pt_SumId, ppt_Ids[u32_I], &pt_NextSumId, true);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it is
+             * more important to convey the result of the sum */
+            (void)ITC_Id_destroy(&pt_SumId);
+            pt_SumId = pt_NextSumId;
+        }
+
+        u32_I++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = idToIntervals(pt_SumId, &t_SumIntervals);
+    }
+
+    if (pt_SumId)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the result of the rebalance */
+        (void)ITC_Id_destroy(&pt_SumId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&pu64_Measures, u32_IdsLength * sizeof(uint64_t));
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Each piece of an owned fraction adds at most one subinterval, other
+         * than the ones spread over several subintervals of the sum */
+        t_Status = newIdIntervals(
+            &t_Intervals,
+            ITC_ID_INTERVAL_MAX_DEPTH + 1 + t_SumIntervals.u32_Length);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The ID metrics and the subintervals both use units of `2^-63` */
+        for (u32_I = 0; u32_I < u32_IdsLength; u32_I++)
+        {
+            calcIdMetrics(ppt_Ids[u32_I], &t_Metrics);
+            pu64_Measures[u32_I] =
+                t_Metrics.u64_OwnedNumerator
+                << (ITC_ID_METRICS_MAX_DENOMINATOR_LOG2 -
+                    t_Metrics.u8_OwnedDenominatorLog2);
+            u64_MeasuresSum += pu64_Measures[u32_I];
+        }
+
+        for (u32_I = 0; u32_I < t_SumIntervals.u32_Length; u32_I++)
+        {
+            u64_SumMeasure +=
+                ITC_ID_INTERVAL_END(&t_SumIntervals.pt_Intervals[u32_I]) -
+                ITC_ID_INTERVAL_START(&t_SumIntervals.pt_Intervals[u32_I]);
+        }
+
+        /* The owned fractions of IDs deeper than the smallest possible
+         * subinterval are rounded down */
+        if (u64_MeasuresSum != u64_SumMeasure)
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+    }
+
+    for (u32_I = 0; ppt_RebalancedIds && u32_I < u32_IdsLength; u32_I++)
+    {
+        ppt_RebalancedIds[u32_I] = NULL;
+    }
+
+    u32_I = 0;
+
+    /* Give each ID the same owned fraction within the sum as before */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_IdsLength)
+    {
+        allocRebalancedIdIntervals(
+            &t_SumIntervals, pu64_Measures, u32_IdsLength, u32_I, &t_Intervals);
+
+        t_Status = newIdFromIntervals(&t_Intervals, &ppt_RebalancedIds[u32_I]);
+
+        u32_I++;
+    }
+
+    if (t_Status != ITC_STATUS_SUCCESS)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the original reason for the failure */
+        for (u32_I = 0; ppt_RebalancedIds && u32_I < u32_IdsLength; u32_I++)
+        {
+            (void)ITC_Id_destroy(&ppt_RebalancedIds[u32_I]);
+        }
+    }
+
+    /* There is nothing else to do if the destroy or free fails */
+    (void)destroyIdIntervals(&t_Intervals);
+    (void)destroyIdIntervals(&t_SumIntervals);
+
+    if (pu64_Measures)
+    {
+        (void)ITC_Port_free(pu64_Measures);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Split an ID into a balanced set of parts without modifying the source ID
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_splitNConst(
+    const ITC_Id_t *const pt_Id,
+    const uint32_t u32_PartsCount,
+    ITC_Id_t **ppt_Ids
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_ClonedId = NULL;
+
+    if (!u32_PartsCount || !ppt_Ids)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = cloneId(pt_Id, &pt_ClonedId, NULL);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The clone is deallocated on failure */
+        t_Status = splitIdN(pt_ClonedId, u32_PartsCount, ppt_Ids);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check whether two IDs are equal
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_isEqual(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    bool *pb_IsEqual
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pb_IsEqual)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id1, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id2, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pb_IsEqual = isIdEqual(pt_Id1, pt_Id2);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/******************************************************************************
+ * Sum two IDs similar to ::ITC_Id_sumConst() but do not normalise the result
+ ******************************************************************************/
+
+ITC_Status_t ITC_Id_sumConstUnnormalised(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    ITC_Id_t **ppt_Id
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_Id)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id1, false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id2, false);
     }
 
-    if (t_Status != ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* There is nothing else to do if the destroy fails. Also it is more
-         * important to convey the deserialisation failed, rather than the
-         * destroy */
-        (void)ITC_Id_destroy(ppt_Id);
+        t_Status = sumIdI(pt_Id1, pt_Id2, ppt_Id, false);
     }
 
     return t_Status;
 }
 
-/******************************************************************************
- * Public functions
- ******************************************************************************/
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if ITC_CONFIG_ENABLE_ID_BITMAP
 
 /******************************************************************************
- * Allocate a new ITC ID and initialise it as a seed ID (1)
+ * Convert an existing ITC ID into a bitmap ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_newSeed(
-    ITC_Id_t **ppt_Id
+ITC_Status_t ITC_Id_toBitmap(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Bitmap_t *const pt_Bitmap
 )
 {
-    if (!ppt_Id)
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Bitmap)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    return newId(ppt_Id, NULL, true);
-}
-
-/******************************************************************************
- * Allocate a new ITC ID and initialise it as a null ID (0)
- ******************************************************************************/
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateId(pt_Id, true);
+    }
 
-ITC_Status_t ITC_Id_newNull(
-    ITC_Id_t **ppt_Id
-)
-{
-    if (!ppt_Id)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        t_Status = idToBitmap(pt_Id, pt_Bitmap);
     }
 
-    return newId(ppt_Id, NULL, false);
+    return t_Status;
 }
 
 /******************************************************************************
- * Free an allocated ITC ID
+ * Allocate a new ITC ID from a bitmap ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_destroy(
+ITC_Status_t ITC_Id_newFromBitmap(
+    const ITC_Id_Bitmap_t *const pt_Bitmap,
     ITC_Id_t **ppt_Id
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
-    ITC_Id_t *pt_CurrentId = NULL; /* The current element */
-    ITC_Id_t *pt_CurrentIdParent = NULL;
-    ITC_Id_t *pt_RootIdParent = NULL;
 
     if (!ppt_Id)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
-    else if (*ppt_Id)
-    {
-        pt_CurrentId = *ppt_Id;
-        /* Remember the parent as this might be a subtree */
-        pt_RootIdParent = pt_CurrentId->pt_Parent;
-
-        /* Keep trying to free elements even if some frees fail */
-        while(pt_CurrentId && pt_CurrentId != pt_RootIdParent)
-        {
-            /* Advance into left subtree */
-            if(pt_CurrentId->pt_Left)
-            {
-                pt_CurrentId = pt_CurrentId->pt_Left;
-            }
-            /* Advance into right subtree */
-            else if(pt_CurrentId->pt_Right)
-            {
-                pt_CurrentId = pt_CurrentId->pt_Right;
-            }
-            else
-            {
-                /* Remember the parent element */
-                pt_CurrentIdParent = pt_CurrentId->pt_Parent;
-
-                if(pt_CurrentIdParent)
-                {
-                    /* Remove the current element address from the parent */
-                    if(pt_CurrentIdParent->pt_Left == pt_CurrentId)
-                    {
-                        pt_CurrentIdParent->pt_Left = NULL;
-                    }
-                    else
-                    {
-                        pt_CurrentIdParent->pt_Right = NULL;
-                    }
-                }
-
-                /* Free the current element */
-                t_FreeStatus = ITC_Port_free(pt_CurrentId);
-
-                /* Return last error */
-                if (t_FreeStatus != ITC_STATUS_SUCCESS)
-                {
-                    t_Status = t_FreeStatus;
-                }
 
-                /* Go up the tree */
-                pt_CurrentId = pt_CurrentIdParent;
-            }
-        }
-    }
-    else
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Nothing to do */
+        t_Status = validateIdBitmap(pt_Bitmap);
     }
 
-    if (t_Status != ITC_STATUS_INVALID_PARAM)
+    if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Sanitize the freed pointer regardless of the exit status */
-        *ppt_Id = NULL;
+        t_Status = newIdFromBitmap(pt_Bitmap, ppt_Id);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Clone an existing ITC ID
+ * Split a bitmap ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_clone(
-    const ITC_Id_t *const pt_Id,
-    ITC_Id_t **ppt_ClonedId
+ITC_Status_t ITC_Id_splitBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_Bitmap_t *const pt_OtherBitmap
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_ClonedId)
+    if (!pt_OtherBitmap || pt_Bitmap == pt_OtherBitmap)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id, true);
+        t_Status = validateIdBitmap(pt_Bitmap);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = cloneId(pt_Id, ppt_ClonedId, NULL);
+        t_Status = splitIdBitmap(pt_Bitmap, pt_OtherBitmap);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Validate an ID
+ * Sum two bitmap IDs
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_validate(
-    const ITC_Id_t *const pt_Id
+ITC_Status_t ITC_Id_sumBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    const ITC_Id_Bitmap_t *const pt_OtherBitmap
 )
 {
-    return validateId(pt_Id, true);
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateIdBitmap(pt_Bitmap);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateIdBitmap(pt_OtherBitmap);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = sumIdBitmap(pt_Bitmap, pt_OtherBitmap);
+    }
+
+    return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+
 /******************************************************************************
- * Split an existing ITC ID into two distinct (non-overlaping) ITC IDs
+ * Convert an existing ITC ID into a sorted dyadic interval ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_split(
-    ITC_Id_t **ppt_Id,
-    ITC_Id_t **ppt_OtherId
+ITC_Status_t ITC_Id_toIntervals(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Intervals_t *const pt_Intervals
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_NewId = NULL;
 
-    if (!ppt_Id || !ppt_OtherId)
+    if (!pt_Intervals)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(*ppt_Id, true);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = splitIdI(*ppt_Id, &pt_NewId, ppt_OtherId);
+        t_Status = validateId(pt_Id, true);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* XXX: Save the parent pointer in case the original ID was a subtree.
-         * This makes no sense from a functional point of view, especially
-         * since `validateId` should fail if a subtree is passed in. However,
-         * if that somehow fails and a subtree is split, the new Id will lose
-         * the reference to the original Id subtree's parent nodes, which
-         * would lead to a memory leak. */
-        pt_NewId->pt_Parent = (*ppt_Id)->pt_Parent;
-
-        /* Destroy the old ID.
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall sum
-         * operation was successful */
-        (void)ITC_Id_destroy(ppt_Id);
-
-        /* Return the first half of the split ID */
-        *ppt_Id = pt_NewId;
+        t_Status = idToIntervals(pt_Id, pt_Intervals);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Sum two existing IDs into a single ID
+ * Allocate a new ITC ID from a sorted dyadic interval ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_sum(
-    ITC_Id_t **ppt_Id,
-    ITC_Id_t **ppt_OtherId
+ITC_Status_t ITC_Id_newFromIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_t **ppt_Id
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_SummedId = NULL;
 
-    if (!ppt_Id || !ppt_OtherId)
+    if (!ppt_Id)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(*ppt_Id, true);
+        t_Status = validateIdIntervals(pt_Intervals);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(*ppt_OtherId, true);
+        t_Status = newIdFromIntervals(pt_Intervals, ppt_Id);
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = sumIdI(*ppt_Id, *ppt_OtherId, &pt_SummedId);
-    }
+    return t_Status;
+}
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        /* XXX: Save the parent pointer in case the original ID was a subtree.
-         * This makes no sense from a functional point of view, especially
-         * since `validateId` should fail if a subtree is passed in. However,
-         * if that somehow fails and a subtree is summed, the new Id will lose
-         * the reference to the original Id subtree's parent nodes, which
-         * would lead to a memory leak. */
-        pt_SummedId->pt_Parent = (*ppt_Id)->pt_Parent;
+/******************************************************************************
+ * Free an allocated sorted dyadic interval ID
+ ******************************************************************************/
 
-        /* Destroy the old IDs.
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall sum
-         * operation was successful */
-        (void)ITC_Id_destroy(ppt_Id);
-        (void)ITC_Id_destroy(ppt_OtherId);
+ITC_Status_t ITC_Id_destroyIntervals(
+    ITC_Id_Intervals_t *const pt_Intervals
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-        /* Return the summed ID */
-        *ppt_Id = pt_SummedId;
+    if (!pt_Intervals)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = destroyIdIntervals(pt_Intervals);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Split an ID similar to ::ITC_Id_split() but do not modify the source ID
+ * Split a sorted dyadic interval ID
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_splitConst(
-    const ITC_Id_t *const pt_Id,
-    ITC_Id_t **ppt_Id1,
-    ITC_Id_t **ppt_Id2
+ITC_Status_t ITC_Id_splitIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_Intervals_t *const pt_Intervals1,
+    ITC_Id_Intervals_t *const pt_Intervals2
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Id1 || !ppt_Id2)
+    if (!pt_Intervals1 || !pt_Intervals2 ||
+        pt_Intervals1 == pt_Intervals2 ||
+        pt_Intervals == pt_Intervals1 ||
+        pt_Intervals == pt_Intervals2)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id, true);
+        t_Status = validateIdIntervals(pt_Intervals);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = splitIdI(pt_Id, ppt_Id1, ppt_Id2);
+        t_Status = splitIdIntervals(pt_Intervals, pt_Intervals1, pt_Intervals2);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Sum two IDs similar to ::ITC_Id_sum() but do not modify the source IDs
+ * Sum two sorted dyadic interval IDs
  ******************************************************************************/
 
-ITC_Status_t ITC_Id_sumConst(
-    const ITC_Id_t *const pt_Id1,
-    const ITC_Id_t *const pt_Id2,
-    ITC_Id_t **ppt_Id
+ITC_Status_t ITC_Id_sumIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals1,
+    const ITC_Id_Intervals_t *const pt_Intervals2,
+    ITC_Id_Intervals_t *const pt_Intervals
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_Id)
+    if (!pt_Intervals ||
+        pt_Intervals == pt_Intervals1 ||
+        pt_Intervals == pt_Intervals2)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id1, true);
+        t_Status = validateIdIntervals(pt_Intervals1);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateId(pt_Id2, true);
+        t_Status = validateIdIntervals(pt_Intervals2);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = sumIdI(pt_Id1, pt_Id2, ppt_Id);
+        t_Status = sumIdIntervals(pt_Intervals1, pt_Intervals2, pt_Intervals);
     }
 
     return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+
 /******************************************************************************
  * Serialise an existing ITC Id
  ******************************************************************************/
@@ -1589,6 +4500,69 @@ ITC_Status_t ITC_SerDes_Util_serialiseId(
     return t_Status;
 }
 
+/******************************************************************************
+ * Calculate the size of a serialised ITC Id without serialising it
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_getSerialisedIdSize(
+    const ITC_Id_t *const pt_Id,
+    const bool b_AddVersion,
+    uint32_t *const pu32_Size
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pu32_Size)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Measure without a buffer. Nothing is written, so any size fits */
+        *pu32_Size = UINT32_MAX;
+        t_Status = serialiseId(pt_Id, NULL, pu32_Size, b_AddVersion);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+/******************************************************************************
+ * Check whether a serialised ITC Id is path-compressed
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_Util_isIdPathCompressed(
+    const ITC_Id_t *const pt_Id,
+    bool *const pb_IsPathCompressed
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    if (!pb_IsPathCompressed)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        t_Status = validateId(pt_Id, true);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pb_IsPathCompressed = hasSerialisedIdPath(pt_Id);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
 /******************************************************************************
  * Deserialise an ITC Id
  ******************************************************************************/
@@ -1699,7 +4673,7 @@ ITC_Status_t ITC_SerDes_deserialiseId(
 
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
-#if IS_UNIT_TEST_BUILD
+#if IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH
 
 /******************************************************************************
  * Normalise an ID
@@ -1715,10 +4689,10 @@ ITC_Status_t ITC_Id_normalise(
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = normIdI(pt_Id);
+        t_Status = normIdI(&pt_Id);
     }
 
     return t_Status;
 }
 
-#endif /* IS_UNIT_TEST_BUILD */
+#endif /* IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH */
@@ -0,0 +1,393 @@
+/**
+ * @file ITC_IdPool.c
+ * @brief Implementation of the Interval Tree Clock's pre-forked ID pool
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_IdPool.h"
+#include "ITC_config.h"
+
+#include "ITC_Id_package.h"
+#include "ITC_Id_private.h"
+#include "ITC_Port.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Validate an existing ITC ID pool
+ *
+ * Should be used to validate all incoming pools before any processing is
+ * done.
+ *
+ * @param pt_Pool The pool to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validatePool(
+    const ITC_IdPool_t *const pt_Pool
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Pool || !pt_Pool->ppt_Ids)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_Pool->u32_IdsCapacity == 0 ||
+             pt_Pool->u32_IdsCapacity > ITC_ID_POOL_MAX_CAPACITY ||
+             pt_Pool->u32_IdsLength > pt_Pool->u32_IdsCapacity)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new empty ITC ID pool
+ ******************************************************************************/
+
+ITC_Status_t ITC_IdPool_new(
+    const uint32_t u32_Capacity,
+    ITC_IdPool_t **ppt_Pool
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_IdPool_t *pt_Alloc = NULL;
+    uint32_t u32_I;
+
+    if (!ppt_Pool ||
+        u32_Capacity == 0 ||
+        u32_Capacity > ITC_ID_POOL_MAX_CAPACITY)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Port_malloc((void **)&pt_Alloc, sizeof(ITC_IdPool_t));
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            pt_Alloc = NULL;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Alloc->u32_IdsCapacity = u32_Capacity;
+        pt_Alloc->u32_IdsLength = 0;
+
+        /* Allocate one extra slot for refilling */
+        t_Status = ITC_Port_malloc(
+            (void **)&pt_Alloc->ppt_Ids,
+            ((size_t)u32_Capacity + 1U) * sizeof(ITC_Id_t *));
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            pt_Alloc->ppt_Ids = NULL;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        for (u32_I = 0; u32_I <= u32_Capacity; u32_I++)
+        {
+            pt_Alloc->ppt_Ids[u32_I] = NULL;
+        }
+
+        /* Return the pointer to the allocated memory */
+        *ppt_Pool = pt_Alloc;
+    }
+    else if (pt_Alloc)
+    {
+        /* There is nothing else to do if the destroy fails */
+        (void)ITC_IdPool_destroy(&pt_Alloc);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Free an allocated ITC ID pool
+ ******************************************************************************/
+
+ITC_Status_t ITC_IdPool_destroy(
+    ITC_IdPool_t **ppt_Pool
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    uint32_t u32_I;
+
+    if (!ppt_Pool)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (*ppt_Pool)
+    {
+        if ((*ppt_Pool)->ppt_Ids)
+        {
+            /* Keep trying to free IDs even if some frees fail */
+            for (u32_I = 0; u32_I < (*ppt_Pool)->u32_IdsLength; u32_I++)
+            {
+                t_FreeStatus = ITC_Id_destroy(&(*ppt_Pool)->ppt_Ids[u32_I]);
+
+                if (t_FreeStatus != ITC_STATUS_SUCCESS)
+                {
+                    t_Status = t_FreeStatus;
+                }
+            }
+
+            t_FreeStatus = ITC_Port_free((*ppt_Pool)->ppt_Ids);
+
+            if (t_FreeStatus != ITC_STATUS_SUCCESS)
+            {
+                t_Status = t_FreeStatus;
+            }
+        }
+
+        t_FreeStatus = ITC_Port_free(*ppt_Pool);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+
+        /* Sanitise the freed pointer regardless of the exit status */
+        *ppt_Pool = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Fill up the pool with IDs split off a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_IdPool_refill(
+    ITC_IdPool_t *const pt_Pool,
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint32_t u32_FreeLength = 0;
+
+    t_Status = validatePool(pt_Pool);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Stamp_validate(pt_Stamp);
+    }
+
+    /* A Stamp that owns nothing (i.e. a peek Stamp) would fill the pool with
+     * IDs that can never record an event. The ID is normalised, so it can
+     * only be a NULL leaf */
+    if (t_Status == ITC_STATUS_SUCCESS && ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_FreeLength = pt_Pool->u32_IdsCapacity - pt_Pool->u32_IdsLength;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && u32_FreeLength > 0)
+    {
+        /* Split the ID straight into the free slots. The last part lands in
+         * the extra slot and is kept by the Stamp */
+        t_Status = ITC_Id_splitNConst(
+            pt_Stamp->pt_Id,
+            u32_FreeLength + 1,
+            &pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength]);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it
+             * is more important to convey the result of the refill */
+            (void)ITC_Id_destroy(&pt_Stamp->pt_Id);
+            pt_Stamp->pt_Id = pt_Pool->ppt_Ids[pt_Pool->u32_IdsCapacity];
+            pt_Pool->ppt_Ids[pt_Pool->u32_IdsCapacity] = NULL;
+            pt_Pool->u32_IdsLength = pt_Pool->u32_IdsCapacity;
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Fork a Stamp using an ID from the pool
+ ******************************************************************************/
+
+ITC_Status_t ITC_IdPool_fork(
+    ITC_IdPool_t *const pt_Pool,
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_t **ppt_ForkedStamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validatePool(pt_Pool);
+
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Pool->u32_IdsLength == 0)
+    {
+        t_Status = ITC_STATUS_ID_POOL_EMPTY;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Copy the Event history */
+        t_Status = ITC_Stamp_newPeek(pt_Stamp, ppt_ForkedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Replace the NULL ID of the peek Stamp with a pooled one.
+         * There is nothing else to do if the destroy fails */
+        (void)ITC_Id_destroy(&(*ppt_ForkedStamp)->pt_Id);
+        pt_Pool->u32_IdsLength--;
+        (*ppt_ForkedStamp)->pt_Id = pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength];
+        pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength] = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Join a Stamp and return its ID to the pool
+ ******************************************************************************/
+
+ITC_Status_t ITC_IdPool_join(
+    ITC_IdPool_t *const pt_Pool,
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_Stamp_t **ppt_OtherStamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Id_t *pt_ReturnedId = NULL;
+    ITC_Id_t *pt_SummedId = NULL;
+    /* Whether the returned ID has been detached from the other Stamp */
+    bool b_IsDetached = false;
+
+    t_Status = validatePool(pt_Pool);
+
+    if (t_Status == ITC_STATUS_SUCCESS && (!ppt_Stamp || !ppt_OtherStamp))
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Stamp_validate(*ppt_OtherStamp);
+    }
+
+    /* Sum the returned ID ahead of the join if the pool is full, so nothing
+     * needs to be undone if the join fails */
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        pt_Pool->u32_IdsLength == pt_Pool->u32_IdsCapacity)
+    {
+        t_Status = ITC_Id_sumConst(
+            pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength - 1],
+            (*ppt_OtherStamp)->pt_Id,
+            &pt_SummedId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Detach the ID, so the join only sums a NULL ID */
+        pt_ReturnedId = (*ppt_OtherStamp)->pt_Id;
+        t_Status = ITC_Id_newSharedNull(&(*ppt_OtherStamp)->pt_Id);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            b_IsDetached = true;
+        }
+        else
+        {
+            (*ppt_OtherStamp)->pt_Id = pt_ReturnedId;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Stamp_join(ppt_Stamp, ppt_OtherStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        if (pt_SummedId)
+        {
+            /* There is nothing else to do if the destroy fails. Also it
+             * is more important to convey the result of the join */
+            (void)ITC_Id_destroy(
+                &pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength - 1]);
+            (void)ITC_Id_destroy(&pt_ReturnedId);
+            pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength - 1] = pt_SummedId;
+        }
+        else
+        {
+            pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength] = pt_ReturnedId;
+            pt_Pool->u32_IdsLength++;
+        }
+    }
+    else
+    {
+        if (b_IsDetached)
+        {
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Id_destroy(&(*ppt_OtherStamp)->pt_Id);
+            (*ppt_OtherStamp)->pt_Id = pt_ReturnedId;
+        }
+
+        /* There is nothing else to do if the destroy fails */
+        (void)ITC_Id_destroy(&pt_SummedId);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Sum all pooled IDs back into the ID of a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_IdPool_drain(
+    ITC_IdPool_t *const pt_Pool,
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validatePool(pt_Pool);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Stamp_validate(pt_Stamp);
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && pt_Pool->u32_IdsLength > 0)
+    {
+        t_Status = ITC_Id_sum(
+            &pt_Stamp->pt_Id, &pt_Pool->ppt_Ids[pt_Pool->u32_IdsLength - 1]);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_Pool->u32_IdsLength--;
+        }
+    }
+
+    return t_Status;
+}
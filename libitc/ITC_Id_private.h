@@ -11,8 +11,10 @@
 #define ITC_ID_PRIVATE_H_
 
 #include "ITC_Id.h"
+#include "ITC_Id_package.h"
 #include "ITC_Status.h"
 
+#include <stdint.h>
 
 /******************************************************************************
  * Defines
@@ -20,30 +22,33 @@
 
 /** Checks whether the given `ITC_Id_t` is a leaf node */
 #define ITC_ID_IS_LEAF_ID(pt_Id)                                               \
-    ((pt_Id) && !(pt_Id)->pt_Left && !(pt_Id)->pt_Right)
+    ((pt_Id) &&                                                                \
+     (ITC_ID_IS_TAGGED_LEAF(pt_Id) ||                                          \
+      (!(pt_Id)->pt_Left && !(pt_Id)->pt_Right)))
 
 /** Checks whether the given `ITC_Id_t` is a parent node */
 #define ITC_ID_IS_PARENT_ID(pt_Id)                                             \
-    ((pt_Id) && (pt_Id)->pt_Left && (pt_Id)->pt_Right)
+    ((pt_Id) && !ITC_ID_IS_TAGGED_LEAF(pt_Id) &&                               \
+     (pt_Id)->pt_Left && (pt_Id)->pt_Right)
 
 /** Checks whether the given `ITC_Id_t` is a valid parent node
  * The ID must:
  *  - Have 2 child node addresses != NULL
  *  - Have 2 unique child node addresses
- *  - NOT own its interval (pt_Id->b_IsOwner == false)
+ *  - NOT own its interval
  */
 #define ITC_ID_IS_VALID_PARENT(pt_Id)                                          \
     (ITC_ID_IS_PARENT_ID(pt_Id) &&                                             \
      ((pt_Id)->pt_Left != (pt_Id)->pt_Right) &&                                \
-     (!(pt_Id)->b_IsOwner))                                                    \
+     (!ITC_ID_IS_OWNER(pt_Id)))                                                \
 
 /** Checks whether the given `ITC_Id_t` is a null ID */
 #define ITC_ID_IS_NULL_ID(pt_Id)                                               \
-    (ITC_ID_IS_LEAF_ID(pt_Id) && !(pt_Id)->b_IsOwner)
+    (ITC_ID_IS_LEAF_ID(pt_Id) && !ITC_ID_IS_OWNER(pt_Id))
 
 /** Checks whether the given `ITC_Id_t` is a seed ID */
 #define ITC_ID_IS_SEED_ID(pt_Id)                                               \
-    (ITC_ID_IS_LEAF_ID(pt_Id) && (pt_Id)->b_IsOwner)
+    (ITC_ID_IS_LEAF_ID(pt_Id) && ITC_ID_IS_OWNER(pt_Id))
 
 /** Checks whether the given `ITC_Id_t` is a (0, 0) ID.
  * @note This macro assumes the ID is a valid parent node.
@@ -73,11 +78,93 @@
 #define ITC_ID_IS_NORMALISED_ID(pt_Id)                                         \
   (ITC_ID_IS_LEAF_ID(pt_Id) ||                                                 \
    (ITC_ID_IS_VALID_PARENT(pt_Id) &&                                           \
-    !(((pt_Id)->pt_Left->b_IsOwner && (pt_Id)->pt_Right->b_IsOwner) ||         \
-     (ITC_ID_IS_PARENT_ID((pt_Id)->pt_Left) && (pt_Id)->pt_Left->b_IsOwner) || \
-     (ITC_ID_IS_PARENT_ID((pt_Id)->pt_Right) && (pt_Id)->pt_Right->b_IsOwner)||\
-     (ITC_ID_IS_LEAF_ID((pt_Id)->pt_Left) &&                                   \
-      ITC_ID_IS_LEAF_ID((pt_Id)->pt_Right) &&                                  \
-      (pt_Id)->pt_Left->b_IsOwner == (pt_Id)->pt_Right->b_IsOwner))))
+    !((ITC_ID_IS_OWNER((pt_Id)->pt_Left) &&                                    \
+       ITC_ID_IS_OWNER((pt_Id)->pt_Right)) ||                                  \
+      (ITC_ID_IS_PARENT_ID((pt_Id)->pt_Left) &&                                \
+       ITC_ID_IS_OWNER((pt_Id)->pt_Left)) ||                                   \
+      (ITC_ID_IS_PARENT_ID((pt_Id)->pt_Right) &&                               \
+       ITC_ID_IS_OWNER((pt_Id)->pt_Right)) ||                                  \
+      (ITC_ID_IS_LEAF_ID((pt_Id)->pt_Left) &&                                  \
+       ITC_ID_IS_LEAF_ID((pt_Id)->pt_Right) &&                                 \
+       ITC_ID_IS_OWNER((pt_Id)->pt_Left) ==                                    \
+           ITC_ID_IS_OWNER((pt_Id)->pt_Right)))))
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+
+/** Checks whether the given `ITC_Id_t` is one of the shared read-only leaf IDs.
+ * Such IDs are statically allocated and must never be modified or freed */
+#define ITC_ID_IS_SHARED_ID(pt_Id)                                             \
+    (((pt_Id) == &gt_ItcSharedNullId) || ((pt_Id) == &gt_ItcSharedSeedId))
+
+/** Get a modifiable pointer to a shared read-only ID.
+ * The `const` qualifier is dropped through `uintptr_t` so the sentinels can
+ * live in read-only memory, where any accidental in-place modification of a
+ * shared ID faults instead of silently corrupting all of its users */
+#define ITC_ID_SHARED_ID_PTR(t_SharedId)                                       \
+    ((ITC_Id_t *)(uintptr_t)&(t_SharedId))
+
+#else
+
+/** Checks whether the given `ITC_Id_t` is one of the shared read-only leaf IDs.
+ * There are none, so this is never the case */
+#define ITC_ID_IS_SHARED_ID(pt_Id)                                      (false)
+
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+
+/** Get the mask of the bits of an `ITC_Id_Bitmap_t` word, which fall in the
+ * `[u32_Start, u32_Start + u32_Len)` range. The range must be dyadic, i.e.
+ * `u32_Len` must be a power of 2 and `u32_Start` a multiple of it */
+#define ITC_ID_BITMAP_RANGE_MASK(u32_Start, u32_Len)                           \
+    (((u32_Len) >= 64U)                                                        \
+         ? UINT64_MAX                                                          \
+         : (((UINT64_C(1) << (u32_Len)) - 1U) << ((u32_Start) % 64U)))
+
+/** Get the index of the first `ITC_Id_Bitmap_t` word of a dyadic range */
+#define ITC_ID_BITMAP_RANGE_START_WORD(u32_Start)            ((u32_Start) / 64U)
+
+/** Get the index of the first `ITC_Id_Bitmap_t` word after a dyadic range */
+#define ITC_ID_BITMAP_RANGE_END_WORD(u32_Start, u32_Len)                       \
+    (((u32_Start) + (u32_Len) + 63U) / 64U)
+
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+/** The maximum depth of an `ITC_Id_Interval_t`. Keeps the scaled interval
+ * bounds within a `uint64_t` */
+#define ITC_ID_INTERVAL_MAX_DEPTH                                          (63U)
+
+/** Get the start of an `ITC_Id_Interval_t` in units of the smallest possible
+ * subinterval */
+#define ITC_ID_INTERVAL_START(pt_Interval)                                     \
+    ((pt_Interval)->u64_Position                                               \
+     << (ITC_ID_INTERVAL_MAX_DEPTH - (pt_Interval)->u8_Depth))
+
+/** Get the end of an `ITC_Id_Interval_t` in units of the smallest possible
+ * subinterval */
+#define ITC_ID_INTERVAL_END(pt_Interval)                                       \
+    (ITC_ID_INTERVAL_START(pt_Interval) +                                      \
+     (UINT64_C(1) << (ITC_ID_INTERVAL_MAX_DEPTH - (pt_Interval)->u8_Depth)))
+
+/** Checks whether two `ITC_Id_Interval_t`s are the two halves of the same
+ * parent subinterval, in that order */
+#define ITC_ID_INTERVALS_ARE_SIBLINGS(pt_Left, pt_Right)                       \
+    (((pt_Left)->u8_Depth > 0U) &&                                             \
+     ((pt_Left)->u8_Depth == (pt_Right)->u8_Depth) &&                          \
+     (!((pt_Left)->u64_Position & 1U)) &&                                      \
+     ((pt_Left)->u64_Position + 1U == (pt_Right)->u64_Position))
+
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+/******************************************************************************
+ * Global variables
+ ******************************************************************************/
+
+/** The shared read-only NULL ID (0). See ::ITC_Id_newSharedNull() */
+extern const ITC_Id_t gt_ItcSharedNullId;
+
+/** The shared read-only seed ID (1). See ::ITC_Id_newSharedSeed() */
+extern const ITC_Id_t gt_ItcSharedSeedId;
+
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
 
 #endif /* ITC_ID_PRIVATE_H_ */
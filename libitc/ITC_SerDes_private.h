@@ -11,6 +11,8 @@
 #ifndef ITC_SERDES_PRIVATE_H_
 #define ITC_SERDES_PRIVATE_H_
 
+#include "ITC_config.h"
+
 #include <stdint.h>
 
 /******************************************************************************
@@ -37,6 +39,52 @@
 /* The header of a serialised parent ITC ID */
 #define ITC_SERDES_PARENT_ID_HEADER                                      (0x01U)
 
+/* The header of a serialised ID path. A path is a chain of parent ID nodes,
+ * each having a leaf null ID as one of its children, i.e. `(0, (0, (..., i)))`.
+ * The header is followed by the length of the path and its bitmap.
+ * See ::ITC_SERDES_PATH_BITMAP_LEN().
+ * Always defined, so builds without `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES`
+ * can tell path-compressed data apart from corrupt data */
+#define ITC_SERDES_PATH_ID_HEADER                                        (0x03U)
+
+/* The header of a serialised Event path. A path is a chain of parent Event
+ * nodes with a 0 counter, each having a leaf 0 Event as one of its children,
+ * i.e. `(0, 0, (0, 0, (..., e)))`. The header is followed by the length of the
+ * path and its bitmap. See ::ITC_SERDES_PATH_BITMAP_LEN() */
+#define ITC_SERDES_PATH_EVENT_HEADER                                     (0x20U)
+
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+/* The size of the length field of a serialised path */
+#define ITC_SERDES_PATH_LEN_LEN                                (sizeof(uint8_t))
+
+/* The maximum number of nodes in a single serialised path. Longer chains are
+ * serialised as consecutive paths */
+#define ITC_SERDES_PATH_MAX_LEN                                      (UINT8_MAX)
+
+/* The minimum number of nodes in a chain for it to be serialised as a path.
+ * Shorter chains take less space when serialised node by node */
+#define ITC_SERDES_PATH_MIN_LEN                                             (2U)
+
+/* The size of the bitmap of a serialised path with `u8_PathLen` nodes.
+ * Each node has a bit, which is set if the path continues through the right
+ * child of the node. The bits are stored in ascending order starting from the
+ * least significant bit of the first byte */
+#define ITC_SERDES_PATH_BITMAP_LEN(u8_PathLen)                                 \
+    (((uint32_t)(u8_PathLen) + 7U) / 8U)
+
+/* Get whether a serialised path continues through the right child of its
+ * `u8_Node`-th node */
+#define ITC_SERDES_PATH_GET_BIT(pu8_Bitmap, u8_Node)                           \
+    ((((pu8_Bitmap)[(u8_Node) / 8U]) >> ((u8_Node) % 8U)) & 1U)
+
+/* Mark a serialised path as continuing through the right child of its
+ * `u8_Node`-th node */
+#define ITC_SERDES_PATH_SET_BIT(pu8_Bitmap, u8_Node)                           \
+    ((pu8_Bitmap)[(u8_Node) / 8U] |= (uint8_t)(1U << ((u8_Node) % 8U)))
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
 /* The minimum possible length of a serialisation/deserialsation ID buffer
  * (a leaf ID) - requires 1 `ITC_SerDes_Header_t` */
 #define ITC_SERDES_ID_MIN_BUFFER_LEN               (sizeof(ITC_SerDes_Header_t))
@@ -114,10 +162,66 @@
  * a 7-byte Event component len size */
 #define ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK                        (0x38U)
 
-/* The mask of the whole Stamp header */
+/* The offset of the `IS_DELTA` flag in a serialised ITC Stamp header */
+#define ITC_SERDES_STAMP_IS_DELTA_OFFSET                                    (6U)
+/* The mask of the `IS_DELTA` flag in a serialised ITC Stamp header */
+#define ITC_SERDES_STAMP_IS_DELTA_MASK                                   (0x40U)
+
+/* The offset of the `HAS_EXTENSION` flag in a serialised ITC Stamp header.
+ * If set, the header is followed by a Stamp extension header */
+#define ITC_SERDES_STAMP_HAS_EXTENSION_OFFSET                               (7U)
+/* The mask of the `HAS_EXTENSION` flag in a serialised ITC Stamp header */
+#define ITC_SERDES_STAMP_HAS_EXTENSION_MASK                              (0x80U)
+
+/* The offset of the epoch length in a serialised ITC Stamp extension header */
+#define ITC_SERDES_STAMP_EXT_EPOCH_LEN_OFFSET                               (0U)
+/* The mask of the epoch len size in a serialised ITC Stamp extension header.
+ * This allows for a maximum of a 3-bit counter. A `0` length means the Stamp
+ * is in epoch `0` */
+#define ITC_SERDES_STAMP_EXT_EPOCH_LEN_MASK                              (0x07U)
+
+/* The offset of the `HAS_REBASE_BASE_ID` flag in a serialised ITC Stamp
+ * extension header. If set, the epoch is followed by the rebase base ID */
+#define ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_OFFSET                      (3U)
+/* The mask of the `HAS_REBASE_BASE_ID` flag in a serialised ITC Stamp
+ * extension header */
+#define ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK                     (0x08U)
+
+/* The size of the rebase base ID of a serialised ITC Stamp */
+#define ITC_SERDES_STAMP_REBASE_BASE_ID_LEN                   (sizeof(uint64_t))
+
+/* The offset of the `IS_PATH_COMPRESSED` flag in a serialised ITC Stamp
+ * extension header. If set, the ID or Event component contains at least one
+ * path. See ::ITC_SERDES_PATH_ID_HEADER and ::ITC_SERDES_PATH_EVENT_HEADER */
+#define ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_OFFSET                      (4U)
+/* The mask of the `IS_PATH_COMPRESSED` flag in a serialised ITC Stamp
+ * extension header */
+#define ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK                     (0x10U)
+
+/* Whether serialised ITC Stamps can have an extension */
+#define ITC_SERDES_ENABLE_STAMP_EXTENSION                                      \
+  (ITC_CONFIG_ENABLE_STAMP_REBASE || ITC_CONFIG_ENABLE_STAMP_EPOCH ||          \
+   ITC_CONFIG_USE_PATH_COMPRESSED_SERDES)
+
+/* The mask of the whole Stamp header. The `HAS_EXTENSION` flag is always
+ * accepted, so that extensions this build does not support can be reported */
 #define ITC_SERDES_STAMP_HEADER_MASK                                           \
   (ITC_SERDES_STAMP_ID_COMPONENT_LEN_MASK |                                    \
-   ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK)
+   ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK |                                 \
+   ITC_SERDES_STAMP_IS_DELTA_MASK |                                            \
+   ITC_SERDES_STAMP_HAS_EXTENSION_MASK)
+
+/* The mask of the whole Stamp extension header */
+#define ITC_SERDES_STAMP_EXT_HEADER_MASK                                       \
+  ((ITC_CONFIG_ENABLE_STAMP_EPOCH                                              \
+        ? ITC_SERDES_STAMP_EXT_EPOCH_LEN_MASK                                  \
+        : 0U) |                                                                \
+   (ITC_CONFIG_ENABLE_STAMP_REBASE                                             \
+        ? ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK                         \
+        : 0U) |                                                                \
+   (ITC_CONFIG_USE_PATH_COMPRESSED_SERDES                                      \
+        ? ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK                         \
+        : 0U))
 
 /* The minimum possible length of a serialisation/deserialsation Stamp buffer
  * (a Stamp with a leaf ID and Event nodes). Requires:
@@ -130,6 +234,15 @@
     (sizeof(ITC_SerDes_Header_t) + (2 * sizeof(uint8_t)) +                     \
         ITC_SERDES_ID_MIN_BUFFER_LEN + ITC_SERDES_EVENT_MIN_BUFFER_LEN)
 
+/* The minimum possible length of a Stamp delta deserialisation buffer
+ * (a delta with an omitted ID component and a leaf Event node). Requires:
+ *   - 1 Stamp header (`ITC_SerDes_Header_t`)
+ *   - 1 byte to denote the serialised Event component length
+ *   - 1 `ITC_SERDES_EVENT_MIN_BUFFER_LEN` */
+#define ITC_SERDES_STAMP_DELTA_MIN_BUFFER_LEN                                  \
+    (sizeof(ITC_SerDes_Header_t) + sizeof(uint8_t) +                           \
+        ITC_SERDES_EVENT_MIN_BUFFER_LEN)
+
 /* Get the `ID component length` length from a serialised Stamp node */
 #define ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(t_Header)                    \
     ITC_SERDES_HEADER_GET(                                                     \
@@ -162,6 +275,84 @@
         ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK,                             \
         ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_OFFSET)
 
+/* Get the `IS_DELTA` flag of a serialised Stamp */
+#define ITC_SERDES_STAMP_GET_IS_DELTA(t_Header)                                \
+    ITC_SERDES_HEADER_GET(                                                     \
+        t_Header,                                                              \
+        ITC_SERDES_STAMP_IS_DELTA_MASK,                                        \
+        ITC_SERDES_STAMP_IS_DELTA_OFFSET)
+
+/* Set the `IS_DELTA` flag of a serialised Stamp */
+#define ITC_SERDES_STAMP_SET_IS_DELTA(t_Header, b_IsDelta)                     \
+    ITC_SERDES_HEADER_SET(                                                     \
+        t_Header,                                                              \
+        b_IsDelta,                                                             \
+        ITC_SERDES_STAMP_IS_DELTA_MASK,                                        \
+        ITC_SERDES_STAMP_IS_DELTA_OFFSET)
+
+/* Get the `HAS_EXTENSION` flag of a serialised Stamp */
+#define ITC_SERDES_STAMP_GET_HAS_EXTENSION(t_Header)                           \
+    ITC_SERDES_HEADER_GET(                                                     \
+        t_Header,                                                              \
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK,                                   \
+        ITC_SERDES_STAMP_HAS_EXTENSION_OFFSET)
+
+/* Set the `HAS_EXTENSION` flag of a serialised Stamp */
+#define ITC_SERDES_STAMP_SET_HAS_EXTENSION(t_Header, b_HasExtension)           \
+    ITC_SERDES_HEADER_SET(                                                     \
+        t_Header,                                                              \
+        b_HasExtension,                                                        \
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK,                                   \
+        ITC_SERDES_STAMP_HAS_EXTENSION_OFFSET)
+
+/* Get the epoch length of a serialised Stamp extension header */
+#define ITC_SERDES_STAMP_GET_EXT_EPOCH_LEN(t_Header)                           \
+    ITC_SERDES_HEADER_GET(                                                     \
+        t_Header,                                                              \
+        ITC_SERDES_STAMP_EXT_EPOCH_LEN_MASK,                                   \
+        ITC_SERDES_STAMP_EXT_EPOCH_LEN_OFFSET)
+
+/** Set the epoch length of a serialised Stamp extension header
+ * @warning The `u8_Len` must be `<= 7` */
+#define ITC_SERDES_STAMP_SET_EXT_EPOCH_LEN(t_Header, u8_Len)                   \
+    ITC_SERDES_HEADER_SET(                                                     \
+        t_Header,                                                              \
+        u8_Len,                                                                \
+        ITC_SERDES_STAMP_EXT_EPOCH_LEN_MASK,                                   \
+        ITC_SERDES_STAMP_EXT_EPOCH_LEN_OFFSET)
+
+/* Get the `HAS_REBASE_BASE_ID` flag of a serialised Stamp extension
+ * header */
+#define ITC_SERDES_STAMP_GET_EXT_HAS_REBASE_BASE_ID(t_Header)                  \
+    ITC_SERDES_HEADER_GET(                                                     \
+        t_Header,                                                              \
+        ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK,                          \
+        ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_OFFSET)
+
+/* Set the `HAS_REBASE_BASE_ID` flag of a serialised Stamp extension
+ * header */
+#define ITC_SERDES_STAMP_SET_EXT_HAS_REBASE_BASE_ID(t_Header, b_HasBaseId)     \
+    ITC_SERDES_HEADER_SET(                                                     \
+        t_Header,                                                              \
+        b_HasBaseId,                                                           \
+        ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK,                          \
+        ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_OFFSET)
+
+/* Get the `IS_PATH_COMPRESSED` flag of a serialised Stamp extension header */
+#define ITC_SERDES_STAMP_GET_EXT_IS_PATH_COMPRESSED(t_Header)                  \
+    ITC_SERDES_HEADER_GET(                                                     \
+        t_Header,                                                              \
+        ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK,                          \
+        ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_OFFSET)
+
+/* Set the `IS_PATH_COMPRESSED` flag of a serialised Stamp extension header */
+#define ITC_SERDES_STAMP_SET_EXT_IS_PATH_COMPRESSED(t_Header, b_IsCompressed)  \
+    ITC_SERDES_HEADER_SET(                                                     \
+        t_Header,                                                              \
+        b_IsCompressed,                                                        \
+        ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK,                          \
+        ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_OFFSET)
+
 /* The minimum possible length of an ID serialisation (to string) string buffer
  * - a NULL terminated buffer. Requires 1 byte for the NULL termination. Keeping
  * the minimum length requirement to be just a NULL terminator ensures that even
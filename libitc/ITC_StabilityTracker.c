@@ -0,0 +1,425 @@
+/**
+ * @file ITC_StabilityTracker.c
+ * @brief Implementation of the Interval Tree Clock's causal stability tracker
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_StabilityTracker.h"
+#include "ITC_config.h"
+
+#include "ITC_Event_package.h"
+#include "ITC_Port.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Validate an existing ITC stability tracker
+ *
+ * Should be used to validate all incoming trackers before any processing is
+ * done.
+ *
+ * @param pt_Tracker The tracker to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateTracker(
+    const ITC_StabilityTracker_t *const pt_Tracker
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Tracker || !pt_Tracker->ppt_Nodes || !pt_Tracker->ppt_Nodes[1])
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (pt_Tracker->u32_PeersLength == 0 ||
+             pt_Tracker->u32_PeersLength > pt_Tracker->u32_LeavesOffset ||
+             pt_Tracker->u32_LeavesOffset > ITC_STABILITY_TRACKER_MAX_PEERS)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Meet the children of a tournament tree node
+ *
+ * The peers occupy the leftmost leaf nodes, so the left child of a node
+ * covering at least one peer is never `NULL`.
+ *
+ * @param pt_Tracker The tracker
+ * @param u32_Node The index of the node. Must cover at least one peer
+ * @param ppt_Event (out) The pointer to the met Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t meetChildNodes(
+    const ITC_StabilityTracker_t *const pt_Tracker,
+    const uint32_t u32_Node,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    const ITC_Event_t *pt_LeftEvent = pt_Tracker->ppt_Nodes[u32_Node << 1U];
+    const ITC_Event_t *pt_RightEvent =
+        pt_Tracker->ppt_Nodes[(u32_Node << 1U) + 1U];
+
+    if (pt_RightEvent)
+    {
+        t_Status = ITC_Event_meet(pt_LeftEvent, pt_RightEvent, ppt_Event);
+    }
+    else
+    {
+        /* The right subtree does not cover any peers */
+        t_Status = ITC_Event_clone(pt_LeftEvent, ppt_Event);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Recompute the meets on the path from a node to the root
+ *
+ * The Events of the peers only ever grow, and so do their meets. Thus, once a
+ * recomputed meet is `<=` its current value it is unchanged, and so are all of
+ * its ancestors.
+ *
+ * @param pt_Tracker The tracker
+ * @param u32_Node The index of the node that has changed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t updateAncestorNodes(
+    ITC_StabilityTracker_t *const pt_Tracker,
+    uint32_t u32_Node
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Event_t *pt_MetEvent = NULL;
+    bool b_IsChanged = true;
+
+    while (t_Status == ITC_STATUS_SUCCESS && b_IsChanged && u32_Node > 1U)
+    {
+        /* Climb to the parent node */
+        u32_Node >>= 1U;
+
+        t_Status = meetChildNodes(pt_Tracker, u32_Node, &pt_MetEvent);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Event_leq(
+                pt_MetEvent, pt_Tracker->ppt_Nodes[u32_Node], &b_IsChanged);
+            /* `<=` means unchanged */
+            b_IsChanged = !b_IsChanged;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS && b_IsChanged)
+        {
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Event_destroy(&pt_Tracker->ppt_Nodes[u32_Node]);
+            pt_Tracker->ppt_Nodes[u32_Node] = pt_MetEvent;
+        }
+        else if (pt_MetEvent)
+        {
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Event_destroy(&pt_MetEvent);
+        }
+
+        pt_MetEvent = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC stability tracker and initialise it
+ ******************************************************************************/
+
+ITC_Status_t ITC_StabilityTracker_new(
+    const uint32_t u32_PeersLength,
+    ITC_StabilityTracker_t **ppt_Tracker
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_StabilityTracker_t *pt_Alloc = NULL;
+    uint32_t u32_LeavesOffset = 1;
+    uint32_t u32_Node;
+
+    if (!ppt_Tracker ||
+        u32_PeersLength == 0 ||
+        u32_PeersLength > ITC_STABILITY_TRACKER_MAX_PEERS)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&pt_Alloc, sizeof(ITC_StabilityTracker_t));
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            pt_Alloc = NULL;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Round the number of leaf nodes up to a power of 2 */
+        while (u32_LeavesOffset < u32_PeersLength)
+        {
+            u32_LeavesOffset <<= 1U;
+        }
+
+        pt_Alloc->u32_PeersLength = u32_PeersLength;
+        pt_Alloc->u32_LeavesOffset = u32_LeavesOffset;
+
+        t_Status = ITC_Port_malloc(
+            (void **)&pt_Alloc->ppt_Nodes,
+            (size_t)(u32_LeavesOffset << 1U) * sizeof(ITC_Event_t *));
+
+        if (t_Status != ITC_STATUS_SUCCESS)
+        {
+            pt_Alloc->ppt_Nodes = NULL;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        for (u32_Node = 0; u32_Node < (u32_LeavesOffset << 1U); u32_Node++)
+        {
+            pt_Alloc->ppt_Nodes[u32_Node] = NULL;
+        }
+
+        /* Nothing is known about the peers yet */
+        u32_Node = 0;
+
+        while (t_Status == ITC_STATUS_SUCCESS && u32_Node < u32_PeersLength)
+        {
+            t_Status = ITC_Event_new(
+                &pt_Alloc->ppt_Nodes[u32_LeavesOffset + u32_Node]);
+            u32_Node++;
+        }
+
+        /* Build the meets bottom-up. Only the nodes covering at least one
+         * peer (i.e. with a left child) hold an Event */
+        u32_Node = u32_LeavesOffset - 1U;
+
+        while (t_Status == ITC_STATUS_SUCCESS && u32_Node > 0U)
+        {
+            if (pt_Alloc->ppt_Nodes[u32_Node << 1U])
+            {
+                t_Status = meetChildNodes(
+                    pt_Alloc, u32_Node, &pt_Alloc->ppt_Nodes[u32_Node]);
+            }
+
+            u32_Node--;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Return the pointer to the allocated memory */
+        *ppt_Tracker = pt_Alloc;
+    }
+    else if (pt_Alloc)
+    {
+        /* There is nothing else to do if the destroy fails */
+        (void)ITC_StabilityTracker_destroy(&pt_Alloc);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Free an allocated ITC stability tracker
+ ******************************************************************************/
+
+ITC_Status_t ITC_StabilityTracker_destroy(
+    ITC_StabilityTracker_t **ppt_Tracker
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    uint32_t u32_Node;
+
+    if (!ppt_Tracker)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (*ppt_Tracker)
+    {
+        if ((*ppt_Tracker)->ppt_Nodes)
+        {
+            /* Keep trying to free Events even if some frees fail */
+            for (u32_Node = 0;
+                 u32_Node < ((*ppt_Tracker)->u32_LeavesOffset << 1U);
+                 u32_Node++)
+            {
+                if ((*ppt_Tracker)->ppt_Nodes[u32_Node])
+                {
+                    t_FreeStatus = ITC_Event_destroy(
+                        &(*ppt_Tracker)->ppt_Nodes[u32_Node]);
+
+                    if (t_FreeStatus != ITC_STATUS_SUCCESS)
+                    {
+                        t_Status = t_FreeStatus;
+                    }
+                }
+            }
+
+            t_FreeStatus = ITC_Port_free((*ppt_Tracker)->ppt_Nodes);
+
+            if (t_FreeStatus != ITC_STATUS_SUCCESS)
+            {
+                t_Status = t_FreeStatus;
+            }
+        }
+
+        t_FreeStatus = ITC_Port_free(*ppt_Tracker);
+
+        if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        {
+            t_Status = t_FreeStatus;
+        }
+
+        /* Sanitise the freed pointer regardless of the exit status */
+        *ppt_Tracker = NULL;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Record the Event of a Stamp received from a peer
+ ******************************************************************************/
+
+ITC_Status_t ITC_StabilityTracker_update(
+    ITC_StabilityTracker_t *const pt_Tracker,
+    const uint32_t u32_Peer,
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Event_t *pt_JoinedEvent = NULL;
+    uint32_t u32_Node = 0;
+    bool b_IsLeq = false;
+
+    t_Status = validateTracker(pt_Tracker);
+
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        u32_Peer >= pt_Tracker->u32_PeersLength)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Stamp_validate(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_Node = pt_Tracker->u32_LeavesOffset + u32_Peer;
+
+        /* Stale and duplicate Stamps do not tell anything new */
+        t_Status = ITC_Event_leq(
+            pt_Stamp->pt_Event, pt_Tracker->ppt_Nodes[u32_Node], &b_IsLeq);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsLeq)
+    {
+        t_Status = ITC_Event_joinConst(
+            pt_Tracker->ppt_Nodes[u32_Node],
+            pt_Stamp->pt_Event,
+            &pt_JoinedEvent);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Event_destroy(&pt_Tracker->ppt_Nodes[u32_Node]);
+            pt_Tracker->ppt_Nodes[u32_Node] = pt_JoinedEvent;
+
+            t_Status = updateAncestorNodes(pt_Tracker, u32_Node);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Check whether a Stamp is causally stable
+ ******************************************************************************/
+
+ITC_Status_t ITC_StabilityTracker_isStable(
+    const ITC_StabilityTracker_t *const pt_Tracker,
+    const ITC_Stamp_t *const pt_Stamp,
+    bool *pb_IsStable
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateTracker(pt_Tracker);
+
+    if (t_Status == ITC_STATUS_SUCCESS && !pb_IsStable)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Stamp_validate(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_leq(
+            pt_Stamp->pt_Event, pt_Tracker->ppt_Nodes[1], pb_IsStable);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/******************************************************************************
+ * Get a copy of the stable frontier
+ ******************************************************************************/
+
+ITC_Status_t ITC_StabilityTracker_getFrontier(
+    const ITC_StabilityTracker_t *const pt_Tracker,
+    ITC_Event_t **ppt_Frontier
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateTracker(pt_Tracker);
+
+    if (t_Status == ITC_STATUS_SUCCESS && !ppt_Frontier)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_clone(pt_Tracker->ppt_Nodes[1], ppt_Frontier);
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
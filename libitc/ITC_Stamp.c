@@ -53,6 +53,14 @@ static ITC_Status_t validateStamp(
     {
         t_Status = ITC_STATUS_CORRUPT_STAMP;
     }
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    /* Batched Stamps might not be normalised. They must leave the batch first
+     * via ::ITC_Stamp_endBatch() */
+    else if (pt_Stamp->b_IsBatched)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -88,6 +96,19 @@ static ITC_Status_t newStamp(
         /* Initialise members */
         pt_Alloc->pt_Event = NULL;
         pt_Alloc->pt_Id = NULL;
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+        pt_Alloc->b_IsBatched = false;
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+        pt_Alloc->u64_EventHash = 0;
+        pt_Alloc->b_IsEventHashCached = false;
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+        pt_Alloc->u64_RebaseBaseId = 0;
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+        pt_Alloc->u32_Epoch = 0;
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
 
         /* Return the pointer to the allocated memory */
         *ppt_Stamp = pt_Alloc;
@@ -101,6 +122,247 @@ static ITC_Status_t newStamp(
     return t_Status;
 }
 
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+
+/**
+ * @brief Check two existing Stamps are in the same epoch
+ *
+ * The IDs and Events of Stamps in different epochs belong to different
+ * reseeds of the system and cannot be combined with each other.
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_MISMATCHED_STAMP_EPOCH` if the epochs differ
+ */
+static ITC_Status_t validateStampEpochs(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Stamp1->u32_Epoch != pt_Stamp2->u32_Epoch)
+    {
+        t_Status = ITC_STATUS_MISMATCHED_STAMP_EPOCH;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/**
+ * @brief Check two existing Stamps were rebased against the same base
+ *
+ * The Events of Stamps with different rebase base IDs are relative to
+ * different bases and cannot be compared or joined with each other.
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_MISMATCHED_STAMP_BASE` if the rebase base IDs differ
+ */
+static ITC_Status_t validateStampRebaseBaseIds(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (pt_Stamp1->u64_RebaseBaseId != pt_Stamp2->u64_RebaseBaseId)
+    {
+        t_Status = ITC_STATUS_MISMATCHED_STAMP_BASE;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+/**
+ * @brief Join the ID and Event components of two existing Stamps
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @param ppt_Id (out) The summed ID
+ * @param ppt_Event (out) The joined Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinStampComponents(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Id_t **ppt_Id,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateStamp(pt_Stamp1);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp2);
+    }
+
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampEpochs(pt_Stamp1, pt_Stamp2);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampRebaseBaseIds(pt_Stamp1, pt_Stamp2);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_sumConst(pt_Stamp1->pt_Id, pt_Stamp2->pt_Id, ppt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_joinConst(
+            pt_Stamp1->pt_Event, pt_Stamp2->pt_Event, ppt_Event);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/**
+ * @brief Validate a Stamp, which is allowed to be part of a batch
+ *
+ * Only the Stamp itself is checked. The ID and Event components are validated
+ * (without requiring them to be normalised) by the functions consuming them.
+ *
+ * @param pt_Stamp The Stamp to validate
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t validateBatchedStamp(
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (!pt_Stamp->pt_Id || !pt_Stamp->pt_Event)
+    {
+        t_Status = ITC_STATUS_CORRUPT_STAMP;
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Join the ID and Event components of two existing Stamps, at least
+ * one of which is part of a batch, without normalising them
+ *
+ * @param pt_Stamp1 The first Stamp
+ * @param pt_Stamp2 The second Stamp
+ * @param ppt_Id (out) The summed ID
+ * @param ppt_Event (out) The joined Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t joinBatchedStampComponents(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Id_t **ppt_Id,
+    ITC_Event_t **ppt_Event
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateBatchedStamp(pt_Stamp1);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateBatchedStamp(pt_Stamp2);
+    }
+
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampEpochs(pt_Stamp1, pt_Stamp2);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampRebaseBaseIds(pt_Stamp1, pt_Stamp2);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_sumConstUnnormalised(
+            pt_Stamp1->pt_Id, pt_Stamp2->pt_Id, ppt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_joinConstUnnormalised(
+            pt_Stamp1->pt_Event, pt_Stamp2->pt_Event, ppt_Event);
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Normalise the ID and Event components of a batched Stamp and remove
+ * it from the batch
+ *
+ * @param pt_Stamp The batched Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t normaliseBatchedStamp(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateBatchedStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS && !pt_Stamp->b_IsBatched)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_normalise(pt_Stamp->pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_normalise(pt_Stamp->pt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Stamp->b_IsBatched = false;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
 /**
  * @brief Allocate a new ITC Stamp and init it with ID and Event components
  *
@@ -110,10 +372,10 @@ static ITC_Status_t newStamp(
  * deallocated in case of failure.
  * @param ppt_Stamp (out) The pointer to the new Stamp
  * @param pt_Id The pointer to an existing valid ID tree to be cloned.
- * Otherwise NULL.
+ * Otherwise NULL, in which case the shared seed or NULL ID is used.
  * @param pt_Event The pointer to an existing valid Event tree to be cloned.
- * Otherwise NULL.
- * @param b_CreateNullId Allocate a NULL ID instead of a Seed ID.
+ * Otherwise NULL, in which case the shared leaf Event is used.
+ * @param b_CreateNullId Use a NULL ID instead of a Seed ID.
  * Ignored if pt_Id != NULL
  * @param b_CloneId Whether to clone or simply assign the passed ID to the
  * Stamp. Ignored if pt_Id == NULL
@@ -150,11 +412,11 @@ static ITC_Status_t newStampWithIdAndEvent(
         }
         else if (b_CreateNullId)
         {
-            t_Status = ITC_Id_newNull(&(*ppt_Stamp)->pt_Id);
+            t_Status = ITC_Id_newSharedNull(&(*ppt_Stamp)->pt_Id);
         }
         else
         {
-            t_Status = ITC_Id_newSeed(&(*ppt_Stamp)->pt_Id);
+            t_Status = ITC_Id_newSharedSeed(&(*ppt_Stamp)->pt_Id);
         }
     }
 
@@ -173,7 +435,7 @@ static ITC_Status_t newStampWithIdAndEvent(
         }
         else
         {
-            t_Status = ITC_Event_new(&(*ppt_Stamp)->pt_Event);
+            t_Status = ITC_Event_newShared(&(*ppt_Stamp)->pt_Event);
         }
     }
 
@@ -226,17 +488,45 @@ static ITC_Status_t compareStamps(
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    bool b_IsLeq12; /* `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` */
-    bool b_IsLeq21; /* `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
+    bool b_IsLeq12 = true; /* `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` */
+    bool b_IsLeq21 = true; /* `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
+    bool b_IsLeq12Needed = true; /* Whether `b_IsLeq12` must be calculated */
+    bool b_IsLeq21Needed = true; /* Whether `b_IsLeq21` must be calculated */
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+    bool b_AreEventsDifferent = false;
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (pt_Stamp1->b_IsEventHashCached && pt_Stamp2->b_IsEventHashCached)
+    {
+        /* Normalised Events are canonical. Equal hashes mean equal Events */
+        if (pt_Stamp1->u64_EventHash == pt_Stamp2->u64_EventHash)
+        {
+            b_IsLeq12Needed = false;
+            b_IsLeq21Needed = false;
+        }
+        else
+        {
+            b_AreEventsDifferent = true;
+        }
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsLeq12Needed)
     {
         /* Check if `pt_Stamp1->pt_Event <= pt_Stamp2->pt_Event` */
         t_Status = ITC_Event_leq(
             pt_Stamp1->pt_Event, pt_Stamp2->pt_Event, &b_IsLeq12);
     }
+#if ITC_CONFIG_ENABLE_EVENT_HASH
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    /* Different Events cannot be `<=` to each other both ways */
+    if (b_AreEventsDifferent && b_IsLeq12)
+    {
+        b_IsLeq21 = false;
+        b_IsLeq21Needed = false;
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsLeq21Needed)
     {
         /* Check if `pt_Stamp2->pt_Event <= pt_Stamp1->pt_Event` */
         t_Status = ITC_Event_leq(
@@ -372,11 +662,30 @@ static ITC_Status_t u32FromNetwork(
  *  - Byte 0: The major component of the version of the `libitc` library used to
  *      serialise the data
  *  - Byte 1: The Stamp header.
- *      Contains 2 fields:
+ *      Contains 3 fields:
  *      - Bits 0 - 2: The length of the `ID component length` field (see below)
  *      - Bits 3 - 5: The length of the `Event component length` field
  *        (see below)
- *      - Bits 6 - 7: Reserved, always 0
+ *      - Bit 6: Set if this is a Stamp delta. See below
+ *      - Bit 7: Set if the Stamp header is followed by a Stamp extension
+ *        (see below). Always 0 unless `ITC_CONFIG_ENABLE_STAMP_REBASE`,
+ *        `ITC_CONFIG_ENABLE_STAMP_EPOCH` or
+ *        `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is enabled
+ *  - Bytes 2 - 14 (only present if bit 7 of the Stamp header is set): The
+ *    Stamp extension. All subsequent fields are shifted by its length:
+ *      - Byte 0: The Stamp extension header. Contains 3 fields:
+ *          - Bits 0 - 2: The length of the `Epoch` field (see below). `0` if
+ *            the Stamp is in epoch `0`
+ *          - Bit 3: Set if the Stamp has been rebased. See below
+ *          - Bit 4: Set if the ID or Event component contains a path. Builds
+ *            without `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` reject such
+ *            Stamps with `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT`
+ *          - Bits 5 - 7: Reserved, always 0
+ *      - Bytes 1 - 4: Epoch. Can be 0 - 4 bytes long. See
+ *        ::ITC_Stamp_reseedEpoch(). Serialised in network-endian.
+ *      - Bytes <EPOCH_END + 1> - <EPOCH_END + 8> (only present if bit 3 of
+ *        the Stamp extension header is set): The rebase base ID. See
+ *        ::ITC_Stamp_rebase(). Serialised in network-endian.
  *  - Bytes 2 - 5: ID component length. Can be 1 - 4 bytes long. The length of
  *    this field is encoded in the Stamp header. Serialised in network-endian.
  *  - Bytes (3 - 6) - <ID_END> (see above): The ID tree, **without** a version
@@ -387,7 +696,20 @@ static ITC_Status_t u32FromNetwork(
  *  - Bytes (<ID_END + 2> - <ID_END + 5>) - <EVENT_END> (see above): The Event
  *    tree, **without** a version field. See ::serialiseEvent()
  *
+ * A Stamp delta has the same layout with the following differences:
+ *  - Its Event component only holds `rebase(e, base_e)`
+ *    (see ::ITC_Event_rebase()), i.e. by how much the counters of the Stamp
+ *    exceed the counters of the base Stamp. All unchanged regions collapse
+ *    into `0` leaves, so a delta of a Stamp which differs from the base in a
+ *    few counters serialises into a few Event nodes with small counters
+ *  - If the ID of the Stamp is equal to the ID of the base Stamp, the
+ *    `ID component length` length in the Stamp header is `0` and both the
+ *    `ID component length` and the ID tree are omitted
+ *
  * @param ppt_Stamp The pointer to the Stamp
+ * @param pt_Base The Stamp to serialise a delta against, which must satisfy
+ * `pt_Base->pt_Event <= ppt_Stamp->pt_Event`. Otherwise NULL, in which case
+ * the whole Stamp is serialised
  * @param pu8_Buffer The buffer to hold the serialised data
  * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
  * of the data inside the buffer in bytes.
@@ -397,11 +719,12 @@ static ITC_Status_t u32FromNetwork(
  */
 static ITC_Status_t serialiseStamp(
     const ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base,
     uint8_t *const pu8_Buffer,
     uint32_t *const pu32_BufferSize
 )
 {
-    ITC_Status_t t_Status; /* The current status */
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
     ITC_SerDes_Header_t t_StampHeader = 0;
     uint32_t u32_Offset = 0; /* The current offset into the buffer */
     uint32_t u32_ComponentLength; /* The current serialised component size*/
@@ -409,6 +732,56 @@ static ITC_Status_t serialiseStamp(
     uint8_t ru8_ComponentLength[sizeof(uint32_t)] = { 0 };
     /* The length of `ru8_ComponentLength` */
     uint32_t u32_ComponentLengthLength;
+    /* The Event component to serialise */
+    const ITC_Event_t *pt_Event = pt_Stamp->pt_Event;
+    ITC_Event_t *pt_DeltaEvent = NULL;
+    bool b_IsLeq;
+    /* Whether the ID component is omitted from the delta */
+    bool b_IsIdUnchanged = false;
+#if ITC_SERDES_ENABLE_STAMP_EXTENSION
+    ITC_SerDes_Header_t t_ExtensionHeader = 0;
+    /* The offset of the Stamp extension header into the buffer */
+    uint32_t u32_ExtensionOffset;
+#endif /* ITC_SERDES_ENABLE_STAMP_EXTENSION */
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    bool b_IsIdPathCompressed = false;
+    bool b_IsEventPathCompressed = false;
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+    if (pt_Base)
+    {
+        /* A delta can only describe new events */
+        t_Status = ITC_Event_leq(
+            pt_Base->pt_Event, pt_Stamp->pt_Event, &b_IsLeq);
+
+        if (t_Status == ITC_STATUS_SUCCESS && !b_IsLeq)
+        {
+            t_Status = ITC_STATUS_INVALID_PARAM;
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Event_clone(pt_Stamp->pt_Event, &pt_DeltaEvent);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Only send how much the counters have grown since the base */
+            t_Status = ITC_Event_rebase(&pt_DeltaEvent, pt_Base->pt_Event);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Id_isEqual(
+                pt_Base->pt_Id, pt_Stamp->pt_Id, &b_IsIdUnchanged);
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_Event = pt_DeltaEvent;
+            t_StampHeader = ITC_SERDES_STAMP_SET_IS_DELTA(t_StampHeader, 1);
+        }
+    }
 
     /* Add the lib version (provided by build system c args) */
     pu8_Buffer[u32_Offset] = ITC_VERSION_MAJOR;
@@ -419,47 +792,150 @@ static ITC_Status_t serialiseStamp(
     /* Leave space for the header */
     u32_Offset += sizeof(ITC_SerDes_Header_t);
 
-    /* Calculate the size of the buffer */
-    u32_ComponentLength = *pu32_BufferSize - u32_Offset;
-
-    /* Serialise ID component */
-    t_Status = ITC_SerDes_Util_serialiseId(
-        pt_Stamp->pt_Id,
-        &pu8_Buffer[u32_Offset],
-        &u32_ComponentLength,
-        false);
+#if ITC_SERDES_ENABLE_STAMP_EXTENSION
+    /* Leave space for the extension header. The minimum buffer length
+     * guarantees there is space for it */
+    u32_ExtensionOffset = u32_Offset;
+    u32_Offset += sizeof(ITC_SerDes_Header_t);
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Stamp->u32_Epoch != 0)
     {
         /* Set the size of the buffer */
-        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
+        u32_ComponentLengthLength = *pu32_BufferSize - u32_Offset;
 
-        /* Serialise the ID component length */
+        /* Serialise the epoch */
         t_Status = u32ToNetwork(
-            u32_ComponentLength,
-            &ru8_ComponentLength[0],
+            pt_Stamp->u32_Epoch,
+            &pu8_Buffer[u32_Offset],
             &u32_ComponentLengthLength);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Set the `Epoch` length in the extension header */
+            t_ExtensionHeader = ITC_SERDES_STAMP_SET_EXT_EPOCH_LEN(
+                t_ExtensionHeader, u32_ComponentLengthLength);
+
+            /* Increment offset */
+            u32_Offset += u32_ComponentLengthLength;
+        }
     }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
 
-    /* Check there is enough space left in the buffer before continuing */
-    if (t_Status == ITC_STATUS_SUCCESS &&
-        (*pu32_BufferSize <
-         (u32_Offset + u32_ComponentLengthLength + u32_ComponentLength)))
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Stamp->u64_RebaseBaseId != 0)
     {
-        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        if (*pu32_BufferSize <
+            (u32_Offset + ITC_SERDES_STAMP_REBASE_BASE_ID_LEN))
+        {
+            t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+        }
+        else
+        {
+            /* Add the rebase base ID in network-endian */
+            for (uint32_t u32_I = 0;
+                 u32_I < ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+                 u32_I++)
+            {
+                pu8_Buffer[u32_Offset + u32_I] = (uint8_t)(
+                    pt_Stamp->u64_RebaseBaseId >>
+                    ((ITC_SERDES_STAMP_REBASE_BASE_ID_LEN - 1U - u32_I) * 8U));
+            }
+
+            t_ExtensionHeader = ITC_SERDES_STAMP_SET_EXT_HAS_REBASE_BASE_ID(
+                t_ExtensionHeader, 1);
+
+            /* Increment offset */
+            u32_Offset += ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+        }
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
+    {
+        t_Status = ITC_SerDes_Util_isIdPathCompressed(
+            pt_Stamp->pt_Id, &b_IsIdPathCompressed);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Move contents to free space for the ID component length */
-        memmove(
-            &pu8_Buffer[u32_Offset + u32_ComponentLengthLength],
-            &pu8_Buffer[u32_Offset],
-            u32_ComponentLength);
+        t_Status = ITC_SerDes_Util_isEventPathCompressed(
+            pt_Event, &b_IsEventPathCompressed);
+    }
 
-        /* Copy the serialised ID component length */
-        memcpy(
-            &pu8_Buffer[u32_Offset],
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        (b_IsIdPathCompressed || b_IsEventPathCompressed))
+    {
+        /* Mark the Stamp, so builds which cannot deserialise paths can
+         * report it */
+        t_ExtensionHeader = ITC_SERDES_STAMP_SET_EXT_IS_PATH_COMPRESSED(
+            t_ExtensionHeader, 1);
+    }
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+    if (t_ExtensionHeader != 0)
+    {
+        /* Add the extension header */
+        pu8_Buffer[u32_ExtensionOffset] = t_ExtensionHeader;
+
+        t_StampHeader = ITC_SERDES_STAMP_SET_HAS_EXTENSION(t_StampHeader, 1);
+    }
+    else
+    {
+        /* Stamps in epoch `0`, which have never been rebased and have no
+         * paths, do not need an extension. This keeps their serialised form
+         * compatible with builds which have none of these features enabled */
+        u32_Offset = u32_ExtensionOffset;
+    }
+
+#endif /* ITC_SERDES_ENABLE_STAMP_EXTENSION */
+    /* Calculate the size of the buffer */
+    u32_ComponentLength = *pu32_BufferSize - u32_Offset;
+
+    /* The ID component of a delta is omitted if the base already has it.
+     * The `ID component length` length in the header is left as `0` */
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
+    {
+        /* Serialise ID component */
+        t_Status = ITC_SerDes_Util_serialiseId(
+            pt_Stamp->pt_Id,
+            &pu8_Buffer[u32_Offset],
+            &u32_ComponentLength,
+            false);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
+    {
+        /* Set the size of the buffer */
+        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
+
+        /* Serialise the ID component length */
+        t_Status = u32ToNetwork(
+            u32_ComponentLength,
+            &ru8_ComponentLength[0],
+            &u32_ComponentLengthLength);
+    }
+
+    /* Check there is enough space left in the buffer before continuing */
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged &&
+        (*pu32_BufferSize <
+         (u32_Offset + u32_ComponentLengthLength + u32_ComponentLength)))
+    {
+        t_Status = ITC_STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
+    {
+        /* Move contents to free space for the ID component length */
+        memmove(
+            &pu8_Buffer[u32_Offset + u32_ComponentLengthLength],
+            &pu8_Buffer[u32_Offset],
+            u32_ComponentLength);
+
+        /* Copy the serialised ID component length */
+        memcpy(
+            &pu8_Buffer[u32_Offset],
             &ru8_ComponentLength[0],
             u32_ComponentLengthLength);
 
@@ -469,13 +945,16 @@ static ITC_Status_t serialiseStamp(
 
         /* Increment the offset */
         u32_Offset += u32_ComponentLength + u32_ComponentLengthLength;
+    }
 
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
         /* Set the size of the buffer */
         u32_ComponentLength = *pu32_BufferSize - u32_Offset;
 
         /* Serialise Event component */
         t_Status = ITC_SerDes_Util_serialiseEvent(
-            pt_Stamp->pt_Event,
+            pt_Event,
             &pu8_Buffer[u32_Offset],
             &u32_ComponentLength,
             false);
@@ -529,6 +1008,13 @@ static ITC_Status_t serialiseStamp(
         *pu32_BufferSize = u32_Offset;
     }
 
+    if (pt_DeltaEvent)
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the result of the serialisation */
+        (void)ITC_Event_destroy(&pt_DeltaEvent);
+    }
+
     return t_Status;
 }
 
@@ -684,25 +1170,41 @@ static ITC_Status_t serialiseStampToString(
  *
  * @param pu8_Buffer The buffer holding the serialised Stamp data
  * @param u32_BufferSize The size of the buffer in bytes
+ * @param pt_Base The Stamp the data was serialised as a delta against.
+ * Otherwise NULL, in which case the data must hold a whole Stamp
  * @param ppt_Stamp The pointer to the deserialised Stamp
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_MISMATCHED_STAMP_BASE` if the delta was serialised
+ * against a base with a different rebase base ID
+ * @retval `ITC_STATUS_MISMATCHED_STAMP_EPOCH` if the delta was serialised
+ * against a base from a different epoch
  */
 static ITC_Status_t deserialiseStamp(
     const uint8_t *const pu8_Buffer,
     const uint32_t u32_BufferSize,
+    const ITC_Stamp_t *const pt_Base,
     ITC_Stamp_t **ppt_Stamp
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_SerDes_Header_t t_StampHeader;
+    ITC_SerDes_Header_t t_StampHeader = 0;
     uint32_t u32_Offset = 0; /* The current offset into the buffer */
     uint32_t u32_ComponentLength; /* The current serialised component size */
     /* The length of the `serialised component length` length */
-    uint32_t u32_ComponentLengthLength;
+    uint32_t u32_ComponentLengthLength = 0;
 
     ITC_Id_t *pt_Id = NULL;
     ITC_Event_t *pt_Event = NULL;
+    ITC_SerDes_Header_t t_ExtensionHeader = 0;
+    /* Whether the ID component was omitted from the delta */
+    bool b_IsIdUnchanged = false;
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    uint32_t u32_Epoch = 0; /* The epoch of the Stamp */
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    uint64_t u64_RebaseBaseId = 0; /* The rebase base ID of the Stamp */
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
 
     /* Init stamp */
     *ppt_Stamp = NULL;
@@ -721,8 +1223,10 @@ static ITC_Status_t deserialiseStamp(
         /* Get the stamp header */
         t_StampHeader = pu8_Buffer[u32_Offset];
 
-        /* This is an invalid header */
-        if (t_StampHeader & ~ITC_SERDES_STAMP_HEADER_MASK)
+        /* This is an invalid header, or a delta is deserialised without
+         * its base (or vice versa) */
+        if ((t_StampHeader & ~ITC_SERDES_STAMP_HEADER_MASK) ||
+            (ITC_SERDES_STAMP_GET_IS_DELTA(t_StampHeader) != !!pt_Base))
         {
             t_Status = ITC_STATUS_CORRUPT_STAMP;
         }
@@ -732,19 +1236,144 @@ static ITC_Status_t deserialiseStamp(
     {
         /* Increment the offset */
         u32_Offset += sizeof(ITC_SerDes_Header_t);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        ITC_SERDES_STAMP_GET_HAS_EXTENSION(t_StampHeader))
+    {
+        /* Get the extension header. The minimum buffer length guarantees it
+         * is in bounds */
+        t_ExtensionHeader = pu8_Buffer[u32_Offset];
+
+        /* Increment the offset */
+        u32_Offset += sizeof(ITC_SerDes_Header_t);
+
+        /* The ID or Event contains paths, which this build cannot
+         * deserialise */
+        if (!ITC_CONFIG_USE_PATH_COMPRESSED_SERDES &&
+            ITC_SERDES_STAMP_GET_EXT_IS_PATH_COMPRESSED(t_ExtensionHeader))
+        {
+            t_Status = ITC_STATUS_SERDES_UNSUPPORTED_FORMAT;
+        }
+#if ITC_SERDES_ENABLE_STAMP_EXTENSION
+        /* This is an invalid extension header. Empty extensions are never
+         * serialised */
+        else if ((t_ExtensionHeader & ~ITC_SERDES_STAMP_EXT_HEADER_MASK) ||
+                 (t_ExtensionHeader == 0))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+#else
+        /* This build does not support any other Stamp extension */
+        else
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+#endif /* ITC_SERDES_ENABLE_STAMP_EXTENSION */
+    }
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
 
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        ITC_SERDES_STAMP_GET_EXT_EPOCH_LEN(t_ExtensionHeader))
+    {
         /* Set the size of the buffer */
         u32_ComponentLengthLength =
-            ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(t_StampHeader);
+            ITC_SERDES_STAMP_GET_EXT_EPOCH_LEN(t_ExtensionHeader);
 
-        if ((u32_ComponentLengthLength < 1) ||
+        if ((u32_ComponentLengthLength > sizeof(uint32_t)) ||
             (u32_ComponentLengthLength > (u32_BufferSize - u32_Offset)))
         {
             t_Status = ITC_STATUS_CORRUPT_STAMP;
         }
+        else
+        {
+            /* Deserialise the epoch */
+            t_Status = u32FromNetwork(
+                &pu8_Buffer[u32_Offset],
+                u32_ComponentLengthLength,
+                &u32_Epoch);
+
+            /* Increment the offset */
+            u32_Offset += u32_ComponentLengthLength;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Base &&
+        pt_Base->u32_Epoch != u32_Epoch)
+    {
+        t_Status = ITC_STATUS_MISMATCHED_STAMP_EPOCH;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        ITC_SERDES_STAMP_GET_EXT_HAS_REBASE_BASE_ID(t_ExtensionHeader))
+    {
+        if (ITC_SERDES_STAMP_REBASE_BASE_ID_LEN > (u32_BufferSize - u32_Offset))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+        else
+        {
+            /* Get the rebase base ID from network-endian */
+            for (uint32_t u32_I = 0;
+                 u32_I < ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+                 u32_I++)
+            {
+                u64_RebaseBaseId = (u64_RebaseBaseId << 8U) |
+                                   pu8_Buffer[u32_Offset + u32_I];
+            }
+
+            /* Increment the offset */
+            u32_Offset += ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+
+            /* The serialiser never flags a `0` rebase base ID */
+            if (u64_RebaseBaseId == 0)
+            {
+                t_Status = ITC_STATUS_CORRUPT_STAMP;
+            }
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Base &&
+        pt_Base->u64_RebaseBaseId != u64_RebaseBaseId)
+    {
+        t_Status = ITC_STATUS_MISMATCHED_STAMP_BASE;
     }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
 
     if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Set the size of the buffer */
+        u32_ComponentLengthLength =
+            ITC_SERDES_STAMP_GET_ID_COMPONENT_LEN_LEN(t_StampHeader);
+
+        /* A delta omits the ID component if it is the ID of the base */
+        if (pt_Base && u32_ComponentLengthLength == 0)
+        {
+            b_IsIdUnchanged = true;
+        }
+        else if ((u32_ComponentLengthLength < 1) ||
+                 (u32_ComponentLengthLength > (u32_BufferSize - u32_Offset)))
+        {
+            t_Status = ITC_STATUS_CORRUPT_STAMP;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsIdUnchanged)
+    {
+        t_Status = ITC_Id_clone(pt_Base->pt_Id, &pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
     {
         /* Deserialise the ID component length */
         t_Status = u32FromNetwork(
@@ -753,7 +1382,7 @@ static ITC_Status_t deserialiseStamp(
             &u32_ComponentLength);
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
     {
         /* Increment offset */
         u32_Offset += u32_ComponentLengthLength;
@@ -765,7 +1394,7 @@ static ITC_Status_t deserialiseStamp(
         }
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsIdUnchanged)
     {
         /* Deserialise the ID component */
         t_Status = ITC_SerDes_Util_deserialiseId(
@@ -773,13 +1402,13 @@ static ITC_Status_t deserialiseStamp(
             u32_ComponentLength,
             false,
             &pt_Id);
-    }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
         /* Increment the offset */
         u32_Offset += u32_ComponentLength;
+    }
 
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
         /* Set the size of the buffer */
         u32_ComponentLengthLength =
             ITC_SERDES_STAMP_GET_EVENT_COMPONENT_LEN_LEN(t_StampHeader);
@@ -834,6 +1463,12 @@ static ITC_Status_t deserialiseStamp(
         }
     }
 
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Base)
+    {
+        /* Apply the delta: `add(rebase(e, base_e), base_e) == e` */
+        t_Status = ITC_Event_add(&pt_Event, pt_Base->pt_Event);
+    }
+
     /* Create the Stamp */
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -841,6 +1476,21 @@ static ITC_Status_t deserialiseStamp(
             ppt_Stamp, pt_Id, pt_Event, false, false, false);
     }
 
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        (*ppt_Stamp)->u64_RebaseBaseId = u64_RebaseBaseId;
+    }
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        (*ppt_Stamp)->u32_Epoch = u32_Epoch;
+    }
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
     if (t_Status != ITC_STATUS_SUCCESS)
     {
         /* There is nothing else to do if a destroy call fails. Also it is more
@@ -867,79 +1517,308 @@ static ITC_Status_t deserialiseStamp(
     return t_Status;
 }
 
-/******************************************************************************
- * Public functions
- ******************************************************************************/
-
-/******************************************************************************
- * Allocate a new ITC seed Stamp and initialise it
- ******************************************************************************/
-
-ITC_Status_t ITC_Stamp_newSeed(
-    ITC_Stamp_t **ppt_Stamp
+/**
+ * @brief Calculate the size of a serialised Stamp without serialising it
+ *
+ * Mirrors the data format of ::serialiseStamp() for a whole Stamp.
+ *
+ * @param pt_Stamp The Stamp
+ * @param pu32_Size (out) The size of the serialised Stamp in bytes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t getSerialisedStampSize(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint32_t *const pu32_Size
 )
 {
-    if (!ppt_Stamp)
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    uint32_t u32_ComponentLength; /* The current serialised component size*/
+    /* Scratch space for serialising `u32_ComponentLength` */
+    uint8_t ru8_ComponentLength[sizeof(uint32_t)] = { 0 };
+    /* The length of the serialised `u32_ComponentLength` */
+    uint32_t u32_ComponentLengthLength;
+    bool b_HasExtension = false; /* Whether a Stamp extension is needed */
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    bool b_IsPathCompressed = false;
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+    /* The version and the Stamp header */
+    *pu32_Size = ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t);
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+
+    if (pt_Stamp->u32_Epoch != 0)
     {
-        return ITC_STATUS_INVALID_PARAM;
+        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
+        t_Status = u32ToNetwork(
+            pt_Stamp->u32_Epoch,
+            &ru8_ComponentLength[0],
+            &u32_ComponentLengthLength);
+
+        /* The epoch */
+        *pu32_Size += u32_ComponentLengthLength;
+        b_HasExtension = true;
     }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
 
-    return newStampWithIdAndEvent(ppt_Stamp, NULL, NULL, false, false, false);
-}
+    if (pt_Stamp->u64_RebaseBaseId != 0)
+    {
+        *pu32_Size += ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+        b_HasExtension = true;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
 
-/******************************************************************************
- * Allocate a new ITC peek Stamp based on an existing Stamp
- ******************************************************************************/
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_isIdPathCompressed(
+            pt_Stamp->pt_Id, &b_IsPathCompressed);
+    }
 
-ITC_Status_t ITC_Stamp_newPeek(
-    const ITC_Stamp_t *const pt_Stamp,
-    ITC_Stamp_t **ppt_PeekStamp
-)
-{
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    if (t_Status == ITC_STATUS_SUCCESS && !b_IsPathCompressed)
+    {
+        t_Status = ITC_SerDes_Util_isEventPathCompressed(
+            pt_Stamp->pt_Event, &b_IsPathCompressed);
+    }
 
-    if (!ppt_PeekStamp)
+    b_HasExtension = b_HasExtension || b_IsPathCompressed;
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+    if (b_HasExtension)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        /* The extension header */
+        *pu32_Size += sizeof(ITC_SerDes_Header_t);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp);
+        t_Status = ITC_SerDes_Util_getSerialisedIdSize(
+            pt_Stamp->pt_Id, false, &u32_ComponentLength);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newStampWithIdAndEvent(
-            ppt_PeekStamp, NULL, pt_Stamp->pt_Event, true, false, true);
+        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
+        t_Status = u32ToNetwork(
+            u32_ComponentLength,
+            &ru8_ComponentLength[0],
+            &u32_ComponentLengthLength);
+
+        *pu32_Size += u32_ComponentLengthLength + u32_ComponentLength;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_SerDes_Util_getSerialisedEventSize(
+            pt_Stamp->pt_Event, false, &u32_ComponentLength);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        u32_ComponentLengthLength = sizeof(ru8_ComponentLength);
+        t_Status = u32ToNetwork(
+            u32_ComponentLength,
+            &ru8_ComponentLength[0],
+            &u32_ComponentLengthLength);
+
+        *pu32_Size += u32_ComponentLengthLength + u32_ComponentLength;
     }
 
     return t_Status;
 }
 
-/******************************************************************************
- * Free an allocated ITC Stamp
- ******************************************************************************/
+/**
+ * @brief Get the effective budget from a caller and a configured budget
+ *
+ * @param u32_Budget The budget set by the caller. `0` means unlimited
+ * @param u32_ConfigBudget The configured budget. `0` means unlimited
+ * @return `uint32_t` The smaller of the set budgets. `0` if neither is set
+ */
+static uint32_t getCompactBudget(
+    const uint32_t u32_Budget,
+    const uint32_t u32_ConfigBudget
+)
+{
+    if (u32_Budget == 0 ||
+        (u32_ConfigBudget != 0 && u32_ConfigBudget < u32_Budget))
+    {
+        return u32_ConfigBudget;
+    }
 
-ITC_Status_t ITC_Stamp_destroy(
-    ITC_Stamp_t **ppt_Stamp
+    return u32_Budget;
+}
+
+/**
+ * @brief Check whether a Stamp exceeds a compaction budget
+ *
+ * @param pt_Stamp The Stamp to check
+ * @param u32_NodeBudget The maximum number of Event nodes. `0` means unlimited
+ * @param u32_SizeBudget The maximum serialised size of the Stamp in bytes.
+ * `0` means unlimited
+ * @param pb_IsOverBudget (out) Whether either budget is exceeded
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t isStampOverCompactBudget(
+    const ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_NodeBudget,
+    const uint32_t u32_SizeBudget,
+    bool *const pb_IsOverBudget
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+    ITC_Event_Metrics_t t_Metrics;
+    uint32_t u32_Size;
 
-    if (!ppt_Stamp)
+    *pb_IsOverBudget = false;
+
+    if (u32_NodeBudget != 0)
     {
-        t_Status = ITC_STATUS_INVALID_PARAM;
+        t_Status = ITC_Event_getMetrics(pt_Stamp->pt_Event, &t_Metrics);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            *pb_IsOverBudget = t_Metrics.u32_Nodes > u32_NodeBudget;
+        }
     }
-    else if (*ppt_Stamp)
+
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        !*pb_IsOverBudget &&
+        u32_SizeBudget != 0)
     {
-        if ((*ppt_Stamp)->pt_Event)
-        {
-            /* Destroy the Event tree */
-            t_FreeStatus = ITC_Event_destroy(&(*ppt_Stamp)->pt_Event);
+        t_Status = getSerialisedStampSize(pt_Stamp, &u32_Size);
 
-            if (t_FreeStatus != ITC_STATUS_SUCCESS)
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            *pb_IsOverBudget = u32_Size > u32_SizeBudget;
+        }
+    }
+
+    return t_Status;
+}
+
+/**
+ * @brief Compact the Event of a Stamp, fulfilling `fill(i, e)` with the full
+ * ID of the Stamp
+ *
+ * Like ::ITC_Stamp_event(), this inflates the Event of the Stamp. Only the
+ * parts of the Event inside the ID are raised, so the result is the same as
+ * recording a local event that happens to shrink the Event tree.
+ *
+ * @param pt_Stamp The Stamp to compact
+ * @param pb_WasCompacted (out) Whether the Event was changed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t compactStamp(
+    ITC_Stamp_t *const pt_Stamp,
+    bool *const pb_WasCompacted
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = ITC_Event_fill(
+        &pt_Stamp->pt_Event, pt_Stamp->pt_Id, pb_WasCompacted);
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+    if (t_Status == ITC_STATUS_SUCCESS && *pb_WasCompacted)
+    {
+        /* The Event has changed */
+        pt_Stamp->b_IsEventHashCached = false;
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+/******************************************************************************
+ * Allocate a new ITC seed Stamp and initialise it
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_newSeed(
+    ITC_Stamp_t **ppt_Stamp
+)
+{
+    if (!ppt_Stamp)
+    {
+        return ITC_STATUS_INVALID_PARAM;
+    }
+
+    return newStampWithIdAndEvent(ppt_Stamp, NULL, NULL, false, false, false);
+}
+
+/******************************************************************************
+ * Allocate a new ITC peek Stamp based on an existing Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_newPeek(
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_t **ppt_PeekStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!ppt_PeekStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_PeekStamp, NULL, pt_Stamp->pt_Event, true, false, true);
+    }
+
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        (*ppt_PeekStamp)->u64_RebaseBaseId = pt_Stamp->u64_RebaseBaseId;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        (*ppt_PeekStamp)->u32_Epoch = pt_Stamp->u32_Epoch;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Free an allocated ITC Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_destroy(
+    ITC_Stamp_t **ppt_Stamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_FreeStatus = ITC_STATUS_SUCCESS; /* The last free status */
+
+    if (!ppt_Stamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else if (*ppt_Stamp)
+    {
+        if ((*ppt_Stamp)->pt_Event)
+        {
+            /* Destroy the Event tree */
+            t_FreeStatus = ITC_Event_destroy(&(*ppt_Stamp)->pt_Event);
+
+            if (t_FreeStatus != ITC_STATUS_SUCCESS)
             {
                 t_Status = t_FreeStatus;
             }
@@ -984,271 +1863,1088 @@ ITC_Status_t ITC_Stamp_clone(
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
 
-    if (!ppt_ClonedStamp)
+    if (!ppt_ClonedStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStampWithIdAndEvent(
+            ppt_ClonedStamp,
+            pt_Stamp->pt_Id,
+            pt_Stamp->pt_Event,
+            false,
+            true,
+            true);
+    }
+
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        (*ppt_ClonedStamp)->u64_RebaseBaseId = pt_Stamp->u64_RebaseBaseId;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        (*ppt_ClonedStamp)->u32_Epoch = pt_Stamp->u32_Epoch;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Validate a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_validate(
+    const ITC_Stamp_t *const pt_Stamp
+)
+{
+    return validateStamp(pt_Stamp);
+}
+
+/******************************************************************************
+ * Fork an existing Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_fork(
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_Stamp_t **ppt_OtherStamp
+)
+{
+    return ITC_Stamp_forkWeighted(ppt_Stamp, ppt_OtherStamp, 1, 1);
+}
+
+/******************************************************************************
+ * Fork an existing Stamp with uneven ID shares
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_forkWeighted(
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_Stamp_t **ppt_OtherStamp,
+    const uint32_t u32_Numerator,
+    const uint8_t u8_DenominatorLog2
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SplitId1 = NULL;
+    ITC_Id_t *pt_SplitId2 = NULL;
+
+    if (!ppt_Stamp || !ppt_OtherStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Init Stamp */
+        *ppt_OtherStamp = NULL;
+
+        t_Status = validateStamp(*ppt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Split the ID */
+        t_Status = ITC_Id_splitWeightedConst(
+            (*ppt_Stamp)->pt_Id,
+            &pt_SplitId1,
+            &pt_SplitId2,
+            u32_Numerator,
+            u8_DenominatorLog2);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Create the other Stamp and clone the Event component */
+        t_Status = newStampWithIdAndEvent(
+            ppt_OtherStamp,
+            pt_SplitId2,
+            (*ppt_Stamp)->pt_Event,
+            false,
+            false,
+            true);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Forget the ID. The Stamp now has "ownership" of it and its
+             * destruct function will deallocated it when needed */
+            pt_SplitId2 = NULL;
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+            (*ppt_OtherStamp)->u64_RebaseBaseId = (*ppt_Stamp)->u64_RebaseBaseId;
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+            (*ppt_OtherStamp)->u32_Epoch = (*ppt_Stamp)->u32_Epoch;
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Destroy the first Stamp ID.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall fork
+         * operation was successful. */
+        (void)ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+
+        /* Replace with the first half of the split ID */
+        (*ppt_Stamp)->pt_Id = pt_SplitId1;
+    }
+    else
+    {
+        /* Deallocate the Stamp and IDs.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey original reason for
+         * the failure, rather than the destroy failure */
+        (void)ITC_Stamp_destroy(ppt_OtherStamp);
+        (void)ITC_Id_destroy(&pt_SplitId1);
+        (void)ITC_Id_destroy(&pt_SplitId2);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Fork an existing Stamp into multiple Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_forkN(
+    ITC_Stamp_t **ppt_Stamp,
+    const uint32_t u32_StampsCount,
+    ITC_Stamp_t **ppt_OtherStamps
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t **ppt_SplitIds = NULL;
+    /* Whether the split IDs have been allocated */
+    bool b_HasSplitIds = false;
+    uint32_t u32_I = 0;
+
+    if (!ppt_Stamp || !u32_StampsCount || !ppt_OtherStamps)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Init Stamps */
+        for (u32_I = 0; u32_I < u32_StampsCount - 1; u32_I++)
+        {
+            ppt_OtherStamps[u32_I] = NULL;
+        }
+
+        t_Status = validateStamp(*ppt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&ppt_SplitIds, u32_StampsCount * sizeof(ITC_Id_t *));
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Split the ID */
+        t_Status = ITC_Id_splitNConst(
+            (*ppt_Stamp)->pt_Id, u32_StampsCount, ppt_SplitIds);
+        u32_I = 1;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        b_HasSplitIds = true;
+    }
+
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampsCount)
+    {
+        /* Create the other Stamp and clone the Event component */
+        t_Status = newStampWithIdAndEvent(
+            &ppt_OtherStamps[u32_I - 1],
+            ppt_SplitIds[u32_I],
+            (*ppt_Stamp)->pt_Event,
+            false,
+            false,
+            true);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* Forget the ID. The Stamp now has "ownership" of it and its
+             * destruct function will deallocated it when needed */
+            ppt_SplitIds[u32_I] = NULL;
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+            ppt_OtherStamps[u32_I - 1]->u64_RebaseBaseId =
+                (*ppt_Stamp)->u64_RebaseBaseId;
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+            ppt_OtherStamps[u32_I - 1]->u32_Epoch = (*ppt_Stamp)->u32_Epoch;
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+        }
+
+        u32_I++;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Destroy the first Stamp ID.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall fork
+         * operation was successful. */
+        (void)ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+
+        /* Replace with the first part of the split ID */
+        (*ppt_Stamp)->pt_Id = ppt_SplitIds[0];
+    }
+    else
+    {
+        /* Deallocate the Stamps and IDs.
+         * Ignore return status. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey original reason for
+         * the failure, rather than the destroy failure */
+        for (u32_I = 0; b_HasSplitIds && u32_I < u32_StampsCount; u32_I++)
+        {
+            (void)ITC_Id_destroy(&ppt_SplitIds[u32_I]);
+
+            if (u32_I < u32_StampsCount - 1)
+            {
+                (void)ITC_Stamp_destroy(&ppt_OtherStamps[u32_I]);
+            }
+        }
+    }
+
+    if (ppt_SplitIds)
+    {
+        /* There is nothing else to do if the free fails */
+        (void)ITC_Port_free(ppt_SplitIds);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Add a new Event to the Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_event(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    return ITC_Stamp_eventWithGrowPolicy(
+        pt_Stamp, (ITC_Event_GrowPolicy_t)ITC_CONFIG_EVENT_GROW_POLICY);
+}
+
+/******************************************************************************
+ * Add a new Event to the Stamp using the given grow policy
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_eventWithGrowPolicy(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_GrowPolicy_t t_GrowPolicy
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    bool b_WasFilled = false;
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    bool b_WasBatched = false;
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+    if (t_GrowPolicy != ITC_EVENT_GROW_POLICY_MIN_SIZE &&
+        t_GrowPolicy != ITC_EVENT_GROW_POLICY_MIN_DEPTH &&
+        t_GrowPolicy != ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+    if (t_Status == ITC_STATUS_SUCCESS && pt_Stamp && pt_Stamp->b_IsBatched)
+    {
+        /* `fill` and `grow` rely on normalised components. Normalise the
+         * Stamp now and put it back in the batch afterwards */
+        b_WasBatched = true;
+        t_Status = normaliseBatchedStamp(pt_Stamp);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_fill(
+            &pt_Stamp->pt_Event, pt_Stamp->pt_Id, &b_WasFilled);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !b_WasFilled)
+    {
+        t_Status = ITC_Event_growWithPolicy(
+            &pt_Stamp->pt_Event, pt_Stamp->pt_Id, t_GrowPolicy);
+    }
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The Event has changed */
+        pt_Stamp->b_IsEventHashCached = false;
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+    if (b_WasBatched)
+    {
+        pt_Stamp->b_IsBatched = true;
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compact the Event of a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compact(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    bool b_WasCompacted;
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = compactStamp(pt_Stamp, &b_WasCompacted);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compact the Event of a Stamp if it exceeds a budget
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compactIfOverBudget(
+    ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_NodeBudget,
+    const uint32_t u32_SizeBudget,
+    bool *const pb_WasCompacted
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    bool b_IsOverBudget = false;
+
+    if (!pb_WasCompacted)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+    else
+    {
+        *pb_WasCompacted = false;
+
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The configured budgets always apply */
+        t_Status = isStampOverCompactBudget(
+            pt_Stamp,
+            getCompactBudget(
+                u32_NodeBudget, ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET),
+            getCompactBudget(
+                u32_SizeBudget, ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET),
+            &b_IsOverBudget);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsOverBudget)
+    {
+        t_Status = compactStamp(pt_Stamp, pb_WasCompacted);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Join two existing Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_join(
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_Stamp_t **ppt_OtherStamp
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Id_t *pt_SummedId = NULL;
+    ITC_Event_t *pt_JoinedEvent = NULL;
+    ITC_Stamp_t *pt_JoinedStamp = NULL;
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    bool b_IsBatched = false;
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+    if (!ppt_Stamp || !ppt_OtherStamp)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+        /* Joining into a batch defers the normalisation of the result */
+        b_IsBatched = (*ppt_Stamp && (*ppt_Stamp)->b_IsBatched) ||
+                      (*ppt_OtherStamp && (*ppt_OtherStamp)->b_IsBatched);
+
+        if (b_IsBatched)
+        {
+            t_Status = joinBatchedStampComponents(
+                *ppt_Stamp, *ppt_OtherStamp, &pt_SummedId, &pt_JoinedEvent);
+        }
+        else
+        {
+            t_Status = joinStampComponents(
+                *ppt_Stamp, *ppt_OtherStamp, &pt_SummedId, &pt_JoinedEvent);
+        }
+#else
+        t_Status = joinStampComponents(
+            *ppt_Stamp, *ppt_OtherStamp, &pt_SummedId, &pt_JoinedEvent);
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = newStamp(&pt_JoinedStamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+        /* Both Stamps have the same rebase base ID */
+        pt_JoinedStamp->u64_RebaseBaseId = (*ppt_Stamp)->u64_RebaseBaseId;
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+        /* Both Stamps are in the same epoch */
+        pt_JoinedStamp->u32_Epoch = (*ppt_Stamp)->u32_Epoch;
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+        /* Destroy the source Stamps
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall join
+         * operation was successful. */
+        (void)ITC_Stamp_destroy(ppt_Stamp);
+        (void)ITC_Stamp_destroy(ppt_OtherStamp);
+
+        /* Create the new Stamp. */
+        pt_JoinedStamp->pt_Event = pt_JoinedEvent;
+        pt_JoinedStamp->pt_Id = pt_SummedId;
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+        pt_JoinedStamp->b_IsBatched = b_IsBatched;
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+        /* Forget the ID and Event. The Stamp now has "ownership" */
+        pt_SummedId = NULL;
+        pt_JoinedEvent = NULL;
+
+        /* Return the joined Stamp */
+        *ppt_Stamp = pt_JoinedStamp;
+    }
+    else
+    {
+        /* Something went wrong, destroy anything that might have been created.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey the original reason
+         * for the failure, rather than the destroy failure. */
+        (void)ITC_Id_destroy(&pt_SummedId);
+        (void)ITC_Event_destroy(&pt_JoinedEvent);
+        (void)ITC_Stamp_destroy(&pt_JoinedStamp);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Compare two existing Stamps
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_compare(
+    const ITC_Stamp_t *const pt_Stamp1,
+    const ITC_Stamp_t *const pt_Stamp2,
+    ITC_Stamp_Comparison_t *pt_Result
+
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    /* Whether the Events of the Stamps must be compared */
+    bool b_IsEventComparisonNeeded = true;
+
+    if (!pt_Result)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp1);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp2);
+    }
+
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    if (t_Status == ITC_STATUS_SUCCESS &&
+        pt_Stamp1->u32_Epoch != pt_Stamp2->u32_Epoch)
+    {
+        /* All events of an epoch happened before the Stamps were reseeded
+         * into a later epoch */
+        if (pt_Stamp1->u32_Epoch < pt_Stamp2->u32_Epoch)
+        {
+            *pt_Result = ITC_STAMP_COMPARISON_LESS_THAN;
+        }
+        else
+        {
+            *pt_Result = ITC_STAMP_COMPARISON_GREATER_THAN;
+        }
+
+        b_IsEventComparisonNeeded = false;
+    }
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsEventComparisonNeeded)
+    {
+        t_Status = validateStampRebaseBaseIds(pt_Stamp1, pt_Stamp2);
+    }
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsEventComparisonNeeded)
+    {
+        /* Compare *pt_Stamp1 to *pt_Stamp2 */
+        t_Status = compareStamps(pt_Stamp1, pt_Stamp2, pt_Result);
+    }
+
+    return t_Status;
+}
+
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/******************************************************************************
+ * Start deferring the normalisation of a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_beginBatch(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_Stamp->b_IsBatched = true;
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Normalise a batched Stamp and stop deferring its normalisation
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_endBatch(
+    ITC_Stamp_t *const pt_Stamp
+)
+{
+    return normaliseBatchedStamp(pt_Stamp);
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+/******************************************************************************
+ * Calculate the hash of the Event component of a Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_hash(
+    ITC_Stamp_t *const pt_Stamp,
+    uint64_t *pu64_Hash
+)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+
+    if (!pu64_Hash)
+    {
+        t_Status = ITC_STATUS_INVALID_PARAM;
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Stamp);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS && !pt_Stamp->b_IsEventHashCached)
+    {
+        t_Status = ITC_Event_hash(
+            pt_Stamp->pt_Event, &pt_Stamp->u64_EventHash);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            pt_Stamp->b_IsEventHashCached = true;
+        }
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        *pu64_Hash = pt_Stamp->u64_EventHash;
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/******************************************************************************
+ * Rebase a Stamp against a base Stamp
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_rebase(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    uint64_t u64_RebaseBaseId = 0; /* The new rebase base ID */
+
+    t_Status = validateStamp(pt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Base);
+    }
+
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampEpochs(pt_Stamp, pt_Base);
+    }
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampRebaseBaseIds(pt_Stamp, pt_Base);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Identify the base before the Event changes, as both Stamps might
+         * share it */
+        t_Status = ITC_Event_chainRebaseBaseId(
+            pt_Base->pt_Event,
+            pt_Stamp->u64_RebaseBaseId,
+            &u64_RebaseBaseId);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The Event is left untouched on failure */
+        t_Status = ITC_Event_rebase(&pt_Stamp->pt_Event, pt_Base->pt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Only Stamps rebased against the same chain of bases can be
+         * compared with this one */
+        pt_Stamp->u64_RebaseBaseId = u64_RebaseBaseId;
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+        /* The Event has changed */
+        pt_Stamp->b_IsEventHashCached = false;
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+    }
+
+    return t_Status;
+}
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+
+/******************************************************************************
+ * Reseed a Stamp into a later epoch
+ ******************************************************************************/
+
+ITC_Status_t ITC_Stamp_reseedEpoch(
+    ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_Epoch,
+    const uint32_t u32_PeerIndex,
+    const uint32_t u32_PeersCount
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Event_t *pt_Event = NULL;
+
+    t_Status = validateStamp(pt_Stamp);
+
+    /* Epochs can only move forward */
+    if (t_Status == ITC_STATUS_SUCCESS && u32_Epoch <= pt_Stamp->u32_Epoch)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp);
+        t_Status = ITC_Id_newBalanced(u32_PeerIndex, u32_PeersCount, &pt_Id);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = newStampWithIdAndEvent(
-            ppt_ClonedStamp,
-            pt_Stamp->pt_Id,
-            pt_Stamp->pt_Event,
-            false,
-            true,
-            true);
+        t_Status = ITC_Event_newShared(&pt_Event);
     }
 
-    return t_Status;
-}
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Destroy the old components.
+         * Ignore return statuses. There is nothing else to do if the destroy
+         * fails. Also it is more important to convey that the overall reseed
+         * operation was successful */
+        (void)ITC_Id_destroy(&pt_Stamp->pt_Id);
+        (void)ITC_Event_destroy(&pt_Stamp->pt_Event);
 
-/******************************************************************************
- * Validate a Stamp
- ******************************************************************************/
+        pt_Stamp->pt_Id = pt_Id;
+        pt_Stamp->pt_Event = pt_Event;
+        pt_Stamp->u32_Epoch = u32_Epoch;
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
 
-ITC_Status_t ITC_Stamp_validate(
-    const ITC_Stamp_t *const pt_Stamp
-)
-{
-    return validateStamp(pt_Stamp);
+        /* The new Event is not relative to any base */
+        pt_Stamp->u64_RebaseBaseId = 0;
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+        /* The Event has changed */
+        pt_Stamp->b_IsEventHashCached = false;
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+    }
+    else
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the original reason for the failure */
+        (void)ITC_Id_destroy(&pt_Id);
+    }
+
+    return t_Status;
 }
 
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
 /******************************************************************************
- * Fork an existing Stamp
+ * Rebalance the IDs of a set of Stamps
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_fork(
-    ITC_Stamp_t **ppt_Stamp,
-    ITC_Stamp_t **ppt_OtherStamp
+ITC_Status_t ITC_Stamp_rebalance(
+    ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampsLength
 )
 {
     ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_SplitId1 = NULL;
-    ITC_Id_t *pt_SplitId2 = NULL;
+    const ITC_Id_t **ppt_Ids = NULL;
+    ITC_Id_t **ppt_NewIds = NULL;
+    ITC_Event_t **ppt_NewEvents = NULL;
+    /* The join of the Events of all Stamps */
+    ITC_Event_t *pt_JoinedEvent = NULL;
+    ITC_Event_t *pt_NextJoinedEvent = NULL;
+    /* Whether the new IDs have been allocated */
+    bool b_HasNewIds = false;
+    uint32_t u32_I = 0;
 
-    if (!ppt_Stamp || !ppt_OtherStamp)
+    if (!ppt_Stamps || !u32_StampsLength)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampsLength)
     {
-        /* Init Stamp */
-        *ppt_OtherStamp = NULL;
+        t_Status = validateStamp(ppt_Stamps[u32_I]);
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
 
-        t_Status = validateStamp(*ppt_Stamp);
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = validateStampEpochs(ppt_Stamps[0], ppt_Stamps[u32_I]);
+        }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = validateStampRebaseBaseIds(
+                ppt_Stamps[0], ppt_Stamps[u32_I]);
+        }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+        u32_I++;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Split the ID */
-        t_Status = ITC_Id_splitConst(
-            (*ppt_Stamp)->pt_Id, &pt_SplitId1, &pt_SplitId2);
+        t_Status = ITC_Port_malloc(
+            (void **)&ppt_Ids, u32_StampsLength * sizeof(ITC_Id_t *));
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Create the other Stamp and clone the Event component */
-        t_Status = newStampWithIdAndEvent(
-            ppt_OtherStamp,
-            pt_SplitId2,
-            (*ppt_Stamp)->pt_Event,
-            false,
-            false,
-            true);
+        t_Status = ITC_Port_malloc(
+            (void **)&ppt_NewIds, u32_StampsLength * sizeof(ITC_Id_t *));
+    }
 
-        if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Port_malloc(
+            (void **)&ppt_NewEvents,
+            u32_StampsLength * sizeof(ITC_Event_t *));
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        for (u32_I = 0; u32_I < u32_StampsLength; u32_I++)
         {
-            /* Forget the ID. The Stamp now has "ownership" of it and its
-             * destruct function will deallocated it when needed */
-            pt_SplitId2 = NULL;
+            ppt_Ids[u32_I] = ppt_Stamps[u32_I]->pt_Id;
+            ppt_NewEvents[u32_I] = NULL;
         }
+
+        t_Status = ITC_Id_rebalanceConst(
+            ppt_Ids, u32_StampsLength, ppt_NewIds);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Destroy the first Stamp ID.
-         * Ignore return status. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall fork
-         * operation was successful. */
-        (void)ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+        b_HasNewIds = true;
 
-        /* Replace with the first half of the split ID */
-        (*ppt_Stamp)->pt_Id = pt_SplitId1;
+        t_Status = ITC_Event_clone(ppt_Stamps[0]->pt_Event, &pt_JoinedEvent);
+        u32_I = 1;
     }
-    else
+
+    /* Join the Events one by one */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampsLength)
     {
-        /* Deallocate the Stamp and IDs.
-         * Ignore return status. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey original reason for
-         * the failure, rather than the destroy failure */
-        (void)ITC_Stamp_destroy(ppt_OtherStamp);
-        (void)ITC_Id_destroy(&pt_SplitId1);
-        (void)ITC_Id_destroy(&pt_SplitId2);
+        t_Status = ITC_Event_joinConst(
+            pt_JoinedEvent, ppt_Stamps[u32_I]->pt_Event, &pt_NextJoinedEvent);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            /* There is nothing else to do if the destroy fails. Also it is
+             * more important to convey the result of the join */
+            (void)ITC_Event_destroy(&pt_JoinedEvent);
+            pt_JoinedEvent = pt_NextJoinedEvent;
+        }
+
+        u32_I++;
     }
 
-    return t_Status;
-}
+    /* Remap the Events. The intervals a Stamp now owns might have been
+     * incremented by any of the Stamps. Make the Stamp witness everything that
+     * happened in them, so its future events dominate all past ones there */
+    u32_I = 0;
 
-/******************************************************************************
- * Add a new Event to the Stamp
- ******************************************************************************/
+    while (t_Status == ITC_STATUS_SUCCESS && u32_I < u32_StampsLength)
+    {
+        t_Status = ITC_Event_clone(
+            ppt_Stamps[u32_I]->pt_Event, &ppt_NewEvents[u32_I]);
 
-ITC_Status_t ITC_Stamp_event(
-    ITC_Stamp_t *const pt_Stamp
-)
-{
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    bool b_WasFilled = false;
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            t_Status = ITC_Event_joinOwned(
+                &ppt_NewEvents[u32_I], pt_JoinedEvent, ppt_NewIds[u32_I]);
+        }
+
+        u32_I++;
+    }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp);
+        for (u32_I = 0; u32_I < u32_StampsLength; u32_I++)
+        {
+            /* Destroy the old components.
+             * Ignore return statuses. There is nothing else to do if the
+             * destroy fails. Also it is more important to convey that the
+             * overall rebalance operation was successful */
+            (void)ITC_Id_destroy(&ppt_Stamps[u32_I]->pt_Id);
+            (void)ITC_Event_destroy(&ppt_Stamps[u32_I]->pt_Event);
+
+            ppt_Stamps[u32_I]->pt_Id = ppt_NewIds[u32_I];
+            ppt_Stamps[u32_I]->pt_Event = ppt_NewEvents[u32_I];
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+            /* The Event might have changed */
+            ppt_Stamps[u32_I]->b_IsEventHashCached = false;
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+        }
+    }
+    else
+    {
+        /* There is nothing else to do if the destroy fails. Also it is more
+         * important to convey the original reason for the failure */
+        for (u32_I = 0; b_HasNewIds && u32_I < u32_StampsLength; u32_I++)
+        {
+            (void)ITC_Id_destroy(&ppt_NewIds[u32_I]);
+            (void)ITC_Event_destroy(&ppt_NewEvents[u32_I]);
+        }
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    /* There is nothing else to do if the destroy or free fails */
+    (void)ITC_Event_destroy(&pt_JoinedEvent);
+
+    if (ppt_Ids)
     {
-        t_Status = ITC_Event_fill(
-            &pt_Stamp->pt_Event, pt_Stamp->pt_Id, &b_WasFilled);
+        (void)ITC_Port_free((void *)ppt_Ids);
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS && !b_WasFilled)
+    if (ppt_NewIds)
+    {
+        (void)ITC_Port_free(ppt_NewIds);
+    }
+
+    if (ppt_NewEvents)
     {
-        t_Status = ITC_Event_grow(&pt_Stamp->pt_Event, pt_Stamp->pt_Id);
+        (void)ITC_Port_free(ppt_NewEvents);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Join two existing Stamps
+ * Serialise an existing ITC Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_join(
-    ITC_Stamp_t **ppt_Stamp,
-    ITC_Stamp_t **ppt_OtherStamp
+ITC_Status_t ITC_SerDes_serialiseStamp(
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
-    ITC_Id_t *pt_SummedId = NULL;
-    ITC_Event_t *pt_JoinedEvent = NULL;
-    ITC_Stamp_t *pt_JoinedStamp = NULL;
+    ITC_Status_t t_Status; /* The current status */
 
-    if (!ppt_Stamp || !ppt_OtherStamp)
-    {
-        t_Status = ITC_STATUS_INVALID_PARAM;
-    }
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(*ppt_Stamp);
+        t_Status = validateStamp(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(*ppt_OtherStamp);
+        t_Status = serialiseStamp(
+            pt_Stamp, NULL, pu8_Buffer, pu32_BufferSize);
     }
 
+    return t_Status;
+}
+
+/******************************************************************************
+ * Serialise an existing ITC Stamp for persisting it
+ ******************************************************************************/
+
+ITC_Status_t ITC_SerDes_persistStamp(
+    ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    bool b_IsOverBudget = false;
+    bool b_WasCompacted;
+
+    t_Status = ITC_SerDes_Util_validateBuffer(
+        pu8_Buffer,
+        pu32_BufferSize,
+        ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+        true);
+
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Id_sumConst(
-            (*ppt_Stamp)->pt_Id, (*ppt_OtherStamp)->pt_Id, &pt_SummedId);
+        t_Status = validateStamp(pt_Stamp);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = ITC_Event_joinConst(
-            (*ppt_Stamp)->pt_Event,
-            (*ppt_OtherStamp)->pt_Event,
-            &pt_JoinedEvent);
+        t_Status = isStampOverCompactBudget(
+            pt_Stamp,
+            ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET,
+            ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET,
+            &b_IsOverBudget);
     }
 
-    if (t_Status == ITC_STATUS_SUCCESS)
+    if (t_Status == ITC_STATUS_SUCCESS && b_IsOverBudget)
     {
-        t_Status = newStamp(&pt_JoinedStamp);
+        t_Status = compactStamp(pt_Stamp, &b_WasCompacted);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Destroy the source Stamps
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey that the overall join
-         * operation was successful. */
-        (void)ITC_Stamp_destroy(ppt_Stamp);
-        (void)ITC_Stamp_destroy(ppt_OtherStamp);
-
-        /* Create the new Stamp. */
-        pt_JoinedStamp->pt_Event = pt_JoinedEvent;
-        pt_JoinedStamp->pt_Id = pt_SummedId;
-        /* Forget the ID and Event. The Stamp now has "ownership" */
-        pt_SummedId = NULL;
-        pt_JoinedEvent = NULL;
-
-        /* Return the joined Stamp */
-        *ppt_Stamp = pt_JoinedStamp;
-    }
-    else
-    {
-        /* Something went wrong, destroy anything that might have been created.
-         * Ignore return statuses. There is nothing else to do if the destroy
-         * fails. Also it is more important to convey the original reason
-         * for the failure, rather than the destroy failure. */
-        (void)ITC_Id_destroy(&pt_SummedId);
-        (void)ITC_Event_destroy(&pt_JoinedEvent);
-        (void)ITC_Stamp_destroy(&pt_JoinedStamp);
+        t_Status = serialiseStamp(
+            pt_Stamp, NULL, pu8_Buffer, pu32_BufferSize);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Compare two existing Stamps
+ * Deserialise an ITC Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_Stamp_compare(
-    const ITC_Stamp_t *const pt_Stamp1,
-    const ITC_Stamp_t *const pt_Stamp2,
-    ITC_Stamp_Comparison_t *pt_Result
-
+ITC_Status_t ITC_SerDes_deserialiseStamp(
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_t **ppt_Stamp
 )
 {
-    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS;
 
-    if (!pt_Result)
+    if (!ppt_Stamp)
     {
         t_Status = ITC_STATUS_INVALID_PARAM;
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = validateStamp(pt_Stamp1);
-    }
-
-    if (t_Status == ITC_STATUS_SUCCESS)
-    {
-        t_Status = validateStamp(pt_Stamp2);
+        t_Status = ITC_SerDes_Util_validateBuffer(
+            pu8_Buffer,
+            &u32_BufferSize,
+            ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            false);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        /* Compare *pt_Stamp1 to *pt_Stamp2 */
-        t_Status = compareStamps(pt_Stamp1, pt_Stamp2, pt_Result);
+        t_Status = deserialiseStamp(
+            pu8_Buffer, u32_BufferSize, NULL, ppt_Stamp);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Serialise an existing ITC Stamp
+ * Serialise an existing ITC Stamp as a delta against a base Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_serialiseStamp(
+ITC_Status_t ITC_SerDes_serialiseStampDelta(
+    const ITC_Stamp_t *const pt_Base,
     const ITC_Stamp_t *const pt_Stamp,
     uint8_t *const pu8_Buffer,
     uint32_t *const pu32_BufferSize
@@ -1262,24 +2958,44 @@ ITC_Status_t ITC_SerDes_serialiseStamp(
         ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
         true);
 
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStamp(pt_Base);
+    }
+
     if (t_Status == ITC_STATUS_SUCCESS)
     {
         t_Status = validateStamp(pt_Stamp);
     }
 
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampEpochs(pt_Base, pt_Stamp);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = validateStampRebaseBaseIds(pt_Base, pt_Stamp);
+    }
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = serialiseStamp(pt_Stamp, pu8_Buffer, pu32_BufferSize);
+        t_Status = serialiseStamp(
+            pt_Stamp, pt_Base, pu8_Buffer, pu32_BufferSize);
     }
 
     return t_Status;
 }
 
 /******************************************************************************
- * Deserialise an ITC Stamp
+ * Deserialise an ITC Stamp delta and apply it to its base Stamp
  ******************************************************************************/
 
-ITC_Status_t ITC_SerDes_deserialiseStamp(
+ITC_Status_t ITC_SerDes_applyStampDelta(
+    const ITC_Stamp_t *const pt_Base,
     const uint8_t *const pu8_Buffer,
     const uint32_t u32_BufferSize,
     ITC_Stamp_t **ppt_Stamp
@@ -1297,13 +3013,19 @@ ITC_Status_t ITC_SerDes_deserialiseStamp(
         t_Status = ITC_SerDes_Util_validateBuffer(
             pu8_Buffer,
             &u32_BufferSize,
-            ITC_SERDES_STAMP_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
+            ITC_SERDES_STAMP_DELTA_MIN_BUFFER_LEN + ITC_VERSION_MAJOR_LEN,
             false);
     }
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        t_Status = deserialiseStamp(pu8_Buffer, u32_BufferSize, ppt_Stamp);
+        t_Status = validateStamp(pt_Base);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = deserialiseStamp(
+            pu8_Buffer, u32_BufferSize, pt_Base, ppt_Stamp);
     }
 
     return t_Status;
@@ -1507,6 +3229,14 @@ ITC_Status_t ITC_Stamp_setEvent(
     {
         t_Status = ITC_Event_destroy(&pt_Stamp->pt_Event);
     }
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* The Event is about to change */
+        pt_Stamp->b_IsEventHashCached = false;
+    }
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
 
     if (t_Status == ITC_STATUS_SUCCESS)
     {
@@ -12,7 +12,9 @@
 
 #include "ITC_Event.h"
 #include "ITC_Id.h"
+#include "ITC_IdPool.h"
 #include "ITC_Stamp.h"
+#include "ITC_StabilityTracker.h"
 #include "ITC_Status.h"
 #include "ITC_SerDes.h"
 
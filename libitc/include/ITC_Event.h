@@ -12,6 +12,7 @@
 
 #include "ITC_config.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #if ITC_CONFIG_USE_64BIT_EVENT_COUNTERS
@@ -33,8 +34,104 @@ typedef struct ITC_Event_t
     struct ITC_Event_t *pt_Parent;
     /** Counts the number of events witnessed by this node in the event tree */
     ITC_Event_Counter_t t_Count;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+    /** The maximum number of events witnessed by any node in this subtree,
+     * including the events of this node, i.e. `max(e)`. Saturates on
+     * overflow. There is no matching minimum, as `min(e)` of a normalised
+     * Event is `t_Count` */
+    ITC_Event_Counter_t t_Max;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    /** The Merkle hash of this subtree. Combines the kind and counter of
+     * this node with the hashes of its children */
+    uint64_t u64_Hash;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
 } ITC_Event_t;
 
+/* The ITC Event grow policy. Picks where `grow(i, e)` adds an event when the
+ * ID owns several parts of the Event interval */
+typedef enum
+{
+    /* Minimise the size of the Event tree. This is the cost model from the
+     * ITC paper: expanding a leaf is costlier than any number of levels */
+    ITC_EVENT_GROW_POLICY_MIN_SIZE = 0,
+    /* Minimise the depth at which the event is added. Expansions only break
+     * ties between equally deep candidates */
+    ITC_EVENT_GROW_POLICY_MIN_DEPTH = 1,
+    /* Never expand the Event tree if the ID owns an existing leaf. Unlike
+     * `ITC_EVENT_GROW_POLICY_MIN_SIZE`, all owned subtrees are searched */
+    ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES = 2,
+} ITC_Event_GrowPolicy_t;
+
+/* The shape metrics of an ITC Event */
+typedef struct
+{
+    /** The number of nodes */
+    uint32_t u32_Nodes;
+    /** The depth of the deepest leaf. `0` for leaf Events */
+    uint32_t u32_Depth;
+    /** The largest total sum of events in the tree, i.e. `max(e)`. Saturates
+     * on overflow */
+    ITC_Event_Counter_t t_Max;
+    /** The sum of all event counters. Every `grow` adds exactly `1` to it,
+     * while `fill` and normalisation can move it either way, so it is only an
+     * estimate of the number of recorded events. Saturates on overflow */
+    ITC_Event_Counter_t t_Total;
+} ITC_Event_Metrics_t;
+
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+/* The number of counters in an `ITC_Event_Array_t` */
+#define ITC_EVENT_ARRAY_LEN                (1UL << ITC_CONFIG_EVENT_ARRAY_DEPTH)
+
+/* The dense fixed-depth ITC Event. Counter `n` holds the total number of
+ * events witnessed by the `n`-th smallest subinterval of the Event interval */
+typedef struct
+{
+    /** The counters of each subinterval */
+    ITC_Event_Counter_t rt_Counters[ITC_EVENT_ARRAY_LEN];
+} ITC_Event_Array_t;
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+/* A step of an ITC Event step function. Holds the total number of events
+ * witnessed by the `[u64_Start / 2^63, next step start / 2^63)` subinterval
+ * of the Event interval */
+typedef struct
+{
+    /** The start of the step in units of `2^-63` */
+    uint64_t u64_Start;
+    /** The total number of events witnessed by the step */
+    ITC_Event_Counter_t t_Count;
+} ITC_Event_Step_t;
+
+/* The step function ITC Event. The steps are sorted by their start, the first
+ * one always starts at `0` and adjacent steps always have different counts */
+typedef struct
+{
+    /** The steps of the function */
+    ITC_Event_Step_t *pt_Steps;
+    /** The number of steps */
+    uint32_t u32_Length;
+} ITC_Event_Steps_t;
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+/* The Merkle hash of an ITC Event subtree. The subtree root is the
+ * `u64_Index`-th node (from the left) at depth `u8_Level` of a full binary
+ * tree. Used to find the subtrees in which two Events differ */
+typedef struct
+{
+    /** The Merkle hash of the subtree */
+    uint64_t u64_Hash;
+    /** The index of the subtree root within its level */
+    uint64_t u64_Index;
+    /** The level (depth) of the subtree root */
+    uint8_t u8_Level;
+    /** Whether the subtree root is a leaf node */
+    bool b_IsLeaf;
+} ITC_Event_SubtreeHash_t;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 /* Late include. We need to define the types first */
 #include "ITC_Event_prototypes.h"
 
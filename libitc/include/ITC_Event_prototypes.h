@@ -71,6 +71,212 @@ ITC_Status_t ITC_Event_validate(
     const ITC_Event_t *const pt_Event
 );
 
+/**
+ * @brief Find where an Event exceeds another Event, i.e. what the first Event
+ * knows that the second one does not
+ *
+ * The result holds the counters of `pt_Event1` in the regions where it
+ * exceeds `pt_Event2` and `0` everywhere else. It is normalised, so it is the
+ * smallest Event tree describing those regions. Joining it into `pt_Event2`
+ * gives the same result as joining `pt_Event1` into it.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Diff (out) The pointer to the difference Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_diff(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Diff
+);
+
+/**
+ * @brief Count the regions in which an Event exceeds another Event, without
+ * allocating the difference
+ *
+ * Can be used to size the difference before calling ::ITC_Event_diff().
+ * The count is `0` only if `pt_Event1 <= pt_Event2`. Otherwise it is an upper
+ * bound of the number of non-zero leaves of the difference.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pu32_Regions (out) The number of regions
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_diffRegions(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    uint32_t *pu32_Regions
+);
+
+/**
+ * @brief Meet two Events, i.e. take their pointwise minimum
+ *
+ * The result is the largest Event that is `<=` to both Events. It describes
+ * the history both Events are known to contain.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Event (out) The pointer to the met Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_meet(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event
+);
+
+/**
+ * @brief Meet multiple Events, i.e. take their pointwise minimum
+ *
+ * Equivalent to folding ::ITC_Event_meet() over the Events, but stops early
+ * once the result can no longer shrink.
+ *
+ * @param ppt_Events The Events to meet
+ * @param u32_EventsLength The number of Events. Must be at least `1`
+ * @param ppt_Event (out) The pointer to the met Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_meetMany(
+    const ITC_Event_t *const *const ppt_Events,
+    const uint32_t u32_EventsLength,
+    ITC_Event_t **ppt_Event
+);
+
+/**
+ * @brief Rebase an Event by subtracting a common lower bound from it
+ *
+ * Subtracts `pt_Base` from every counter of the Event and normalises the
+ * result. Rebasing all Events of a system against the same base (e.g. a
+ * stable frontier) preserves their ordering, while keeping the counters small.
+ *
+ * @param ppt_Event (in) The Event to rebase. (out) The rebased Event
+ * @param pt_Base The base to subtract. Must be `<=` the Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if the base is not `<=` the
+ * Event
+ */
+ITC_Status_t ITC_Event_rebase(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_Base
+);
+
+/**
+ * @brief Add an Event to another, i.e. take their pointwise sum
+ *
+ * Undoes ::ITC_Event_rebase(): adding the base back to a rebased Event gives
+ * the original Event.
+ *
+ * @param ppt_Event (in) The Event to add to. (out) The summed Event
+ * @param pt_Addend The Event to add
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if a counter of the sum overflows
+ */
+ITC_Status_t ITC_Event_add(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_Addend
+);
+
+/**
+ * @brief Get the shape metrics of an Event
+ *
+ * Does not allocate any memory. Useful for monitoring the growth of the Event
+ * tree.
+ *
+ * @param pt_Event The Event
+ * @param pt_Metrics (out) The Event metrics
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_getMetrics(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Metrics_t *const pt_Metrics
+);
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/**
+ * @brief Get the Merkle hashes of the subtrees of an Event
+ *
+ * The hashes are listed in pre-order, down to (and including) `u8_MaxLevel`.
+ * The result can be sent to a remote replica and compared against its Event
+ * via ::ITC_Event_diffSubtreeHashes()
+ *
+ * @param pt_Event The Event
+ * @param u8_MaxLevel The deepest level to get the subtree hashes of. Must not
+ * exceed `63`
+ * @param pt_Hashes (out) The subtree hashes
+ * @param pu32_Length (in) The number of elements `pt_Hashes` can hold.
+ * (out) The number of subtree hashes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Hashes` is not big
+ * enough
+ */
+ITC_Status_t ITC_Event_getSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const uint8_t u8_MaxLevel,
+    ITC_Event_SubtreeHash_t *const pt_Hashes,
+    uint32_t *const pu32_Length
+);
+
+/**
+ * @brief Find the subtrees of an Event, which differ from a (remote) list of
+ * subtree hashes
+ *
+ * Only descends into the subtrees whose hashes differ. The differing subtrees
+ * are the deepest ones, which can be compared given the list of hashes.
+ *
+ * @param pt_Event The Event
+ * @param pt_Hashes The subtree hashes as returned by
+ * ::ITC_Event_getSubtreeHashes()
+ * @param u32_HashesLength The number of elements in `pt_Hashes`
+ * @param pt_Diffs (out) The hashes of the differing subtrees of `pt_Event`
+ * @param pu32_DiffsLength (in) The number of elements `pt_Diffs` can hold.
+ * (out) The number of differing subtrees
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Diffs` is not big enough
+ */
+ITC_Status_t ITC_Event_diffSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_HashesLength,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
+);
+
+/**
+ * @brief Find the subtrees of an Event, which differ from another Event
+ *
+ * Only descends into the subtrees whose hashes differ, so the cost is
+ * proportional to the number of differences times the depth of the trees.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pt_Diffs (out) The hashes of the differing subtrees of `pt_Event1`
+ * @param pu32_DiffsLength (in) The number of elements `pt_Diffs` can hold.
+ * (out) The number of differing subtrees
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Diffs` is not big enough
+ */
+ITC_Status_t ITC_Event_diffSubtrees(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
 #endif /* ITC_EVENT_PROTOTYPES_H_ */
@@ -10,23 +10,95 @@
 #ifndef ITC_ID_H_
 #define ITC_ID_H_
 
+#include "ITC_config.h"
+
 #include <stdbool.h>
+#include <stdint.h>
 
 /* The ITC ID */
 typedef struct ITC_Id_t
 {
-    /** A pointer to the left ID subtree */
+    /** A pointer to the left ID subtree. If ::ITC_CONFIG_USE_COMPACT_ID_NODES
+     * is enabled, this is a tagged value instead, when the subtree is a leaf.
+     * Such values must never be dereferenced */
     struct ITC_Id_t *pt_Left;
-    /** A pointer to the right ID subtree */
+    /** A pointer to the right ID subtree. Same as `pt_Left` */
     struct ITC_Id_t *pt_Right;
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    /** A pointer to the parent ID subtree (NULL if root), with the owner flag
+     * folded into its lowest bit. The owner flag determines whether the
+     * interval (or subinterval) represented by this ID is owned by it or not.
+     * Parent (i.e. not leaf IDs) should always have this flag cleared */
+    uintptr_t t_ParentAndOwner;
+#else
     /** A pointer to the parent ID subtree. NULL if root */
     struct ITC_Id_t *pt_Parent;
     /** Determines whether the interval (or subinterval) represented by this
      * ID is owned by it (i.e. it can be used to inflate events) or not.
      * Parent (i.e. not leaf IDs) should always have this set to `false` */
     bool b_IsOwner;
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
 } ITC_Id_t;
 
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+
+/* The number of subintervals in an `ITC_Id_Bitmap_t` */
+#define ITC_ID_BITMAP_LEN                    (1UL << ITC_CONFIG_ID_BITMAP_DEPTH)
+
+/* The number of words in an `ITC_Id_Bitmap_t` */
+#define ITC_ID_BITMAP_WORDS                      ((ITC_ID_BITMAP_LEN + 63) / 64)
+
+/* A dense bitmap ITC ID of a tree no deeper than `ITC_CONFIG_ID_BITMAP_DEPTH`.
+ * Bit `n` (bit `n % 64` of word `n / 64`) is set if the ID owns the
+ * `[n / ITC_ID_BITMAP_LEN, (n + 1) / ITC_ID_BITMAP_LEN)` subinterval */
+typedef struct
+{
+    /** The ownership bitmap */
+    uint64_t ru64_Words[ITC_ID_BITMAP_WORDS];
+} ITC_Id_Bitmap_t;
+
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+/* A dyadic subinterval `[u64_Position / 2^u8_Depth,
+ * (u64_Position + 1) / 2^u8_Depth)` of the ID interval */
+typedef struct
+{
+    /** The index of the subinterval within its level */
+    uint64_t u64_Position;
+    /** The level of the subinterval. I.e. the depth of its ID tree node */
+    uint8_t u8_Depth;
+} ITC_Id_Interval_t;
+
+/* A sorted dyadic interval ITC ID. Holds the owned subintervals in ascending
+ * order. Sibling subintervals are always coalesced into their parent */
+typedef struct
+{
+    /** The owned subintervals. `NULL` if `u32_Length == 0` */
+    ITC_Id_Interval_t *pt_Intervals;
+    /** The number of owned subintervals */
+    uint32_t u32_Length;
+} ITC_Id_Intervals_t;
+
+/* The largest denominator (as a power of 2) of the owned fraction in an
+ * `ITC_Id_Metrics_t` */
+#define ITC_ID_METRICS_MAX_DENOMINATOR_LOG2                                (63U)
+
+/* The shape and ownership metrics of an ITC ID */
+typedef struct
+{
+    /** The numerator of the owned fraction of the ID interval. The fraction is
+     * the reduced dyadic value `u64_OwnedNumerator / 2^u8_OwnedDenominatorLog2`
+     * and is rounded down to a multiple of
+     * `2^-ITC_ID_METRICS_MAX_DENOMINATOR_LOG2` */
+    uint64_t u64_OwnedNumerator;
+    /** The log2 of the denominator of the owned fraction */
+    uint8_t u8_OwnedDenominatorLog2;
+    /** The depth of the deepest leaf. `0` for leaf IDs */
+    uint32_t u32_Depth;
+    /** The number of leaves */
+    uint32_t u32_Leaves;
+} ITC_Id_Metrics_t;
+
 /* Late include. We need to define the types first */
 #include "ITC_Id_prototypes.h"
 
@@ -0,0 +1,36 @@
+/**
+ * @file ITC_IdPool.h
+ * @brief Definitions for the Interval Tree Clock's pre-forked ID pool
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_ID_POOL_H_
+#define ITC_ID_POOL_H_
+
+#include "ITC_Id.h"
+
+#include <stdint.h>
+
+/* The ITC pre-forked ID pool
+ *
+ * Holds a reservoir of disjoint IDs split off a Stamp ahead of time, so
+ * forking the Stamp does not need to split its ID. The IDs are kept in a
+ * stack, so handing one out or taking one back is `O(1)`. */
+typedef struct
+{
+    /* The pooled IDs. Slots `[0, u32_IdsLength)` hold the pooled IDs. The
+     * array has one extra slot, used as scratch space while refilling */
+    ITC_Id_t **ppt_Ids;
+    /* The maximum number of pooled IDs */
+    uint32_t u32_IdsCapacity;
+    /* The number of pooled IDs */
+    uint32_t u32_IdsLength;
+} ITC_IdPool_t;
+
+/* Late include. We need to define the types first */
+#include "ITC_IdPool_prototypes.h"
+
+#endif /* ITC_ID_POOL_H_ */
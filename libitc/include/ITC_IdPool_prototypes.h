@@ -0,0 +1,144 @@
+/**
+ * @file ITC_IdPool_prototypes.h
+ * @brief Prototypes for the Interval Tree Clock's pre-forked ID pool
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_ID_POOL_PROTOTYPES_H_
+#define ITC_ID_POOL_PROTOTYPES_H_
+
+#include "ITC_IdPool.h"
+#include "ITC_Stamp.h"
+#include "ITC_Status.h"
+#include "ITC_config.h"
+
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/** The maximum number of IDs an ID pool can hold */
+#define ITC_ID_POOL_MAX_CAPACITY                            ((uint32_t)1 << 24U)
+
+/******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/**
+ * @brief Allocate a new empty ITC ID pool
+ *
+ * @param u32_Capacity The maximum number of pooled IDs. Must be between `1`
+ * and ::ITC_ID_POOL_MAX_CAPACITY
+ * @param ppt_Pool (out) The pointer to the pool
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_IdPool_new(
+    const uint32_t u32_Capacity,
+    ITC_IdPool_t **ppt_Pool
+);
+
+/**
+ * @brief Free an allocated ITC ID pool and all IDs pooled in it
+ *
+ * @warning The pooled IDs are lost. To give them back to a Stamp use
+ * ::ITC_IdPool_drain() first.
+ * @warning Even if the function call fails, the pool might be partially
+ * freed and not safe to use. For this reason, the returned `*ppt_Pool` will
+ * always be set to `NULL`.
+ *
+ * @param ppt_Pool (in) The pointer to the pool to deallocate. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_IdPool_destroy(
+    ITC_IdPool_t **ppt_Pool
+);
+
+/**
+ * @brief Fill up the pool with IDs split off a Stamp
+ *
+ * The ID of the Stamp is split into one part more than there are free slots
+ * in the pool, in the same balanced way as ::ITC_Stamp_forkN(). The Stamp
+ * keeps one of the parts and the pool receives the rest. Meant to be called
+ * off the critical path (e.g. when idle), so that ::ITC_IdPool_fork() does not
+ * need to split the ID.
+ *
+ * @note Nothing is done if the pool is already full.
+ *
+ * @param pt_Pool The pool
+ * @param pt_Stamp The Stamp to split the IDs off
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the Stamp has a NULL ID
+ */
+ITC_Status_t ITC_IdPool_refill(
+    ITC_IdPool_t *const pt_Pool,
+    ITC_Stamp_t *const pt_Stamp
+);
+
+/**
+ * @brief Fork a Stamp using an ID from the pool
+ *
+ * The forked Stamp receives one of the pooled IDs and a copy of the Event
+ * history of `pt_Stamp`. Taking the ID is `O(1)` and the ID of `pt_Stamp` is
+ * not modified. The pool must have been filled from `pt_Stamp` (or from a
+ * Stamp whose ID has since been joined into it), otherwise the IDs might
+ * overlap.
+ *
+ * @param pt_Pool The pool
+ * @param pt_Stamp The Stamp to fork
+ * @param ppt_ForkedStamp (out) The forked Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_ID_POOL_EMPTY` if there are no IDs in the pool
+ */
+ITC_Status_t ITC_IdPool_fork(
+    ITC_IdPool_t *const pt_Pool,
+    const ITC_Stamp_t *const pt_Stamp,
+    ITC_Stamp_t **ppt_ForkedStamp
+);
+
+/**
+ * @brief Join a Stamp and return its ID to the pool
+ *
+ * Same as ::ITC_Stamp_join(), except the ID of `*ppt_OtherStamp` is put back
+ * into the pool instead of being summed into the ID of `*ppt_Stamp`. Returned
+ * IDs are only summed lazily: if the pool is full, the ID is summed with the
+ * most recently pooled one.
+ *
+ * @note On success, `ppt_OtherStamp` will be automatically deallocated
+ *
+ * @param pt_Pool The pool
+ * @param ppt_Stamp (in) The existing Stamp. (out) The joined Stamp
+ * @param ppt_OtherStamp (in) The Stamp to join. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_IdPool_join(
+    ITC_IdPool_t *const pt_Pool,
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_Stamp_t **ppt_OtherStamp
+);
+
+/**
+ * @brief Sum all pooled IDs back into the ID of a Stamp
+ *
+ * @note If the operation fails part of the way through, the IDs that have
+ * not been summed yet remain in the pool.
+ *
+ * @param pt_Pool The pool
+ * @param pt_Stamp The Stamp to give the IDs to
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_IdPool_drain(
+    ITC_IdPool_t *const pt_Pool,
+    ITC_Stamp_t *const pt_Stamp
+);
+
+#endif /* ITC_ID_POOL_PROTOTYPES_H_ */
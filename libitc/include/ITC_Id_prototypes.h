@@ -97,6 +97,31 @@ ITC_Status_t ITC_Id_split(
     ITC_Id_t **ppt_OtherId
 );
 
+/**
+ * @brief Split an existing ITC ID into two distinct ITC IDs with uneven shares
+ *
+ * The split follows the same rules as ::ITC_Id_split(), except wherever an
+ * owned interval is divided: there the other ID receives the rightmost
+ * `u32_Numerator / 2^u8_DenominatorLog2` of the interval and the existing ID
+ * keeps the rest. Giving a short-lived fork a small share keeps the ID of a
+ * long-lived one shallow. Both IDs are normalised.
+ *
+ * @param ppt_Id (in) The existing ID. (out) The first split ID
+ * @param ppt_OtherId (out) The second split ID
+ * @param u32_Numerator The numerator of the share of the other ID
+ * @param u8_DenominatorLog2 The log2 of the denominator of the share of the
+ * other ID. Must be less than 32
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the share is not in the (0, 1) range
+ */
+ITC_Status_t ITC_Id_splitWeighted(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t **ppt_OtherId,
+    uint32_t u32_Numerator,
+    uint8_t u8_DenominatorLog2
+);
+
 /**
  * @brief Sum two existing IDs into a single ID
  *
@@ -113,6 +138,219 @@ ITC_Status_t ITC_Id_sum(
     ITC_Id_t **ppt_OtherId
 );
 
+/**
+ * @brief Allocate a new ID owning one part of a balanced split of the seed ID
+ *
+ * The seed interval is halved recursively, giving the extra part of an odd
+ * split to the left half, until it is split into `u32_PartsCount` parts. The
+ * parts are disjoint and their sum is the seed ID. Each part is at most
+ * `ceil(log2(u32_PartsCount))` levels deep, regardless of how the IDs they
+ * replace were forked.
+ *
+ * @param u32_PartIndex The index of the part, counting from the left
+ * @param u32_PartsCount The number of parts to split the seed ID into
+ * @param ppt_Id (out) The pointer to the new ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if `u32_PartIndex >= u32_PartsCount`
+ */
+ITC_Status_t ITC_Id_newBalanced(
+    const uint32_t u32_PartIndex,
+    const uint32_t u32_PartsCount,
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Rebalance a set of IDs after churn
+ *
+ * Repeated forks and joins can leave IDs as deep, unbalanced trees, which
+ * makes every subsequent fill and grow more expensive. This replaces the IDs
+ * with shallow IDs owning the same fraction of the interval as before. Each
+ * owned fraction is reallocated within the sum of the IDs as the fewest and
+ * shallowest dyadic subintervals available. E.g. IDs owning `1/2`, `1/4`,
+ * `1/8` and `1/8` of a seed ID become no deeper than `3`, regardless of their
+ * previous shape. The sum of the IDs is preserved.
+ *
+ * @warning The IDs are reassigned to different intervals. Unless the Events
+ * they are used with are remapped accordingly, causality is lost. Use
+ * ::ITC_Stamp_rebalance() to rebalance a set of Stamps instead.
+ *
+ * @param ppt_Ids The IDs to rebalance. Must not overlap. Left unmodified on
+ * failure
+ * @param u32_IdsLength The number of IDs
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if an ID or the sum of the IDs
+ * is deeper than `63`
+ */
+ITC_Status_t ITC_Id_rebalance(
+    ITC_Id_t **ppt_Ids,
+    const uint32_t u32_IdsLength
+);
+
+/**
+ * @brief Get the shape and ownership metrics of an ID
+ *
+ * Does not allocate any memory. Useful for load-aware decisions, such as
+ * forking from the replica owning the largest interval, or for monitoring the
+ * growth of the ID tree.
+ *
+ * @param pt_Id The ID
+ * @param pt_Metrics (out) The ID metrics
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_getMetrics(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Metrics_t *const pt_Metrics
+);
+
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+
+/**
+ * @brief Convert an existing ID into a fixed-depth bitmap ID
+ *
+ * Bit `n` of the bitmap is set if the ID owns the `n`-th of the
+ * `ITC_ID_BITMAP_LEN` equally sized subintervals of the ID interval.
+ *
+ * @param pt_Id The existing ID
+ * @param pt_Bitmap (out) The bitmap ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID tree is deeper than
+ * `ITC_CONFIG_ID_BITMAP_DEPTH`
+ */
+ITC_Status_t ITC_Id_toBitmap(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Bitmap_t *const pt_Bitmap
+);
+
+/**
+ * @brief Allocate a new normalised ID from a bitmap ID
+ *
+ * @param pt_Bitmap The bitmap ID
+ * @param ppt_Id (out) The ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_newFromBitmap(
+    const ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Split a bitmap ID in place, following the same rules as
+ * ::ITC_Id_split()
+ *
+ * @param pt_Bitmap (in) The bitmap ID to split. (out) The first half
+ * @param pt_OtherBitmap (out) The second half
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a single subinterval would
+ * need to be split
+ */
+ITC_Status_t ITC_Id_splitBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_Bitmap_t *const pt_OtherBitmap
+);
+
+/**
+ * @brief Sum two bitmap IDs in place
+ *
+ * @param pt_Bitmap (in) The first bitmap ID. (out) The summed bitmap ID
+ * @param pt_OtherBitmap The second bitmap ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the bitmap IDs overlap
+ */
+ITC_Status_t ITC_Id_sumBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    const ITC_Id_Bitmap_t *const pt_OtherBitmap
+);
+
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+
+/**
+ * @brief Convert an existing ID into a sorted dyadic interval ID
+ *
+ * @note Memory for the subintervals will be dynamically allocated. Free it
+ * with ::ITC_Id_destroyIntervals()
+ * @param pt_Id The existing ID
+ * @param pt_Intervals (out) The interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID tree is deeper than
+ * 63 levels
+ */
+ITC_Status_t ITC_Id_toIntervals(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Intervals_t *const pt_Intervals
+);
+
+/**
+ * @brief Allocate a new normalised ID from a sorted dyadic interval ID
+ *
+ * @param pt_Intervals The interval ID
+ * @param ppt_Id (out) The ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_newFromIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Free the subintervals of a sorted dyadic interval ID
+ *
+ * @param pt_Intervals The interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_destroyIntervals(
+    ITC_Id_Intervals_t *const pt_Intervals
+);
+
+/**
+ * @brief Split a sorted dyadic interval ID, following the same rules as
+ * ::ITC_Id_split()
+ *
+ * @note Memory for the subintervals of both halves will be dynamically
+ * allocated. The source interval ID is not modified
+ * @param pt_Intervals The interval ID to split
+ * @param pt_Intervals1 (out) The first half
+ * @param pt_Intervals2 (out) The second half
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_splitIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_Intervals_t *const pt_Intervals1,
+    ITC_Id_Intervals_t *const pt_Intervals2
+);
+
+/**
+ * @brief Sum two sorted dyadic interval IDs
+ *
+ * @note Memory for the subintervals of the summed ID will be dynamically
+ * allocated. The source interval IDs are not modified
+ * @param pt_Intervals1 The first interval ID
+ * @param pt_Intervals2 The second interval ID
+ * @param pt_Intervals (out) The summed interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the interval IDs overlap
+ */
+ITC_Status_t ITC_Id_sumIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals1,
+    const ITC_Id_Intervals_t *const pt_Intervals2,
+    ITC_Id_Intervals_t *const pt_Intervals
+);
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+
 #endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
 
 #endif /* ITC_ID_PROTOTYPES_H_ */
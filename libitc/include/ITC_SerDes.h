@@ -66,6 +66,8 @@ ITC_Status_t ITC_SerDes_serialiseId(
  * @param ppt_Id The pointer to the deserialised Id
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
  */
 ITC_Status_t ITC_SerDes_deserialiseId(
     const uint8_t *const pu8_Buffer,
@@ -112,6 +114,8 @@ ITC_Status_t ITC_SerDes_serialiseEvent(
  * @param ppt_Event The pointer to the deserialised Event
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
  */
 ITC_Status_t ITC_SerDes_deserialiseEvent(
     const uint8_t *const pu8_Buffer,
@@ -145,6 +149,33 @@ ITC_Status_t ITC_SerDes_serialiseStamp(
     uint32_t *const pu32_BufferSize
 );
 
+/**
+ * @brief Serialise an existing ITC Stamp for persisting it
+ *
+ * Same as ::ITC_SerDes_serialiseStamp(), but first compacts the Stamp in place
+ * if it exceeds `ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET` or
+ * `ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET` (see ::ITC_Stamp_compact()). With
+ * neither budget configured, this is the same as ::ITC_SerDes_serialiseStamp().
+ *
+ * @note Compacting inflates the Stamp like recording a local event would, so
+ * the Stamp is compacted even if the buffer turns out to be too small.
+ *
+ * @warning See the warning of ::ITC_SerDes_serialiseStamp()
+ *
+ * @param pt_Stamp The Stamp to compact and serialise
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_persistStamp(
+    ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
 /**
  * @brief Deserialise an ITC Stamp
  *
@@ -160,6 +191,8 @@ ITC_Status_t ITC_SerDes_serialiseStamp(
  * @param ppt_Stamp The pointer to the deserialised Stamp
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
  */
 ITC_Status_t ITC_SerDes_deserialiseStamp(
     const uint8_t *const pu8_Buffer,
@@ -167,6 +200,56 @@ ITC_Status_t ITC_SerDes_deserialiseStamp(
     ITC_Stamp_t **ppt_Stamp
 );
 
+/**
+ * @brief Serialise an existing ITC Stamp as a delta against a base Stamp
+ *
+ * Only the number of events the Stamp has seen on top of the base Stamp is
+ * serialised, along with the ID if it differs from the ID of the base Stamp.
+ * If the receiver already holds the base Stamp (e.g. the last Stamp it
+ * received from the sender), the original Stamp can be recovered via
+ * ::ITC_SerDes_applyStampDelta().
+ *
+ * @warning See the warning of ::ITC_SerDes_serialiseStamp()
+ *
+ * @param pt_Base The base Stamp. Must be `<=` to `pt_Stamp`
+ * @param pt_Stamp The Stamp to serialise
+ * @param pu8_Buffer The buffer to hold the serialised data
+ * @param pu32_BufferSize (in) The size of the buffer in bytes. (out) The size
+ * of the data inside the buffer in bytes.
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if `pt_Base` is not `<=` to `pt_Stamp`
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the buffer is not big enough
+ */
+ITC_Status_t ITC_SerDes_serialiseStampDelta(
+    const ITC_Stamp_t *const pt_Base,
+    const ITC_Stamp_t *const pt_Stamp,
+    uint8_t *const pu8_Buffer,
+    uint32_t *const pu32_BufferSize
+);
+
+/**
+ * @brief Deserialise an ITC Stamp delta and apply it to its base Stamp
+ *
+ * @warning See the warning of ::ITC_SerDes_deserialiseStamp()
+ *
+ * @param pt_Base The Stamp the delta was serialised against
+ * @param pu8_Buffer The buffer holding the serialised Stamp delta
+ * @param u32_BufferSize The size of the buffer in bytes
+ * @param ppt_Stamp The pointer to the deserialised Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_CORRUPT_STAMP` if the buffer does not hold a Stamp delta
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
+ */
+ITC_Status_t ITC_SerDes_applyStampDelta(
+    const ITC_Stamp_t *const pt_Base,
+    const uint8_t *const pu8_Buffer,
+    const uint32_t u32_BufferSize,
+    ITC_Stamp_t **ppt_Stamp
+);
+
 #if ITC_CONFIG_ENABLE_SERIALISE_TO_STRING_API
 
 #if ITC_CONFIG_ENABLE_EXTENDED_API
@@ -0,0 +1,38 @@
+/**
+ * @file ITC_StabilityTracker.h
+ * @brief Definitions for the Interval Tree Clock's causal stability tracker
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_STABILITY_TRACKER_H_
+#define ITC_STABILITY_TRACKER_H_
+
+#include "ITC_Event.h"
+
+#include <stdint.h>
+
+/* The ITC causal stability tracker
+ *
+ * Holds the latest known Event of each peer in a replica set and maintains
+ * their meet (the stable frontier) incrementally. The Events are kept in a
+ * tournament tree: node `1` is the root, node `n` has the children `2n` and
+ * `2n + 1`, and every node holds the meet of its children. Updating a peer
+ * only recomputes the meets on the path from its leaf node to the root. */
+typedef struct
+{
+    /* The tournament tree nodes. Node `0` is unused and nodes that do not
+     * cover any peer are `NULL` */
+    ITC_Event_t **ppt_Nodes;
+    /* The number of tracked peers */
+    uint32_t u32_PeersLength;
+    /* The index of the leaf node of the first peer. Always a power of 2 */
+    uint32_t u32_LeavesOffset;
+} ITC_StabilityTracker_t;
+
+/* Late include. We need to define the types first */
+#include "ITC_StabilityTracker_prototypes.h"
+
+#endif /* ITC_STABILITY_TRACKER_H_ */
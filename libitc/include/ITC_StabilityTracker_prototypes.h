@@ -0,0 +1,126 @@
+/**
+ * @file ITC_StabilityTracker_prototypes.h
+ * @brief Prototypes for the Interval Tree Clock's causal stability tracker
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#ifndef ITC_STABILITY_TRACKER_PROTOTYPES_H_
+#define ITC_STABILITY_TRACKER_PROTOTYPES_H_
+
+#include "ITC_StabilityTracker.h"
+#include "ITC_Stamp.h"
+#include "ITC_Status.h"
+#include "ITC_config.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+/** The maximum number of peers a stability tracker can track */
+#define ITC_STABILITY_TRACKER_MAX_PEERS                     ((uint32_t)1 << 24U)
+
+/******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/**
+ * @brief Allocate a new ITC stability tracker and initialise it
+ *
+ * Initially nothing is known about any of the peers, so the stable frontier
+ * is a `0` Event.
+ *
+ * @param u32_PeersLength The number of peers to track. Must be between `1`
+ * and ::ITC_STABILITY_TRACKER_MAX_PEERS
+ * @param ppt_Tracker (out) The pointer to the tracker
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_StabilityTracker_new(
+    const uint32_t u32_PeersLength,
+    ITC_StabilityTracker_t **ppt_Tracker
+);
+
+/**
+ * @brief Free an allocated ITC stability tracker
+ *
+ * @warning Even if the function call fails, the tracker might be partially
+ * freed and not safe to use. For this reason, the returned `*ppt_Tracker` will
+ * always be set to `NULL`.
+ *
+ * @param ppt_Tracker (in) The pointer to the tracker to deallocate. (out) NULL
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_StabilityTracker_destroy(
+    ITC_StabilityTracker_t **ppt_Tracker
+);
+
+/**
+ * @brief Record the Event of a Stamp received from a peer
+ *
+ * The Event is joined into the latest known Event of the peer, so Stamps
+ * arriving out of order or more than once are harmless. Only the meets on the
+ * path from the peer to the root of the tracker are recomputed, and the walk
+ * stops as soon as a meet does not change.
+ *
+ * @note If the operation fails part of the way through, the stable frontier
+ * might lag behind the peers, but it never overstates what all of them are
+ * known to have seen.
+ *
+ * @param pt_Tracker The tracker
+ * @param u32_Peer The index of the peer. Must be less than the number of peers
+ * @param pt_Stamp The Stamp received from the peer
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_StabilityTracker_update(
+    ITC_StabilityTracker_t *const pt_Tracker,
+    const uint32_t u32_Peer,
+    const ITC_Stamp_t *const pt_Stamp
+);
+
+/**
+ * @brief Check whether a Stamp is causally stable
+ *
+ * A Stamp is causally stable once all peers have seen its Event history, i.e.
+ * when its Event is `<=` the stable frontier. Anything concurrent to or
+ * preceding such a Stamp can no longer be delivered by any of the peers.
+ *
+ * @param pt_Tracker The tracker
+ * @param pt_Stamp The Stamp to check
+ * @param pb_IsStable (out) `true` if the Stamp is causally stable. Otherwise
+ * `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_StabilityTracker_isStable(
+    const ITC_StabilityTracker_t *const pt_Tracker,
+    const ITC_Stamp_t *const pt_Stamp,
+    bool *pb_IsStable
+);
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+
+/**
+ * @brief Get a copy of the stable frontier, i.e. the meet of the latest known
+ * Events of all peers
+ *
+ * @param pt_Tracker The tracker
+ * @param ppt_Frontier (out) The pointer to the stable frontier copy
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_StabilityTracker_getFrontier(
+    const ITC_StabilityTracker_t *const pt_Tracker,
+    ITC_Event_t **ppt_Frontier
+);
+
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+#endif /* ITC_STABILITY_TRACKER_PROTOTYPES_H_ */
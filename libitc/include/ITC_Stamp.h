@@ -26,13 +26,44 @@ typedef enum
     ITC_STAMP_COMPARISON_CONCURRENT = (1 << 3),
 } ITC_Stamp_Comparison_t;
 
-/* The ITC Stamp */
+/* The ITC Stamp
+ *
+ * @warning If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is enabled, the ID and Event
+ * components might be statically allocated, read-only seed or null IDs and 0
+ * counter leaf Events, which are shared by all Stamps. This is the case for
+ * the components of Stamps created with ::ITC_Stamp_newSeed() or
+ * ::ITC_Stamp_newPeek(), as well as for leaf components produced by forking,
+ * peeking, cloning or deserialising a Stamp. Such components live in read-only
+ * memory, so modifying them in place faults. Replace a component with one
+ * allocated via ::ITC_Id_newSeed(), ::ITC_Id_newNull() or ::ITC_Event_new() of
+ * the extended API before modifying it in place. Destroying a shared component
+ * is a no-op */
 typedef struct
 {
-    /* The ITC ID */
+    /* The ITC ID. See ::ITC_Stamp_t */
     ITC_Id_t *pt_Id;
-    /* The ITC Event */
+    /* The ITC Event. See ::ITC_Stamp_t */
     ITC_Event_t *pt_Event;
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    /* Whether the Stamp is part of a batch and might not be normalised */
+    bool b_IsBatched;
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+    /* The cached hash of the ITC Event. Only valid if `b_IsEventHashCached` */
+    uint64_t u64_EventHash;
+    /* Whether `u64_EventHash` matches the current ITC Event */
+    bool b_IsEventHashCached;
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    /* The identity of the chain of bases the Event has been rebased against.
+     * `0` if the Event has never been rebased. Only Stamps with the same
+     * rebase base ID can be compared or joined */
+    uint64_t u64_RebaseBaseId;
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    /* The epoch of the Stamp. Only advanced by reseeding the Stamp */
+    uint32_t u32_Epoch;
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
 } ITC_Stamp_t;
 
 /* Late include. We need to define the types first */
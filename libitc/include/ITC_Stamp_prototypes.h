@@ -21,6 +21,10 @@
 /**
  * @brief Allocate a new ITC seed Stamp and initialise it
  *
+ * @warning If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is enabled, the ID and Event
+ * of the Stamp are the shared read-only seed ID and leaf Event and must not be
+ * modified in place. See ::ITC_Stamp_t
+ *
  * @param ppt_Stamp (out) The pointer to the Stamp
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
@@ -32,6 +36,10 @@ ITC_Status_t ITC_Stamp_newSeed(
 /**
  * @brief Allocate a new ITC peek Stamp based on an existing Stamp
  *
+ * @warning If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is enabled, the ID of the
+ * peek Stamp is the shared read-only null ID and must not be modified in
+ * place. See ::ITC_Stamp_t
+ *
  * @param pt_Stamp The existing Stamp
  * @param ppt_PeekStamp (out) The pointer to the peek Stamp
  * @return `ITC_Status_t` The status of the operation
@@ -96,6 +104,54 @@ ITC_Status_t ITC_Stamp_fork(
     ITC_Stamp_t **ppt_OtherStamp
 );
 
+/**
+ * @brief Fork an existing Stamp, giving the other Stamp an uneven share of
+ * the ID
+ * Creates 2 stamps with distinct (non-overlaping) IDs and the same
+ * event history.
+ *
+ * The ID is split as in ::ITC_Id_splitWeighted(). Forking short-lived Stamps
+ * with a small share keeps the ID of a long-lived Stamp shallow.
+ *
+ * @param ppt_Stamp (in) The existing Stamp. (out) The first forked Stamp
+ * @param ppt_OtherStamp (out) The second forked Stamp
+ * @param u32_Numerator The numerator of the share of the second Stamp
+ * @param u8_DenominatorLog2 The log2 of the denominator of the share of the
+ * second Stamp. Must be less than 32
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the share is not in the (0, 1) range
+ */
+ITC_Status_t ITC_Stamp_forkWeighted(
+    ITC_Stamp_t **ppt_Stamp,
+    ITC_Stamp_t **ppt_OtherStamp,
+    const uint32_t u32_Numerator,
+    const uint8_t u8_DenominatorLog2
+);
+
+/**
+ * @brief Fork an existing Stamp into multiple Stamps
+ * Creates `u32_StampsCount` stamps with distinct (non-overlaping) IDs and the
+ * same event history.
+ *
+ * Unlike `u32_StampsCount - 1` successive calls to ::ITC_Stamp_fork(), the ID
+ * is split in a balanced way, so the IDs of the forked Stamps are at most
+ * `ceil(log2(u32_StampsCount))` levels deeper than the original ID.
+ *
+ * @param ppt_Stamp (in) The existing Stamp. (out) The first forked Stamp
+ * @param u32_StampsCount The total number of forked Stamps, including the
+ * first one
+ * @param ppt_OtherStamps (out) The other `u32_StampsCount - 1` forked Stamps.
+ * Must have room for `u32_StampsCount - 1` Stamps
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_forkN(
+    ITC_Stamp_t **ppt_Stamp,
+    const uint32_t u32_StampsCount,
+    ITC_Stamp_t **ppt_OtherStamps
+);
+
 /**
  * @brief Add a new Event to the Stamp
  *
@@ -107,6 +163,66 @@ ITC_Status_t ITC_Stamp_event(
     ITC_Stamp_t *const pt_Stamp
 );
 
+/**
+ * @brief Add a new Event to the Stamp using the given grow policy
+ *
+ * Same as ::ITC_Stamp_event(), which uses ::ITC_CONFIG_EVENT_GROW_POLICY. The
+ * policy only matters if the Event cannot be filled, i.e. the Event tree has
+ * to grow.
+ *
+ * @param pt_Stamp The existing Stamp
+ * @param t_GrowPolicy The grow policy
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_eventWithGrowPolicy(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Event_GrowPolicy_t t_GrowPolicy
+);
+
+/**
+ * @brief Compact the Event of a Stamp
+ *
+ * Fills the Event with the full ID of the Stamp (`fill(i, e)`), collapsing
+ * any Event structure left behind by past joins that lies inside the ID.
+ * Useful before persisting or sending a Stamp.
+ *
+ * @note Compacting only inflates the parts of the Event owned by the ID, so it
+ * is equivalent to recording a local event: the compacted Stamp is greater than
+ * or equal to the original one
+ * @param pt_Stamp The existing Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_compact(
+    ITC_Stamp_t *const pt_Stamp
+);
+
+/**
+ * @brief Compact the Event of a Stamp if it exceeds a budget
+ *
+ * Same as ::ITC_Stamp_compact(), but only if the Event has more than
+ * `u32_NodeBudget` nodes or the serialised Stamp is larger than
+ * `u32_SizeBudget` bytes.
+ *
+ * @note ::ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET and
+ * ::ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET always apply. If both the caller and
+ * the configuration set a budget, the smaller one is used
+ * @param pt_Stamp The existing Stamp
+ * @param u32_NodeBudget The maximum number of Event nodes. `0` means unlimited
+ * @param u32_SizeBudget The maximum serialised size of the Stamp in bytes.
+ * `0` means unlimited
+ * @param pb_WasCompacted (out) Whether the Event was changed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_compactIfOverBudget(
+    ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_NodeBudget,
+    const uint32_t u32_SizeBudget,
+    bool *const pb_WasCompacted
+);
+
 /**
  * @brief Join two existing Stamps
  * Joins 2 stamps into a single Stamp, combining their IDs and event histories.
@@ -148,6 +264,152 @@ ITC_Status_t ITC_Stamp_compare(
     ITC_Stamp_Comparison_t *pt_Result
 );
 
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/**
+ * @brief Start deferring the normalisation of a Stamp
+ *
+ * Any Stamp joined (via ::ITC_Stamp_join()) with a batched Stamp is batched as
+ * well and its ID and Event components are left unnormalised, saving the
+ * normalisation work when merging many Stamps in a burst.
+ * ::ITC_Stamp_event() can still be used on a batched Stamp, although it has to
+ * normalise the Stamp first. All other Stamp operations reject batched Stamps
+ * with `ITC_STATUS_INVALID_PARAM` until ::ITC_Stamp_endBatch() is called.
+ *
+ * @param pt_Stamp The existing Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_beginBatch(
+    ITC_Stamp_t *const pt_Stamp
+);
+
+/**
+ * @brief Normalise a batched Stamp and stop deferring its normalisation
+ *
+ * @param pt_Stamp The existing batched Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_endBatch(
+    ITC_Stamp_t *const pt_Stamp
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+/**
+ * @brief Calculate the hash of the Event component of a Stamp
+ *
+ * Stamps with equal Events always have equal hashes, making the hash usable
+ * as a hash table key. The hash is cached in the Stamp until its Event is
+ * modified (via ::ITC_Stamp_event() or ::ITC_Stamp_setEvent()), and
+ * ::ITC_Stamp_compare() uses it to detect equal Stamps without traversing
+ * their Events.
+ *
+ * @note The cache is not invalidated if the Event component is modified
+ * directly, bypassing the Stamp API
+ * @param pt_Stamp The existing Stamp
+ * @param pu64_Hash (out) The hash of the Event component of the Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_hash(
+    ITC_Stamp_t *const pt_Stamp,
+    uint64_t *pu64_Hash
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/**
+ * @brief Rebase a Stamp against a base Stamp
+ *
+ * Subtracts the Event component of the base from the Event component of the
+ * Stamp and derives the new rebase base ID of the Stamp from its current one
+ * and a hash of the Event component of the base. The base must be known to be
+ * `<=` all Stamps in the system (e.g. a causally stable Stamp), and all of them
+ * must be rebased against it before they are compared or joined again.
+ * Stamps rebased against different bases end up with different rebase base
+ * IDs, so comparing or joining them fails instead of giving a wrong result.
+ *
+ * @note Two different bases are only told apart by their 64-bit hashes. The
+ * probability of them sharing a hash is negligible, but not zero.
+ *
+ * @param pt_Stamp The Stamp to rebase
+ * @param pt_Base The base Stamp. Must have the same rebase base ID as the
+ * Stamp and must be `<=` the Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_MISMATCHED_STAMP_BASE` if the rebase base IDs differ
+ * @retval `ITC_STATUS_MISMATCHED_STAMP_EPOCH` if the Stamps are from different
+ * epochs
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if the base is not `<=` the
+ * Stamp
+ */
+ITC_Status_t ITC_Stamp_rebase(
+    ITC_Stamp_t *const pt_Stamp,
+    const ITC_Stamp_t *const pt_Base
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+
+/**
+ * @brief Reseed a Stamp into a later epoch
+ *
+ * Replaces the ID of the Stamp with its part of a balanced split of the seed
+ * ID (see ::ITC_Id_newBalanced()) and its Event with a `0` Event. Meant to be
+ * coordinated: once the system is quiescent, each of the `u32_PeersCount`
+ * peers reseeds its Stamp into the same epoch using its own `u32_PeerIndex`.
+ * The reseeded Stamps compare as greater than all Stamps of earlier epochs.
+ *
+ * @param pt_Stamp The Stamp to reseed
+ * @param u32_Epoch The new epoch. Must be greater than the current epoch of
+ * the Stamp
+ * @param u32_PeerIndex The index of the peer owning the Stamp
+ * @param u32_PeersCount The number of peers taking part in the reseed
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the epoch does not move forward or
+ * `u32_PeerIndex >= u32_PeersCount`
+ */
+ITC_Status_t ITC_Stamp_reseedEpoch(
+    ITC_Stamp_t *const pt_Stamp,
+    const uint32_t u32_Epoch,
+    const uint32_t u32_PeerIndex,
+    const uint32_t u32_PeersCount
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
+/**
+ * @brief Rebalance the IDs of a set of Stamps after churn
+ *
+ * Repeated forks and joins of short-lived Stamps leave their IDs as deep,
+ * unbalanced trees, which makes every subsequent event more expensive. This
+ * replaces the IDs with shallow IDs owning the same fractions of the same
+ * interval (see ::ITC_Id_rebalance()).
+ *
+ * Since the IDs are reassigned to different intervals, the Events are remapped
+ * as well: each Stamp witnesses everything any of the Stamps has witnessed in
+ * the intervals it now owns. The Stamps never move backwards, so the causal
+ * order between them and all Stamps derived from them is preserved.
+ *
+ * @param ppt_Stamps The Stamps to rebalance. Must hold the complete set of IDs
+ * sharing the interval and must not overlap. Left unmodified on failure
+ * @param u32_StampsLength The number of Stamps
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Stamp_rebalance(
+    ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampsLength
+);
+
 #if ITC_CONFIG_ENABLE_EXTENDED_API
 
 /**
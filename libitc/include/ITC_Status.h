@@ -55,6 +55,22 @@
  * same major `libitc` version is compatible */
 #define ITC_STATUS_SERDES_INCOMPATIBLE_LIB_VERSION                         (11U)
 
+/** Operation failed because the Stamps were rebased against different bases,
+ * so their Events cannot be compared */
+#define ITC_STATUS_MISMATCHED_STAMP_BASE                                   (12U)
+
+/** Operation failed because the Stamps are from different epochs, so their
+ * IDs and Events cannot be combined */
+#define ITC_STATUS_MISMATCHED_STAMP_EPOCH                                  (13U)
+
+/** Operation failed because there are no IDs left in the ID pool */
+#define ITC_STATUS_ID_POOL_EMPTY                                           (14U)
+
+/** Operation failed due to the serialised ITC data using a format which this
+ * build of `libitc` cannot deserialise. E.g. path-compressed data, while
+ * `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled */
+#define ITC_STATUS_SERDES_UNSUPPORTED_FORMAT                               (15U)
+
 /******************************************************************************
  * Types
  ******************************************************************************/
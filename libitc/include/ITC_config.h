@@ -21,6 +21,267 @@
 #define ITC_CONFIG_USE_64BIT_EVENT_COUNTERS                                  (0)
 #endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
 
+#ifndef ITC_CONFIG_USE_SHARED_LEAF_NODES
+/** Whether trivial root level IDs and Events are shared instead of allocated
+ * - When disabled, every ID and Event node is allocated on its own.
+ * - When enabled, Stamps hold statically allocated, read-only seed and null
+ *   IDs and 0 counter leaf Events wherever their whole ID or Event is such a
+ *   leaf. This is the case for ::ITC_Stamp_newSeed() and ::ITC_Stamp_newPeek()
+ *   Stamps, as well as for leaf components produced by forking, cloning or
+ *   deserialising. Creating these costs no allocation.
+ *
+ * @warning When enabled, the ID and Event components of a Stamp must not be
+ * modified in place, as they might live in read-only memory. All operations
+ * of this library handle them, but code that modifies `pt_Id` or `pt_Event`
+ * of a Stamp directly faults. See ::ITC_Stamp_t
+*/
+#define ITC_CONFIG_USE_SHARED_LEAF_NODES                                     (0)
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+
+#ifndef ITC_CONFIG_USE_COMPACT_ID_NODES
+/** Whether to fold the owner flag of each ID node into the low bit of its
+ * parent pointer and to hold seed and null leaves as tagged values
+ * - When disabled, each ID node carries a separate `bool` owner flag, which
+ *   gets padded to the size of a pointer. Every leaf is a separately allocated
+ *   node.
+ * - When enabled, the owner flag is stored in the otherwise unused low bit
+ *   of the parent pointer, which reduces the size of each ID node from 4 to 3
+ *   words (i.e. 32 to 24 bytes on 64-bit targets). Additionally, seed and null
+ *   leaves below the root are not allocated at all. Their parent holds a
+ *   tagged value in place of the child pointer instead, made up of the
+ *   address of the parent, the owner flag and which child the leaf is. An ID
+ *   tree with `n` parent nodes then takes `n` allocations instead of `2n + 1`,
+ *   and at most 3/8 of the memory on 64-bit targets.
+ *
+ * @note Root leaves are still allocated (see
+ * `ITC_CONFIG_USE_SHARED_LEAF_NODES` to avoid that).
+ *
+ * @warning When enabled, all ID nodes must be at least 8 byte aligned, as the
+ * low 3 bits of their address are used for the tags. Memory returned by
+ * ::ITC_Port_malloc must fulfil this.
+*/
+#define ITC_CONFIG_USE_COMPACT_ID_NODES                                      (0)
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+/** Whether each Event node keeps track of the maximum event count in its
+ * subtree
+ * - When disabled, the maximum of a subtree is only known after traversing
+ *   it.
+ * - When enabled, each Event node carries an extra counter, which is kept up
+ *   to date by all operations modifying the Event tree. This allows comparing
+ *   Events to skip subtrees that are entirely `<=` the other Event, at the
+ *   cost of an extra recalculation pass after each modification. Since Event
+ *   trees are normalised, the minimum of a subtree is always its root counter
+ *   and does not need to be tracked.
+*/
+#define ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX                                  (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+
+#ifndef ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+/** Whether to path-compress serialised ID and Event trees
+ * - When disabled, every node of a tree is serialised on its own.
+ * - When enabled, chains of parent nodes, which only have a single non-empty
+ *   child (i.e. `(0, (0, (..., 1)))` IDs or `(0, 0, (0, 0, (..., 1)))`
+ *   Events), are serialised as a single path node holding the length of the
+ *   chain and a bitmap of the direction it takes at each level. Such chains
+ *   are produced by repeatedly forking the same Stamp.
+ *
+ * @note This only affects the serialised form. In memory, IDs and Events are
+ * always plain trees, so the depth and node count of heavily forked IDs are
+ * the same as without this option.
+ *
+ * @warning Path-compressed data cannot be deserialised if this option is
+ * disabled. Such data is rejected with `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT`.
+ * To allow this, serialised Stamps containing paths are marked in their Stamp
+ * extension header.
+*/
+#define ITC_CONFIG_USE_PATH_COMPRESSED_SERDES                                (0)
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
+#ifndef ITC_CONFIG_ENABLE_ID_BITMAP
+/** Whether to enable the dense bitmap ID API
+ * - When disabled, IDs are only available as trees.
+ * - When enabled, IDs no deeper than `ITC_CONFIG_ID_BITMAP_DEPTH` levels can
+ *   be converted to and from an `ITC_Id_Bitmap_t`, holding a bit for each of
+ *   the `2^ITC_CONFIG_ID_BITMAP_DEPTH` smallest subintervals. Splitting and
+ *   summing such IDs are word-parallel bitwise operations, which do not
+ *   allocate any memory. Useful when the number of replicas is bounded.
+*/
+#define ITC_CONFIG_ENABLE_ID_BITMAP                                          (0)
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+#ifndef ITC_CONFIG_ID_BITMAP_DEPTH
+/** The maximum depth of an ID tree, which can be represented as a bitmap.
+ * E.g. `6` gives 64-bit bitmaps and `8` - 256-bit ones. Must be in the range
+ * `[2, 16]` */
+#define ITC_CONFIG_ID_BITMAP_DEPTH                                           (6)
+#endif /* ITC_CONFIG_ID_BITMAP_DEPTH */
+
+#ifndef ITC_CONFIG_ENABLE_ID_INTERVALS
+/** Whether to enable the sorted dyadic interval ID API
+ * - When disabled, IDs are only available as trees.
+ * - When enabled, IDs can be converted to and from an `ITC_Id_Intervals_t`,
+ *   holding the sorted array of the dyadic subintervals owned by the ID.
+ *   Summing such IDs is a linear merge and splitting them is a linear
+ *   partition, with a single allocation per resulting ID. Useful for very
+ *   fragmented IDs.
+*/
+#define ITC_CONFIG_ENABLE_ID_INTERVALS                                       (0)
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_ARRAY
+/** Whether to enable the dense fixed-depth array Event API
+ * - When disabled, Events are only available as trees.
+ * - When enabled, Events no deeper than `ITC_CONFIG_EVENT_ARRAY_DEPTH` levels
+ *   can be converted to and from an `ITC_Event_Array_t`, holding the total
+ *   number of events witnessed by each of the
+ *   `2^ITC_CONFIG_EVENT_ARRAY_DEPTH` smallest subintervals. Joining and
+ *   comparing such Events are element-wise loops, which do not allocate any
+ *   memory and can be vectorised by the compiler. Useful when Event trees are
+ *   bushy and close to full depth.
+ *   Joining and meeting Events (including through Stamps) also switch to the
+ *   array form on their own, if one of the Events is dense enough (see
+ *   `ITC_CONFIG_EVENT_ARRAY_FILL_PERCENT`). Events are still stored and
+ *   serialised as trees.
+*/
+#define ITC_CONFIG_ENABLE_EVENT_ARRAY                                        (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+
+#ifndef ITC_CONFIG_EVENT_ARRAY_DEPTH
+/** The maximum depth of an Event tree, which can be represented as an array.
+ * E.g. `4` gives arrays of 16 counters. Must be in the range `[2, 16]` */
+#define ITC_CONFIG_EVENT_ARRAY_DEPTH                                         (4)
+#endif /* ITC_CONFIG_EVENT_ARRAY_DEPTH */
+
+#ifndef ITC_CONFIG_EVENT_ARRAY_FILL_PERCENT
+/** How full (in percent) an Event tree must be for joins and meets to switch
+ * to the array form. An Event tree is `100%` full if it has a leaf for each
+ * of the `2^ITC_CONFIG_EVENT_ARRAY_DEPTH` smallest subintervals. Set to more
+ * than `100` to never switch automatically */
+#define ITC_CONFIG_EVENT_ARRAY_FILL_PERCENT                                 (50)
+#endif /* ITC_CONFIG_EVENT_ARRAY_FILL_PERCENT */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_STEPS
+/** Whether to enable the step function Event API
+ * - When disabled, Events are only available as trees.
+ * - When enabled, Events (up to 63 levels deep) can be converted to and from
+ *   an `ITC_Event_Steps_t`, holding the function an Event tree denotes over
+ *   the Event interval as a sorted array of breakpoints and counters. Joining
+ *   and comparing such Events are linear merges without any pointer chasing.
+*/
+#define ITC_CONFIG_ENABLE_EVENT_STEPS                                        (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
+#ifndef ITC_CONFIG_EVENT_GROW_POLICY
+/** The default Event grow policy, used by `ITC_Stamp_event`. One of:
+ * - `0` (`ITC_EVENT_GROW_POLICY_MIN_SIZE`) - the cost model from the ITC
+ *   paper. Keeps the Event tree small.
+ * - `1` (`ITC_EVENT_GROW_POLICY_MIN_DEPTH`) - adds events as close to the
+ *   root as the ID allows. Keeps the Event tree shallow, which is what
+ *   comparing and serialising Events scale with.
+ * - `2` (`ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES`) - only expands the
+ *   Event tree if the ID owns none of its existing leaves.
+ * `ITC_Stamp_eventWithGrowPolicy` can be used to pick a different policy for
+ * a single event.
+*/
+#define ITC_CONFIG_EVENT_GROW_POLICY                                         (0)
+#endif /* ITC_CONFIG_EVENT_GROW_POLICY */
+
+#ifndef ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET
+/** The Event node budget of persisted Stamps
+ * - When `0`, the node count is unlimited unless the caller of
+ *   `ITC_Stamp_compactIfOverBudget` sets a budget.
+ * - Otherwise, `ITC_SerDes_persistStamp` compacts Stamps with more Event nodes
+ *   than this before serialising them. `ITC_Stamp_compactIfOverBudget` uses
+ *   the smaller of this and the budget set by its caller.
+ * @note Joins never compact Stamps, as compacting inflates the Stamp as if a
+ * local event was recorded
+*/
+#define ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET                                 (0)
+#endif /* ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET */
+
+#ifndef ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+/** The serialised size budget of persisted Stamps in bytes
+ * - When `0`, the size is unlimited unless the caller of
+ *   `ITC_Stamp_compactIfOverBudget` sets a budget.
+ * - Otherwise, `ITC_SerDes_persistStamp` compacts Stamps that serialise to
+ *   more bytes than this before serialising them.
+ *   `ITC_Stamp_compactIfOverBudget` uses the smaller of this and the budget
+ *   set by its caller.
+*/
+#define ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET                                 (0)
+#endif /* ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+
+#ifndef ITC_CONFIG_ENABLE_STAMP_BATCH
+/** Whether to enable the Stamp batch API
+ * - When disabled, every Stamp join normalises the resulting ID and Event.
+ * - When enabled, `ITC_Stamp_beginBatch` and `ITC_Stamp_endBatch` can be used
+ *   to defer the normalisation of Stamps joined inside the batch until
+ *   `ITC_Stamp_endBatch` is called. Useful when merging many Stamps in a burst
+*/
+#define ITC_CONFIG_ENABLE_STAMP_BATCH                                        (0)
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_HASH
+/** Whether to enable the Event hashing API
+ * - When disabled, Stamps can only be compared via `leq` traversals.
+ * - When enabled, `ITC_Stamp_hash` returns a 64-bit structural hash of the
+ *   Event component of a Stamp and caches it in the Stamp until the Event is
+ *   modified. `ITC_Stamp_compare` uses the cached hashes to report equal
+ *   Stamps without traversing their Events.
+ * @note Equal hashes are trusted to mean equal Events. The probability of two
+ *   different Events sharing a hash is negligible, but not zero.
+*/
+#define ITC_CONFIG_ENABLE_EVENT_HASH                                         (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+#ifndef ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+/** Whether to memoise a Merkle hash in every Event node
+ * - When disabled, Events can only be compared as a whole.
+ * - When enabled, every Event node caches a 64-bit hash of its subtree, which
+ *   is refreshed by the Event operations (fill, grow, join, etc.). This costs
+ *   8 bytes per node but allows finding the subtrees in which two Events
+ *   differ by only descending into subtrees with differing hashes.
+ *   With `ITC_CONFIG_ENABLE_EXTENDED_API` enabled, the following functions
+ *   become part of the public API:
+ *   * `ITC_Event_getSubtreeHashes`
+ *   * `ITC_Event_diffSubtreeHashes`
+ *   * `ITC_Event_diffSubtrees`
+ * @note If `ITC_CONFIG_ENABLE_EVENT_HASH` is also enabled, hashing an Event
+ *   becomes a constant time operation.
+*/
+#define ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH                                 (0)
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+#ifndef ITC_CONFIG_ENABLE_STAMP_REBASE
+/** Whether to enable the Stamp rebase API
+ * - When disabled, Event counters only ever grow.
+ * - When enabled, `ITC_Stamp_rebase` subtracts a base known to be common to
+ *   all Stamps (e.g. a stable frontier) from the Event component of a Stamp,
+ *   keeping the counters (and their serialised size) small. Every Stamp
+ *   carries a 64-bit rebase base ID, which identifies the chain of bases the
+ *   Stamp has been rebased against and is serialised with the Stamp.
+ *   Comparing or joining Stamps with different rebase base IDs fails with
+ *   `ITC_STATUS_MISMATCHED_STAMP_BASE`.
+*/
+#define ITC_CONFIG_ENABLE_STAMP_REBASE                                       (0)
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+#ifndef ITC_CONFIG_ENABLE_STAMP_EPOCH
+/** Whether to enable Stamp epochs
+ * - When disabled, a Stamp can only shrink by joining it back together.
+ * - When enabled, every Stamp carries an epoch, which is serialised with the
+ *   Stamp. `ITC_Stamp_reseedEpoch` moves a Stamp to a later epoch, giving it a
+ *   fresh balanced ID and a `0` Event. Once all peers have been reseeded (e.g.
+ *   while the system is quiescent) all Stamps are back to their minimal size.
+ *   Stamps of a later epoch compare as greater than Stamps of an earlier one.
+ *   Joining Stamps of different epochs fails with
+ *   `ITC_STATUS_MISMATCHED_STAMP_EPOCH`.
+*/
+#define ITC_CONFIG_ENABLE_STAMP_EPOCH                                        (0)
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+
 #ifndef ITC_CONFIG_ENABLE_EXTENDED_API
 /** Enabling this setting gives access to a few additional API calls,
  * which are not part of the original ITC specification. These are:
@@ -31,7 +292,11 @@
  *   * `ITC_Id_clone`
  *   * `ITC_Id_validate`
  *   * `ITC_Id_split`
+ *   * `ITC_Id_splitWeighted`
  *   * `ITC_Id_sum`
+ *   * `ITC_Id_newBalanced`
+ *   * `ITC_Id_rebalance`
+ *   * `ITC_Id_getMetrics`
  *   * `ITC_SerDes_serialiseId`
  *   * `ITC_SerDes_deserialiseId`
  * - For Events - makes the following functions part of the public API:
@@ -39,6 +304,13 @@
  *   * `ITC_Event_destroy`
  *   * `ITC_Event_clone`
  *   * `ITC_Event_validate`
+ *   * `ITC_Event_diff`
+ *   * `ITC_Event_diffRegions`
+ *   * `ITC_Event_meet`
+ *   * `ITC_Event_meetMany`
+ *   * `ITC_Event_rebase`
+ *   * `ITC_Event_add`
+ *   * `ITC_Event_getMetrics`
  *   * `ITC_SerDes_serialiseEvent`
  *   * `ITC_SerDes_deserialiseEvent`
  * - For Stamps - adds the following functions to the public API:
@@ -74,8 +74,233 @@ ITC_Status_t ITC_Event_validate(
     const ITC_Event_t *const pt_Event
 );
 
+/**
+ * @brief Find where an Event exceeds another Event, i.e. what the first Event
+ * knows that the second one does not
+ *
+ * The result holds the counters of `pt_Event1` in the regions where it
+ * exceeds `pt_Event2` and `0` everywhere else. It is normalised, so it is the
+ * smallest Event tree describing those regions. Joining it into `pt_Event2`
+ * gives the same result as joining `pt_Event1` into it.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Diff (out) The pointer to the difference Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_diff(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Diff
+);
+
+/**
+ * @brief Count the regions in which an Event exceeds another Event, without
+ * allocating the difference
+ *
+ * Can be used to size the difference before calling ::ITC_Event_diff().
+ * The count is `0` only if `pt_Event1 <= pt_Event2`. Otherwise it is an upper
+ * bound of the number of non-zero leaves of the difference.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pu32_Regions (out) The number of regions
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_diffRegions(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    uint32_t *pu32_Regions
+);
+
+/**
+ * @brief Meet two Events, i.e. take their pointwise minimum
+ *
+ * The result is the largest Event that is `<=` to both Events. It describes
+ * the history both Events are known to contain.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Event (out) The pointer to the met Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_meet(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event
+);
+
+/**
+ * @brief Meet multiple Events, i.e. take their pointwise minimum
+ *
+ * Equivalent to folding ::ITC_Event_meet() over the Events, but stops early
+ * once the result can no longer shrink.
+ *
+ * @param ppt_Events The Events to meet
+ * @param u32_EventsLength The number of Events. Must be at least `1`
+ * @param ppt_Event (out) The pointer to the met Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_meetMany(
+    const ITC_Event_t *const *const ppt_Events,
+    const uint32_t u32_EventsLength,
+    ITC_Event_t **ppt_Event
+);
+
+/**
+ * @brief Rebase an Event by subtracting a common lower bound from it
+ *
+ * Subtracts `pt_Base` from every counter of the Event and normalises the
+ * result. Rebasing all Events of a system against the same base (e.g. a
+ * stable frontier) preserves their ordering, while keeping the counters small.
+ *
+ * @param ppt_Event (in) The Event to rebase. (out) The rebased Event
+ * @param pt_Base The base to subtract. Must be `<=` the Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_UNDERFLOW` if the base is not `<=` the
+ * Event
+ */
+ITC_Status_t ITC_Event_rebase(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_Base
+);
+
+/**
+ * @brief Add an Event to another, i.e. take their pointwise sum
+ *
+ * Undoes ::ITC_Event_rebase(): adding the base back to a rebased Event gives
+ * the original Event.
+ *
+ * @param ppt_Event (in) The Event to add to. (out) The summed Event
+ * @param pt_Addend The Event to add
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_EVENT_COUNTER_OVERFLOW` if a counter of the sum overflows
+ */
+ITC_Status_t ITC_Event_add(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_Addend
+);
+
+/**
+ * @brief Get the shape metrics of an Event
+ *
+ * Does not allocate any memory. Useful for monitoring the growth of the Event
+ * tree.
+ *
+ * @param pt_Event The Event
+ * @param pt_Metrics (out) The Event metrics
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_getMetrics(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Metrics_t *const pt_Metrics
+);
+
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/**
+ * @brief Get the Merkle hashes of the subtrees of an Event
+ *
+ * The hashes are listed in pre-order, down to (and including) `u8_MaxLevel`.
+ * The result can be sent to a remote replica and compared against its Event
+ * via ::ITC_Event_diffSubtreeHashes()
+ *
+ * @param pt_Event The Event
+ * @param u8_MaxLevel The deepest level to get the subtree hashes of. Must not
+ * exceed `63`
+ * @param pt_Hashes (out) The subtree hashes
+ * @param pu32_Length (in) The number of elements `pt_Hashes` can hold.
+ * (out) The number of subtree hashes
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Hashes` is not big
+ * enough
+ */
+ITC_Status_t ITC_Event_getSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const uint8_t u8_MaxLevel,
+    ITC_Event_SubtreeHash_t *const pt_Hashes,
+    uint32_t *const pu32_Length
+);
+
+/**
+ * @brief Find the subtrees of an Event, which differ from a (remote) list of
+ * subtree hashes
+ *
+ * Only descends into the subtrees whose hashes differ. The differing subtrees
+ * are the deepest ones, which can be compared given the list of hashes.
+ *
+ * @param pt_Event The Event
+ * @param pt_Hashes The subtree hashes as returned by
+ * ::ITC_Event_getSubtreeHashes()
+ * @param u32_HashesLength The number of elements in `pt_Hashes`
+ * @param pt_Diffs (out) The hashes of the differing subtrees of `pt_Event`
+ * @param pu32_DiffsLength (in) The number of elements `pt_Diffs` can hold.
+ * (out) The number of differing subtrees
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Diffs` is not big enough
+ */
+ITC_Status_t ITC_Event_diffSubtreeHashes(
+    const ITC_Event_t *const pt_Event,
+    const ITC_Event_SubtreeHash_t *const pt_Hashes,
+    const uint32_t u32_HashesLength,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
+);
+
+/**
+ * @brief Find the subtrees of an Event, which differ from another Event
+ *
+ * Only descends into the subtrees whose hashes differ, so the cost is
+ * proportional to the number of differences times the depth of the trees.
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param pt_Diffs (out) The hashes of the differing subtrees of `pt_Event1`
+ * @param pu32_DiffsLength (in) The number of elements `pt_Diffs` can hold.
+ * (out) The number of differing subtrees
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if `pt_Diffs` is not big enough
+ */
+ITC_Status_t ITC_Event_diffSubtrees(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_SubtreeHash_t *const pt_Diffs,
+    uint32_t *const pu32_DiffsLength
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 #endif /* !ITC_CONFIG_ENABLE_EXTENDED_API */
 
+/**
+ * @brief Get the shared read-only leaf Event with a 0 counter
+ *
+ * The returned Event is statically allocated and shared by all of its users,
+ * so obtaining it does not allocate any memory. It must never be modified in
+ * place. Destroying it is a no-op and cloning it returns the same shared
+ * Event. ::ITC_Event_grow() transparently replaces it with a private copy.
+ *
+ * If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is disabled, a new Event is allocated
+ * instead.
+ *
+ * @param ppt_Event (out) The pointer to the shared Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_newShared(
+    ITC_Event_t **ppt_Event
+);
+
 /**
  * @brief Join two existing Events into a single Event
  *
@@ -158,7 +383,249 @@ ITC_Status_t ITC_Event_grow(
     const ITC_Id_t *const pt_Id
 );
 
-#if IS_UNIT_TEST_BUILD
+/**
+ * @brief Grow an Event using the given grow policy
+ *
+ * Same as ::ITC_Event_grow(), which uses ::ITC_CONFIG_EVENT_GROW_POLICY.
+ *
+ * @param ppt_Event The Event to grow
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @param t_GrowPolicy The grow policy
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_growWithPolicy(
+    ITC_Event_t **ppt_Event,
+    const ITC_Id_t *const pt_Id,
+    const ITC_Event_GrowPolicy_t t_GrowPolicy
+);
+
+/**
+ * @brief Join the intervals of an Event owned by an ID into another Event
+ *
+ * Fulfills `join(e1, meet(e2, m))`, where `m` is the largest event counter in
+ * the intervals owned by the ID and `0` everywhere else. I.e. `e1` only learns
+ * about the events `e2` has witnessed in the intervals owned by the ID.
+ *
+ * @param ppt_Event The Event to join into
+ * @param pt_OtherEvent The Event to join the owned intervals of
+ * @param pt_Id The ID showing the ownership information for the interval
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_joinOwned(
+    ITC_Event_t **ppt_Event,
+    const ITC_Event_t *const pt_OtherEvent,
+    const ITC_Id_t *const pt_Id
+);
+
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+
+/**
+ * @brief Convert an existing Event into a dense fixed-depth Event array
+ *
+ * @param pt_Event The existing Event
+ * @param pt_Array (out) The Event array
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the Event tree is deeper than
+ * `ITC_CONFIG_EVENT_ARRAY_DEPTH`
+ */
+ITC_Status_t ITC_Event_toArray(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Array_t *const pt_Array
+);
+
+/**
+ * @brief Allocate a new normalised Event from a dense Event array
+ *
+ * @param pt_Array The Event array
+ * @param ppt_Event (out) The Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_newFromArray(
+    const ITC_Event_Array_t *const pt_Array,
+    ITC_Event_t **ppt_Event
+);
+
+/**
+ * @brief Join two dense Event arrays in place
+ *
+ * @param pt_Array (in) The first Event array. (out) The joined Event array
+ * @param pt_OtherArray The second Event array
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_joinArray(
+    ITC_Event_Array_t *const pt_Array,
+    const ITC_Event_Array_t *const pt_OtherArray
+);
+
+/**
+ * @brief Check if a dense Event array is `less than or equal` (`<=`) to
+ * another one
+ *
+ * @param pt_Array1 The first Event array
+ * @param pt_Array2 The second Event array
+ * @param pb_IsLeq (out) `true` if `*pt_Array1 <= *pt_Array2`. Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_leqArray(
+    const ITC_Event_Array_t *const pt_Array1,
+    const ITC_Event_Array_t *const pt_Array2,
+    bool *pb_IsLeq
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+
+/**
+ * @brief Convert an existing Event into a step function Event
+ *
+ * @note Memory for the steps will be dynamically allocated. Free it with
+ * ::ITC_Event_destroySteps()
+ * @param pt_Event The existing Event
+ * @param pt_Steps (out) The step function Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the Event tree is deeper than
+ * 63 levels
+ */
+ITC_Status_t ITC_Event_toSteps(
+    const ITC_Event_t *const pt_Event,
+    ITC_Event_Steps_t *const pt_Steps
+);
+
+/**
+ * @brief Allocate a new normalised Event from a step function Event
+ *
+ * @param pt_Steps The step function Event
+ * @param ppt_Event (out) The Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_newFromSteps(
+    const ITC_Event_Steps_t *const pt_Steps,
+    ITC_Event_t **ppt_Event
+);
+
+/**
+ * @brief Free the steps of a step function Event
+ *
+ * @param pt_Steps The step function Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_destroySteps(
+    ITC_Event_Steps_t *const pt_Steps
+);
+
+/**
+ * @brief Join two step function Events
+ *
+ * @note Memory for the steps of the joined Event will be dynamically
+ * allocated. The source step function Events are not modified
+ * @param pt_Steps1 The first step function Event
+ * @param pt_Steps2 The second step function Event
+ * @param pt_Steps (out) The joined step function Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_joinSteps(
+    const ITC_Event_Steps_t *const pt_Steps1,
+    const ITC_Event_Steps_t *const pt_Steps2,
+    ITC_Event_Steps_t *const pt_Steps
+);
+
+/**
+ * @brief Check if a step function Event is `less than or equal` (`<=`) to
+ * another one
+ *
+ * @param pt_Steps1 The first step function Event
+ * @param pt_Steps2 The second step function Event
+ * @param pb_IsLeq (out) `true` if `*pt_Steps1 <= *pt_Steps2`. Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_leqSteps(
+    const ITC_Event_Steps_t *const pt_Steps1,
+    const ITC_Event_Steps_t *const pt_Steps2,
+    bool *pb_IsLeq
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+
+/**
+ * @brief Calculate the structural hash of an Event
+ *
+ * Normalised Events are canonical, so equal Events always have equal hashes.
+ * Different Events have different hashes with overwhelming probability.
+ *
+ * @param pt_Event The Event to hash
+ * @param pu64_Hash (out) The hash of the Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_hash(
+    const ITC_Event_t *const pt_Event,
+    uint64_t *pu64_Hash
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+
+/**
+ * @brief Chain the identity of a rebase base
+ *
+ * Mixes the structural hash of the base Event into the ID of the chain of
+ * bases an Event has already been rebased against. Events rebased against
+ * different bases (or chains of bases) get different IDs, barring a 64-bit
+ * hash collision.
+ *
+ * @param pt_Base The base Event
+ * @param u64_BaseId The current rebase base ID. `0` if never rebased
+ * @param pu64_BaseId (out) The new rebase base ID. Never `0`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_chainRebaseBaseId(
+    const ITC_Event_t *const pt_Base,
+    const uint64_t u64_BaseId,
+    uint64_t *pu64_BaseId
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/**
+ * @brief Join two Events similar to ::ITC_Event_joinConst() but do not
+ * normalise the result
+ *
+ * The source Events are not required to be normalised either. The result can
+ * be normalised later via ::ITC_Event_normalise()
+ *
+ * @param pt_Event1 The first Event
+ * @param pt_Event2 The second Event
+ * @param ppt_Event The new Event
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Event_joinConstUnnormalised(
+    const ITC_Event_t *const pt_Event1,
+    const ITC_Event_t *const pt_Event2,
+    ITC_Event_t **ppt_Event
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH
 
 /**
  * @brief Normalise an Event
@@ -171,6 +638,24 @@ ITC_Status_t ITC_Event_normalise(
     ITC_Event_t *pt_Event
 );
 
+#endif /* IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if IS_UNIT_TEST_BUILD
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+/**
+ * @brief Calculate the Merkle hash of an Event subtree from the memoised
+ * hashes of its children
+ *
+ * @param pt_Event The root of the Event subtree
+ * @return `uint64_t` The Merkle hash of the subtree
+ */
+uint64_t ITC_Event_calcSubtreeHash(
+    const ITC_Event_t *const pt_Event
+);
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
 /**
  * @brief Maximise an Event
  *
@@ -14,6 +14,111 @@
 #include "ITC_Status.h"
 #include "ITC_config.h"
 
+#include <stdbool.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Defines
+ ******************************************************************************/
+
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+
+/** The bit of `ITC_Id_t.t_ParentAndOwner` holding the owner flag */
+#define ITC_ID_OWNER_FLAG                                         ((uintptr_t)1)
+
+/** The bit marking a tagged leaf ID.
+ * Seed and null leaves below the root are not allocated. Instead, their
+ * parent holds a tagged value in place of the child pointer, made up of the
+ * address of the parent and the `ITC_ID_TAG_*` bits. ID nodes are at least 8
+ * byte aligned, so these never clash with the address */
+#define ITC_ID_TAG_LEAF                                           ((uintptr_t)1)
+
+/** The bit of a tagged leaf ID marking it as the right child of its parent */
+#define ITC_ID_TAG_RIGHT                                          ((uintptr_t)2)
+
+/** The bit of a tagged leaf ID holding the owner flag */
+#define ITC_ID_TAG_OWNER                                          ((uintptr_t)4)
+
+/** All bits of a tagged leaf ID, which are not part of the parent address */
+#define ITC_ID_TAG_MASK                                           ((uintptr_t)7)
+
+/** Checks whether the given `ITC_Id_t` is a tagged leaf ID.
+ * Tagged leaf IDs must never be dereferenced */
+#define ITC_ID_IS_TAGGED_LEAF(pt_Id)                                           \
+    (((uintptr_t)(pt_Id) & ITC_ID_TAG_LEAF) != 0)
+
+/** Get a tagged leaf ID for a child of the given parent `ITC_Id_t` */
+#define ITC_ID_NEW_TAGGED_LEAF(pt_Parent, b_IsRight, b_IsOwner)                \
+    ((ITC_Id_t *)((uintptr_t)(pt_Parent) | ITC_ID_TAG_LEAF |                   \
+                  ((b_IsRight) ? ITC_ID_TAG_RIGHT : 0) |                       \
+                  ((b_IsOwner) ? ITC_ID_TAG_OWNER : 0)))
+
+/** Get the parent of the given `ITC_Id_t` */
+#define ITC_ID_GET_PARENT(pt_Id)                                               \
+    (ITC_ID_IS_TAGGED_LEAF(pt_Id)                                              \
+         ? (ITC_Id_t *)((uintptr_t)(pt_Id) & ~ITC_ID_TAG_MASK)                 \
+         : (ITC_Id_t *)((pt_Id)->t_ParentAndOwner & ~ITC_ID_OWNER_FLAG))
+
+/** Set the parent of the given `ITC_Id_t`.
+ * Must not be used on tagged leaf IDs */
+#define ITC_ID_SET_PARENT(pt_Id, pt_NewParent)                                 \
+    ((pt_Id)->t_ParentAndOwner =                                               \
+        (uintptr_t)(pt_NewParent) |                                            \
+        ((pt_Id)->t_ParentAndOwner & ITC_ID_OWNER_FLAG))
+
+/** Get the left child of the given `ITC_Id_t` */
+#define ITC_ID_GET_LEFT(pt_Id)                                                 \
+    (ITC_ID_IS_TAGGED_LEAF(pt_Id) ? NULL : (pt_Id)->pt_Left)
+
+/** Get the right child of the given `ITC_Id_t` */
+#define ITC_ID_GET_RIGHT(pt_Id)                                                \
+    (ITC_ID_IS_TAGGED_LEAF(pt_Id) ? NULL : (pt_Id)->pt_Right)
+
+/** Checks whether the given `ITC_Id_t` owns its interval */
+#define ITC_ID_IS_OWNER(pt_Id)                                                 \
+    (ITC_ID_IS_TAGGED_LEAF(pt_Id)                                              \
+         ? (((uintptr_t)(pt_Id) & ITC_ID_TAG_OWNER) != 0)                      \
+         : (((pt_Id)->t_ParentAndOwner & ITC_ID_OWNER_FLAG) != 0))
+
+/** Set whether the given `ITC_Id_t` owns its interval.
+ * Must not be used on tagged leaf IDs */
+#define ITC_ID_SET_OWNER(pt_Id, b_NewIsOwner)                                  \
+    ((pt_Id)->t_ParentAndOwner =                                               \
+        ((pt_Id)->t_ParentAndOwner & ~ITC_ID_OWNER_FLAG) |                     \
+        ((b_NewIsOwner) ? ITC_ID_OWNER_FLAG : 0))
+
+#else
+
+/** Checks whether the given `ITC_Id_t` is a tagged leaf ID.
+ * There are none, so this is never the case */
+#define ITC_ID_IS_TAGGED_LEAF(pt_Id)                                    (false)
+
+/** Get the parent of the given `ITC_Id_t` */
+#define ITC_ID_GET_PARENT(pt_Id)                                               \
+    ((pt_Id)->pt_Parent)
+
+/** Set the parent of the given `ITC_Id_t` */
+#define ITC_ID_SET_PARENT(pt_Id, pt_NewParent)                                 \
+    ((pt_Id)->pt_Parent = (pt_NewParent))
+
+/** Get the left child of the given `ITC_Id_t` */
+#define ITC_ID_GET_LEFT(pt_Id)                                                 \
+    ((pt_Id)->pt_Left)
+
+/** Get the right child of the given `ITC_Id_t` */
+#define ITC_ID_GET_RIGHT(pt_Id)                                                \
+    ((pt_Id)->pt_Right)
+
+/** Checks whether the given `ITC_Id_t` owns its interval */
+#define ITC_ID_IS_OWNER(pt_Id)                                                 \
+    ((pt_Id)->b_IsOwner)
+
+/** Set whether the given `ITC_Id_t` owns its interval */
+#define ITC_ID_SET_OWNER(pt_Id, b_NewIsOwner)                                  \
+    ((pt_Id)->b_IsOwner = (b_NewIsOwner))
+
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+
 /******************************************************************************
  * Functions
  ******************************************************************************/
@@ -96,6 +201,31 @@ ITC_Status_t ITC_Id_split(
     ITC_Id_t **ppt_OtherId
 );
 
+/**
+ * @brief Split an existing ITC ID into two distinct ITC IDs with uneven shares
+ *
+ * The split follows the same rules as ::ITC_Id_split(), except wherever an
+ * owned interval is divided: there the other ID receives the rightmost
+ * `u32_Numerator / 2^u8_DenominatorLog2` of the interval and the existing ID
+ * keeps the rest. Giving a short-lived fork a small share keeps the ID of a
+ * long-lived one shallow. Both IDs are normalised.
+ *
+ * @param ppt_Id (in) The existing ID. (out) The first split ID
+ * @param ppt_OtherId (out) The second split ID
+ * @param u32_Numerator The numerator of the share of the other ID
+ * @param u8_DenominatorLog2 The log2 of the denominator of the share of the
+ * other ID. Must be less than 32
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the share is not in the (0, 1) range
+ */
+ITC_Status_t ITC_Id_splitWeighted(
+    ITC_Id_t **ppt_Id,
+    ITC_Id_t **ppt_OtherId,
+    uint32_t u32_Numerator,
+    uint8_t u8_DenominatorLog2
+);
+
 /**
  * @brief Sum two existing IDs into a single ID
  *
@@ -112,8 +242,257 @@ ITC_Status_t ITC_Id_sum(
     ITC_Id_t **ppt_OtherId
 );
 
+/**
+ * @brief Allocate a new ID owning one part of a balanced split of the seed ID
+ *
+ * The seed interval is halved recursively, giving the extra part of an odd
+ * split to the left half, until it is split into `u32_PartsCount` parts. The
+ * parts are disjoint and their sum is the seed ID. Each part is at most
+ * `ceil(log2(u32_PartsCount))` levels deep, regardless of how the IDs they
+ * replace were forked.
+ *
+ * @param u32_PartIndex The index of the part, counting from the left
+ * @param u32_PartsCount The number of parts to split the seed ID into
+ * @param ppt_Id (out) The pointer to the new ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if `u32_PartIndex >= u32_PartsCount`
+ */
+ITC_Status_t ITC_Id_newBalanced(
+    const uint32_t u32_PartIndex,
+    const uint32_t u32_PartsCount,
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Rebalance a set of IDs after churn
+ *
+ * Repeated forks and joins can leave IDs as deep, unbalanced trees, which
+ * makes every subsequent fill and grow more expensive. This replaces the IDs
+ * with shallow IDs owning the same fraction of the interval as before. Each
+ * owned fraction is reallocated within the sum of the IDs as the fewest and
+ * shallowest dyadic subintervals available. E.g. IDs owning `1/2`, `1/4`,
+ * `1/8` and `1/8` of a seed ID become no deeper than `3`, regardless of their
+ * previous shape. The sum of the IDs is preserved.
+ *
+ * @warning The IDs are reassigned to different intervals. Unless the Events
+ * they are used with are remapped accordingly, causality is lost. Use
+ * ::ITC_Stamp_rebalance() to rebalance a set of Stamps instead.
+ *
+ * @param ppt_Ids The IDs to rebalance. Must not overlap. Left unmodified on
+ * failure
+ * @param u32_IdsLength The number of IDs
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if an ID or the sum of the IDs
+ * is deeper than `63`
+ */
+ITC_Status_t ITC_Id_rebalance(
+    ITC_Id_t **ppt_Ids,
+    const uint32_t u32_IdsLength
+);
+
+/**
+ * @brief Get the shape and ownership metrics of an ID
+ *
+ * Does not allocate any memory. Useful for load-aware decisions, such as
+ * forking from the replica owning the largest interval, or for monitoring the
+ * growth of the ID tree.
+ *
+ * @param pt_Id The ID
+ * @param pt_Metrics (out) The ID metrics
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_getMetrics(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Metrics_t *const pt_Metrics
+);
+
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+
+/**
+ * @brief Convert an existing ID into a fixed-depth bitmap ID
+ *
+ * Bit `n` of the bitmap is set if the ID owns the `n`-th of the
+ * `ITC_ID_BITMAP_LEN` equally sized subintervals of the ID interval.
+ *
+ * @param pt_Id The existing ID
+ * @param pt_Bitmap (out) The bitmap ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID tree is deeper than
+ * `ITC_CONFIG_ID_BITMAP_DEPTH`
+ */
+ITC_Status_t ITC_Id_toBitmap(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Bitmap_t *const pt_Bitmap
+);
+
+/**
+ * @brief Allocate a new normalised ID from a bitmap ID
+ *
+ * @param pt_Bitmap The bitmap ID
+ * @param ppt_Id (out) The ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_newFromBitmap(
+    const ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Split a bitmap ID in place, following the same rules as
+ * ::ITC_Id_split()
+ *
+ * @param pt_Bitmap (in) The bitmap ID to split. (out) The first half
+ * @param pt_OtherBitmap (out) The second half
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if a single subinterval would
+ * need to be split
+ */
+ITC_Status_t ITC_Id_splitBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    ITC_Id_Bitmap_t *const pt_OtherBitmap
+);
+
+/**
+ * @brief Sum two bitmap IDs in place
+ *
+ * @param pt_Bitmap (in) The first bitmap ID. (out) The summed bitmap ID
+ * @param pt_OtherBitmap The second bitmap ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the bitmap IDs overlap
+ */
+ITC_Status_t ITC_Id_sumBitmap(
+    ITC_Id_Bitmap_t *const pt_Bitmap,
+    const ITC_Id_Bitmap_t *const pt_OtherBitmap
+);
+
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+
+/**
+ * @brief Convert an existing ID into a sorted dyadic interval ID
+ *
+ * @note Memory for the subintervals will be dynamically allocated. Free it
+ * with ::ITC_Id_destroyIntervals()
+ * @param pt_Id The existing ID
+ * @param pt_Intervals (out) The interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if the ID tree is deeper than
+ * 63 levels
+ */
+ITC_Status_t ITC_Id_toIntervals(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_Intervals_t *const pt_Intervals
+);
+
+/**
+ * @brief Allocate a new normalised ID from a sorted dyadic interval ID
+ *
+ * @param pt_Intervals The interval ID
+ * @param ppt_Id (out) The ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_newFromIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Free the subintervals of a sorted dyadic interval ID
+ *
+ * @param pt_Intervals The interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_destroyIntervals(
+    ITC_Id_Intervals_t *const pt_Intervals
+);
+
+/**
+ * @brief Split a sorted dyadic interval ID, following the same rules as
+ * ::ITC_Id_split()
+ *
+ * @note Memory for the subintervals of both halves will be dynamically
+ * allocated. The source interval ID is not modified
+ * @param pt_Intervals The interval ID to split
+ * @param pt_Intervals1 (out) The first half
+ * @param pt_Intervals2 (out) The second half
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_splitIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals,
+    ITC_Id_Intervals_t *const pt_Intervals1,
+    ITC_Id_Intervals_t *const pt_Intervals2
+);
+
+/**
+ * @brief Sum two sorted dyadic interval IDs
+ *
+ * @note Memory for the subintervals of the summed ID will be dynamically
+ * allocated. The source interval IDs are not modified
+ * @param pt_Intervals1 The first interval ID
+ * @param pt_Intervals2 The second interval ID
+ * @param pt_Intervals (out) The summed interval ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_OVERLAPPING_ID_INTERVAL` if the interval IDs overlap
+ */
+ITC_Status_t ITC_Id_sumIntervals(
+    const ITC_Id_Intervals_t *const pt_Intervals1,
+    const ITC_Id_Intervals_t *const pt_Intervals2,
+    ITC_Id_Intervals_t *const pt_Intervals
+);
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+
 #endif /* !ITC_CONFIG_ENABLE_EXTENDED_API */
 
+/**
+ * @brief Get the shared read-only seed ID (1)
+ *
+ * The returned ID is statically allocated and shared by all of its users, so
+ * obtaining it does not allocate any memory. It must never be modified in
+ * place. Destroying it is a no-op and cloning it returns the same shared ID.
+ *
+ * If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is disabled, a new ID is allocated
+ * instead.
+ *
+ * @param ppt_Id (out) The pointer to the shared seed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_newSharedSeed(
+    ITC_Id_t **ppt_Id
+);
+
+/**
+ * @brief Get the shared read-only null ID (0)
+ *
+ * The returned ID is statically allocated and shared by all of its users, so
+ * obtaining it does not allocate any memory. It must never be modified in
+ * place. Destroying it is a no-op and cloning it returns the same shared ID.
+ *
+ * If ::ITC_CONFIG_USE_SHARED_LEAF_NODES is disabled, a new ID is allocated
+ * instead.
+ *
+ * @param ppt_Id (out) The pointer to the shared null ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_newSharedNull(
+    ITC_Id_t **ppt_Id
+);
+
 /**
  * @brief Split an ID similar to ::ITC_Id_split() but do not modify the source ID
  *
@@ -129,6 +508,28 @@ ITC_Status_t ITC_Id_splitConst(
     ITC_Id_t **ppt_Id2
 );
 
+/**
+ * @brief Split an ID similar to ::ITC_Id_splitWeighted() but do not modify the
+ * source ID
+ *
+ * @param pt_Id The existing ID
+ * @param ppt_Id1 The first part of the split ID
+ * @param ppt_Id2 The second part of the split ID
+ * @param u32_Numerator The numerator of the share of `ppt_Id2`
+ * @param u8_DenominatorLog2 The log2 of the denominator of the share of
+ * `ppt_Id2`. Must be less than 32
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INVALID_PARAM` if the share is not in the (0, 1) range
+ */
+ITC_Status_t ITC_Id_splitWeightedConst(
+    const ITC_Id_t *const pt_Id,
+    ITC_Id_t **ppt_Id1,
+    ITC_Id_t **ppt_Id2,
+    uint32_t u32_Numerator,
+    uint8_t u8_DenominatorLog2
+);
+
 /**
  * @brief Sum two IDs similar to ::ITC_Id_sum() but do not modify the source IDs
  *
@@ -144,7 +545,86 @@ ITC_Status_t ITC_Id_sumConst(
     ITC_Id_t **ppt_Id
 );
 
-#if IS_UNIT_TEST_BUILD
+/**
+ * @brief Rebalance IDs similar to ::ITC_Id_rebalance() but do not modify the
+ * source IDs
+ *
+ * @param ppt_Ids The existing IDs. Must not overlap
+ * @param u32_IdsLength The number of IDs
+ * @param ppt_RebalancedIds (out) The rebalanced IDs. Must have room for
+ * `u32_IdsLength` IDs
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_INSUFFICIENT_RESOURCES` if an ID or the sum of the IDs
+ * is deeper than `63`
+ */
+ITC_Status_t ITC_Id_rebalanceConst(
+    const ITC_Id_t *const *const ppt_Ids,
+    const uint32_t u32_IdsLength,
+    ITC_Id_t **ppt_RebalancedIds
+);
+
+/**
+ * @brief Split an ID into a balanced set of parts without modifying the source
+ * ID
+ *
+ * The ID is halved recursively, giving the extra part of an odd split to the
+ * left half, until it is split into `u32_PartsCount` parts. Each part is at
+ * most `ceil(log2(u32_PartsCount))` levels deeper than the ID. Equivalent to
+ * splitting the ID `u32_PartsCount - 1` times in a balanced order.
+ *
+ * @param pt_Id The existing ID
+ * @param u32_PartsCount The number of parts to split the ID into
+ * @param ppt_Ids (out) The parts of the ID, counting from the left. Must have
+ * room for `u32_PartsCount` IDs
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_splitNConst(
+    const ITC_Id_t *const pt_Id,
+    const uint32_t u32_PartsCount,
+    ITC_Id_t **ppt_Ids
+);
+
+/**
+ * @brief Check whether two IDs are equal, i.e. have the same tree
+ *
+ * @param pt_Id1 The first ID
+ * @param pt_Id2 The second ID
+ * @param pb_IsEqual (out) `true` if the IDs are equal. Otherwise `false`
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_isEqual(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    bool *pb_IsEqual
+);
+
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+
+/**
+ * @brief Sum two IDs similar to ::ITC_Id_sumConst() but do not normalise the
+ * result
+ *
+ * The source IDs are not required to be normalised either. The result can be
+ * normalised later via ::ITC_Id_normalise()
+ *
+ * @param pt_Id1 The first existing ID
+ * @param pt_Id2 The second existing ID
+ * @param ppt_Id The summed ID
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_Id_sumConstUnnormalised(
+    const ITC_Id_t *const pt_Id1,
+    const ITC_Id_t *const pt_Id2,
+    ITC_Id_t **ppt_Id
+);
+
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+
+#if IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH
 
 /**
  * @brief Normalise an ID
@@ -157,6 +637,6 @@ ITC_Status_t ITC_Id_normalise(
     ITC_Id_t *pt_Id
 );
 
-#endif /* IS_UNIT_TEST_BUILD */
+#endif /* IS_UNIT_TEST_BUILD || ITC_CONFIG_ENABLE_STAMP_BATCH */
 
 #endif /* ITC_ID_PACKAGE_H_ */
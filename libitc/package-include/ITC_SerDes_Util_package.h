@@ -68,6 +68,41 @@ ITC_Status_t ITC_SerDes_Util_serialiseId(
     const bool b_AddVersion
 );
 
+/**
+ * @brief Calculate the size of a serialised ITC Id without serialising it
+ *
+ * @param pt_Id The Id
+ * @param b_AddVersion Whether the value of `ITC_VERSION_MAJOR` is prepended to
+ * the output
+ * @param pu32_Size (out) The size of the serialised Id in bytes. Same as the
+ * size returned by ::ITC_SerDes_Util_serialiseId()
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_getSerialisedIdSize(
+    const ITC_Id_t *const pt_Id,
+    const bool b_AddVersion,
+    uint32_t *const pu32_Size
+);
+
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+/**
+ * @brief Check whether a serialised ITC Id contains at least one path
+ *
+ * @param pt_Id The Id
+ * @param pb_IsPathCompressed (out) Whether ::ITC_SerDes_Util_serialiseId()
+ * serialises any part of the Id as a path
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_isIdPathCompressed(
+    const ITC_Id_t *const pt_Id,
+    bool *const pb_IsPathCompressed
+);
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
 /**
  * @brief Deserialise an ITC Id
  *
@@ -85,6 +120,8 @@ ITC_Status_t ITC_SerDes_Util_serialiseId(
  * @param ppt_Id The pointer to the deserialised Id
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
  */
 ITC_Status_t ITC_SerDes_Util_deserialiseId(
     const uint8_t *const pu8_Buffer,
@@ -120,6 +157,41 @@ ITC_Status_t ITC_SerDes_Util_serialiseEvent(
     const bool b_AddVersion
 );
 
+/**
+ * @brief Calculate the size of a serialised ITC Event without serialising it
+ *
+ * @param pt_Event The Event
+ * @param b_AddVersion Whether the value of `ITC_VERSION_MAJOR` is prepended to
+ * the output
+ * @param pu32_Size (out) The size of the serialised Event in bytes. Same as
+ * the size returned by ::ITC_SerDes_Util_serialiseEvent()
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_getSerialisedEventSize(
+    const ITC_Event_t *const pt_Event,
+    const bool b_AddVersion,
+    uint32_t *const pu32_Size
+);
+
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+
+/**
+ * @brief Check whether a serialised ITC Event contains at least one path
+ *
+ * @param pt_Event The Event
+ * @param pb_IsPathCompressed (out) Whether ::ITC_SerDes_Util_serialiseEvent()
+ * serialises any part of the Event as a path
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_SerDes_Util_isEventPathCompressed(
+    const ITC_Event_t *const pt_Event,
+    bool *const pb_IsPathCompressed
+);
+
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+
 /**
  * @brief Deserialise an ITC Event
  *
@@ -137,6 +209,8 @@ ITC_Status_t ITC_SerDes_Util_serialiseEvent(
  * @param ppt_Event The pointer to the deserialised Event
  * @return `ITC_Status_t` The status of the operation
  * @retval `ITC_STATUS_SUCCESS` on success
+ * @retval `ITC_STATUS_SERDES_UNSUPPORTED_FORMAT` if the data is
+ * path-compressed but `ITC_CONFIG_USE_PATH_COMPRESSED_SERDES` is disabled
  */
 ITC_Status_t ITC_SerDes_Util_deserialiseEvent(
     const uint8_t *const pu8_Buffer,
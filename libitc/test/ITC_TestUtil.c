@@ -142,7 +142,7 @@ static void destroyInvalidIdSubtree(
 )
 {
     /* Fix the damage so the Id can be properly deallocated */
-    (*ppt_Id)->pt_Parent = NULL;
+    ITC_ID_SET_PARENT((*ppt_Id), NULL);
     TEST_SUCCESS(ITC_Id_destroy(ppt_Id));
 }
 
@@ -210,7 +210,7 @@ static void destroyInvalidIdWithNullParentPointer(
 )
 {
     /* Fix the damage so the ID can be properly deallocated */
-    (*ppt_Id)->pt_Left->pt_Parent = *ppt_Id;
+    ITC_ID_SET_PARENT((*ppt_Id)->pt_Left, *ppt_Id);
     TEST_SUCCESS(ITC_Id_destroy(ppt_Id));
 }
 
@@ -242,7 +242,7 @@ static void destroyInvalidIdWithInvalidParentPointer(
 )
 {
     /* Fix the damage so the ID can be properly deallocated */
-    (*ppt_Id)->pt_Right->pt_Parent = *ppt_Id;
+    ITC_ID_SET_PARENT((*ppt_Id)->pt_Right, *ppt_Id);
     TEST_SUCCESS(ITC_Id_destroy(ppt_Id));
 }
 
@@ -1243,7 +1243,9 @@ static void newInvalidSerialisedStampWithInvalidHeader(
     static const uint8_t ru8_Buffer[] =
     {
         ITC_VERSION_MAJOR, /* Provided by build system c args */
-        ITC_SERDES_STAMP_HEADER_MASK << 1,
+        /* Every header bit is in use when rebasing is enabled. The header is
+         * then still invalid, as it claims to be a delta */
+        (uint8_t)(ITC_SERDES_STAMP_HEADER_MASK << 1),
         1,
         ITC_SERDES_SEED_ID_HEADER,
         1,
@@ -1494,7 +1496,7 @@ ITC_Status_t ITC_TestUtil_newNullId(
     t_Status = ITC_Id_newNull(ppt_Id);
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        (*ppt_Id)->pt_Parent = pt_Parent;
+        ITC_ID_SET_PARENT((*ppt_Id), pt_Parent);
     }
 
     return t_Status;
@@ -1514,7 +1516,7 @@ ITC_Status_t ITC_TestUtil_newSeedId(
     t_Status = ITC_Id_newSeed(ppt_Id);
     if (t_Status == ITC_STATUS_SUCCESS)
     {
-        (*ppt_Id)->pt_Parent = pt_Parent;
+        ITC_ID_SET_PARENT((*ppt_Id), pt_Parent);
     }
 
     return t_Status;
@@ -1537,6 +1539,115 @@ ITC_Status_t ITC_TestUtil_newEvent(
     {
         (*ppt_Event)->pt_Parent = pt_Parent;
         (*ppt_Event)->t_Count = t_Count;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+        (*ppt_Event)->t_Max = t_Count;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+        (*ppt_Event)->u64_Hash = ITC_Event_calcSubtreeHash(*ppt_Event);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+        /* Some invalid Events use made up parent addresses. Only refresh the
+         * memoised summaries of the parent if the Event was attached to it */
+        if (pt_Parent &&
+            ((uintptr_t)ppt_Event - (uintptr_t)pt_Parent) <
+                sizeof(ITC_Event_t))
+        {
+            ITC_TestUtil_updateEventSubtreeMax(pt_Parent);
+        }
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ * Recalculate the memoised subtree summaries of an Event and its ancestors
+ ******************************************************************************/
+
+void ITC_TestUtil_updateEventSubtreeMax(
+    ITC_Event_t *pt_Event
+)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    ITC_Event_t *pt_Child = NULL;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+    ITC_Event_Counter_t t_ChildrenMax;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+
+    if (pt_Event)
+    {
+        /* Refresh the subtree first */
+        ITC_TestUtil_updateEventSubtreeMax(pt_Event->pt_Left);
+        ITC_TestUtil_updateEventSubtreeMax(pt_Event->pt_Right);
+    }
+
+    /* Refresh all ancestors still linked to their children */
+    while (pt_Event &&
+           (!pt_Child ||
+            pt_Event->pt_Left == pt_Child ||
+            pt_Event->pt_Right == pt_Child))
+    {
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+        t_ChildrenMax = 0;
+
+        if (pt_Event->pt_Left && pt_Event->pt_Left->t_Max > t_ChildrenMax)
+        {
+            t_ChildrenMax = pt_Event->pt_Left->t_Max;
+        }
+
+        if (pt_Event->pt_Right && pt_Event->pt_Right->t_Max > t_ChildrenMax)
+        {
+            t_ChildrenMax = pt_Event->pt_Right->t_Max;
+        }
+
+        /* Saturate instead of overflowing */
+        pt_Event->t_Max =
+            (t_ChildrenMax > ((ITC_Event_Counter_t)~0) - pt_Event->t_Count)
+                ? ((ITC_Event_Counter_t)~0)
+                : pt_Event->t_Count + t_ChildrenMax;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+        pt_Event->u64_Hash = ITC_Event_calcSubtreeHash(pt_Event);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+        pt_Child = pt_Event;
+        pt_Event = pt_Event->pt_Parent;
+    }
+#else
+    (void)pt_Event;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+}
+
+/******************************************************************************
+ * Same as ITC_Stamp_newSeed but allocates the ID and Event instead of sharing
+ ******************************************************************************/
+
+ITC_Status_t ITC_TestUtil_newSeedStamp(
+    ITC_Stamp_t **ppt_Stamp
+)
+{
+    ITC_Status_t t_Status;
+
+    t_Status = ITC_Stamp_newSeed(ppt_Stamp);
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        /* Destroying the shared components is a no-op */
+        t_Status = ITC_Id_destroy(&(*ppt_Stamp)->pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Id_newSeed(&(*ppt_Stamp)->pt_Id);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_destroy(&(*ppt_Stamp)->pt_Event);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        t_Status = ITC_Event_new(&(*ppt_Stamp)->pt_Event);
     }
 
     return t_Status;
@@ -0,0 +1,366 @@
+/**
+ * @file ITC_GrowPolicy_Benchmark.c
+ * @brief Compares the Event tree shape produced by the different grow policies
+ *
+ * Runs the same deterministic fork/event/join workload once per grow policy
+ * and reports the size and depth of the resulting Event trees, along with the
+ * depth at which each event was recorded.
+ *
+ * The peak tree depth is bounded by the deepest ID leaf any Stamp got from
+ * forking, which is the same under every policy. The policies only differ in
+ * which of a Stamp's own ID leaves they record the event at, so the recorded
+ * depth is what `ITC_EVENT_GROW_POLICY_MIN_DEPTH` improves on.
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_Event.h"
+#include "ITC_Stamp.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+/******************************************************************************
+ *  Private definitions
+ ******************************************************************************/
+
+/** The maximum number of concurrently alive Stamps */
+#define BENCHMARK_MAX_STAMPS                                               (16U)
+
+/** The number of operations performed by the workload */
+#define BENCHMARK_OPERATIONS                                            (20000U)
+
+/** The seed of the pseudo-random operation sequence */
+#define BENCHMARK_SEED                                              (12345678U)
+
+/** The shape of an Event tree */
+typedef struct
+{
+    /** The number of nodes in the tree */
+    uint32_t u32_Nodes;
+    /** The depth of the deepest leaf in the tree */
+    uint32_t u32_Depth;
+} BenchmarkShape_t;
+
+/** The depths at which events were recorded */
+typedef struct
+{
+    /** The number of recorded events */
+    uint32_t u32_Events;
+    /** The sum of the depths of all recorded events */
+    uint64_t u64_DepthSum;
+    /** The depth of the deepest recorded event */
+    uint32_t u32_MaxDepth;
+} BenchmarkGrowDepth_t;
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Get the next pseudo-random number of the workload
+ *
+ * @param pu32_State The generator state
+ * @return `uint32_t` The next pseudo-random number
+ */
+static uint32_t nextRandom(
+    uint32_t *const pu32_State
+)
+{
+    /* Numerical Recipes LCG. The upper bits have the longest period */
+    *pu32_State = (*pu32_State * 1664525U) + 1013904223U;
+
+    return *pu32_State >> 8U;
+}
+
+/**
+ * @brief Measure the shape of an Event tree
+ *
+ * @param pt_Event The root of the Event tree
+ * @param u32_Depth The depth of `pt_Event`
+ * @param pt_Shape The shape to update
+ */
+static void measureEvent(
+    const ITC_Event_t *const pt_Event,
+    const uint32_t u32_Depth,
+    BenchmarkShape_t *const pt_Shape
+)
+{
+    pt_Shape->u32_Nodes++;
+
+    if (u32_Depth > pt_Shape->u32_Depth)
+    {
+        pt_Shape->u32_Depth = u32_Depth;
+    }
+
+    if (pt_Event->pt_Left)
+    {
+        measureEvent(pt_Event->pt_Left, u32_Depth + 1, pt_Shape);
+        measureEvent(pt_Event->pt_Right, u32_Depth + 1, pt_Shape);
+    }
+}
+
+/**
+ * @brief Find the depth at which an event was recorded
+ *
+ * Compares the Event before and after growing it. The event was recorded
+ * either at the node whose counter changed, or at the bottom of the path
+ * expanded from a former leaf.
+ *
+ * @param pt_Before The Event before growing it
+ * @param pt_After The Event after growing it
+ * @param u32_Depth The depth of `pt_Before` and `pt_After`
+ * @return `uint32_t` The depth of the recorded event. `0` if not found
+ */
+static uint32_t findGrowDepth(
+    const ITC_Event_t *const pt_Before,
+    const ITC_Event_t *const pt_After,
+    const uint32_t u32_Depth
+)
+{
+    BenchmarkShape_t t_Shape;
+    uint32_t u32_GrowDepth = 0;
+
+    if (!pt_Before->pt_Left && pt_After->pt_Left)
+    {
+        /* The expanded path is the deepest part of the new subtree */
+        t_Shape.u32_Nodes = 0;
+        t_Shape.u32_Depth = 0;
+        measureEvent(pt_After, u32_Depth, &t_Shape);
+        u32_GrowDepth = t_Shape.u32_Depth;
+    }
+    else if (pt_Before->t_Count != pt_After->t_Count)
+    {
+        u32_GrowDepth = u32_Depth;
+    }
+    else if (pt_Before->pt_Left)
+    {
+        u32_GrowDepth = findGrowDepth(
+            pt_Before->pt_Left, pt_After->pt_Left, u32_Depth + 1);
+
+        if (!u32_GrowDepth)
+        {
+            u32_GrowDepth = findGrowDepth(
+                pt_Before->pt_Right, pt_After->pt_Right, u32_Depth + 1);
+        }
+    }
+
+    return u32_GrowDepth;
+}
+
+/**
+ * @brief Run the workload with the given grow policy
+ *
+ * Each operation picks a random alive Stamp and either adds an Event to it,
+ * forks it or joins it with another alive Stamp.
+ *
+ * @param t_GrowPolicy The grow policy
+ * @param pt_PeakShape The largest shape seen during the workload
+ * @param pt_FinalShape The shape after joining all Stamps back
+ * @param pt_GrowDepth The depths at which events were recorded
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+static ITC_Status_t runWorkload(
+    const ITC_Event_GrowPolicy_t t_GrowPolicy,
+    BenchmarkShape_t *const pt_PeakShape,
+    BenchmarkShape_t *const pt_FinalShape,
+    BenchmarkGrowDepth_t *const pt_GrowDepth
+)
+{
+    ITC_Status_t t_Status; /* The current status */
+    ITC_Stamp_t *rpt_Stamps[BENCHMARK_MAX_STAMPS] = { NULL };
+    uint32_t u32_StampsLength = 1;
+    uint32_t u32_State = BENCHMARK_SEED;
+    uint32_t u32_Operation = 0;
+    uint32_t u32_I;
+    uint32_t u32_J;
+    uint32_t u32_Choice;
+    uint32_t u32_Depth;
+    BenchmarkShape_t t_Shape;
+    ITC_Event_t *pt_Before = NULL;
+
+    pt_PeakShape->u32_Nodes = 0;
+    pt_PeakShape->u32_Depth = 0;
+    pt_GrowDepth->u32_Events = 0;
+    pt_GrowDepth->u64_DepthSum = 0;
+    pt_GrowDepth->u32_MaxDepth = 0;
+
+    t_Status = ITC_Stamp_newSeed(&rpt_Stamps[0]);
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_Operation < BENCHMARK_OPERATIONS)
+    {
+        u32_I = nextRandom(&u32_State) % u32_StampsLength;
+        u32_Choice = nextRandom(&u32_State) % 10U;
+
+        /* Mostly record events, with the occasional fork and join */
+        if (u32_Choice < 6U)
+        {
+            t_Status = ITC_Event_clone(rpt_Stamps[u32_I]->pt_Event, &pt_Before);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                t_Status = ITC_Stamp_eventWithGrowPolicy(
+                    rpt_Stamps[u32_I], t_GrowPolicy);
+            }
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                u32_Depth = findGrowDepth(
+                    pt_Before, rpt_Stamps[u32_I]->pt_Event, 0);
+
+                pt_GrowDepth->u32_Events++;
+                pt_GrowDepth->u64_DepthSum += u32_Depth;
+
+                if (u32_Depth > pt_GrowDepth->u32_MaxDepth)
+                {
+                    pt_GrowDepth->u32_MaxDepth = u32_Depth;
+                }
+            }
+
+            /* There is nothing else to do if the destroy fails */
+            (void)ITC_Event_destroy(&pt_Before);
+        }
+        else if (u32_Choice < 8U && u32_StampsLength < BENCHMARK_MAX_STAMPS)
+        {
+            t_Status = ITC_Stamp_fork(
+                &rpt_Stamps[u32_I], &rpt_Stamps[u32_StampsLength]);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                u32_StampsLength++;
+            }
+        }
+        else if (u32_StampsLength > 1U)
+        {
+            /* Pick a different Stamp to join with */
+            u32_J = (u32_I + 1U + (nextRandom(&u32_State) %
+                                   (u32_StampsLength - 1U))) %
+                    u32_StampsLength;
+
+            t_Status = ITC_Stamp_join(&rpt_Stamps[u32_I], &rpt_Stamps[u32_J]);
+
+            if (t_Status == ITC_STATUS_SUCCESS)
+            {
+                /* Fill the gap with the last Stamp */
+                u32_StampsLength--;
+                rpt_Stamps[u32_J] = rpt_Stamps[u32_StampsLength];
+                rpt_Stamps[u32_StampsLength] = NULL;
+            }
+        }
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            for (u32_I = 0; u32_I < u32_StampsLength; u32_I++)
+            {
+                t_Shape.u32_Nodes = 0;
+                t_Shape.u32_Depth = 0;
+                measureEvent(rpt_Stamps[u32_I]->pt_Event, 0, &t_Shape);
+
+                if (t_Shape.u32_Nodes > pt_PeakShape->u32_Nodes)
+                {
+                    pt_PeakShape->u32_Nodes = t_Shape.u32_Nodes;
+                }
+
+                if (t_Shape.u32_Depth > pt_PeakShape->u32_Depth)
+                {
+                    pt_PeakShape->u32_Depth = t_Shape.u32_Depth;
+                }
+            }
+        }
+
+        u32_Operation++;
+    }
+
+    /* Join everything back into the first Stamp */
+    while (t_Status == ITC_STATUS_SUCCESS && u32_StampsLength > 1U)
+    {
+        u32_StampsLength--;
+        t_Status = ITC_Stamp_join(
+            &rpt_Stamps[0], &rpt_Stamps[u32_StampsLength]);
+    }
+
+    if (t_Status == ITC_STATUS_SUCCESS)
+    {
+        pt_FinalShape->u32_Nodes = 0;
+        pt_FinalShape->u32_Depth = 0;
+        measureEvent(rpt_Stamps[0]->pt_Event, 0, pt_FinalShape);
+    }
+
+    for (u32_I = 0; u32_I < BENCHMARK_MAX_STAMPS; u32_I++)
+    {
+        /* There is nothing else to do if the destroy fails */
+        (void)ITC_Stamp_destroy(&rpt_Stamps[u32_I]);
+    }
+
+    return t_Status;
+}
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/* Benchmark entrypoint */
+int main(void)
+{
+    ITC_Status_t t_Status = ITC_STATUS_SUCCESS; /* The current status */
+    static const char *const rpc_PolicyNames[] = {
+        "MIN_SIZE",
+        "MIN_DEPTH",
+        "PREFER_EXISTING_LEAVES",
+    };
+    BenchmarkShape_t t_PeakShape;
+    BenchmarkShape_t t_FinalShape;
+    BenchmarkGrowDepth_t t_GrowDepth;
+    uint32_t u32_I = 0;
+
+    printf(
+        "%-24s %10s %10s %10s %10s %10s %10s\n",
+        "Policy",
+        "PeakNodes",
+        "PeakDepth",
+        "FinalNodes",
+        "FinalDepth",
+        "MeanGrow",
+        "MaxGrow");
+
+    while (t_Status == ITC_STATUS_SUCCESS &&
+           u32_I <= (uint32_t)ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES)
+    {
+        t_Status = runWorkload(
+            (ITC_Event_GrowPolicy_t)u32_I,
+            &t_PeakShape,
+            &t_FinalShape,
+            &t_GrowDepth);
+
+        if (t_Status == ITC_STATUS_SUCCESS)
+        {
+            printf(
+                "%-24s %10u %10u %10u %10u %10.2f %10u\n",
+                rpc_PolicyNames[u32_I],
+                (unsigned int)t_PeakShape.u32_Nodes,
+                (unsigned int)t_PeakShape.u32_Depth,
+                (unsigned int)t_FinalShape.u32_Nodes,
+                (unsigned int)t_FinalShape.u32_Depth,
+                (t_GrowDepth.u32_Events)
+                    ? ((double)t_GrowDepth.u64_DepthSum /
+                       (double)t_GrowDepth.u32_Events)
+                    : 0.0,
+                (unsigned int)t_GrowDepth.u32_MaxDepth);
+        }
+        else
+        {
+            printf(
+                "%s failed with status %u\n",
+                rpc_PolicyNames[u32_I],
+                (unsigned int)t_Status);
+        }
+
+        u32_I++;
+    }
+
+    return (t_Status == ITC_STATUS_SUCCESS) ? 0 : 1;
+}
@@ -11,6 +11,7 @@
 #define ITC_ID_TEST_PACKAGE_H_
 
 #include "unity.h"
+#include "ITC_Id_package.h"
 #include "ITC_Status.h"
 
 /******************************************************************************
@@ -19,27 +20,27 @@
 
 /** Checks whether the given `ITC_Id_t` is a leaf ID */
 #define ITC_ID_IS_LEAF_ID(pt_Id)                                              \
-    ((pt_Id) && !(pt_Id)->pt_Left && !(pt_Id)->pt_Right)
+    ((pt_Id) && !ITC_ID_GET_LEFT(pt_Id) && !ITC_ID_GET_RIGHT(pt_Id))
 
 /** Checks whether the given `ITC_Id_t` is a valid parent node
  * The ID must:
  *  - Have 2 child node addresses != NULL
  *  - Have 2 unique child node addresses
- *  - NOT own its interval (pt_Id->b_IsOwner == false)
+ *  - NOT own its interval
  */
 #define ITC_ID_IS_VALID_PARENT(pt_Id)                                         \
     ((pt_Id) &&                                                               \
-     ((pt_Id)->pt_Left && (pt_Id)->pt_Right) &&                               \
+     (ITC_ID_GET_LEFT(pt_Id) && ITC_ID_GET_RIGHT(pt_Id)) &&                   \
      ((pt_Id)->pt_Left != (pt_Id)->pt_Right) &&                               \
-     (!(pt_Id)->b_IsOwner))                                                   \
+     (!ITC_ID_IS_OWNER(pt_Id)))                                               \
 
 /** Checks whether the given `ITC_Id_t` is a NULL ID */
 #define ITC_ID_IS_NULL_ID(pt_Id)                                              \
-    (ITC_ID_IS_LEAF_ID(pt_Id) && !(pt_Id)->b_IsOwner)
+    (ITC_ID_IS_LEAF_ID(pt_Id) && !ITC_ID_IS_OWNER(pt_Id))
 
 /** Checks whether the given `ITC_Id_t` is a seed ID */
 #define ITC_ID_IS_SEED_ID(pt_Id)                                              \
-    (ITC_ID_IS_LEAF_ID(pt_Id) && (pt_Id)->b_IsOwner)
+    (ITC_ID_IS_LEAF_ID(pt_Id) && ITC_ID_IS_OWNER(pt_Id))
 
 /** Checks whether the given `ITC_Id_t` is a (0, 1) ID */
 #define ITC_ID_IS_NULL_SEED_ID(pt_Id)                                         \
@@ -11,6 +11,8 @@
 #ifndef ITC_SERDES_TEST_PACKAGE_H_
 #define ITC_SERDES_TEST_PACKAGE_H_
 
+#include "ITC_config.h"
+
 #include <stdint.h>
 
 /******************************************************************************
@@ -33,6 +35,11 @@
 /* The header of a serialised parent ITC ID */
 #define ITC_SERDES_PARENT_ID_HEADER                                      (0x01U)
 
+/* The header of a serialised ID path */
+#define ITC_SERDES_PATH_ID_HEADER                                        (0x03U)
+/* The header of a serialised Event path */
+#define ITC_SERDES_PATH_EVENT_HEADER                                     (0x20U)
+
 /* The minimum possible length of a serialisation/deserialsation ID buffer
  * (a leaf ID) - version number + 1 `ITC_SerDes_Header_t` */
 #define ITC_SERDES_ID_MIN_BUFFER_LEN                                           \
@@ -98,10 +105,60 @@
  * a 7-byte Event component len size */
 #define ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK                        (0x38U)
 
+/* The offset of the `IS_DELTA` flag in a serialised ITC Stamp header */
+#define ITC_SERDES_STAMP_IS_DELTA_OFFSET                                    (6U)
+/* The mask of the `IS_DELTA` flag in a serialised ITC Stamp header */
+#define ITC_SERDES_STAMP_IS_DELTA_MASK                                   (0x40U)
+
+/* The offset of the `HAS_EXTENSION` flag in a serialised ITC Stamp header.
+ * If set, the header is followed by a Stamp extension header */
+#define ITC_SERDES_STAMP_HAS_EXTENSION_OFFSET                               (7U)
+/* The mask of the `HAS_EXTENSION` flag in a serialised ITC Stamp header */
+#define ITC_SERDES_STAMP_HAS_EXTENSION_MASK                              (0x80U)
+
+/* The offset of the epoch length in a serialised ITC Stamp extension header */
+#define ITC_SERDES_STAMP_EXT_EPOCH_LEN_OFFSET                               (0U)
+/* The mask of the epoch len size in a serialised ITC Stamp extension header.
+ * This allows for a maximum of a 3-bit counter. A `0` length means the Stamp
+ * is in epoch `0` */
+#define ITC_SERDES_STAMP_EXT_EPOCH_LEN_MASK                              (0x07U)
+
+/* The offset of the `HAS_REBASE_BASE_ID` flag in a serialised ITC Stamp
+ * extension header. If set, the epoch is followed by the rebase base ID */
+#define ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_OFFSET                      (3U)
+/* The mask of the `HAS_REBASE_BASE_ID` flag in a serialised ITC Stamp
+ * extension header */
+#define ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK                     (0x08U)
+
+/* The size of the rebase base ID of a serialised ITC Stamp */
+#define ITC_SERDES_STAMP_REBASE_BASE_ID_LEN                   (sizeof(uint64_t))
+
+/* The offset of the `IS_PATH_COMPRESSED` flag in a serialised ITC Stamp
+ * extension header. If set, the ID or Event component contains at least one
+ * path */
+#define ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_OFFSET                      (4U)
+/* The mask of the `IS_PATH_COMPRESSED` flag in a serialised ITC Stamp
+ * extension header */
+#define ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK                     (0x10U)
+
 /* The mask of the whole Stamp header */
 #define ITC_SERDES_STAMP_HEADER_MASK                                           \
   (ITC_SERDES_STAMP_ID_COMPONENT_LEN_MASK |                                    \
-   ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK)
+   ITC_SERDES_STAMP_EVENT_COMPONENT_LEN_MASK |                                 \
+   ITC_SERDES_STAMP_IS_DELTA_MASK |                                            \
+   ITC_SERDES_STAMP_HAS_EXTENSION_MASK)
+
+/* The mask of the whole Stamp extension header */
+#define ITC_SERDES_STAMP_EXT_HEADER_MASK                                       \
+  ((ITC_CONFIG_ENABLE_STAMP_EPOCH                                              \
+        ? ITC_SERDES_STAMP_EXT_EPOCH_LEN_MASK                                  \
+        : 0U) |                                                                \
+   (ITC_CONFIG_ENABLE_STAMP_REBASE                                             \
+        ? ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK                         \
+        : 0U) |                                                                \
+   (ITC_CONFIG_USE_PATH_COMPRESSED_SERDES                                      \
+        ? ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK                         \
+        : 0U))
 
 /* The minimum possible length of a serialisation/deserialsation Stamp buffer
  * (a Stamp with a leaf ID and Event nodes). Requires:
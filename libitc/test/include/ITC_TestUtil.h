@@ -199,4 +199,28 @@ ITC_Status_t ITC_TestUtil_newEvent(
     ITC_Event_Counter_t t_Count
 );
 
+/**
+ * @brief Recalculate the memoised subtree maximums and hashes of an Event and
+ * all of its ancestors. Must be called after modifying an Event counter in
+ * place. Does nothing unless `ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX` or
+ * `ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH` is enabled
+ *
+ * @param pt_Event The pointer to the modified Event
+ */
+void ITC_TestUtil_updateEventSubtreeMax(
+    ITC_Event_t *pt_Event
+);
+
+/**
+ * @brief Same as ITC_Stamp_newSeed but the ID and Event are allocated
+ * instead of shared, so the Stamp components can be modified in place
+ *
+ * @param ppt_Stamp (out) The pointer to the seed Stamp
+ * @return `ITC_Status_t` The status of the operation
+ * @retval `ITC_STATUS_SUCCESS` on success
+ */
+ITC_Status_t ITC_TestUtil_newSeedStamp(
+    ITC_Stamp_t **ppt_Stamp
+);
+
 #endif /* ITC_TESTUTIL_H_ */
@@ -9,9 +9,11 @@
  */
 #include "ITC_Event.h"
 #include "ITC_Event_package.h"
+#include "ITC_Id_package.h"
 #include "ITC_Event_Test.h"
 
 #include "ITC_Test_package.h"
+#include "ITC_TestUtil.h"
 #include "MockITC_Port.h"
 
 /******************************************************************************
@@ -60,6 +62,9 @@ void setUp(void)
     gt_LeafNode.pt_Right = NULL;
 
     gpt_LeafEvent = &gt_LeafNode;
+
+    ITC_TestUtil_updateEventSubtreeMax(gpt_ParentEvent);
+    ITC_TestUtil_updateEventSubtreeMax(gpt_LeafEvent);
 }
 
 /* Fini test */
@@ -141,6 +146,7 @@ void ITC_Event_Test_normaliseEventIsRecoveredOnFailure(void)
     /* Test failing to normalise a (0, 1, 1) Event */
     gpt_ParentEvent->pt_Left->t_Count = 1;
     gpt_ParentEvent->pt_Right->t_Count = 1;
+    ITC_TestUtil_updateEventSubtreeMax(gpt_ParentEvent);
     TEST_FAILURE(ITC_Event_normalise(gpt_ParentEvent), ITC_STATUS_FAILURE);
 
     /* Test the Event was normalised properly, even though one of the children
@@ -294,6 +300,7 @@ void ITC_Event_Test_maximiseEventIsRecoveredOnFailure(void)
     /* Test failing to maximise a (0, 3, 0) Event */
     gpt_ParentEvent->pt_Left->t_Count = 3;
     gpt_ParentEvent->pt_Right->t_Count = 0;
+    ITC_TestUtil_updateEventSubtreeMax(gpt_ParentEvent);
     TEST_FAILURE(ITC_Event_maximise(gpt_ParentEvent), ITC_STATUS_FAILURE);
 
     /* Test the Event was maximised properly, even though one of the children
@@ -317,7 +324,7 @@ void ITC_Event_Test_fillEventIsRecoveredOnFailure(void)
     bool b_WasFilled;
 
     /* Assign interval ownership */
-    t_SeedId.b_IsOwner = true;
+    ITC_ID_SET_OWNER(&t_SeedId, true);
 
     /* Expect the source event to be cloned before the operation starts */
     for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_ClonedParentEvent); u32_I++)
@@ -341,6 +348,7 @@ void ITC_Event_Test_fillEventIsRecoveredOnFailure(void)
     /* Test failing to fill a (0, 3, 0) Event with a seed ID */
     gpt_ParentEvent->pt_Left->t_Count = 3;
     gpt_ParentEvent->pt_Right->t_Count = 0;
+    ITC_TestUtil_updateEventSubtreeMax(gpt_ParentEvent);
     TEST_FAILURE(
         ITC_Event_fill(&gpt_ParentEvent, &t_SeedId, &b_WasFilled),
         ITC_STATUS_FAILURE);
@@ -371,15 +379,15 @@ void ITC_Event_Test_growEventIsRecoveredOnFailure(void)
     ITC_Id_t t_NestedNullId = { 0 };
 
     /* Assign interval ownerships */
-    t_ParentId.b_IsOwner = false;
-    t_NestedSeedId.b_IsOwner = true;
-    t_NestedNullId.b_IsOwner = false;
+    ITC_ID_SET_OWNER(&t_ParentId, false);
+    ITC_ID_SET_OWNER(&t_NestedSeedId, true);
+    ITC_ID_SET_OWNER(&t_NestedNullId, false);
 
     /* Connect the parent ID tree */
     t_ParentId.pt_Left = &t_NestedSeedId;
     t_ParentId.pt_Right = &t_NestedNullId;
-    t_NestedSeedId.pt_Parent = &t_ParentId;
-    t_NestedNullId.pt_Parent = &t_ParentId;
+    ITC_ID_SET_PARENT(&t_NestedSeedId, &t_ParentId);
+    ITC_ID_SET_PARENT(&t_NestedNullId, &t_ParentId);
 
     /* Expect the source event to be cloned before the operation starts */
     for (uint32_t u32_I = 0; u32_I < ARRAY_COUNT(rt_ClonedParentEvent); u32_I++)
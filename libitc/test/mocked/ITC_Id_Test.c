@@ -35,27 +35,27 @@ ITC_Id_t *gpt_LeafId;
 void setUp(void)
 {
     /* Setup the parent ID tree as a (0, 1) ID */
-    gt_RootOfParentId.b_IsOwner = false;
-    gt_LeftLeafOfParentId.b_IsOwner = false;
-    gt_RightLeafOfParentId.b_IsOwner = true;
+    ITC_ID_SET_OWNER(&gt_RootOfParentId, false);
+    ITC_ID_SET_OWNER(&gt_LeftLeafOfParentId, false);
+    ITC_ID_SET_OWNER(&gt_RightLeafOfParentId, true);
 
-    gt_RootOfParentId.pt_Parent = NULL;
+    ITC_ID_SET_PARENT(&gt_RootOfParentId, NULL);
 
     gt_RootOfParentId.pt_Left = &gt_LeftLeafOfParentId;
-    gt_LeftLeafOfParentId.pt_Parent = &gt_RootOfParentId;
+    ITC_ID_SET_PARENT(&gt_LeftLeafOfParentId, &gt_RootOfParentId);
     gt_LeftLeafOfParentId.pt_Left = NULL;
     gt_LeftLeafOfParentId.pt_Right = NULL;
 
     gt_RootOfParentId.pt_Right = &gt_RightLeafOfParentId;
-    gt_RightLeafOfParentId.pt_Parent = &gt_RootOfParentId;
+    ITC_ID_SET_PARENT(&gt_RightLeafOfParentId, &gt_RootOfParentId);
     gt_RightLeafOfParentId.pt_Left = NULL;
     gt_RightLeafOfParentId.pt_Right = NULL;
 
     gpt_ParentId = &gt_RootOfParentId;
 
     /* Setup the leaf as a NULL ID */
-    gt_LeafNode.b_IsOwner = false;
-    gt_LeafNode.pt_Parent = NULL;
+    ITC_ID_SET_OWNER(&gt_LeafNode, false);
+    ITC_ID_SET_PARENT(&gt_LeafNode, NULL);
     gt_LeafNode.pt_Left = NULL;
     gt_LeafNode.pt_Right = NULL;
 
@@ -118,6 +118,12 @@ void ITC_Id_Test_clonedIdIsDestroyedOnFailure(void)
 {
     ITC_Id_t *pt_ClonedId;
 
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    /* Setup expectations.
+     * The leaf children are tagged leaf IDs, so only the root is allocated */
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_FAILURE);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
+#else
     ITC_Id_t t_NewId = {0};
     ITC_Id_t *pt_NewId = &t_NewId;
 
@@ -130,6 +136,7 @@ void ITC_Id_Test_clonedIdIsDestroyedOnFailure(void)
     ITC_Port_malloc_IgnoreArg_ppv_Ptr();
 
     ITC_Port_free_ExpectAndReturn(pt_NewId, ITC_STATUS_SUCCESS);
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
 
     /* Test cloning failure */
     TEST_FAILURE(ITC_Id_clone(gpt_ParentId, &pt_ClonedId), ITC_STATUS_FAILURE);
@@ -146,6 +153,9 @@ void ITC_Id_Test_splitIdsAreDestroyedOnFailure(void)
     ITC_Id_t t_NewId2 = {0};
     ITC_Id_t *pt_NewId2 = &t_NewId2;
 
+    ITC_Id_t t_NewId3 = {0};
+    ITC_Id_t *pt_NewId3 = &t_NewId3;
+
     /* Setup expectations */
     ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_SUCCESS);
     ITC_Port_malloc_IgnoreArg_ppv_Ptr();
@@ -156,8 +166,9 @@ void ITC_Id_Test_splitIdsAreDestroyedOnFailure(void)
 
     ITC_Port_free_ExpectAndReturn(pt_NewId1, ITC_STATUS_SUCCESS);
 
+#if !ITC_CONFIG_USE_SHARED_LEAF_NODES
     /* Test failing to split a null ID */
-    gpt_LeafId->b_IsOwner = false;
+    ITC_ID_SET_OWNER(gpt_LeafId, false);
     TEST_FAILURE(
         ITC_Id_split(
             &gpt_LeafId,
@@ -174,8 +185,9 @@ void ITC_Id_Test_splitIdsAreDestroyedOnFailure(void)
 
     ITC_Port_free_ExpectAndReturn(pt_NewId1, ITC_STATUS_SUCCESS);
 
+#endif /* !ITC_CONFIG_USE_SHARED_LEAF_NODES */
     /* Test failing to split a seed ID */
-    gpt_LeafId->b_IsOwner = true;
+    ITC_ID_SET_OWNER(gpt_LeafId, true);
     TEST_FAILURE(
         ITC_Id_split(
             &gpt_LeafId,
@@ -203,6 +215,40 @@ void ITC_Id_Test_splitIdsAreDestroyedOnFailure(void)
             &gpt_ParentId,
             &pt_OtherId),
         ITC_STATUS_FAILURE);
+
+    /* Setup expectations */
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_SUCCESS);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
+    ITC_Port_malloc_ReturnThruPtr_ppv_Ptr((void **)&pt_NewId1);
+
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_SUCCESS);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
+    ITC_Port_malloc_ReturnThruPtr_ppv_Ptr((void **)&pt_NewId2);
+
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_SUCCESS);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
+    ITC_Port_malloc_ReturnThruPtr_ppv_Ptr((void **)&pt_NewId3);
+
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_FAILURE);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
+
+    ITC_Port_free_ExpectAndReturn(pt_NewId3, ITC_STATUS_SUCCESS);
+    ITC_Port_free_ExpectAndReturn(pt_NewId1, ITC_STATUS_SUCCESS);
+    ITC_Port_free_ExpectAndReturn(pt_NewId2, ITC_STATUS_SUCCESS);
+
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    /* Test failing to split the seed half of a (0, 1) ID.
+     * The null halves are tagged leaf IDs and are not allocated */
+#else
+    /* Test failing to split the null half of a (0, 1) ID.
+     * Unlike root null IDs, null IDs with a parent are never shared and must
+     * be allocated */
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+    TEST_FAILURE(
+        ITC_Id_split(
+            &gpt_ParentId,
+            &pt_OtherId),
+        ITC_STATUS_FAILURE);
 }
 
 /* Test original ID is destroyed when split */
@@ -210,6 +256,22 @@ void ITC_Id_Test_splitIdOriginalIdIsDestroyedOnSuccess(void)
 {
     ITC_Id_t *pt_OtherId;
 
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    /* Setup expectations.
+     * Splitting a root null ID yields the shared null ID, so nothing is
+     * allocated */
+    ITC_Port_free_ExpectAndReturn(gpt_LeafId, ITC_STATUS_SUCCESS);
+
+    /* Test splitting the ID */
+    ITC_ID_SET_OWNER(gpt_LeafId, false);
+    TEST_SUCCESS(ITC_Id_split(&gpt_LeafId, &pt_OtherId));
+    TEST_ITC_ID_IS_NULL_ID(gpt_LeafId);
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId);
+
+    /* Test destroying the shared null IDs does not deallocate anything */
+    TEST_SUCCESS(ITC_Id_destroy(&gpt_LeafId));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+#else
     ITC_Id_t t_NewId1 = {0};
     ITC_Id_t *pt_NewId1 = &t_NewId1;
 
@@ -228,8 +290,9 @@ void ITC_Id_Test_splitIdOriginalIdIsDestroyedOnSuccess(void)
     ITC_Port_free_ExpectAndReturn(gpt_LeafId, ITC_STATUS_SUCCESS);
 
     /* Test splitting the ID */
-    gpt_LeafId->b_IsOwner = false;
+    ITC_ID_SET_OWNER(gpt_LeafId, false);
     TEST_SUCCESS(ITC_Id_split(&gpt_LeafId, &pt_OtherId));
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
 }
 
 /* Test failed normalisation of an ID is properly recovered from */
@@ -240,8 +303,8 @@ void ITC_Id_Test_normaliseIdIsRecoveredOnFailure(void)
     ITC_Port_free_ExpectAndReturn(gpt_ParentId->pt_Right, ITC_STATUS_FAILURE);
 
     /* Test failing to normalise a (1, 1) ID */
-    gpt_ParentId->pt_Left->b_IsOwner = true;
-    gpt_ParentId->pt_Right->b_IsOwner = true;
+    ITC_ID_SET_OWNER(gpt_ParentId->pt_Left, true);
+    ITC_ID_SET_OWNER(gpt_ParentId->pt_Right, true);
     TEST_FAILURE(ITC_Id_normalise(gpt_ParentId), ITC_STATUS_FAILURE);
 
     /* Test the ID was normalised properly, even though one of the children
@@ -252,10 +315,12 @@ void ITC_Id_Test_normaliseIdIsRecoveredOnFailure(void)
 /* Test failed summing of two IDs is properly cleaned up */
 void ITC_Id_Test_sumIdAreDestroyedOnFailure(void)
 {
+#if !ITC_CONFIG_USE_COMPACT_ID_NODES
     ITC_Id_t t_NewId1 = { 0 };
     ITC_Id_t *pt_NewId1 = &t_NewId1;
     ITC_Id_t t_NewId2 = { 0 };
     ITC_Id_t *pt_NewId2 = &t_NewId2;
+#endif /* !ITC_CONFIG_USE_COMPACT_ID_NODES */
 
     ITC_Id_t t_OtherId = gt_RootOfParentId;
     /* Mirror the global test ID */
@@ -267,9 +332,30 @@ void ITC_Id_Test_sumIdAreDestroyedOnFailure(void)
     /* Fix pointers */
     t_OtherId.pt_Left = &t_OtherIdLeftChild;
     t_OtherId.pt_Right = &t_OtherIdRightChild;
-    t_OtherIdLeftChild.pt_Parent = &t_OtherId;
-    t_OtherIdRightChild.pt_Parent = &t_OtherId;
+    ITC_ID_SET_PARENT(&t_OtherIdLeftChild, &t_OtherId);
+    ITC_ID_SET_PARENT(&t_OtherIdRightChild, &t_OtherId);
+
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    /* Setup expectations.
+     * The summed leaf children are tagged leaf IDs, so only the root is
+     * allocated */
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_FAILURE);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
+
+    /* Test summing the IDs */
+    TEST_FAILURE(ITC_Id_sum(&gpt_ParentId, &pt_OtherId), ITC_STATUS_FAILURE);
+
+    /* Setup expectations */
+    ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_FAILURE);
+    ITC_Port_malloc_IgnoreArg_ppv_Ptr();
 
+    /* Test summing the IDs the other way around */
+    TEST_FAILURE(
+        ITC_Id_sum(
+            &pt_OtherId,
+            &gpt_ParentId),
+        ITC_STATUS_FAILURE);
+#else
     /* Setup expectations */
     ITC_Port_malloc_ExpectAndReturn(NULL, sizeof(ITC_Id_t), ITC_STATUS_SUCCESS);
     ITC_Port_malloc_IgnoreArg_ppv_Ptr();
@@ -309,6 +395,7 @@ void ITC_Id_Test_sumIdAreDestroyedOnFailure(void)
             &pt_OtherId,
             &gpt_ParentId),
         ITC_STATUS_FAILURE);
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
 }
 
 /* Test original IDs are destroyed when summed */
@@ -329,7 +416,7 @@ void ITC_Id_Test_sumIdOriginalIdsAreDestroyedOnSuccess(void)
     ITC_Port_free_ExpectAndReturn(pt_OtherId, ITC_STATUS_SUCCESS);
 
     /* Test summing the IDs */
-    pt_OtherId->b_IsOwner = false;
-    gpt_LeafId->b_IsOwner = true;
+    ITC_ID_SET_OWNER(pt_OtherId, false);
+    ITC_ID_SET_OWNER(gpt_LeafId, true);
     TEST_SUCCESS(ITC_Id_sum(&gpt_LeafId, &pt_OtherId));
 }
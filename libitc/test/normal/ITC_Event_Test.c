@@ -87,6 +87,36 @@ static void checkEventConcurrent(
     TEST_ASSERT_FALSE(b_IsLeq21);
 }
 
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+
+/* Test the joined step function Event matches the one of the joined Event.
+ * Destroys both step function Events */
+static void checkEventStepsMatchEvent(
+    ITC_Event_Steps_t *pt_Steps,
+    const ITC_Event_t *const pt_Event
+)
+{
+    ITC_Event_Steps_t t_Expected;
+
+    TEST_SUCCESS(ITC_Event_toSteps(pt_Event, &t_Expected));
+    TEST_ASSERT_EQUAL(t_Expected.u32_Length, pt_Steps->u32_Length);
+
+    for (uint32_t u32_I = 0; u32_I < t_Expected.u32_Length; u32_I++)
+    {
+        TEST_ASSERT_EQUAL(
+            t_Expected.pt_Steps[u32_I].u64_Start,
+            pt_Steps->pt_Steps[u32_I].u64_Start);
+        TEST_ASSERT_EQUAL(
+            t_Expected.pt_Steps[u32_I].t_Count,
+            pt_Steps->pt_Steps[u32_I].t_Count);
+    }
+
+    TEST_SUCCESS(ITC_Event_destroySteps(&t_Expected));
+    TEST_SUCCESS(ITC_Event_destroySteps(pt_Steps));
+}
+
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+
 /******************************************************************************
  *  Public functions
  ******************************************************************************/
@@ -136,6 +166,36 @@ void ITC_Event_Test_createEventSuccessful(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
+/* Test creating the shared leaf Event succeeds */
+void ITC_Event_Test_createSharedEventSuccessful(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_ClonedEvent;
+
+    /* Create the shared Event */
+    TEST_SUCCESS(ITC_Event_newShared(&pt_Event));
+
+    /* Test this is a leaf node with 0 events */
+    TEST_ASSERT_FALSE(pt_Event->pt_Parent);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+
+    /* Test cloning the shared Event returns the same Event */
+    TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_ClonedEvent));
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    TEST_ASSERT_EQUAL_PTR(pt_Event, pt_ClonedEvent);
+#else
+    TEST_ASSERT_TRUE(pt_Event != pt_ClonedEvent);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_ClonedEvent));
+    TEST_ASSERT_NULL(pt_ClonedEvent);
+
+    /* Test the shared Event survived destroying its clone */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
 /* Test cloning an Event fails with invalid param */
 void ITC_Event_Test_cloneEventFailInvalidParam(void)
 {
@@ -323,6 +383,7 @@ void ITC_Event_Test_normaliseParentEventWithLeafChildrenSucceeds(void)
 
     /* Make the children event count equal */
     pt_Event->pt_Right->t_Count = pt_Event->pt_Left->t_Count;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event->pt_Right);
 
     /* Normalise the event */
     TEST_SUCCESS(ITC_Event_normalise(pt_Event));
@@ -487,6 +548,107 @@ void ITC_Event_Test_maximiseComplexEventSucceeds(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
+/* Test getting the metrics of an Event fails with invalid param */
+void ITC_Event_Test_getEventMetricsFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_Metrics_t t_Metrics;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_Event_getMetrics(NULL, &t_Metrics), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_getMetrics(pt_Event, NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test getting the metrics of an Event fails with corrupt Event */
+void ITC_Event_Test_getEventMetricsFailWithCorruptEvent(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_Metrics_t t_Metrics;
+
+    /* Test different invalid Events are handled properly */
+    for (uint32_t u32_I = 0;
+         u32_I < gu32_InvalidEventTablesSize;
+         u32_I++)
+    {
+        /* Construct an invalid Event */
+        gpv_InvalidEventConstructorTable[u32_I](&pt_Event);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Event_getMetrics(pt_Event, &t_Metrics),
+            ITC_STATUS_CORRUPT_EVENT);
+
+        /* Destroy the Event */
+        gpv_InvalidEventDestructorTable[u32_I](&pt_Event);
+    }
+}
+
+/* Test getting the metrics of an Event succeeds */
+void ITC_Event_Test_getEventMetricsSucceeds(void)
+{
+    ITC_Event_t *pt_Event = NULL;
+    ITC_Event_Metrics_t t_Metrics;
+
+    /* Test the metrics of a leaf Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 4));
+    TEST_SUCCESS(ITC_Event_getMetrics(pt_Event, &t_Metrics));
+    TEST_ASSERT_EQUAL(1, t_Metrics.u32_Nodes);
+    TEST_ASSERT_EQUAL(0, t_Metrics.u32_Depth);
+    TEST_ASSERT_EQUAL(4, t_Metrics.t_Max);
+    TEST_ASSERT_EQUAL(4, t_Metrics.t_Total);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* clang-format off */
+    /* Create a (0, (0, 6, 0), (5, (0, 2, 0), 3)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Left, pt_Event->pt_Left, 6));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Right, pt_Event->pt_Left, 0));
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 5));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Left, pt_Event->pt_Right->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Right, pt_Event->pt_Right->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 3));
+    /* clang-format on */
+
+    /* Test the metrics match the maximised Event */
+    TEST_SUCCESS(ITC_Event_getMetrics(pt_Event, &t_Metrics));
+    TEST_ASSERT_EQUAL(9, t_Metrics.u32_Nodes);
+    TEST_ASSERT_EQUAL(3, t_Metrics.u32_Depth);
+    TEST_ASSERT_EQUAL(8, t_Metrics.t_Max);
+    TEST_ASSERT_EQUAL(16, t_Metrics.t_Total);
+    TEST_SUCCESS(ITC_Event_maximise(pt_Event));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, t_Metrics.t_Max);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Create a (MAX - 1, (0, 0, 2), 1) Event */
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_Event, NULL, ((ITC_Event_Counter_t)~0) - 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Left->pt_Left, pt_Event->pt_Left, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Left->pt_Right, pt_Event->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 1));
+
+    /* Test the counter sums saturate instead of overflowing */
+    TEST_SUCCESS(ITC_Event_getMetrics(pt_Event, &t_Metrics));
+    TEST_ASSERT_EQUAL(5, t_Metrics.u32_Nodes);
+    TEST_ASSERT_EQUAL(2, t_Metrics.u32_Depth);
+    TEST_ASSERT_TRUE(t_Metrics.t_Max == (ITC_Event_Counter_t)~0);
+    TEST_ASSERT_TRUE(t_Metrics.t_Total == (ITC_Event_Counter_t)~0);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
 /* Test joining Events fails with invalid param */
 void ITC_Event_Test_joinEventFailInvalidParam(void)
 {
@@ -564,6 +726,7 @@ void ITC_Event_Test_joinEventFailWithEventCounterOverflow(void)
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 1));
     pt_OtherEvent->pt_Left->t_Count = 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_OtherEvent->pt_Left);
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 0));
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, ((ITC_Event_Counter_t)~0)));
     /* clang-format on */
@@ -1013,6 +1176,7 @@ void ITC_Event_Test_compareFailWithEventCounterOverflow(void)
     /* clang-format off */
     /* Modify the Event */
     pt_Event1->pt_Left->t_Count = 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event1->pt_Left);
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left->pt_Left, pt_Event1->pt_Left, 0));
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left->pt_Right, pt_Event1->pt_Left, ((ITC_Event_Counter_t)~0)));
     /* clang-format on */
@@ -1044,6 +1208,7 @@ void ITC_Event_Test_compareLeafEventsSucceeds(void)
 
     /* Make the events different */
     pt_Event1->t_Count += 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event1);
 
     /* Compare Events */
     checkEventGreaterThan(pt_Event1, pt_Event2);
@@ -1074,6 +1239,7 @@ void ITC_Event_Test_compareLeafAndParentEventsSucceeds(void)
 
     /* Make Event 2 bigger */
     pt_Event2->t_Count += 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event2);
 
     /* Compare Events */
     checkEventLessThan(pt_Event1, pt_Event2);
@@ -1111,6 +1277,7 @@ void ITC_Event_Test_compareTwoParentEventsSucceeds(void)
 
     /* Make the 2 Events concurrent */
     pt_Event2->pt_Right->t_Count -= 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event2->pt_Right);
 
     /* Compare Events */
     checkEventConcurrent(pt_Event1, pt_Event2);
@@ -1154,6 +1321,7 @@ void ITC_Event_Test_compareTwoParentEventsWith1LevelDifferenceSucceeds(void)
 
     /* Make the 2 Events concurrent */
     pt_Event2->pt_Right->t_Count -= 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event2->pt_Right);
 
     /* Compare Events */
     checkEventConcurrent(pt_Event1, pt_Event2);
@@ -1202,6 +1370,7 @@ void ITC_Event_Test_compareTwoParentEventsWith2LevelDifferenceSucceeds(void)
     /* Make the 2 Events concurrent */
     pt_Event1->pt_Right->t_Count = 0;
     pt_Event1->pt_Left->t_Count = 5;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event1);
 
     /* Compare Events */
     checkEventConcurrent(pt_Event1, pt_Event2);
@@ -1217,6 +1386,233 @@ void ITC_Event_Test_compareTwoParentEventsWith2LevelDifferenceSucceeds(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
 }
 
+/* Test comparing Events deeper than the fixed traversal stack succeeds */
+void ITC_Event_Test_compareDeepParentEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    ITC_Event_t *pt_Parent;
+
+    /* Create a (0, (0, (... (0, 0, 1) ...), 1), 1) Event. Each level leaves a
+     * pending right subtree check on the traversal stack */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 0));
+    pt_Parent = pt_Event1;
+    for (uint32_t u32_I = 0; u32_I < 64; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Parent->pt_Left, pt_Parent, 0));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(&pt_Parent->pt_Right, pt_Parent, 1));
+        pt_Parent = pt_Parent->pt_Left;
+    }
+    TEST_SUCCESS(ITC_Event_clone(pt_Event1, &pt_Event2));
+
+    /* Check events are equal to each other */
+    checkEventEqual(pt_Event1, pt_Event2);
+
+    /* Bump the deepest right leaf of the second Event */
+    pt_Parent = pt_Event2;
+    while (pt_Parent->pt_Left->pt_Left)
+    {
+        pt_Parent = pt_Parent->pt_Left;
+    }
+    pt_Parent->pt_Right->t_Count = 2;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Parent->pt_Right);
+
+    /* Compare Events */
+    checkEventLessThan(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventGreaterThan(pt_Event2, pt_Event1);
+
+    /* Make the 2 Events concurrent */
+    pt_Event1->pt_Right->t_Count = 2;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event1->pt_Right);
+
+    /* Compare Events */
+    checkEventConcurrent(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventConcurrent(pt_Event2, pt_Event1);
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+}
+
+/* Test the memoised Event subtree maximums are kept up to date */
+void ITC_Event_Test_eventSubtreeMaxIsMaintained(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+
+    /* Construct a (1, 2, 0) and a (0, 0, 4) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 4));
+
+    /* Test joining the Events produces a (3, 0, 1) Event with max of 4 */
+    TEST_SUCCESS(ITC_Event_join(&pt_Event, &pt_OtherEvent));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 3);
+    TEST_ASSERT_EQUAL(4, pt_Event->t_Max);
+    TEST_ASSERT_EQUAL(0, pt_Event->pt_Left->t_Max);
+    TEST_ASSERT_EQUAL(1, pt_Event->pt_Right->t_Max);
+
+    /* Test maximising the Event keeps the max */
+    TEST_SUCCESS(ITC_Event_maximise(pt_Event));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 4);
+    TEST_ASSERT_EQUAL(4, pt_Event->t_Max);
+
+    /* Test a stale max is treated as a corrupt Event */
+    pt_Event->t_Max = 3;
+    TEST_FAILURE(ITC_Event_validate(pt_Event), ITC_STATUS_CORRUPT_EVENT);
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event subtree maximums are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+}
+
+/* Test growing and filling an Event keeps the memoised subtree summaries up
+ * to date */
+void ITC_Event_Test_eventSubtreeSummariesAreUpdatedInPlace(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    ITC_Event_t *pt_Event;
+    ITC_Id_t *pt_GrowId;
+    ITC_Id_t *pt_FillId;
+    bool b_WasFilled;
+    uint32_t u32_I;
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    ITC_Event_t *pt_ExpectedEvent;
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+    /* clang-format off */
+    /* Create a (0, (1, 0)) and a (0, (0, 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_GrowId, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_GrowId->pt_Left, pt_GrowId));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_GrowId->pt_Right, pt_GrowId));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_GrowId->pt_Right->pt_Left, pt_GrowId->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_GrowId->pt_Right->pt_Right, pt_GrowId->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_FillId, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_FillId->pt_Left, pt_FillId));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_FillId->pt_Right, pt_FillId));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_FillId->pt_Right->pt_Left, pt_FillId->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_FillId->pt_Right->pt_Right, pt_FillId->pt_Right));
+
+    /* Create a (0, 9, (0, 6, 0)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 9));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 6));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 0));
+    /* clang-format on */
+
+    /* Grow the Event into (0, 9, (0, 10, 0)). The maximum of the root only
+     * changes on the last grow.
+     * Every grow is validated, which checks the summaries of all nodes */
+    for (u32_I = 0; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_GrowId));
+        TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    }
+
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 9);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Left, 10);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Right, 0);
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+    TEST_ASSERT_EQUAL(10, pt_Event->t_Max);
+    TEST_ASSERT_EQUAL(10, pt_Event->pt_Right->t_Max);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+
+    /* Fill the Event into (9, 0, 1) */
+    TEST_SUCCESS(ITC_Event_fill(&pt_Event, pt_FillId, &b_WasFilled));
+    TEST_ASSERT_TRUE(b_WasFilled);
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 9);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 1);
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX
+    TEST_ASSERT_EQUAL(10, pt_Event->t_Max);
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX */
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+
+    /* Test the hash matches the one of a (9, 0, 1) Event built from scratch */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_ExpectedEvent, NULL, 9));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_ExpectedEvent->pt_Left, pt_ExpectedEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_ExpectedEvent->pt_Right, pt_ExpectedEvent, 1));
+    TEST_ASSERT_EQUAL(pt_ExpectedEvent->u64_Hash, pt_Event->u64_Hash);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_ExpectedEvent));
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_GrowId));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_FillId));
+#else
+    TEST_IGNORE_MESSAGE("Event subtree summaries are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_MAX || ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+}
+
+/* Test comparing Events whose subtrees are dominated by the other Event
+ * root counter succeeds */
+void ITC_Event_Test_compareDominatedParentEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+
+    /* Create a (0, (1, 2, (0, 3, 0)), 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left, pt_Event1, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right, pt_Event1, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event1->pt_Left->pt_Left, pt_Event1->pt_Left, 2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event1->pt_Left->pt_Right, pt_Event1->pt_Left, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event1->pt_Left->pt_Right->pt_Left,
+            pt_Event1->pt_Left->pt_Right,
+            3));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event1->pt_Left->pt_Right->pt_Right,
+            pt_Event1->pt_Left->pt_Right,
+            0));
+
+    /* Create a (4, 0, 1) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2, NULL, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Left, pt_Event2, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event2->pt_Right, pt_Event2, 1));
+
+    /* Compare Events */
+    checkEventLessThan(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventGreaterThan(pt_Event2, pt_Event1);
+
+    /* Make the 2 Events concurrent */
+    pt_Event1->pt_Left->pt_Right->pt_Left->t_Count = 4;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event1->pt_Left->pt_Right->pt_Left);
+
+    /* Compare Events */
+    checkEventConcurrent(pt_Event1, pt_Event2);
+    /* Compare the other way around */
+    checkEventConcurrent(pt_Event2, pt_Event1);
+
+    /* Destroy the Events */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+}
+
 /* Test filling an Event fails with invalid param */
 void ITC_Event_Test_fillEventFailInvalidParam(void)
 {
@@ -1326,6 +1722,7 @@ void ITC_Event_Test_fillEventFailWithEventCounterOverflow(void)
     /* clang-format off */
     /* Modify the Event */
     pt_Event->pt_Left->t_Count = ((ITC_Event_Counter_t)~0) - 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event->pt_Left);
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Left, pt_Event->pt_Left, 1));
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Right, pt_Event->pt_Left, 0));
     /* clang-format on */
@@ -1388,7 +1785,9 @@ void ITC_Event_Test_fillLeafEventWithNullAndSeedIdsSucceeds(void)
 
     /* Make the Event count different */
     pt_Event->t_Count += 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event);
     pt_OriginalEvent->t_Count += 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_OriginalEvent);
 
     /* Fill Event with null ID */
     TEST_SUCCESS(ITC_Event_fill(&pt_Event, pt_NullId, &b_WasFilled));
@@ -1450,7 +1849,9 @@ void ITC_Event_Test_fillLeafEventWith1001IdSucceeds(void)
 
     /* Make the event count different */
     pt_Event->t_Count += 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event);
     pt_OriginalEvent->t_Count += 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_OriginalEvent);
 
     /* Fill Event with null ID */
     TEST_SUCCESS(ITC_Event_fill(&pt_Event, pt_Id, &b_WasFilled));
@@ -2557,7 +2958,8 @@ void ITC_Event_Test_growLeafEventWith110And101IdsSucceeds(void)
     TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OriginalEvent));
 
     /* Grow the Event */
-    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_MIN_SIZE));
 
     /* Test the Event has changed */
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
@@ -2579,7 +2981,8 @@ void ITC_Event_Test_growLeafEventWith110And101IdsSucceeds(void)
     TEST_SUCCESS(ITC_Event_clone(pt_OriginalEvent, &pt_Event));
 
     /* Grow the Event */
-    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_MIN_SIZE));
 
     /* Test the Event has changed */
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
@@ -2622,7 +3025,8 @@ void ITC_Event_Test_growLeafEventWith1110And1101IdsSucceeds(void)
     TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OriginalEvent));
 
     /* Grow the Event */
-    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_MIN_SIZE));
 
     /* Test the Event has changed */
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
@@ -2646,7 +3050,8 @@ void ITC_Event_Test_growLeafEventWith1110And1101IdsSucceeds(void)
     TEST_SUCCESS(ITC_Event_clone(pt_OriginalEvent, &pt_Event));
 
     /* Grow the Event */
-    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_MIN_SIZE));
 
     /* Test the Event has changed */
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
@@ -2700,7 +3105,8 @@ void ITC_Event_Test_grow1102010EventWith10010IdSucceeds(void)
     TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OriginalEvent));
 
     /* Grow the Event */
-    TEST_SUCCESS(ITC_Event_grow(&pt_Event, pt_Id));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_MIN_SIZE));
 
     /* Test the Event has changed */
     TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
@@ -2719,3 +3125,1429 @@ void ITC_Event_Test_grow1102010EventWith10010IdSucceeds(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
     TEST_SUCCESS(ITC_Event_destroy(&pt_OriginalEvent));
 }
+
+/* Test growing an Event with a grow policy fails with invalid param */
+void ITC_Event_Test_growEventWithPolicyFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Id_t *pt_Id;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+
+    TEST_FAILURE(
+        ITC_Event_growWithPolicy(
+            NULL, pt_Id, ITC_EVENT_GROW_POLICY_MIN_DEPTH),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_growWithPolicy(
+            &pt_Event,
+            pt_Id,
+            (ITC_Event_GrowPolicy_t)(
+                ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES + 1)),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+}
+
+/* Test growing an Event with each grow policy succeeds */
+void ITC_Event_Test_growEventWithPolicySucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OriginalEvent;
+    ITC_Id_t *pt_Id;
+
+    /* clang-format off */
+    /* Create a ((0, (0, 1)), (1, 0)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right->pt_Left, pt_Id->pt_Left->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Right->pt_Right, pt_Id->pt_Left->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+
+    /* Create a (0, (0, 0, (0, 0, 1)), 0) Event. The ID owns an existing leaf
+     * 3 levels deep, or the right half of the 1 level deep leaf */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent->pt_Left, pt_OriginalEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent->pt_Left->pt_Left, pt_OriginalEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent->pt_Left->pt_Right, pt_OriginalEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent->pt_Left->pt_Right->pt_Left, pt_OriginalEvent->pt_Left->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent->pt_Left->pt_Right->pt_Right, pt_OriginalEvent->pt_Left->pt_Right, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OriginalEvent->pt_Right, pt_OriginalEvent, 0));
+    /* clang-format on */
+
+    /* Test minimising the depth expands the shallow leaf:
+     * (0, (0, 0, (0, 0, 1)), (0, 1, 0)) */
+    TEST_SUCCESS(ITC_Event_clone(pt_OriginalEvent, &pt_Event));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_MIN_DEPTH));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Right->pt_Right, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Right, 0);
+    checkEventLessThan(pt_OriginalEvent, pt_Event);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test preferring existing leaves increments the deep leaf:
+     * (0, (0, 0, (0, 0, 2)), 0) */
+    TEST_SUCCESS(ITC_Event_clone(pt_OriginalEvent, &pt_Event));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event, pt_Id, ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Right->pt_Right, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    checkEventLessThan(pt_OriginalEvent, pt_Event);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test the configured policy matches `ITC_Event_grow` */
+    TEST_SUCCESS(ITC_Event_clone(pt_OriginalEvent, &pt_Event));
+    TEST_SUCCESS(ITC_Event_growWithPolicy(
+        &pt_Event,
+        pt_Id,
+        (ITC_Event_GrowPolicy_t)ITC_CONFIG_EVENT_GROW_POLICY));
+    TEST_SUCCESS(ITC_Event_grow(&pt_OriginalEvent, pt_Id));
+    checkEventEqual(pt_OriginalEvent, pt_Event);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OriginalEvent));
+}
+
+/* Test converting an Event to a dense array and back succeeds */
+void ITC_Event_Test_convertEventToAndFromArraySucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_Array_t t_Array;
+    uint32_t u32_Quarter = ITC_EVENT_ARRAY_LEN / 4;
+
+    /* Test invalid params */
+    TEST_FAILURE(ITC_Event_toArray(NULL, &t_Array), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_newFromArray(&t_Array, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_newFromArray(NULL, &pt_Event), ITC_STATUS_INVALID_PARAM);
+
+    /* Create a (1, 2, (0, 3, 0)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 3));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 0));
+
+    /* Convert the Event */
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_Array));
+
+    /* Test the array holds the total count of each subinterval */
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        TEST_ASSERT_EQUAL(
+            (u32_I < 2 * u32_Quarter) ? 3 : (u32_I < 3 * u32_Quarter) ? 4 : 1,
+            t_Array.rt_Counters[u32_I]);
+    }
+
+    /* Convert it back and test it matches the original Event */
+    TEST_SUCCESS(ITC_Event_newFromArray(&t_Array, &pt_OtherEvent));
+    TEST_SUCCESS(ITC_Event_validate(pt_OtherEvent));
+    checkEventEqual(pt_Event, pt_OtherEvent);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Left, 2);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent->pt_Right, 0);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+#else
+    TEST_IGNORE_MESSAGE("Event arrays are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+}
+
+/* Test converting an Event deeper than the array depth fails */
+void ITC_Event_Test_convertTooDeepEventToArrayFails(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_CurrentEvent;
+    ITC_Event_Array_t t_Array;
+
+    /* Create a (0, 1, (0, 1, (..., (0, 1, 0)))) Event, which is one level
+     * deeper than the array */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    pt_CurrentEvent = pt_Event;
+
+    for (uint32_t u32_I = 0; u32_I <= ITC_CONFIG_EVENT_ARRAY_DEPTH; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_CurrentEvent->pt_Left, pt_CurrentEvent, 1));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_CurrentEvent->pt_Right, pt_CurrentEvent, 0));
+        pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+    }
+
+    TEST_FAILURE(
+        ITC_Event_toArray(pt_Event, &t_Array),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test removing the deepest level makes it fit */
+    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+    TEST_SUCCESS(ITC_Event_destroy(&pt_CurrentEvent->pt_Left));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_CurrentEvent->pt_Right));
+    ITC_TestUtil_updateEventSubtreeMax(pt_CurrentEvent);
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_Array));
+    TEST_ASSERT_EQUAL(0, t_Array.rt_Counters[ITC_EVENT_ARRAY_LEN - 1]);
+    TEST_ASSERT_EQUAL(1, t_Array.rt_Counters[0]);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event arrays are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+}
+
+/* Test joining and comparing Event arrays matches joining and comparing
+ * Events */
+void ITC_Event_Test_joinAndCompareEventArraysMatchesEvents(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_Array_t t_Array = { 0 };
+    ITC_Event_Array_t t_OtherArray;
+    ITC_Event_Array_t t_ExpectedArray;
+    bool b_IsLeq;
+
+    /* Test invalid params */
+    TEST_FAILURE(
+        ITC_Event_joinArray(NULL, &t_Array), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqArray(&t_Array, &t_Array, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Create a (1, 2, 0) and a (0, 0, 4) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 4));
+
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_Array));
+    TEST_SUCCESS(ITC_Event_toArray(pt_OtherEvent, &t_OtherArray));
+
+    /* Test the arrays are concurrent */
+    TEST_SUCCESS(ITC_Event_leqArray(&t_Array, &t_OtherArray, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_leqArray(&t_OtherArray, &t_Array, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+
+    /* Join both representations and test the results match */
+    TEST_SUCCESS(ITC_Event_joinArray(&t_Array, &t_OtherArray));
+    TEST_SUCCESS(ITC_Event_join(&pt_Event, &pt_OtherEvent));
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_ExpectedArray));
+    TEST_ASSERT_EQUAL_MEMORY(&t_ExpectedArray, &t_Array, sizeof(t_Array));
+
+    /* Test both source arrays are `<=` the joined one */
+    TEST_SUCCESS(ITC_Event_leqArray(&t_OtherArray, &t_Array, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_leqArray(&t_Array, &t_OtherArray, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event arrays are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+}
+
+/* Test joining and meeting dense Events, which switch to the array form,
+ * succeeds */
+void ITC_Event_Test_joinAndMeetDenseEventsSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_ARRAY
+    ITC_Event_t *pt_DenseEvent;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_t *pt_DeepEvent;
+    ITC_Event_t *pt_CurrentEvent;
+    ITC_Event_t *pt_Event;
+    ITC_Event_Array_t t_Array;
+    ITC_Event_Array_t t_OtherArray;
+    bool b_IsLeq;
+
+    /* Create a full depth Event, with a leaf for each subinterval */
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        t_Array.rt_Counters[u32_I] = (u32_I & 1U) ? 2 : 1;
+        t_OtherArray.rt_Counters[u32_I] =
+            (u32_I < ITC_EVENT_ARRAY_LEN / 2) ? 3 : 0;
+    }
+
+    TEST_SUCCESS(ITC_Event_newFromArray(&t_Array, &pt_DenseEvent));
+
+    /* Create a sparse (0, 3, 0) Event */
+    TEST_SUCCESS(ITC_Event_newFromArray(&t_OtherArray, &pt_OtherEvent));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Right, 0);
+
+    /* Test the join is the element-wise maximum */
+    TEST_SUCCESS(ITC_Event_joinConst(pt_DenseEvent, pt_OtherEvent, &pt_Event));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_Array));
+
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        TEST_ASSERT_EQUAL(
+            (u32_I < ITC_EVENT_ARRAY_LEN / 2) ? 3 : (u32_I & 1U) ? 2 : 1,
+            t_Array.rt_Counters[u32_I]);
+    }
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test the meet is the element-wise minimum */
+    TEST_SUCCESS(ITC_Event_meet(pt_DenseEvent, pt_OtherEvent, &pt_Event));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_Array));
+
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        TEST_ASSERT_EQUAL(
+            (u32_I < ITC_EVENT_ARRAY_LEN / 2) ? ((u32_I & 1U) ? 2 : 1) : 0,
+            t_Array.rt_Counters[u32_I]);
+    }
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Create a (0, 1, (0, 1, (..., (0, 1, 0)))) Event, which is one level
+     * deeper than the array */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_DeepEvent, NULL, 0));
+    pt_CurrentEvent = pt_DeepEvent;
+
+    for (uint32_t u32_I = 0; u32_I <= ITC_CONFIG_EVENT_ARRAY_DEPTH; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_CurrentEvent->pt_Left, pt_CurrentEvent, 1));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_CurrentEvent->pt_Right, pt_CurrentEvent, 0));
+        pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+    }
+
+    /* Test joining a dense Event with one that does not fit into an array
+     * falls back to the trees. The dense Event dominates the deep one, so the
+     * join normalises back to it */
+    TEST_SUCCESS(ITC_Event_joinConst(pt_DenseEvent, pt_DeepEvent, &pt_Event));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_SUCCESS(ITC_Event_leq(pt_DeepEvent, pt_Event, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_toArray(pt_Event, &t_Array));
+
+    for (uint32_t u32_I = 0; u32_I < ITC_EVENT_ARRAY_LEN; u32_I++)
+    {
+        TEST_ASSERT_EQUAL((u32_I & 1U) ? 2 : 1, t_Array.rt_Counters[u32_I]);
+    }
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_DeepEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_DenseEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+#else
+    TEST_IGNORE_MESSAGE("Event arrays are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_ARRAY */
+}
+
+/* Test converting an Event to a step function and back succeeds */
+void ITC_Event_Test_convertEventToAndFromStepsSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_Steps_t t_Steps;
+    uint64_t u64_Quarter = UINT64_C(1) << 61;
+
+    /* Test invalid params */
+    TEST_FAILURE(ITC_Event_toSteps(NULL, &t_Steps), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_newFromSteps(NULL, &pt_Event), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Event_destroySteps(NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* Create a (1, 2, (0, 3, 0)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 3));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 0));
+
+    /* Convert the Event and test the steps are (0: 3, 1/2: 4, 3/4: 1) */
+    TEST_SUCCESS(ITC_Event_toSteps(pt_Event, &t_Steps));
+    TEST_ASSERT_EQUAL(3, t_Steps.u32_Length);
+    TEST_ASSERT_EQUAL(0, t_Steps.pt_Steps[0].u64_Start);
+    TEST_ASSERT_EQUAL(3, t_Steps.pt_Steps[0].t_Count);
+    TEST_ASSERT_EQUAL(2 * u64_Quarter, t_Steps.pt_Steps[1].u64_Start);
+    TEST_ASSERT_EQUAL(4, t_Steps.pt_Steps[1].t_Count);
+    TEST_ASSERT_EQUAL(3 * u64_Quarter, t_Steps.pt_Steps[2].u64_Start);
+    TEST_ASSERT_EQUAL(1, t_Steps.pt_Steps[2].t_Count);
+
+    /* Convert it back and test it matches the original Event */
+    TEST_SUCCESS(ITC_Event_newFromSteps(&t_Steps, &pt_OtherEvent));
+    TEST_SUCCESS(ITC_Event_validate(pt_OtherEvent));
+    checkEventEqual(pt_Event, pt_OtherEvent);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Left, 2);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent->pt_Right, 0);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+
+    /* Test unsorted, uncoalesced or incomplete steps are rejected */
+    t_Steps.pt_Steps[2].u64_Start = u64_Quarter;
+    TEST_FAILURE(
+        ITC_Event_newFromSteps(&t_Steps, &pt_OtherEvent),
+        ITC_STATUS_CORRUPT_EVENT);
+    t_Steps.pt_Steps[2].u64_Start = 3 * u64_Quarter;
+    t_Steps.pt_Steps[2].t_Count = 4;
+    TEST_FAILURE(
+        ITC_Event_newFromSteps(&t_Steps, &pt_OtherEvent),
+        ITC_STATUS_CORRUPT_EVENT);
+    t_Steps.pt_Steps[2].t_Count = 1;
+    t_Steps.pt_Steps[0].u64_Start = 1;
+    TEST_FAILURE(
+        ITC_Event_newFromSteps(&t_Steps, &pt_OtherEvent),
+        ITC_STATUS_CORRUPT_EVENT);
+
+    TEST_SUCCESS(ITC_Event_destroySteps(&t_Steps));
+    TEST_ASSERT_NULL(t_Steps.pt_Steps);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test a leaf Event is a single step */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 5));
+    TEST_SUCCESS(ITC_Event_toSteps(pt_Event, &t_Steps));
+    TEST_ASSERT_EQUAL(1, t_Steps.u32_Length);
+    TEST_ASSERT_EQUAL(5, t_Steps.pt_Steps[0].t_Count);
+    TEST_SUCCESS(ITC_Event_newFromSteps(&t_Steps, &pt_OtherEvent));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent, 5);
+    TEST_SUCCESS(ITC_Event_destroySteps(&t_Steps));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+#else
+    TEST_IGNORE_MESSAGE("Event step functions are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+}
+
+/* Test converting an Event deeper than the step function depth limit fails */
+void ITC_Event_Test_convertTooDeepEventToStepsFails(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_CurrentEvent;
+    ITC_Event_Steps_t t_Steps;
+
+    /* Create a (0, 1, (0, 1, (..., (0, 1, 0)))) Event, which is 64 levels
+     * deep */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    pt_CurrentEvent = pt_Event;
+
+    for (uint32_t u32_I = 0; u32_I < 64; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_CurrentEvent->pt_Left, pt_CurrentEvent, 1));
+        TEST_SUCCESS(
+            ITC_TestUtil_newEvent(
+                &pt_CurrentEvent->pt_Right, pt_CurrentEvent, 0));
+        pt_CurrentEvent = pt_CurrentEvent->pt_Right;
+    }
+
+    TEST_FAILURE(
+        ITC_Event_toSteps(pt_Event, &t_Steps),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test removing the deepest level makes it fit */
+    pt_CurrentEvent = pt_CurrentEvent->pt_Parent;
+    TEST_SUCCESS(ITC_Event_destroy(&pt_CurrentEvent->pt_Left));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_CurrentEvent->pt_Right));
+    ITC_TestUtil_updateEventSubtreeMax(pt_CurrentEvent);
+    TEST_SUCCESS(ITC_Event_toSteps(pt_Event, &t_Steps));
+    TEST_ASSERT_EQUAL(2, t_Steps.u32_Length);
+    TEST_ASSERT_EQUAL(UINT64_MAX >> 1, t_Steps.pt_Steps[1].u64_Start);
+    TEST_ASSERT_EQUAL(0, t_Steps.pt_Steps[1].t_Count);
+
+    TEST_SUCCESS(ITC_Event_destroySteps(&t_Steps));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event step functions are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+}
+
+/* Test joining and comparing step function Events matches joining and
+ * comparing Events */
+void ITC_Event_Test_joinAndCompareEventStepsMatchesEvents(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_STEPS
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_Steps_t t_Steps1;
+    ITC_Event_Steps_t t_Steps2;
+    ITC_Event_Steps_t t_Steps;
+    bool b_IsLeq;
+
+    /* Create a (1, 2, (0, 3, 0)) and a (0, (0, 0, 4), 5) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 3));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 5));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 4));
+
+    TEST_SUCCESS(ITC_Event_toSteps(pt_Event, &t_Steps1));
+    TEST_SUCCESS(ITC_Event_toSteps(pt_OtherEvent, &t_Steps2));
+
+    /* Test invalid params */
+    TEST_FAILURE(
+        ITC_Event_joinSteps(&t_Steps1, &t_Steps2, &t_Steps1),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_leqSteps(&t_Steps1, &t_Steps2, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test the step functions are concurrent */
+    TEST_SUCCESS(ITC_Event_leqSteps(&t_Steps1, &t_Steps2, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_leqSteps(&t_Steps2, &t_Steps1, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+
+    /* Join both representations and test the results match */
+    TEST_SUCCESS(ITC_Event_joinSteps(&t_Steps1, &t_Steps2, &t_Steps));
+    TEST_SUCCESS(ITC_Event_join(&pt_Event, &pt_OtherEvent));
+
+    /* Test both source step functions are `<=` the joined one */
+    TEST_SUCCESS(ITC_Event_leqSteps(&t_Steps1, &t_Steps, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_leqSteps(&t_Steps2, &t_Steps, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_leqSteps(&t_Steps, &t_Steps1, &b_IsLeq));
+    TEST_ASSERT_FALSE(b_IsLeq);
+
+    checkEventStepsMatchEvent(&t_Steps, pt_Event);
+
+    TEST_SUCCESS(ITC_Event_destroySteps(&t_Steps1));
+    TEST_SUCCESS(ITC_Event_destroySteps(&t_Steps2));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event step functions are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_STEPS */
+}
+
+/* Test hashing Events succeeds */
+void ITC_Event_Test_hashEventSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    uint64_t u64_Hash;
+    uint64_t u64_OtherHash;
+
+    /* Create a (1, 2, 0) Event and a (1, 0, 2) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 1));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 2));
+
+    /* Test invalid params */
+    TEST_FAILURE(ITC_Event_hash(pt_Event, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Event_hash(NULL, &u64_Hash), ITC_STATUS_INVALID_PARAM);
+
+    /* Test mirrored Events have different hashes */
+    TEST_SUCCESS(ITC_Event_hash(pt_Event, &u64_Hash));
+    TEST_SUCCESS(ITC_Event_hash(pt_OtherEvent, &u64_OtherHash));
+    TEST_ASSERT_NOT_EQUAL(u64_Hash, u64_OtherHash);
+
+    /* Test the hash does not change for the same Event */
+    TEST_SUCCESS(ITC_Event_hash(pt_Event, &u64_OtherHash));
+    TEST_ASSERT_EQUAL(u64_Hash, u64_OtherHash);
+
+    /* Test an equal Event built differently has the same hash.
+     * join((1, 1, 0), (1, 2, 0)) = (1, 2, 0) */
+    pt_OtherEvent->pt_Left->t_Count = 1;
+    pt_OtherEvent->pt_Right->t_Count = 0;
+    ITC_TestUtil_updateEventSubtreeMax(pt_OtherEvent);
+    TEST_SUCCESS(ITC_Event_join(&pt_OtherEvent, &pt_Event));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_Event_hash(pt_OtherEvent, &u64_OtherHash));
+    TEST_SUCCESS(ITC_Event_hash(pt_Event, &u64_Hash));
+    TEST_ASSERT_EQUAL(u64_Hash, u64_OtherHash);
+
+    /* Test a leaf with the same counter as a parent has a different hash */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event->pt_Left));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event->pt_Right));
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event);
+    TEST_SUCCESS(ITC_Event_hash(pt_Event, &u64_Hash));
+    TEST_ASSERT_NOT_EQUAL(u64_Hash, u64_OtherHash);
+
+    /* Test unnormalised Events cannot be hashed */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 1));
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event);
+    TEST_FAILURE(
+        ITC_Event_hash(pt_Event, &u64_Hash), ITC_STATUS_CORRUPT_EVENT);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+#else
+    TEST_IGNORE_MESSAGE("Event hashes are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+}
+
+/* Test the memoised subtree hashes are validated */
+void ITC_Event_Test_validateEventSubtreeHashes(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_SharedEvent;
+
+    /* Test the shared Event has the same hash as a new leaf Event */
+    TEST_SUCCESS(ITC_Event_new(&pt_Event));
+    TEST_SUCCESS(ITC_Event_newShared(&pt_SharedEvent));
+    TEST_ASSERT_EQUAL(pt_Event->u64_Hash, pt_SharedEvent->u64_Hash);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_SharedEvent));
+
+    /* Create a (0, 1, 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* Test a stale hash is detected */
+    pt_Event->pt_Left->t_Count = 2;
+    TEST_FAILURE(ITC_Event_validate(pt_Event), ITC_STATUS_CORRUPT_EVENT);
+
+    /* Test a refreshed hash is accepted */
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event->pt_Left);
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Event subtree hashes are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+}
+
+/* Test finding the differing subtrees of two Events succeeds */
+void ITC_Event_Test_diffEventSubtreesSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    ITC_Event_SubtreeHash_t rt_Diffs[2];
+    uint32_t u32_DiffsLength;
+
+    /* Create a (0, (0, 1, (0, 2, 0)), 3) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left, pt_Event1, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right, pt_Event1, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Left, pt_Event1->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Right, pt_Event1->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Right->pt_Left,
+        pt_Event1->pt_Left->pt_Right,
+        2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Right->pt_Right,
+        pt_Event1->pt_Left->pt_Right,
+        0));
+
+    /* Create a (0, (0, 1, (0, 0, 2)), 3) Event */
+    TEST_SUCCESS(ITC_Event_clone(pt_Event1, &pt_Event2));
+    pt_Event2->pt_Left->pt_Right->pt_Left->t_Count = 0;
+    pt_Event2->pt_Left->pt_Right->pt_Right->t_Count = 2;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event2->pt_Left->pt_Right);
+
+    /* Test invalid params */
+    u32_DiffsLength = 2;
+    TEST_FAILURE(
+        ITC_Event_diffSubtrees(pt_Event1, pt_Event2, NULL, &u32_DiffsLength),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_diffSubtrees(pt_Event1, pt_Event2, &rt_Diffs[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_diffSubtrees(
+            NULL, pt_Event2, &rt_Diffs[0], &u32_DiffsLength),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test equal Events have no differing subtrees */
+    TEST_SUCCESS(ITC_Event_diffSubtrees(
+        pt_Event1, pt_Event1, &rt_Diffs[0], &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(0, u32_DiffsLength);
+
+    /* Test only the deepest differing leaves are found */
+    u32_DiffsLength = 2;
+    TEST_SUCCESS(ITC_Event_diffSubtrees(
+        pt_Event1, pt_Event2, &rt_Diffs[0], &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(2, u32_DiffsLength);
+    TEST_ASSERT_EQUAL(3, rt_Diffs[0].u8_Level);
+    TEST_ASSERT_EQUAL(2, rt_Diffs[0].u64_Index);
+    TEST_ASSERT_TRUE(rt_Diffs[0].b_IsLeaf);
+    TEST_ASSERT_EQUAL(
+        pt_Event1->pt_Left->pt_Right->pt_Left->u64_Hash,
+        rt_Diffs[0].u64_Hash);
+    TEST_ASSERT_EQUAL(3, rt_Diffs[1].u8_Level);
+    TEST_ASSERT_EQUAL(3, rt_Diffs[1].u64_Index);
+    TEST_ASSERT_EQUAL(
+        pt_Event1->pt_Left->pt_Right->pt_Right->u64_Hash,
+        rt_Diffs[1].u64_Hash);
+
+    /* Test the output buffer capacity is respected */
+    u32_DiffsLength = 1;
+    TEST_FAILURE(
+        ITC_Event_diffSubtrees(
+            pt_Event1, pt_Event2, &rt_Diffs[0], &u32_DiffsLength),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test a differing counter stops the descent */
+    pt_Event2->t_Count = 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event2);
+    u32_DiffsLength = 2;
+    TEST_SUCCESS(ITC_Event_diffSubtrees(
+        pt_Event1, pt_Event2, &rt_Diffs[0], &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(1, u32_DiffsLength);
+    TEST_ASSERT_EQUAL(0, rt_Diffs[0].u8_Level);
+    TEST_ASSERT_EQUAL(0, rt_Diffs[0].u64_Index);
+    TEST_ASSERT_FALSE(rt_Diffs[0].b_IsLeaf);
+    TEST_ASSERT_EQUAL(pt_Event1->u64_Hash, rt_Diffs[0].u64_Hash);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+#else
+    TEST_IGNORE_MESSAGE("Event subtree hashes are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+}
+
+/* Test finding the subtrees of an Event, which differ from a list of remote
+ * subtree hashes succeeds */
+void ITC_Event_Test_diffEventSubtreeHashesSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH
+    ITC_Event_t *pt_Event1;
+    ITC_Event_t *pt_Event2;
+    ITC_Event_t *pt_LeafEvent;
+    ITC_Event_SubtreeHash_t rt_Hashes[7];
+    ITC_Event_SubtreeHash_t rt_Diffs[2];
+    uint32_t u32_HashesLength;
+    uint32_t u32_DiffsLength;
+
+    /* Create a (0, (0, 1, (0, 2, 0)), 3) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Left, pt_Event1, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event1->pt_Right, pt_Event1, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Left, pt_Event1->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Right, pt_Event1->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Right->pt_Left,
+        pt_Event1->pt_Left->pt_Right,
+        2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(
+        &pt_Event1->pt_Left->pt_Right->pt_Right,
+        pt_Event1->pt_Left->pt_Right,
+        0));
+
+    /* Create a (0, (0, 1, (0, 0, 2)), 3) Event */
+    TEST_SUCCESS(ITC_Event_clone(pt_Event1, &pt_Event2));
+    pt_Event2->pt_Left->pt_Right->pt_Left->t_Count = 0;
+    pt_Event2->pt_Left->pt_Right->pt_Right->t_Count = 2;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Event2->pt_Left->pt_Right);
+
+    /* Test invalid params */
+    u32_HashesLength = 7;
+    TEST_FAILURE(
+        ITC_Event_getSubtreeHashes(pt_Event2, 1, NULL, &u32_HashesLength),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_getSubtreeHashes(pt_Event2, 1, &rt_Hashes[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_getSubtreeHashes(
+            pt_Event2, 64, &rt_Hashes[0], &u32_HashesLength),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test the hashes are collected in pre-order down to the given level */
+    TEST_SUCCESS(ITC_Event_getSubtreeHashes(
+        pt_Event2, 1, &rt_Hashes[0], &u32_HashesLength));
+    TEST_ASSERT_EQUAL(3, u32_HashesLength);
+    TEST_ASSERT_EQUAL(0, rt_Hashes[0].u8_Level);
+    TEST_ASSERT_EQUAL(pt_Event2->u64_Hash, rt_Hashes[0].u64_Hash);
+    TEST_ASSERT_EQUAL(1, rt_Hashes[1].u8_Level);
+    TEST_ASSERT_EQUAL(0, rt_Hashes[1].u64_Index);
+    TEST_ASSERT_FALSE(rt_Hashes[1].b_IsLeaf);
+    TEST_ASSERT_EQUAL(1, rt_Hashes[2].u8_Level);
+    TEST_ASSERT_EQUAL(1, rt_Hashes[2].u64_Index);
+    TEST_ASSERT_TRUE(rt_Hashes[2].b_IsLeaf);
+
+    /* Test a shallow list only narrows the difference down to its depth */
+    u32_DiffsLength = 2;
+    TEST_SUCCESS(ITC_Event_diffSubtreeHashes(
+        pt_Event1,
+        &rt_Hashes[0],
+        u32_HashesLength,
+        &rt_Diffs[0],
+        &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(1, u32_DiffsLength);
+    TEST_ASSERT_EQUAL(1, rt_Diffs[0].u8_Level);
+    TEST_ASSERT_EQUAL(0, rt_Diffs[0].u64_Index);
+    TEST_ASSERT_EQUAL(pt_Event1->pt_Left->u64_Hash, rt_Diffs[0].u64_Hash);
+
+    /* Test the output buffer capacity is respected */
+    u32_HashesLength = 6;
+    TEST_FAILURE(
+        ITC_Event_getSubtreeHashes(
+            pt_Event2, 63, &rt_Hashes[0], &u32_HashesLength),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    /* Test a full list finds the deepest differing leaves */
+    u32_HashesLength = 7;
+    TEST_SUCCESS(ITC_Event_getSubtreeHashes(
+        pt_Event2, 63, &rt_Hashes[0], &u32_HashesLength));
+    TEST_ASSERT_EQUAL(7, u32_HashesLength);
+    u32_DiffsLength = 2;
+    TEST_SUCCESS(ITC_Event_diffSubtreeHashes(
+        pt_Event1,
+        &rt_Hashes[0],
+        u32_HashesLength,
+        &rt_Diffs[0],
+        &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(2, u32_DiffsLength);
+    TEST_ASSERT_EQUAL(3, rt_Diffs[0].u8_Level);
+    TEST_ASSERT_EQUAL(2, rt_Diffs[0].u64_Index);
+    TEST_ASSERT_EQUAL(3, rt_Diffs[1].u8_Level);
+    TEST_ASSERT_EQUAL(3, rt_Diffs[1].u64_Index);
+
+    /* Test a matching list has no differing subtrees */
+    u32_DiffsLength = 2;
+    TEST_SUCCESS(ITC_Event_diffSubtreeHashes(
+        pt_Event2,
+        &rt_Hashes[0],
+        u32_HashesLength,
+        &rt_Diffs[0],
+        &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(0, u32_DiffsLength);
+
+    /* Test a local leaf covering several remote subtrees is reported once */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_LeafEvent, NULL, 0));
+    u32_DiffsLength = 2;
+    TEST_SUCCESS(ITC_Event_diffSubtreeHashes(
+        pt_LeafEvent,
+        &rt_Hashes[1],
+        u32_HashesLength - 1,
+        &rt_Diffs[0],
+        &u32_DiffsLength));
+    TEST_ASSERT_EQUAL(1, u32_DiffsLength);
+    TEST_ASSERT_EQUAL(0, rt_Diffs[0].u8_Level);
+    TEST_ASSERT_TRUE(rt_Diffs[0].b_IsLeaf);
+
+    /* Test an out of range index is rejected */
+    rt_Hashes[1].u64_Index = 2;
+    TEST_FAILURE(
+        ITC_Event_diffSubtreeHashes(
+            pt_Event1,
+            &rt_Hashes[0],
+            u32_HashesLength,
+            &rt_Diffs[0],
+            &u32_DiffsLength),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event1));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event2));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_LeafEvent));
+#else
+    TEST_IGNORE_MESSAGE("Event subtree hashes are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_SUBTREE_HASH */
+}
+
+/* Test finding the difference of Events fails with invalid param */
+void ITC_Event_Test_diffEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Dummy = NULL;
+    uint32_t u32_Regions;
+
+    TEST_FAILURE(
+        ITC_Event_diff(pt_Dummy, pt_Dummy, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_diff(NULL, pt_Dummy, &pt_Dummy), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_diffRegions(pt_Dummy, pt_Dummy, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_diffRegions(NULL, pt_Dummy, &u32_Regions),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test finding the difference of two complex Events succeeds */
+void ITC_Event_Test_diffTwoComplexEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_t *pt_DiffEvent;
+    ITC_Event_t *pt_JoinedEvent;
+    ITC_Event_t *pt_OtherJoinedEvent;
+    uint32_t u32_Regions;
+
+    /* clang-format off */
+    /* Construct the (2, 4, (0, (0, 3, 0), 1)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Left, pt_Event->pt_Right->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Right, pt_Event->pt_Right->pt_Left, 0));
+
+    /* Construct the (1, (0, (3, 4, 0), 0), (6, 0, 2)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left->pt_Left, pt_OtherEvent->pt_Left->pt_Left, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left->pt_Right, pt_OtherEvent->pt_Left->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 6));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right->pt_Left, pt_OtherEvent->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right->pt_Right, pt_OtherEvent->pt_Right, 2));
+    /* clang-format on */
+
+    /* Test what the first Event knows that the other one does not */
+    TEST_SUCCESS(ITC_Event_diff(pt_Event, pt_OtherEvent, &pt_DiffEvent));
+    TEST_SUCCESS(ITC_Event_validate(pt_DiffEvent));
+
+    /* clang-format off */
+    /* Test the difference is a (0, (0, (0, 0, 6), 6), 0) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Left->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Left->pt_Left->pt_Right, 6);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Left->pt_Right, 6);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Right, 0);
+    /* clang-format on */
+
+    /* Test joining the difference into the other Event is the same as
+     * joining the first Event into it */
+    TEST_SUCCESS(
+        ITC_Event_joinConst(pt_OtherEvent, pt_DiffEvent, &pt_JoinedEvent));
+    TEST_SUCCESS(
+        ITC_Event_joinConst(pt_OtherEvent, pt_Event, &pt_OtherJoinedEvent));
+    checkEventEqual(pt_JoinedEvent, pt_OtherJoinedEvent);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_JoinedEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_DiffEvent));
+
+    TEST_SUCCESS(
+        ITC_Event_diffRegions(pt_Event, pt_OtherEvent, &u32_Regions));
+    TEST_ASSERT_EQUAL(2, u32_Regions);
+
+    /* Test what the other Event knows that the first one does not */
+    TEST_SUCCESS(ITC_Event_diff(pt_OtherEvent, pt_Event, &pt_DiffEvent));
+    TEST_SUCCESS(ITC_Event_validate(pt_DiffEvent));
+
+    /* clang-format off */
+    /* Test the difference is a (0, (0, (0, 8, 0), 0), (7, 0, 2)) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Left->pt_Left->pt_Left, 8);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Left->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_DiffEvent->pt_Right, 7);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Right->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent->pt_Right->pt_Right, 2);
+    /* clang-format on */
+
+    TEST_SUCCESS(
+        ITC_Event_joinConst(pt_Event, pt_DiffEvent, &pt_JoinedEvent));
+    checkEventEqual(pt_JoinedEvent, pt_OtherJoinedEvent);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_JoinedEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherJoinedEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_DiffEvent));
+
+    /* Test the region count is counted on the finer of the two trees */
+    TEST_SUCCESS(
+        ITC_Event_diffRegions(pt_OtherEvent, pt_Event, &u32_Regions));
+    TEST_ASSERT_EQUAL(4, u32_Regions);
+
+    /* Test an Event knows nothing the same Event does not */
+    TEST_SUCCESS(ITC_Event_diff(pt_Event, pt_Event, &pt_DiffEvent));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_DiffEvent, 0);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_DiffEvent));
+    TEST_SUCCESS(ITC_Event_diffRegions(pt_Event, pt_Event, &u32_Regions));
+    TEST_ASSERT_EQUAL(0, u32_Regions);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+}
+
+/* Test meeting Events fails with invalid param */
+void ITC_Event_Test_meetEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Dummy = NULL;
+    const ITC_Event_t *rpt_Events[1] = { NULL };
+
+    TEST_FAILURE(
+        ITC_Event_meet(pt_Dummy, pt_Dummy, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_meet(NULL, pt_Dummy, &pt_Dummy), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_meetMany(NULL, 1, &pt_Dummy), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_meetMany(rpt_Events, 0, &pt_Dummy),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_meetMany(rpt_Events, 1, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_meetMany(rpt_Events, 1, &pt_Dummy),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_NULL(pt_Dummy);
+}
+
+/* Test meeting two complex Events succeeds */
+void ITC_Event_Test_meetTwoComplexEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_t *pt_MetEvent;
+    bool b_IsLeq;
+
+    /* clang-format off */
+    /* Construct the (2, 4, (0, (0, 3, 0), 1)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Left, pt_Event->pt_Right->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Right, pt_Event->pt_Right->pt_Left, 0));
+
+    /* Construct the (1, (0, (3, 4, 0), 0), (6, 0, 2)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left->pt_Left, pt_OtherEvent->pt_Left->pt_Left, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left->pt_Right, pt_OtherEvent->pt_Left->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 6));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right->pt_Left, pt_OtherEvent->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right->pt_Right, pt_OtherEvent->pt_Right, 2));
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_Event_meet(pt_Event, pt_OtherEvent, &pt_MetEvent));
+    TEST_SUCCESS(ITC_Event_validate(pt_MetEvent));
+
+    /* clang-format off */
+    /* Test the Event is a (1, (0, (3, 2, 0), 0), (1, (0, 3, 0), 1)) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Left->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Left->pt_Left->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Left->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Right, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Right->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Left->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Right, 1);
+    /* clang-format on */
+
+    /* Test the result is `<=` both Events */
+    TEST_SUCCESS(ITC_Event_leq(pt_MetEvent, pt_Event, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_leq(pt_MetEvent, pt_OtherEvent, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+
+    /* Test meeting is commutative */
+    TEST_SUCCESS(ITC_Event_meet(pt_OtherEvent, pt_Event, &pt_MetEvent));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Right, 1);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+
+    /* Test meeting an Event with itself gives the same Event */
+    TEST_SUCCESS(ITC_Event_meet(pt_Event, pt_Event, &pt_MetEvent));
+    checkEventEqual(pt_MetEvent, pt_Event);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+}
+
+/* Test meeting many Events succeeds */
+void ITC_Event_Test_meetManyEventsSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Event_t *pt_LeafEvent;
+    ITC_Event_t *pt_ZeroEvent;
+    ITC_Event_t *pt_MetEvent;
+    const ITC_Event_t *rpt_Events[4];
+
+    /* clang-format off */
+    /* Construct the (2, 4, (0, (0, 3, 0), 1)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Left, pt_Event->pt_Right->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Right, pt_Event->pt_Right->pt_Left, 0));
+
+    /* Construct the (1, (0, (3, 4, 0), 0), (6, 0, 2)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left, pt_OtherEvent->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left->pt_Left, pt_OtherEvent->pt_Left->pt_Left, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Left->pt_Right, pt_OtherEvent->pt_Left->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left->pt_Right, pt_OtherEvent->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 6));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right->pt_Left, pt_OtherEvent->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right->pt_Right, pt_OtherEvent->pt_Right, 2));
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_LeafEvent, NULL, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_ZeroEvent, NULL, 0));
+
+    /* Test meeting a single Event clones it */
+    rpt_Events[0] = pt_Event;
+    TEST_SUCCESS(ITC_Event_meetMany(rpt_Events, 1, &pt_MetEvent));
+    checkEventEqual(pt_MetEvent, pt_Event);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+
+    rpt_Events[1] = pt_OtherEvent;
+    rpt_Events[2] = pt_LeafEvent;
+    TEST_SUCCESS(ITC_Event_meetMany(rpt_Events, 3, &pt_MetEvent));
+    TEST_SUCCESS(ITC_Event_validate(pt_MetEvent));
+
+    /* clang-format off */
+    /* Test the Event is a (1, (0, 2, 0), (1, (0, 1, 0), 1)) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Left->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Right, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_MetEvent->pt_Right->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Left->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent->pt_Right->pt_Right, 1);
+    /* clang-format on */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+
+    /* Test meeting with a `0` Event gives a `0` Event */
+    rpt_Events[3] = pt_ZeroEvent;
+    TEST_SUCCESS(ITC_Event_meetMany(rpt_Events, 4, &pt_MetEvent));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_MetEvent, 0);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_LeafEvent));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_ZeroEvent));
+}
+
+/* Test rebasing an Event fails with invalid param */
+void ITC_Event_Test_rebaseEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Dummy = NULL;
+
+    TEST_FAILURE(ITC_Event_rebase(NULL, pt_Dummy), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_rebase(&pt_Dummy, pt_Dummy), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test rebasing an Event against a base which is not `<=` it fails */
+void ITC_Event_Test_rebaseEventFailWithCounterUnderflow(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+
+    /* clang-format off */
+    /* Construct the (1, 2, 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+
+    /* Construct the (1, 0, 1) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 1));
+    /* clang-format on */
+
+    /* Test concurrent Events cannot be rebased against each other */
+    TEST_FAILURE(
+        ITC_Event_rebase(&pt_Event, pt_OtherEvent),
+        ITC_STATUS_EVENT_COUNTER_UNDERFLOW);
+    TEST_FAILURE(
+        ITC_Event_rebase(&pt_OtherEvent, pt_Event),
+        ITC_STATUS_EVENT_COUNTER_UNDERFLOW);
+
+    /* Test the Events were left untouched */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Right, 1);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+}
+
+/* Test rebasing a complex Event succeeds */
+void ITC_Event_Test_rebaseComplexEventSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_Base;
+
+    /* clang-format off */
+    /* Construct the (2, 4, (0, (0, 3, 0), 1)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 4));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Left, pt_Event->pt_Right->pt_Left, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Right, pt_Event->pt_Right->pt_Left, 0));
+
+    /* Construct the (1, 3, 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base->pt_Left, pt_Base, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Base->pt_Right, pt_Base, 0));
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_Event_rebase(&pt_Event, pt_Base));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* clang-format off */
+    /* Test the Event is a (1, 1, (0, (0, 3, 0), 1)) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Right->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Left->pt_Left, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Right, 1);
+    /* clang-format on */
+
+    /* Test rebasing an Event against itself gives a `0` Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_Base));
+    TEST_SUCCESS(ITC_Event_rebase(&pt_Event, pt_Base));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Base));
+}
+
+/* Test adding an Event fails with invalid param */
+void ITC_Event_Test_addEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Dummy = NULL;
+
+    TEST_FAILURE(ITC_Event_add(NULL, pt_Dummy), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Event_add(&pt_Dummy, pt_Dummy), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test adding an Event fails with counter overflow */
+void ITC_Event_Test_addEventFailWithCounterOverflow(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+
+    /* clang-format off */
+    /* Construct the (0, ~0, 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, ((ITC_Event_Counter_t)~0)));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+
+    /* Construct the (0, 1, 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 0));
+    /* clang-format on */
+
+    TEST_FAILURE(
+        ITC_Event_add(&pt_Event, pt_OtherEvent),
+        ITC_STATUS_EVENT_COUNTER_OVERFLOW);
+
+    /* clang-format off */
+    /* Test the Events were left untouched */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, (ITC_Event_Counter_t)~0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OtherEvent, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherEvent->pt_Right, 0);
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+}
+
+/* Test adding a complex Event succeeds and undoes a rebase */
+void ITC_Event_Test_addComplexEventSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_Addend;
+    ITC_Event_t *pt_OriginalEvent;
+
+    /* clang-format off */
+    /* Construct the (1, (0, 2, 0), 0) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Left, pt_Event->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left->pt_Right, pt_Event->pt_Left, 0));
+
+    /* Construct the (0, (0, 0, 2), 3) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Addend, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Addend->pt_Left, pt_Addend, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Addend->pt_Right, pt_Addend, 3));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Addend->pt_Left->pt_Left, pt_Addend->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Addend->pt_Left->pt_Right, pt_Addend->pt_Left, 2));
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_Event_clone(pt_Event, &pt_OriginalEvent));
+
+    TEST_SUCCESS(ITC_Event_add(&pt_Event, pt_Addend));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+
+    /* Test the Event is a (3, 0, 1) Event.
+     * The left subtrees sum to (0, 2, 2), which gets normalised */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 3);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 1);
+
+    /* Test rebasing against the addend gives back the original Event */
+    TEST_SUCCESS(ITC_Event_rebase(&pt_Event, pt_Addend));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+
+    /* Test adding a `0` Event leaves the Event unchanged */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Addend));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Addend, NULL, 0));
+    TEST_SUCCESS(ITC_Event_add(&pt_OriginalEvent, pt_Addend));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OriginalEvent, 1);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_OriginalEvent->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OriginalEvent->pt_Left->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OriginalEvent->pt_Left->pt_Right, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OriginalEvent->pt_Right, 0);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Addend));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OriginalEvent));
+}
+
+/* Test joining the owned intervals of an Event fails with invalid param */
+void ITC_Event_Test_joinOwnedEventFailInvalidParam(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Id_t *pt_Id;
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Event_joinOwned(NULL, pt_Event, pt_Id), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_joinOwned(&pt_Event, NULL, pt_Id), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Event_joinOwned(&pt_Event, pt_Event, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test joining the owned intervals of an Event succeeds */
+void ITC_Event_Test_joinOwnedEventSucceeds(void)
+{
+    ITC_Event_t *pt_Event;
+    ITC_Event_t *pt_OtherEvent;
+    ITC_Id_t *pt_Id;
+
+    /* Create the (1, 0) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+
+    /* Create the (0, 0, 1) and (1, 2, 0) Events */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_OtherEvent, NULL, 1));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Left, pt_OtherEvent, 2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(&pt_OtherEvent->pt_Right, pt_OtherEvent, 0));
+
+    /* Test only the owned left interval is joined */
+    TEST_SUCCESS(ITC_Event_joinOwned(&pt_Event, pt_OtherEvent, pt_Id));
+    TEST_SUCCESS(ITC_Event_validate(pt_Event));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test nothing is joined for a NULL ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_Event_joinOwned(&pt_Event, pt_OtherEvent, pt_Id));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event, 0);
+
+    /* Test everything is joined for a seed ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_Event_joinOwned(&pt_Event, pt_OtherEvent, pt_Id));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 2);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right, 0);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_OtherEvent));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
@@ -0,0 +1,222 @@
+/**
+ * @file ITC_IdPool_Test.c
+ * @brief Unit tests for the Interval Tree Clock's pre-forked ID pool
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_IdPool.h"
+#include "ITC_IdPool_Test.h"
+
+#include "ITC_Stamp.h"
+
+#include "ITC_Test_package.h"
+#include "ITC_TestUtil.h"
+#include "ITC_config.h"
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/* Init test */
+void setUp(void) {}
+
+/* Fini test */
+void tearDown(void) {}
+
+/* Test creating a pool fails with invalid param */
+void ITC_IdPool_Test_newPoolFailInvalidParam(void)
+{
+    ITC_IdPool_t *pt_Pool = NULL;
+
+    TEST_FAILURE(ITC_IdPool_new(1, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_IdPool_new(0, &pt_Pool), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_IdPool_new(ITC_ID_POOL_MAX_CAPACITY + 1, &pt_Pool),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_NULL(pt_Pool);
+}
+
+/* Test destroying a pool fails with invalid param */
+void ITC_IdPool_Test_destroyPoolFailInvalidParam(void)
+{
+    TEST_FAILURE(ITC_IdPool_destroy(NULL), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test creating and destroying a pool succeeds */
+void ITC_IdPool_Test_newAndDestroyPoolSucceeds(void)
+{
+    ITC_IdPool_t *pt_Pool = NULL;
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_IdPool_new(4, &pt_Pool));
+    TEST_ASSERT_EQUAL(4, pt_Pool->u32_IdsCapacity);
+    TEST_ASSERT_EQUAL(0, pt_Pool->u32_IdsLength);
+    TEST_SUCCESS(ITC_IdPool_destroy(&pt_Pool));
+    TEST_ASSERT_NULL(pt_Pool);
+
+    /* Test destroying a pool still holding IDs succeeds */
+    TEST_SUCCESS(ITC_IdPool_new(4, &pt_Pool));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_IdPool_refill(pt_Pool, pt_Stamp));
+    TEST_SUCCESS(ITC_IdPool_destroy(&pt_Pool));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Test destroying an already destroyed pool succeeds */
+    TEST_SUCCESS(ITC_IdPool_destroy(&pt_Pool));
+}
+
+/* Test using a pool fails with invalid param */
+void ITC_IdPool_Test_usePoolFailInvalidParam(void)
+{
+    ITC_IdPool_t *pt_Pool;
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+
+    TEST_SUCCESS(ITC_IdPool_new(2, &pt_Pool));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_IdPool_refill(NULL, pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_IdPool_refill(pt_Pool, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_IdPool_fork(NULL, pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_IdPool_join(NULL, &pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_IdPool_join(pt_Pool, NULL, &pt_OtherStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_IdPool_join(pt_Pool, &pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_IdPool_join(pt_Pool, &pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_IdPool_drain(NULL, pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_IdPool_drain(pt_Pool, NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* Test refilling from a Stamp with a NULL ID fails */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_OtherStamp));
+    TEST_FAILURE(
+        ITC_IdPool_refill(pt_Pool, pt_OtherStamp), ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_EQUAL(0, pt_Pool->u32_IdsLength);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+
+    /* Test forking from an empty pool fails */
+    TEST_FAILURE(
+        ITC_IdPool_fork(pt_Pool, pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_ID_POOL_EMPTY);
+    TEST_ASSERT_NULL(pt_OtherStamp);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_IdPool_destroy(&pt_Pool));
+}
+
+/* Test refilling, forking off, joining back and draining a pool succeeds */
+void ITC_IdPool_Test_refillForkJoinAndDrainPoolSucceeds(void)
+{
+    ITC_IdPool_t *pt_Pool;
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *rpt_Workers[3];
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_I;
+
+    TEST_SUCCESS(ITC_IdPool_new(3, &pt_Pool));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Fill up the pool. The Stamp keeps the last part: (0, (0, 1)) */
+    TEST_SUCCESS(ITC_IdPool_refill(pt_Pool, pt_Stamp));
+    TEST_ASSERT_EQUAL(3, pt_Pool->u32_IdsLength);
+    TEST_ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp->pt_Id->pt_Right);
+
+    /* Test refilling a full pool does nothing */
+    TEST_SUCCESS(ITC_IdPool_refill(pt_Pool, pt_Stamp));
+    TEST_ASSERT_EQUAL(3, pt_Pool->u32_IdsLength);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp->pt_Id->pt_Right);
+
+    /* Spawn the workers */
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_IdPool_fork(pt_Pool, pt_Stamp, &rpt_Workers[u32_I]));
+        TEST_ASSERT_EQUAL(2 - u32_I, pt_Pool->u32_IdsLength);
+
+        /* Test the Event history was copied */
+        TEST_SUCCESS(
+            ITC_Stamp_compare(pt_Stamp, rpt_Workers[u32_I], &t_Result));
+        TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    }
+
+    TEST_FAILURE(
+        ITC_IdPool_fork(pt_Pool, pt_Stamp, &rpt_Workers[0]),
+        ITC_STATUS_ID_POOL_EMPTY);
+
+    /* Test the IDs are disjoint by recording concurrent events */
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_event(rpt_Workers[u32_I]));
+    }
+
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, rpt_Workers[0], &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+
+    /* Join the workers back, returning their IDs to the pool */
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_IdPool_join(pt_Pool, &pt_Stamp, &rpt_Workers[u32_I]));
+        TEST_ASSERT_NULL(rpt_Workers[u32_I]);
+        TEST_ASSERT_EQUAL(u32_I + 1, pt_Pool->u32_IdsLength);
+    }
+
+    /* Test the ID of the Stamp was left as it was */
+    TEST_ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp->pt_Id->pt_Right);
+
+    /* Test the pooled IDs sum back into a seed */
+    TEST_SUCCESS(ITC_IdPool_drain(pt_Pool, pt_Stamp));
+    TEST_ASSERT_EQUAL(0, pt_Pool->u32_IdsLength);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_IdPool_destroy(&pt_Pool));
+}
+
+/* Test joining into a full pool sums the returned ID */
+void ITC_IdPool_Test_joinIntoFullPoolSumsReturnedId(void)
+{
+    ITC_IdPool_t *pt_Pool;
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_Worker;
+
+    TEST_SUCCESS(ITC_IdPool_new(1, &pt_Pool));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Spawn a worker with (1, 0) */
+    TEST_SUCCESS(ITC_IdPool_refill(pt_Pool, pt_Stamp));
+    TEST_SUCCESS(ITC_IdPool_fork(pt_Pool, pt_Stamp, &pt_Worker));
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Worker->pt_Id);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Stamp->pt_Id);
+
+    /* Refill the pool with (0, (1, 0)) */
+    TEST_SUCCESS(ITC_IdPool_refill(pt_Pool, pt_Stamp));
+    TEST_ASSERT_EQUAL(1, pt_Pool->u32_IdsLength);
+
+    /* Test the returned ID is summed with the pooled one: (1, (1, 0)) */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Worker));
+    TEST_SUCCESS(ITC_IdPool_join(pt_Pool, &pt_Stamp, &pt_Worker));
+    TEST_ASSERT_EQUAL(1, pt_Pool->u32_IdsLength);
+    TEST_ITC_ID_IS_SEED_ID(pt_Pool->ppt_Ids[0]->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Pool->ppt_Ids[0]->pt_Right);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    TEST_SUCCESS(ITC_IdPool_drain(pt_Pool, pt_Stamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_IdPool_destroy(&pt_Pool));
+}
@@ -14,6 +14,44 @@
 #include "ITC_Test_package.h"
 #include "ITC_TestUtil.h"
 
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+#include <string.h>
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+
+/* Test the split or summed interval ID matches the one of the split or summed
+ * ID. Destroys both interval IDs */
+static void checkIdIntervalsMatchId(
+    ITC_Id_Intervals_t *pt_Intervals,
+    const ITC_Id_t *const pt_Id
+)
+{
+    ITC_Id_Intervals_t t_Expected;
+
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_Expected));
+    TEST_ASSERT_EQUAL(t_Expected.u32_Length, pt_Intervals->u32_Length);
+
+    for (uint32_t u32_I = 0; u32_I < t_Expected.u32_Length; u32_I++)
+    {
+        TEST_ASSERT_EQUAL(
+            t_Expected.pt_Intervals[u32_I].u8_Depth,
+            pt_Intervals->pt_Intervals[u32_I].u8_Depth);
+        TEST_ASSERT_EQUAL(
+            t_Expected.pt_Intervals[u32_I].u64_Position,
+            pt_Intervals->pt_Intervals[u32_I].u64_Position);
+    }
+
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_Expected));
+    TEST_SUCCESS(ITC_Id_destroyIntervals(pt_Intervals));
+}
+
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+
 /******************************************************************************
  *  Public functions
  ******************************************************************************/
@@ -56,7 +94,7 @@ void ITC_Id_Test_createNullIdSuccessful(void)
     TEST_SUCCESS(ITC_Id_newNull(&pt_Id));
 
     /* Test this is a NULL ID */
-    TEST_ASSERT_FALSE(pt_Id->pt_Parent);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_Id));
     TEST_ITC_ID_IS_NULL_ID(pt_Id);
 
     /* Destroy the ID */
@@ -78,13 +116,134 @@ void ITC_Id_Test_createSeedIdSuccessful(void)
     TEST_SUCCESS(ITC_Id_newSeed(&pt_Id));
 
     /* Test this is a seed ID */
-    TEST_ASSERT_FALSE(pt_Id->pt_Parent);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_Id));
     TEST_ITC_ID_IS_SEED_ID(pt_Id);
 
     /* Destroy the ID */
     TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
 }
 
+/* Test creating the shared seed and null IDs succeeds */
+void ITC_Id_Test_createSharedIdsSuccessful(void)
+{
+    ITC_Id_t *pt_SeedId;
+    ITC_Id_t *pt_NullId;
+    ITC_Id_t *pt_ClonedId;
+
+    /* Create the shared IDs */
+    TEST_SUCCESS(ITC_Id_newSharedSeed(&pt_SeedId));
+    TEST_SUCCESS(ITC_Id_newSharedNull(&pt_NullId));
+
+    /* Test these are seed and null IDs */
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_SeedId));
+    TEST_ITC_ID_IS_SEED_ID(pt_SeedId);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_NullId));
+    TEST_ITC_ID_IS_NULL_ID(pt_NullId);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_NullId));
+
+    /* Test cloning a shared ID returns the same ID */
+    TEST_SUCCESS(ITC_Id_clone(pt_SeedId, &pt_ClonedId));
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    TEST_ASSERT_EQUAL_PTR(pt_SeedId, pt_ClonedId);
+#else
+    TEST_ASSERT_TRUE(pt_SeedId != pt_ClonedId);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_ClonedId));
+    TEST_ASSERT_NULL(pt_ClonedId);
+
+    /* Test the shared ID survived destroying its clone */
+    TEST_ITC_ID_IS_SEED_ID(pt_SeedId);
+
+    /* Test splitting a null ID returns the shared null ID */
+    TEST_SUCCESS(ITC_Id_newNull(&pt_ClonedId));
+    TEST_SUCCESS(ITC_Id_split(&pt_ClonedId, &pt_NullId));
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    TEST_ASSERT_EQUAL_PTR(pt_ClonedId, pt_NullId);
+#else
+    TEST_ASSERT_TRUE(pt_ClonedId != pt_NullId);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
+    TEST_ITC_ID_IS_NULL_ID(pt_NullId);
+
+    /* Destroy the IDs */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_SeedId));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_NullId));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_ClonedId));
+}
+
+/* Test the owner flag and parent of a compact ID node are independent */
+void ITC_Id_Test_compactIdNodeOwnerAndParentAreIndependent(void)
+{
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    ITC_Id_t t_Parent = { 0 };
+    ITC_Id_t t_Child = { 0 };
+
+    /* Test the owner flag does not take up a slot of its own */
+    TEST_ASSERT_EQUAL(3 * sizeof(ITC_Id_t *), sizeof(ITC_Id_t));
+
+    /* Test the tag bits of tagged leaf IDs are free */
+    TEST_ASSERT_EQUAL(0, (uintptr_t)&t_Parent & ITC_ID_TAG_MASK);
+
+    /* Test setting the owner flag keeps the parent */
+    ITC_ID_SET_PARENT(&t_Child, &t_Parent);
+    ITC_ID_SET_OWNER(&t_Child, true);
+    TEST_ASSERT_TRUE(ITC_ID_GET_PARENT(&t_Child) == &t_Parent);
+    TEST_ASSERT_TRUE(ITC_ID_IS_OWNER(&t_Child));
+
+    /* Test setting the parent keeps the owner flag */
+    ITC_ID_SET_PARENT(&t_Child, NULL);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(&t_Child));
+    TEST_ASSERT_TRUE(ITC_ID_IS_OWNER(&t_Child));
+
+    /* Test clearing the owner flag */
+    ITC_ID_SET_OWNER(&t_Child, false);
+    TEST_ASSERT_FALSE(ITC_ID_IS_OWNER(&t_Child));
+#else
+    TEST_IGNORE_MESSAGE("Compact ID nodes are disabled");
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+}
+
+/* Test the leaves of compact ID nodes are held as tagged leaf IDs */
+void ITC_Id_Test_compactIdNodeLeavesAreTagged(void)
+{
+#if ITC_CONFIG_USE_COMPACT_ID_NODES
+    ITC_Id_t *pt_Id1;
+    ITC_Id_t *pt_Id2;
+    ITC_Id_t *pt_Id3;
+
+    /* Test the children of a split seed are not allocated */
+    TEST_SUCCESS(ITC_Id_newSeed(&pt_Id1));
+    TEST_SUCCESS(ITC_Id_split(&pt_Id1, &pt_Id2));
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id1);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Id2);
+    TEST_ASSERT_FALSE(ITC_ID_IS_TAGGED_LEAF(pt_Id1));
+    TEST_ASSERT_TRUE(ITC_ID_IS_TAGGED_LEAF(pt_Id1->pt_Left));
+    TEST_ASSERT_TRUE(ITC_ID_IS_TAGGED_LEAF(pt_Id1->pt_Right));
+    TEST_ASSERT_TRUE(ITC_ID_GET_PARENT(pt_Id1->pt_Left) == pt_Id1);
+    TEST_ASSERT_TRUE(ITC_ID_GET_PARENT(pt_Id1->pt_Right) == pt_Id1);
+    TEST_SUCCESS(ITC_Id_validate(pt_Id1));
+
+    /* Test a subtree normalised into a leaf is replaced by a tagged leaf:
+     * sum(((1, 0), 0), ((0, 1), 0)) = (1, 0) */
+    TEST_SUCCESS(ITC_Id_split(&pt_Id1, &pt_Id3));
+    TEST_ASSERT_FALSE(ITC_ID_IS_TAGGED_LEAF(pt_Id1->pt_Left));
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id1, &pt_Id3));
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id1);
+    TEST_ASSERT_TRUE(ITC_ID_IS_TAGGED_LEAF(pt_Id1->pt_Left));
+    TEST_SUCCESS(ITC_Id_validate(pt_Id1));
+
+    /* Test summing into a root leaf allocates a real node */
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id1, &pt_Id2));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id1);
+    TEST_ASSERT_FALSE(ITC_ID_IS_TAGGED_LEAF(pt_Id1));
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id1));
+#else
+    TEST_IGNORE_MESSAGE("Compact ID nodes are disabled");
+#endif /* ITC_CONFIG_USE_COMPACT_ID_NODES */
+}
+
 /* Test cloning an ID fails with invalid param */
 void ITC_Id_Test_cloneIdFailInvalidParam(void)
 {
@@ -128,7 +287,7 @@ void ITC_Id_Test_cloneIdSuccessful(void)
     TEST_ASSERT_TRUE(pt_OriginalId != pt_ClonedId);
     TEST_SUCCESS(ITC_Id_destroy(&pt_OriginalId));
 
-    TEST_ASSERT_FALSE(pt_ClonedId->pt_Parent);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_ClonedId));
     TEST_ITC_ID_IS_SEED_ID(pt_ClonedId);
     TEST_SUCCESS(ITC_Id_destroy(&pt_ClonedId));
 
@@ -138,7 +297,7 @@ void ITC_Id_Test_cloneIdSuccessful(void)
     TEST_ASSERT_TRUE(pt_OriginalId != pt_ClonedId);
     TEST_SUCCESS(ITC_Id_destroy(&pt_OriginalId));
 
-    TEST_ASSERT_FALSE(pt_ClonedId->pt_Parent);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_ClonedId));
     TEST_ITC_ID_IS_NULL_ID(pt_ClonedId);
     TEST_SUCCESS(ITC_Id_destroy(&pt_ClonedId));
 
@@ -155,11 +314,11 @@ void ITC_Id_Test_cloneIdSuccessful(void)
     TEST_SUCCESS(ITC_Id_destroy(&pt_OriginalId));
     /* clang-format on */
 
-    TEST_ASSERT_FALSE(pt_ClonedId->pt_Parent);
+    TEST_ASSERT_FALSE(ITC_ID_GET_PARENT(pt_ClonedId));
     TEST_ITC_ID_IS_NULL_ID(pt_ClonedId->pt_Left);
-    TEST_ASSERT_TRUE(pt_ClonedId->pt_Left->pt_Parent == pt_ClonedId);
+    TEST_ASSERT_TRUE(ITC_ID_GET_PARENT(pt_ClonedId->pt_Left) == pt_ClonedId);
     TEST_ITC_ID_IS_SEED_ID(pt_ClonedId->pt_Right);
-    TEST_ASSERT_TRUE(pt_ClonedId->pt_Right->pt_Parent == pt_ClonedId);
+    TEST_ASSERT_TRUE(ITC_ID_GET_PARENT(pt_ClonedId->pt_Right) == pt_ClonedId);
     TEST_SUCCESS(ITC_Id_destroy(&pt_ClonedId));
 }
 
@@ -431,6 +590,106 @@ void ITC_Id_Test_split010010IdSuccessful(void)
     TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
 }
 
+/* Test splitting an ID with uneven shares fails with invalid param */
+void ITC_Id_Test_splitWeightedIdFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId = NULL;
+
+    TEST_FAILURE(
+        ITC_Id_splitWeighted(NULL, &pt_OtherId, 1, 2),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Id_splitWeighted(&pt_Id, NULL, 1, 2), ITC_STATUS_INVALID_PARAM);
+    /* Test shares outside of the (0, 1) range are rejected */
+    TEST_FAILURE(
+        ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 0, 2),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 4, 2),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 1, 0),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 1, 32),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test the ID was not modified */
+    TEST_ITC_ID_IS_SEED_ID(pt_Id);
+    TEST_ASSERT_NULL(pt_OtherId);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test splitting an ID with uneven shares succeeds */
+void ITC_Id_Test_splitWeightedIdSuccessful(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_t *pt_HelperId;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    /* Test an even share is the same as a regular split */
+    TEST_SUCCESS(ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 4, 3));
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherId);
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_OtherId));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id);
+
+    /* Give a quarter of the seed to the other ID:
+     * pt_Id      = (1, (1, 0))
+     * pt_OtherId = (0, (0, 1))
+     */
+    TEST_SUCCESS(ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 1, 2));
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_Id);
+    TEST_ITC_ID_IS_SEED_ID(pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_OtherId);
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherId->pt_Right);
+
+    /* Test the owned leaf of the other ID is split with the same weight:
+     * pt_OtherId  = (0, (0, (1, (1, 0))))
+     * pt_HelperId = (0, (0, (0, (0, 1))))
+     */
+    TEST_SUCCESS(ITC_Id_splitWeighted(&pt_OtherId, &pt_HelperId, 1, 2));
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_ID(pt_OtherId->pt_Right->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_OtherId->pt_Right->pt_Right->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(pt_HelperId->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_HelperId->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_HelperId->pt_Right->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_HelperId->pt_Right->pt_Right->pt_Right);
+
+    /* Test the IDs sum back into a seed */
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_HelperId));
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_OtherId));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id);
+
+    /* Give 3/8 of the seed to the other ID:
+     * pt_Id      = (1, ((1, 0), 0))
+     * pt_OtherId = (0, ((0, 1), 1))
+     */
+    TEST_SUCCESS(ITC_Id_splitWeighted(&pt_Id, &pt_OtherId, 3, 3));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_Id->pt_Right->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherId->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_ID(pt_OtherId->pt_Right->pt_Right);
+
+    TEST_SUCCESS(ITC_Id_sum(&pt_OtherId, &pt_Id));
+    TEST_ITC_ID_IS_SEED_ID(pt_OtherId);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+}
+
 /* Test validating an ID fails with invalid param */
 void ITC_Id_Test_validateIdFailInvalidParam(void)
 {
@@ -515,7 +774,7 @@ void ITC_Id_Test_normaliseNullAndSeedIdsSuccessful(void)
     TEST_ITC_ID_IS_NULL_ID(pt_Id);
 
     /* Change ID into a seed ID */
-    pt_Id->b_IsOwner = true;
+    ITC_ID_SET_OWNER(pt_Id, true);
 
     /* Normalise the ID */
     TEST_SUCCESS(ITC_Id_normalise(pt_Id));
@@ -544,8 +803,8 @@ void ITC_Id_Test_normalise10And01IdsSuccessful(void)
     TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id);
 
     /* Switch the (1, 0) ID into a (0, 1) ID */
-    pt_Id->pt_Left->b_IsOwner = false;
-    pt_Id->pt_Right->b_IsOwner = true;
+    ITC_ID_SET_OWNER(pt_Id->pt_Left, false);
+    ITC_ID_SET_OWNER(pt_Id->pt_Right, true);
 
     /* Normalise the ID */
     TEST_SUCCESS(ITC_Id_normalise(pt_Id));
@@ -1185,3 +1444,647 @@ void ITC_Id_Test_sumIdSplitSeedAndSumItBackToSeedSucceeds(void)
     TEST_ITC_ID_IS_SEED_ID(pt_Id7);
     TEST_SUCCESS(ITC_Id_destroy(&pt_Id7));
 }
+
+/* Test creating a balanced ID fails with invalid param */
+void ITC_Id_Test_newBalancedIdFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Dummy = NULL;
+
+    TEST_FAILURE(ITC_Id_newBalanced(0, 1, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_newBalanced(0, 0, &pt_Dummy), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_newBalanced(3, 3, &pt_Dummy), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test creating balanced IDs succeeds and they sum back into a seed */
+void ITC_Id_Test_newBalancedIdSucceeds(void)
+{
+    ITC_Id_t *pt_Id0;
+    ITC_Id_t *pt_Id1;
+    ITC_Id_t *pt_Id2;
+
+    /* Test a single part is the whole seed */
+    TEST_SUCCESS(ITC_Id_newBalanced(0, 1, &pt_Id0));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id0);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id0));
+
+    /* Test splitting into 3 parts gives:
+     * pt_Id0 = ((1, 0), 0)
+     * pt_Id1 = ((0, 1), 0)
+     * pt_Id2 = (0, 1)
+     */
+    TEST_SUCCESS(ITC_Id_newBalanced(0, 3, &pt_Id0));
+    TEST_SUCCESS(ITC_Id_newBalanced(1, 3, &pt_Id1));
+    TEST_SUCCESS(ITC_Id_newBalanced(2, 3, &pt_Id2));
+
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_Id0);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Id0->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_Id0->pt_Right);
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_Id1);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Id1->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_Id1->pt_Right);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Id2);
+
+    /* Test the parts sum back into a seed */
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id2, &pt_Id0));
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id2, &pt_Id1));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id2);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id0));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id1));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id2));
+}
+
+/* Test rebalancing IDs fails with invalid param */
+void ITC_Id_Test_rebalanceIdsFailInvalidParam(void)
+{
+    ITC_Id_t *rpt_Ids[1] = { NULL };
+
+    TEST_FAILURE(ITC_Id_rebalance(NULL, 1), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_rebalance(&rpt_Ids[0], 0), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test rebalancing overlapping IDs fails and leaves them untouched */
+void ITC_Id_Test_rebalanceOverlappingIdsFails(void)
+{
+    ITC_Id_t *rpt_Ids[2];
+    const ITC_Id_t *pt_OriginalId;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&rpt_Ids[0], NULL));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&rpt_Ids[1], NULL));
+    pt_OriginalId = rpt_Ids[0];
+
+    TEST_FAILURE(
+        ITC_Id_rebalance(&rpt_Ids[0], 2), ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+    TEST_ASSERT_EQUAL_PTR(pt_OriginalId, rpt_Ids[0]);
+    TEST_ITC_ID_IS_SEED_ID(rpt_Ids[0]);
+    TEST_ITC_ID_IS_SEED_ID(rpt_Ids[1]);
+
+    TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[0]));
+    TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[1]));
+}
+
+/* Test rebalancing deep IDs succeeds */
+void ITC_Id_Test_rebalanceDeepIdsSucceeds(void)
+{
+    ITC_Id_t *rpt_Ids[4];
+    uint32_t u32_I;
+
+    /* Split the seed unevenly:
+     * rpt_Ids[0] = (1, 0)
+     * rpt_Ids[1] = (0, (1, 0))
+     * rpt_Ids[2] = (0, (0, (1, 0)))
+     * rpt_Ids[3] = (0, (0, (0, 1)))
+     */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&rpt_Ids[0], NULL));
+
+    for (u32_I = 1; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Id_split(&rpt_Ids[u32_I - 1], &rpt_Ids[u32_I]));
+    }
+
+    /* Test IDs which are already as shallow as their owned fractions allow
+     * are left as they are */
+    TEST_SUCCESS(ITC_Id_rebalance(&rpt_Ids[0], 4));
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Ids[0]);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[1]->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Ids[1]->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[2]->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[2]->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Ids[2]->pt_Right->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[3]->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[3]->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_Ids[3]->pt_Right->pt_Right);
+
+    /* Test the IDs still sum up to a seed */
+    for (u32_I = 1; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Id_sum(&rpt_Ids[0], &rpt_Ids[u32_I]));
+    }
+
+    TEST_ITC_ID_IS_SEED_ID(rpt_Ids[0]);
+    TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[0]));
+}
+
+/* Test rebalancing fragmented IDs keeps their owned fractions */
+void ITC_Id_Test_rebalanceFragmentedIdsKeepsOwnedFractions(void)
+{
+    ITC_Id_t *rpt_Ids[4];
+    ITC_Id_t *pt_Id;
+    uint32_t u32_I;
+
+    /* Create fragmented IDs owning unequal fractions of the seed:
+     * rpt_Ids[0] = (0, (0, (1, 0))) - 1/8
+     * rpt_Ids[1] = ((1, 0), (1, 0)) - 1/2
+     * rpt_Ids[2] = (0, (0, (0, 1))) - 1/8
+     * rpt_Ids[3] = ((0, 1), 0)      - 1/4
+     */
+    TEST_SUCCESS(ITC_Id_newBalanced(3, 4, &rpt_Ids[0]));
+    TEST_SUCCESS(ITC_Id_split(&rpt_Ids[0], &rpt_Ids[2]));
+    TEST_SUCCESS(ITC_Id_newBalanced(0, 4, &rpt_Ids[1]));
+    TEST_SUCCESS(ITC_Id_newBalanced(2, 4, &pt_Id));
+    TEST_SUCCESS(ITC_Id_sum(&rpt_Ids[1], &pt_Id));
+    TEST_SUCCESS(ITC_Id_newBalanced(1, 4, &rpt_Ids[3]));
+
+    /* Test each ID gets a single subinterval of the same size, the largest
+     * ones first:
+     * rpt_Ids[0] = (0, (0, (1, 0)))
+     * rpt_Ids[1] = (1, 0)
+     * rpt_Ids[2] = (0, (0, (0, 1)))
+     * rpt_Ids[3] = (0, (1, 0))
+     */
+    TEST_SUCCESS(ITC_Id_rebalance(&rpt_Ids[0], 4));
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[0]->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[0]->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Ids[0]->pt_Right->pt_Right);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Ids[1]);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[2]->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[2]->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_Ids[2]->pt_Right->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[3]->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Ids[3]->pt_Right);
+
+    /* Create fragmented IDs owning a part of the seed:
+     * rpt_Ids[1] = ((0, 1), (0, 1)) - 1/2
+     * rpt_Ids[3] = (0, (1, 0))      - 1/4
+     */
+    TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[1]));
+    TEST_SUCCESS(ITC_Id_newBalanced(1, 4, &rpt_Ids[1]));
+    TEST_SUCCESS(ITC_Id_newBalanced(3, 4, &pt_Id));
+    TEST_SUCCESS(ITC_Id_sum(&rpt_Ids[1], &pt_Id));
+
+    /* Test the owned fractions are allocated within the sum of the IDs, the
+     * largest one in its largest subinterval:
+     * rpt_Ids[1] = (0, 1)
+     * rpt_Ids[3] = ((0, 1), 0)
+     */
+    pt_Id = rpt_Ids[3];
+    rpt_Ids[3] = rpt_Ids[2];
+    rpt_Ids[2] = pt_Id;
+    TEST_SUCCESS(ITC_Id_rebalance(&rpt_Ids[1], 2));
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_Ids[1]);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_Ids[2]->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Ids[2]->pt_Right);
+
+    for (u32_I = 0; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Id_destroy(&rpt_Ids[u32_I]));
+    }
+}
+
+/* Test getting the metrics of an ID fails with invalid param */
+void ITC_Id_Test_getIdMetricsFailInvalidParam(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_Metrics_t t_Metrics;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    TEST_FAILURE(
+        ITC_Id_getMetrics(NULL, &t_Metrics), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_getMetrics(pt_Id, NULL), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test getting the metrics of an ID fails with corrupt ID */
+void ITC_Id_Test_getIdMetricsFailWithCorruptId(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_Metrics_t t_Metrics;
+
+    /* Test different invalid IDs are handled properly */
+    for (uint32_t u32_I = 0; u32_I < gu32_InvalidIdTablesSize; u32_I++)
+    {
+        /* Construct an invalid ID */
+        gpv_InvalidIdConstructorTable[u32_I](&pt_Id);
+
+        /* Test for the failure */
+        TEST_FAILURE(
+            ITC_Id_getMetrics(pt_Id, &t_Metrics), ITC_STATUS_CORRUPT_ID);
+
+        /* Destroy the ID */
+        gpv_InvalidIdDestructorTable[u32_I](&pt_Id);
+    }
+}
+
+/* Test getting the metrics of an ID succeeds */
+void ITC_Id_Test_getIdMetricsSucceeds(void)
+{
+    ITC_Id_t *pt_Id;
+    ITC_Id_Metrics_t t_Metrics;
+
+    /* Test the metrics of a seed ID */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_Id_getMetrics(pt_Id, &t_Metrics));
+    TEST_ASSERT_EQUAL(1, t_Metrics.u64_OwnedNumerator);
+    TEST_ASSERT_EQUAL(0, t_Metrics.u8_OwnedDenominatorLog2);
+    TEST_ASSERT_EQUAL(0, t_Metrics.u32_Depth);
+    TEST_ASSERT_EQUAL(1, t_Metrics.u32_Leaves);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Test the metrics of a NULL ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_Id_getMetrics(pt_Id, &t_Metrics));
+    TEST_ASSERT_EQUAL(0, t_Metrics.u64_OwnedNumerator);
+    TEST_ASSERT_EQUAL(0, t_Metrics.u8_OwnedDenominatorLog2);
+    TEST_ASSERT_EQUAL(0, t_Metrics.u32_Depth);
+    TEST_ASSERT_EQUAL(1, t_Metrics.u32_Leaves);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* clang-format off */
+    /* Create a ((1, 0), (0, (1, 0))) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right->pt_Left, pt_Id->pt_Right->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Right->pt_Right, pt_Id->pt_Right->pt_Right));
+    /* clang-format on */
+
+    /* Test the ID owns 1/4 + 1/8 = 3/8 of the interval */
+    TEST_SUCCESS(ITC_Id_getMetrics(pt_Id, &t_Metrics));
+    TEST_ASSERT_EQUAL(3, t_Metrics.u64_OwnedNumerator);
+    TEST_ASSERT_EQUAL(3, t_Metrics.u8_OwnedDenominatorLog2);
+    TEST_ASSERT_EQUAL(3, t_Metrics.u32_Depth);
+    TEST_ASSERT_EQUAL(5, t_Metrics.u32_Leaves);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+}
+
+/* Test converting an ID to a bitmap ID and back succeeds */
+void ITC_Id_Test_convertIdToAndFromBitmapSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_Bitmap_t t_Bitmap;
+    uint32_t u32_Quarter = ITC_ID_BITMAP_LEN / 4;
+    bool b_IsOwned;
+
+    /* Test invalid params */
+    TEST_FAILURE(ITC_Id_toBitmap(NULL, &t_Bitmap), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_newFromBitmap(&t_Bitmap, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_newFromBitmap(NULL, &pt_Id), ITC_STATUS_INVALID_PARAM);
+
+    /* clang-format off */
+    /* Create a new ((1, 0), (0, 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    /* clang-format on */
+
+    /* Convert the ID */
+    TEST_SUCCESS(ITC_Id_toBitmap(pt_Id, &t_Bitmap));
+
+    /* Test only the first and the last quarters are owned */
+    for (uint32_t u32_I = 0; u32_I < ITC_ID_BITMAP_LEN; u32_I++)
+    {
+        b_IsOwned = (t_Bitmap.ru64_Words[u32_I / 64] >> (u32_I % 64)) & 1U;
+        TEST_ASSERT_EQUAL(
+            u32_I < u32_Quarter || u32_I >= 3 * u32_Quarter, b_IsOwned);
+    }
+
+    /* Convert it back and test it matches ((1, 0), (0, 1)) */
+    TEST_SUCCESS(ITC_Id_newFromBitmap(&t_Bitmap, &pt_OtherId));
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_OtherId);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_OtherId->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherId->pt_Right);
+    TEST_SUCCESS(ITC_Id_validate(pt_OtherId));
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+
+    /* Test the seed and null bitmap IDs become leaf IDs */
+    memset(&t_Bitmap, 0xFF, sizeof(t_Bitmap));
+    t_Bitmap.ru64_Words[0] = ITC_ID_BITMAP_LEN < 64
+        ? ((1ULL << ITC_ID_BITMAP_LEN) - 1U) : UINT64_MAX;
+    TEST_SUCCESS(ITC_Id_newFromBitmap(&t_Bitmap, &pt_Id));
+    TEST_ITC_ID_IS_SEED_ID(pt_Id);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    memset(&t_Bitmap, 0, sizeof(t_Bitmap));
+    TEST_SUCCESS(ITC_Id_newFromBitmap(&t_Bitmap, &pt_Id));
+    TEST_ITC_ID_IS_NULL_ID(pt_Id);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Bitmap IDs are disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+}
+
+/* Test converting an ID deeper than the bitmap depth fails */
+void ITC_Id_Test_convertTooDeepIdToBitmapFails(void)
+{
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_Bitmap_t t_Bitmap;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    /* Keep splitting the first half until it no longer fits the bitmap */
+    for (uint32_t u32_I = 0; u32_I < ITC_CONFIG_ID_BITMAP_DEPTH; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+        TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+        TEST_SUCCESS(ITC_Id_toBitmap(pt_Id, &t_Bitmap));
+    }
+
+    /* Test the smallest subinterval can't be split as a bitmap */
+    TEST_FAILURE(
+        ITC_Id_splitBitmap(&t_Bitmap, &t_Bitmap), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_splitBitmap(&t_Bitmap, &(ITC_Id_Bitmap_t){0}),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+    TEST_FAILURE(
+        ITC_Id_toBitmap(pt_Id, &t_Bitmap), ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+#else
+    TEST_IGNORE_MESSAGE("Bitmap IDs are disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+}
+
+/* Test splitting and summing bitmap IDs matches splitting and summing IDs */
+void ITC_Id_Test_splitAndSumBitmapIdsMatchesIds(void)
+{
+#if ITC_CONFIG_ENABLE_ID_BITMAP
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_t *pt_BitmapId;
+    ITC_Id_Bitmap_t t_Bitmap;
+    ITC_Id_Bitmap_t t_OtherBitmap;
+    ITC_Id_Bitmap_t t_ExpectedBitmap;
+
+    /* Create a (1, 0) and (0, (1, 0)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+    TEST_SUCCESS(ITC_Id_split(&pt_OtherId, &pt_BitmapId));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_BitmapId));
+
+    /* Sum them into a (1, (1, 0)) bitmap ID */
+    TEST_SUCCESS(ITC_Id_toBitmap(pt_Id, &t_Bitmap));
+    TEST_SUCCESS(ITC_Id_toBitmap(pt_OtherId, &t_OtherBitmap));
+    TEST_SUCCESS(ITC_Id_sumBitmap(&t_Bitmap, &t_OtherBitmap));
+    TEST_FAILURE(
+        ITC_Id_sumBitmap(&t_Bitmap, &t_OtherBitmap),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_OtherId));
+    TEST_SUCCESS(ITC_Id_toBitmap(pt_Id, &t_ExpectedBitmap));
+    TEST_ASSERT_EQUAL_MEMORY(
+        &t_ExpectedBitmap, &t_Bitmap, sizeof(t_Bitmap));
+
+    /* Split both representations and test the halves match */
+    TEST_SUCCESS(ITC_Id_splitBitmap(&t_Bitmap, &t_OtherBitmap));
+    TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+
+    TEST_SUCCESS(ITC_Id_toBitmap(pt_Id, &t_ExpectedBitmap));
+    TEST_ASSERT_EQUAL_MEMORY(
+        &t_ExpectedBitmap, &t_Bitmap, sizeof(t_Bitmap));
+    TEST_SUCCESS(ITC_Id_toBitmap(pt_OtherId, &t_ExpectedBitmap));
+    TEST_ASSERT_EQUAL_MEMORY(
+        &t_ExpectedBitmap, &t_OtherBitmap, sizeof(t_OtherBitmap));
+
+    /* Test a bitmap with unused bits set is rejected */
+    if (ITC_ID_BITMAP_LEN < 64)
+    {
+        t_Bitmap.ru64_Words[0] = UINT64_MAX;
+        TEST_FAILURE(
+            ITC_Id_newFromBitmap(&t_Bitmap, &pt_BitmapId),
+            ITC_STATUS_CORRUPT_ID);
+    }
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+#else
+    TEST_IGNORE_MESSAGE("Bitmap IDs are disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_BITMAP */
+}
+
+/* Test converting an ID to a sorted interval ID and back succeeds */
+void ITC_Id_Test_convertIdToAndFromIntervalsSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_Intervals_t t_Intervals;
+
+    /* Test invalid params */
+    TEST_FAILURE(
+        ITC_Id_toIntervals(NULL, &t_Intervals), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_newFromIntervals(NULL, &pt_Id), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Id_destroyIntervals(NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* clang-format off */
+    /* Create a new ((1, 0), (0, 1)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    /* clang-format on */
+
+    /* Convert the ID and test it owns the first and the last quarters */
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_Intervals));
+    TEST_ASSERT_EQUAL(2, t_Intervals.u32_Length);
+    TEST_ASSERT_EQUAL(2, t_Intervals.pt_Intervals[0].u8_Depth);
+    TEST_ASSERT_EQUAL(0, t_Intervals.pt_Intervals[0].u64_Position);
+    TEST_ASSERT_EQUAL(2, t_Intervals.pt_Intervals[1].u8_Depth);
+    TEST_ASSERT_EQUAL(3, t_Intervals.pt_Intervals[1].u64_Position);
+
+    /* Convert it back and test it matches ((1, 0), (0, 1)) */
+    TEST_SUCCESS(ITC_Id_newFromIntervals(&t_Intervals, &pt_OtherId));
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_OtherId);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_OtherId->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherId->pt_Right);
+    TEST_SUCCESS(ITC_Id_validate(pt_OtherId));
+
+    /* Test unsorted or uncoalesced subintervals are rejected */
+    t_Intervals.pt_Intervals[0].u64_Position = 3;
+    TEST_FAILURE(
+        ITC_Id_newFromIntervals(&t_Intervals, &pt_Id), ITC_STATUS_CORRUPT_ID);
+    t_Intervals.pt_Intervals[0].u64_Position = 2;
+    TEST_FAILURE(
+        ITC_Id_newFromIntervals(&t_Intervals, &pt_Id), ITC_STATUS_CORRUPT_ID);
+    t_Intervals.pt_Intervals[0].u64_Position = 4;
+    TEST_FAILURE(
+        ITC_Id_newFromIntervals(&t_Intervals, &pt_Id), ITC_STATUS_CORRUPT_ID);
+
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_Intervals));
+    TEST_ASSERT_NULL(t_Intervals.pt_Intervals);
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+
+    /* Test the seed and null IDs */
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_Intervals));
+    TEST_ASSERT_EQUAL(1, t_Intervals.u32_Length);
+    TEST_ASSERT_EQUAL(0, t_Intervals.pt_Intervals[0].u8_Depth);
+    TEST_SUCCESS(ITC_Id_newFromIntervals(&t_Intervals, &pt_OtherId));
+    TEST_ITC_ID_IS_SEED_ID(pt_OtherId);
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_Intervals));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_Intervals));
+    TEST_ASSERT_EQUAL(0, t_Intervals.u32_Length);
+    TEST_SUCCESS(ITC_Id_newFromIntervals(&t_Intervals, &pt_OtherId));
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherId);
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_Intervals));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+#else
+    TEST_IGNORE_MESSAGE("Interval IDs are disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+}
+
+/* Test splitting and summing interval IDs matches splitting and summing IDs */
+void ITC_Id_Test_splitAndSumIntervalIdsMatchesIds(void)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_t *pt_DiscardId;
+    ITC_Id_Intervals_t t_Intervals;
+    ITC_Id_Intervals_t t_Intervals1;
+    ITC_Id_Intervals_t t_Intervals2;
+    ITC_Id_Intervals_t t_SumIntervals;
+
+    /* clang-format off */
+    /* Create a new ((0, 1), (1, 0)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left->pt_Left, pt_Id->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Left->pt_Right, pt_Id->pt_Left));
+
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    /* clang-format on */
+
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_Intervals));
+    TEST_ASSERT_EQUAL(2, t_Intervals.u32_Length);
+
+    /* Test invalid params */
+    TEST_FAILURE(
+        ITC_Id_splitIntervals(&t_Intervals, &t_Intervals1, &t_Intervals1),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Id_sumIntervals(&t_Intervals, &t_Intervals1, &t_Intervals),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Split both representations and test the halves match */
+    TEST_SUCCESS(
+        ITC_Id_splitIntervals(&t_Intervals, &t_Intervals1, &t_Intervals2));
+    TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+    TEST_SUCCESS(ITC_Id_sumIntervals(
+        &t_Intervals1, &t_Intervals2, &t_SumIntervals));
+    checkIdIntervalsMatchId(&t_Intervals1, pt_Id);
+    checkIdIntervalsMatchId(&t_Intervals2, pt_OtherId);
+
+    /* Test summing the halves restores the original interval ID */
+    TEST_FAILURE(
+        ITC_Id_sumIntervals(&t_SumIntervals, &t_Intervals, &t_Intervals1),
+        ITC_STATUS_OVERLAPPING_ID_INTERVAL);
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_OtherId));
+    checkIdIntervalsMatchId(&t_SumIntervals, pt_Id);
+
+    /* Split the single owned subinterval of each half */
+    TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_OtherId, &t_SumIntervals));
+    TEST_SUCCESS(
+        ITC_Id_splitIntervals(&t_SumIntervals, &t_Intervals1, &t_Intervals2));
+    TEST_SUCCESS(ITC_Id_split(&pt_OtherId, &pt_DiscardId));
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_SumIntervals));
+    checkIdIntervalsMatchId(&t_Intervals1, pt_OtherId);
+    checkIdIntervalsMatchId(&t_Intervals2, pt_DiscardId);
+
+    /* Test summing everything back restores the original ID */
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_OtherId));
+    TEST_SUCCESS(ITC_Id_sum(&pt_Id, &pt_DiscardId));
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_SumIntervals));
+    checkIdIntervalsMatchId(&t_SumIntervals, pt_Id);
+
+    /* Test summing with the complementing ((1, 0), (0, 1)) ID coalesces all
+     * subintervals into a seed */
+    t_Intervals1.pt_Intervals = (ITC_Id_Interval_t[]){
+        { .u64_Position = 0, .u8_Depth = 2 },
+        { .u64_Position = 3, .u8_Depth = 2 },
+    };
+    t_Intervals1.u32_Length = 2;
+    TEST_SUCCESS(
+        ITC_Id_sumIntervals(&t_Intervals1, &t_Intervals, &t_SumIntervals));
+    TEST_ASSERT_EQUAL(1, t_SumIntervals.u32_Length);
+    TEST_ASSERT_EQUAL(0, t_SumIntervals.pt_Intervals[0].u8_Depth);
+    TEST_ASSERT_EQUAL(0, t_SumIntervals.pt_Intervals[0].u64_Position);
+
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_Intervals));
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_SumIntervals));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Interval IDs are disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+}
+
+/* Test converting an ID deeper than the interval depth limit fails */
+void ITC_Id_Test_convertTooDeepIdToIntervalsFails(void)
+{
+#if ITC_CONFIG_ENABLE_ID_INTERVALS
+    ITC_Id_t *pt_Id;
+    ITC_Id_t *pt_OtherId;
+    ITC_Id_Intervals_t t_Intervals;
+    ITC_Id_Intervals_t t_Intervals1;
+    ITC_Id_Intervals_t t_Intervals2;
+
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id, NULL));
+
+    /* Keep splitting and keeping the second half until it reaches the depth
+     * limit */
+    for (uint32_t u32_I = 0; u32_I < 63; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+        TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+        pt_Id = pt_OtherId;
+    }
+
+    /* Test the deepest subinterval can't be split as an interval ID */
+    TEST_SUCCESS(ITC_Id_toIntervals(pt_Id, &t_Intervals));
+    TEST_ASSERT_EQUAL(63, t_Intervals.pt_Intervals[0].u8_Depth);
+    TEST_ASSERT_EQUAL(
+        UINT64_MAX >> 1, t_Intervals.pt_Intervals[0].u64_Position);
+    TEST_FAILURE(
+        ITC_Id_splitIntervals(&t_Intervals, &t_Intervals1, &t_Intervals2),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+    TEST_SUCCESS(ITC_Id_destroyIntervals(&t_Intervals));
+
+    TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+    TEST_FAILURE(
+        ITC_Id_toIntervals(pt_Id, &t_Intervals),
+        ITC_STATUS_INSUFFICIENT_RESOURCES);
+
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+#else
+    TEST_IGNORE_MESSAGE("Interval IDs are disabled");
+#endif /* ITC_CONFIG_ENABLE_ID_INTERVALS */
+}
@@ -1465,6 +1465,477 @@ void ITC_SerDes_Test_deserialiseParentEventSuccessful(void)
     TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
 }
 
+/* Test serialising and deserialising a path-compressed ID succeeds */
+void ITC_SerDes_Test_serialiseAndDeserialisePathCompressedIdSuccessful(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    ITC_Id_t *pt_Id = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Serialised (0, ((0, 1), 0)) ID */
+    uint8_t ru8_ExpectedIdSerialisedData[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_PATH_ID_HEADER,
+        3, /* The path length */
+        0x05U, /* Right, left, right */
+        ITC_SERDES_SEED_ID_HEADER,
+    };
+
+    /* clang-format off */
+    /* Create a new (0, ((0, 1), 0)) ID */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Left, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right, pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left, pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Left->pt_Left, pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Id->pt_Right->pt_Left->pt_Right, pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Id->pt_Right->pt_Right, pt_Id->pt_Right));
+    /* clang-format on */
+
+    /* Serialise the ID */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_serialiseId(
+            pt_Id,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedIdSerialisedData), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedIdSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedIdSerialisedData));
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Test deserialising the ID */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            true,
+            &pt_Id));
+
+    /* Test this is a (0, ((0, 1), 0)) ID */
+    TEST_ITC_ID_IS_NULL_ID(pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NOT_LEAF_ID(pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_Id->pt_Right->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_Id->pt_Right->pt_Right);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is disabled");
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
+/* Test serialising and deserialising a deep path-compressed ID succeeds */
+void ITC_SerDes_Test_serialiseAndDeserialiseDeepPathCompressedIdSuccessful(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Id_t *pt_OtherId = NULL;
+    uint8_t ru8_Buffer[64] = { 0 };
+    uint8_t ru8_OtherBuffer[64] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint32_t u32_OtherBufferSize = sizeof(ru8_OtherBuffer);
+
+    /* Create a ((((1, 0), 0) ...), 0) ID, 300 levels deep, by repeatedly
+     * splitting the ID and discarding its right half */
+    TEST_SUCCESS(ITC_Id_newSeed(&pt_Id));
+    for (uint32_t u32_I = 0; u32_I < 300; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Id_split(&pt_Id, &pt_OtherId));
+        TEST_SUCCESS(ITC_Id_destroy(&pt_OtherId));
+    }
+
+    /* Serialise the ID */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_serialiseId(
+            pt_Id,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true));
+
+    /* Test the ID was serialised as a 255 and a 45 node long path, followed
+     * by the seed leaf */
+    TEST_ASSERT_EQUAL(1 + (2 + 32) + (2 + 6) + 1, u32_BufferSize);
+    TEST_ASSERT_EQUAL(ITC_SERDES_PATH_ID_HEADER, ru8_Buffer[1]);
+    TEST_ASSERT_EQUAL(255, ru8_Buffer[2]);
+    TEST_ASSERT_EQUAL(ITC_SERDES_PATH_ID_HEADER, ru8_Buffer[35]);
+    TEST_ASSERT_EQUAL(45, ru8_Buffer[36]);
+    TEST_ASSERT_EQUAL(ITC_SERDES_SEED_ID_HEADER, ru8_Buffer[43]);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+
+    /* Test deserialising the ID */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            true,
+            &pt_Id));
+
+    /* Test serialising the deserialised ID produces the same data */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_serialiseId(
+            pt_Id,
+            &ru8_OtherBuffer[0],
+            &u32_OtherBufferSize,
+            true));
+    TEST_ASSERT_EQUAL(u32_BufferSize, u32_OtherBufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_Buffer[0],
+        &ru8_OtherBuffer[0],
+        u32_BufferSize);
+
+    /* Destroy the ID */
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Id));
+#else
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is disabled");
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
+/* Test deserialising a path-compressed ID fails with corrupt ID */
+void ITC_SerDes_Test_deserialisePathCompressedIdFailWithCorruptId(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    ITC_Id_t *pt_Id = NULL;
+    /* A 0 length path */
+    uint8_t ru8_EmptyPathBuffer[] = {
+        ITC_SERDES_PATH_ID_HEADER,
+        0,
+        ITC_SERDES_SEED_ID_HEADER,
+    };
+    /* A path missing its bitmap */
+    uint8_t ru8_TruncatedPathBuffer[] = {
+        ITC_SERDES_SEED_ID_HEADER,
+        ITC_SERDES_PATH_ID_HEADER,
+        9,
+        0x01U,
+        ITC_SERDES_SEED_ID_HEADER,
+    };
+    /* A path not followed by any other node */
+    uint8_t ru8_DanglingPathBuffer[] = {
+        ITC_SERDES_PATH_ID_HEADER,
+        1,
+        0x01U,
+    };
+    /* A path ending in a null ID, i.e. a non-normalised (0, 0) ID */
+    uint8_t ru8_NullPathBuffer[] = {
+        ITC_SERDES_PATH_ID_HEADER,
+        2,
+        0x01U,
+        ITC_SERDES_NULL_ID_HEADER,
+    };
+
+    /* Test deserialising the invalid IDs */
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_EmptyPathBuffer[0],
+            sizeof(ru8_EmptyPathBuffer),
+            false,
+            &pt_Id),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_TruncatedPathBuffer[1],
+            sizeof(ru8_TruncatedPathBuffer) - 1,
+            false,
+            &pt_Id),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_DanglingPathBuffer[0],
+            sizeof(ru8_DanglingPathBuffer),
+            false,
+            &pt_Id),
+        ITC_STATUS_CORRUPT_ID);
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_NullPathBuffer[0],
+            sizeof(ru8_NullPathBuffer),
+            false,
+            &pt_Id),
+        ITC_STATUS_CORRUPT_ID);
+#else
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is disabled");
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
+/* Test serialising and deserialising a path-compressed Event succeeds */
+void ITC_SerDes_Test_serialiseAndDeserialisePathCompressedEventSuccessful(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    ITC_Event_t *pt_Event = NULL;
+    uint8_t ru8_Buffer[10] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    /* Serialised (0, 0, (0, (0, 0, 1), 0)) Event */
+    uint8_t ru8_ExpectedEventSerialisedData[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_PATH_EVENT_HEADER,
+        3, /* The path length */
+        0x05U, /* Right, left, right */
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+
+    /* clang-format off */
+    /* Create a new (0, 0, (0, (0, 0, 1), 0)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event, NULL, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Left, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right, pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left, pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Left, pt_Event->pt_Right->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Left->pt_Right, pt_Event->pt_Right->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Event->pt_Right->pt_Right, pt_Event->pt_Right, 0));
+    /* clang-format on */
+
+    /* Serialise the Event */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_serialiseEvent(
+            pt_Event,
+            &ru8_Buffer[0],
+            &u32_BufferSize,
+            true));
+
+    /* Test the serialised data is what is expected */
+    TEST_ASSERT_EQUAL(
+        sizeof(ru8_ExpectedEventSerialisedData), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedEventSerialisedData[0],
+        &ru8_Buffer[0],
+        sizeof(ru8_ExpectedEventSerialisedData));
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+
+    /* Test deserialising the Event */
+    TEST_SUCCESS(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_Buffer[0],
+            u32_BufferSize,
+            true,
+            &pt_Event));
+
+    /* clang-format off */
+    /* Test this is a (0, 0, (0, (0, 0, 1), 0)) Event */
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Left, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Right, 0);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Event->pt_Right->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Left->pt_Left, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Left->pt_Right, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Event->pt_Right->pt_Right, 0);
+    /* clang-format on */
+
+    /* Destroy the Event */
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Event));
+#else
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is disabled");
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
+/* Test deserialising a path-compressed Event fails with corrupt Event */
+void ITC_SerDes_Test_deserialisePathCompressedEventFailWithCorruptEvent(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    ITC_Event_t *pt_Event = NULL;
+    /* A 0 length path */
+    uint8_t ru8_EmptyPathBuffer[] = {
+        ITC_SERDES_PATH_EVENT_HEADER,
+        0,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+    /* A path not followed by any other node */
+    uint8_t ru8_DanglingPathBuffer[] = {
+        ITC_SERDES_PATH_EVENT_HEADER,
+        1,
+        0x01U,
+    };
+    /* A path header with other header bits set */
+    uint8_t ru8_InvalidHeaderBuffer[] = {
+        ITC_SERDES_PATH_EVENT_HEADER | ITC_SERDES_CREATE_EVENT_HEADER(true, 0),
+        1,
+        0x01U,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Test deserialising the invalid Events */
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_EmptyPathBuffer[0],
+            sizeof(ru8_EmptyPathBuffer),
+            false,
+            &pt_Event),
+        ITC_STATUS_CORRUPT_EVENT);
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_DanglingPathBuffer[0],
+            sizeof(ru8_DanglingPathBuffer),
+            false,
+            &pt_Event),
+        ITC_STATUS_CORRUPT_EVENT);
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_InvalidHeaderBuffer[0],
+            sizeof(ru8_InvalidHeaderBuffer),
+            false,
+            &pt_Event),
+        ITC_STATUS_CORRUPT_EVENT);
+#else
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is disabled");
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
+/* Test serialising and deserialising a path-compressed Stamp succeeds */
+void ITC_SerDes_Test_serialiseAndDeserialisePathCompressedStampSuccessful(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[32] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+#if !ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET && !ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+    bool b_WasCompacted;
+#endif /* !ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET && !ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+
+    /* Test Stamps without paths are not marked as path-compressed */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_FALSE(
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN] &
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Create a Stamp with a (0, ((0, 1), 0)) ID and a
+     * (0, 0, (0, (0, 0, (1, 0, 1)), 0)) Event */
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Stamp->pt_Id));
+
+    /* clang-format off */
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id, NULL));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right->pt_Left, pt_Stamp->pt_Id->pt_Right));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right->pt_Left->pt_Left, pt_Stamp->pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Right->pt_Left->pt_Right, pt_Stamp->pt_Id->pt_Right->pt_Left));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right->pt_Right, pt_Stamp->pt_Id->pt_Right));
+
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right->pt_Left, pt_Stamp->pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right->pt_Right, pt_Stamp->pt_Event->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Left, pt_Stamp->pt_Event->pt_Right->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, pt_Stamp->pt_Event->pt_Right->pt_Left, 1));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right->pt_Left, pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right->pt_Right, pt_Stamp->pt_Event->pt_Right->pt_Left->pt_Right, 1));
+    /* clang-format on */
+
+    /* Serialise the Stamp */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+
+    /* Test the Stamp is marked as path-compressed */
+    TEST_ASSERT_TRUE(
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN] &
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK);
+    TEST_ASSERT_EQUAL(
+        ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK,
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t)]);
+
+    /* Test deserialising the Stamp */
+    TEST_SUCCESS(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], u32_BufferSize, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+#if !ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET && !ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+
+    /* Test the size budget accounts for the Stamp extension */
+    for (uint32_t u32_I = 0; u32_I < 2; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OtherStamp));
+        TEST_SUCCESS(
+            ITC_Stamp_compactIfOverBudget(
+                pt_OtherStamp, 0, u32_BufferSize - u32_I, &b_WasCompacted));
+        TEST_ASSERT_EQUAL(u32_I == 1, b_WasCompacted);
+        TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    }
+#endif /* !ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET && !ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is disabled");
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
+/* Test deserialising path-compressed data fails with unsupported format if
+ * path-compressed serialisation is disabled */
+void ITC_SerDes_Test_deserialisePathCompressedDataFailWithUnsupportedFormat(void)
+{
+#if ITC_CONFIG_USE_PATH_COMPRESSED_SERDES
+    TEST_IGNORE_MESSAGE("Path-compressed serialisation is enabled");
+#else
+    ITC_Id_t *pt_Id = NULL;
+    ITC_Event_t *pt_Event = NULL;
+    ITC_Stamp_t *pt_Stamp = NULL;
+    /* A serialised (0, (0, 1)) ID */
+    uint8_t ru8_IdBuffer[] = {
+        ITC_SERDES_PATH_ID_HEADER,
+        2,
+        0x03U,
+        ITC_SERDES_SEED_ID_HEADER,
+    };
+    /* A serialised (0, 0, (0, 0, 1)) Event */
+    uint8_t ru8_EventBuffer[] = {
+        ITC_SERDES_PATH_EVENT_HEADER,
+        2,
+        0x03U,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+    /* A serialised Stamp marked as path-compressed */
+    uint8_t ru8_StampBuffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(1, 1) |
+            ITC_SERDES_STAMP_HAS_EXTENSION_MASK,
+        ITC_SERDES_STAMP_EXT_IS_PATH_COMPRESSED_MASK,
+        4,
+        ITC_SERDES_PATH_ID_HEADER,
+        2,
+        0x03U,
+        ITC_SERDES_SEED_ID_HEADER,
+        1,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 0),
+    };
+
+    /* Test deserialising the path-compressed data */
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseId(
+            &ru8_IdBuffer[0], sizeof(ru8_IdBuffer), false, &pt_Id),
+        ITC_STATUS_SERDES_UNSUPPORTED_FORMAT);
+    TEST_FAILURE(
+        ITC_SerDes_Util_deserialiseEvent(
+            &ru8_EventBuffer[0], sizeof(ru8_EventBuffer), false, &pt_Event),
+        ITC_STATUS_SERDES_UNSUPPORTED_FORMAT);
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_StampBuffer[0], sizeof(ru8_StampBuffer), &pt_Stamp),
+        ITC_STATUS_SERDES_UNSUPPORTED_FORMAT);
+#endif /* ITC_CONFIG_USE_PATH_COMPRESSED_SERDES */
+}
+
 /* Test serialising a Stamp fails with invalid param */
 void ITC_SerDes_Test_serialiseStampFailInvalidParam(void)
 {
@@ -1570,7 +2041,7 @@ void ITC_SerDes_Test_serialiseStampFailWithInsufficentResources(void)
     uint32_t u32_BufferSize = sizeof(ru8_Buffer);
 
     /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* Make the event a parent */
     TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 1));
@@ -1650,11 +2121,11 @@ void ITC_SerDes_Test_serialiseStampWithParentComponentsSuccessful(void)
     };
 
     /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* clang-format off */
     /* Add nodes to the ID component */
-    pt_Stamp->pt_Id->b_IsOwner = false;
+    ITC_ID_SET_OWNER(pt_Stamp->pt_Id, false);
     TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
     TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
 
@@ -1682,6 +2153,148 @@ void ITC_SerDes_Test_serialiseStampWithParentComponentsSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
 }
 
+/* Test calculating the serialised size of an ID and an Event succeeds */
+void ITC_SerDes_Test_getSerialisedIdAndEventSizeSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+    uint8_t ru8_Buffer[32] = { 0 };
+    uint32_t u32_BufferSize;
+    uint32_t u32_Size;
+
+    /* Create a Stamp with a (1, 0) ID and a (0, (0, 0, 2), 2) Event */
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
+
+    /* clang-format off */
+    ITC_ID_SET_OWNER(pt_Stamp->pt_Id, false);
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left->pt_Left, pt_Stamp->pt_Event->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left->pt_Right, pt_Stamp->pt_Event->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 2));
+    /* clang-format on */
+
+    /* Test invalid params are handled properly */
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedIdSize(pt_Stamp->pt_Id, false, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedIdSize(NULL, false, &u32_Size),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedEventSize(pt_Stamp->pt_Event, false, NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_Util_getSerialisedEventSize(NULL, false, &u32_Size),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test the sizes match the serialised data, with and without a version */
+    for (uint32_t u32_I = 0; u32_I < 2; u32_I++)
+    {
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_Util_serialiseId(
+                pt_Stamp->pt_Id,
+                &ru8_Buffer[0],
+                &u32_BufferSize,
+                u32_I == 1));
+        TEST_SUCCESS(
+            ITC_SerDes_Util_getSerialisedIdSize(
+                pt_Stamp->pt_Id, u32_I == 1, &u32_Size));
+        TEST_ASSERT_EQUAL(u32_BufferSize, u32_Size);
+
+        u32_BufferSize = sizeof(ru8_Buffer);
+        TEST_SUCCESS(
+            ITC_SerDes_Util_serialiseEvent(
+                pt_Stamp->pt_Event,
+                &ru8_Buffer[0],
+                &u32_BufferSize,
+                u32_I == 1));
+        TEST_SUCCESS(
+            ITC_SerDes_Util_getSerialisedEventSize(
+                pt_Stamp->pt_Event, u32_I == 1, &u32_Size));
+        TEST_ASSERT_EQUAL(u32_BufferSize, u32_Size);
+    }
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a Stamp for persisting it fails with invalid param */
+void ITC_SerDes_Test_persistStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Dummy = NULL;
+    uint8_t ru8_Buffer[10];
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    TEST_FAILURE(
+        ITC_SerDes_persistStamp(pt_Dummy, &ru8_Buffer[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_persistStamp(NULL, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_persistStamp(pt_Dummy, NULL, &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test serialising a Stamp for persisting it succeeds */
+void ITC_SerDes_Test_persistStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp = NULL;
+    ITC_Stamp_t *pt_ExpectedStamp = NULL;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[32] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+    uint8_t ru8_ExpectedBuffer[32] = { 0 };
+    uint32_t u32_ExpectedBufferSize = sizeof(ru8_ExpectedBuffer);
+    bool b_WasCompacted;
+
+    /* Create a Stamp with a (1, 0) ID and a (0, (0, 0, 2), 2) Event */
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
+
+    /* clang-format off */
+    ITC_ID_SET_OWNER(pt_Stamp->pt_Id, false);
+    TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left, pt_Stamp->pt_Event, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left->pt_Left, pt_Stamp->pt_Event->pt_Left, 0));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Left->pt_Right, pt_Stamp->pt_Event->pt_Left, 2));
+    TEST_SUCCESS(ITC_TestUtil_newEvent(&pt_Stamp->pt_Event->pt_Right, pt_Stamp->pt_Event, 2));
+    /* clang-format on */
+
+    /* Persisting compacts the Stamp exactly when the configured budgets do */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_ExpectedStamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(
+            pt_ExpectedStamp, 0, 0, &b_WasCompacted));
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(
+            pt_ExpectedStamp,
+            &ru8_ExpectedBuffer[0],
+            &u32_ExpectedBufferSize));
+
+    /* Serialise the Stamp for persisting it */
+    TEST_SUCCESS(
+        ITC_SerDes_persistStamp(pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+
+    /* Test the Stamp and the serialised data are what is expected */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_ExpectedStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_ASSERT_EQUAL(u32_ExpectedBufferSize, u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedBuffer[0], &ru8_Buffer[0], u32_ExpectedBufferSize);
+#if !ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET && !ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+    /* Nothing is compacted without any configured budgets */
+    TEST_ASSERT_FALSE(b_WasCompacted);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+#endif /* !ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET && !ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_ExpectedStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
 /* Test serialising a Stamp to string fails with invalid param */
 void ITC_SerDes_Test_serialiseStampToStringFailInvalidParam(void)
 {
@@ -1768,7 +2381,7 @@ void ITC_SerDes_Test_serialiseStampToStringWithLeafIdAndEventSuccessful(void)
     memset(&rc_Buffer[0], 0xAA, sizeof(rc_Buffer));
 
     /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* Serialise the Stamp to string */
     TEST_SUCCESS(
@@ -1790,6 +2403,7 @@ void ITC_SerDes_Test_serialiseStampToStringWithLeafIdAndEventSuccessful(void)
 
     /* Make the Event component bigger */
     pt_Stamp->pt_Event->t_Count = 12;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Stamp->pt_Event);
 
     /* Reset the buffer size */
     u32_BufferSize = sizeof(rc_Buffer);
@@ -1874,11 +2488,11 @@ void ITC_SerDes_Test_serialiseStampToStringWithParentComponentsSuccessful(void)
     memset(&rc_Buffer[0], 0xAA, sizeof(rc_Buffer));
 
     /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* clang-format off */
     /* Add nodes to the ID component */
-    pt_Stamp->pt_Id->b_IsOwner = false;
+    ITC_ID_SET_OWNER(pt_Stamp->pt_Id, false);
     TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
     TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
 
@@ -1932,11 +2546,11 @@ void ITC_SerDes_Test_serialiseStampToStringWithParentComponentsFailWithInsuffice
 #endif /* ITC_CONFIG_USE_64BIT_EVENT_COUNTERS */
 
     /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* clang-format off */
     /* Add nodes to the ID component */
-    pt_Stamp->pt_Id->b_IsOwner = false;
+    ITC_ID_SET_OWNER(pt_Stamp->pt_Id, false);
     TEST_SUCCESS(ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
     TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
 
@@ -2231,3 +2845,359 @@ void ITC_SerDes_Test_deserialiseParentStampSuccessful(void)
     /* Destroy the Stamp */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
 }
+
+/* Test serialising a Stamp delta fails with invalid param */
+void ITC_SerDes_Test_serialiseStampDeltaFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_Stamp;
+    uint8_t ru8_Buffer[ITC_SERDES_STAMP_MIN_BUFFER_LEN + 16] = { 0 };
+    uint32_t u32_BufferSize = sizeof(ru8_Buffer);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Base));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Base, &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Base));
+
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampDelta(
+            pt_Base, pt_Stamp, NULL, &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampDelta(
+            pt_Base, pt_Stamp, &ru8_Buffer[0], NULL),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampDelta(
+            NULL, pt_Stamp, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+
+    /* Test a delta cannot describe a Stamp older than its base */
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampDelta(
+            pt_Base, pt_Stamp, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising a Stamp delta and applying it to its base succeeds */
+void ITC_SerDes_Test_serialiseAndApplyStampDeltaSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp1;
+    ITC_Stamp_t *pt_OtherStamp2;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_AppliedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[128] = { 0 };
+    uint32_t u32_BufferSize;
+    uint32_t u32_DeltaBufferSize;
+
+    /* Build up some history in different parts of the Event tree */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp1));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp2));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp1));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp1));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp2));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_OtherStamp1, &pt_OtherStamp2));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp1));
+
+    /* The peer knows `pt_OtherStamp1`. Then it advances a little further */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OtherStamp1, &pt_Base));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp1));
+
+    /* Get the size of the full Stamp */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+        pt_OtherStamp1, &ru8_Buffer[0], &u32_BufferSize));
+
+    /* Test the delta is smaller than the full Stamp */
+    u32_DeltaBufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStampDelta(
+        pt_Base, pt_OtherStamp1, &ru8_Buffer[0], &u32_DeltaBufferSize));
+    TEST_ASSERT_LESS_THAN(u32_BufferSize, u32_DeltaBufferSize);
+
+    /* Test a delta cannot be deserialised as a full Stamp */
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], u32_DeltaBufferSize, &pt_AppliedStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    /* Test applying the delta recovers the Stamp */
+    TEST_SUCCESS(ITC_SerDes_applyStampDelta(
+        pt_Base, &ru8_Buffer[0], u32_DeltaBufferSize, &pt_AppliedStamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_AppliedStamp, pt_OtherStamp1, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_AppliedStamp));
+
+    /* Test the ID is carried by the delta */
+    TEST_SUCCESS(ITC_Stamp_join(&pt_OtherStamp1, &pt_Stamp));
+    u32_DeltaBufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStampDelta(
+        pt_Base, pt_OtherStamp1, &ru8_Buffer[0], &u32_DeltaBufferSize));
+    TEST_SUCCESS(ITC_SerDes_applyStampDelta(
+        pt_Base, &ru8_Buffer[0], u32_DeltaBufferSize, &pt_AppliedStamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_AppliedStamp->pt_Id);
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_AppliedStamp, pt_OtherStamp1, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_AppliedStamp));
+
+    /* Test a full Stamp cannot be applied as a delta */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+        pt_OtherStamp1, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_FAILURE(
+        ITC_SerDes_applyStampDelta(
+            pt_Base, &ru8_Buffer[0], u32_BufferSize, &pt_AppliedStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp1));
+}
+
+/* Test a Stamp delta only holds the rebased Event and omits an unchanged ID */
+void ITC_SerDes_Test_serialiseStampDeltaRebasesEventAndOmitsUnchangedId(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_AppliedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[32] = { 0 };
+    uint32_t u32_BufferSize;
+    /* A serialised delta of a single new event, without the ID component */
+    uint8_t ru8_ExpectedDeltaBuffer[] = {
+        ITC_VERSION_MAJOR, /* Provided by build system c args */
+        ITC_SERDES_CREATE_STAMP_HEADER(0, 1) | ITC_SERDES_STAMP_IS_DELTA_MASK,
+        2,
+        ITC_SERDES_CREATE_EVENT_HEADER(false, 1),
+        1,
+    };
+
+    /* Build up a counter which needs more than 1 byte */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    for (uint32_t u32_I = 0; u32_I < 300; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    }
+
+    /* The peer knows `pt_Stamp`. Then it advances by a single event */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_Base));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Test the delta only holds the new event */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStampDelta(
+        pt_Base, pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_EQUAL(sizeof(ru8_ExpectedDeltaBuffer), u32_BufferSize);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &ru8_ExpectedDeltaBuffer[0], &ru8_Buffer[0], u32_BufferSize);
+
+    /* Test applying the delta adds the event to the base and takes the ID
+     * of the base */
+    TEST_SUCCESS(ITC_SerDes_applyStampDelta(
+        pt_Base, &ru8_Buffer[0], u32_BufferSize, &pt_AppliedStamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_AppliedStamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_AppliedStamp->pt_Event, 301);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_AppliedStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_AppliedStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test serialising and deserialising rebased Stamps carries the rebase base
+ * ID */
+void ITC_SerDes_Test_serialiseAndDeserialiseRebasedStampSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_DeserialisedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[64] = { 0 };
+    uint32_t u32_BufferSize;
+    uint32_t u32_BaseIdOffset =
+        ITC_VERSION_MAJOR_LEN + (2 * sizeof(ITC_SerDes_Header_t));
+    uint64_t u64_RebaseBaseId = 0;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_Base));
+
+    /* Test Stamps which were never rebased do not carry a base ID */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+        pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_FALSE(
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN] &
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK);
+
+    /* Rebase the Stamp */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_Base));
+
+    /* Test the base ID follows the Stamp extension header in network-endian */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+        pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_TRUE(
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN] &
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK);
+    TEST_ASSERT_EQUAL(
+        ITC_SERDES_STAMP_EXT_HAS_REBASE_BASE_ID_MASK,
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t)]);
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+         u32_I++)
+    {
+        u64_RebaseBaseId =
+            (u64_RebaseBaseId << 8U) | ru8_Buffer[u32_BaseIdOffset + u32_I];
+    }
+    TEST_ASSERT_EQUAL(pt_Stamp->u64_RebaseBaseId, u64_RebaseBaseId);
+
+    /* Test the base ID is deserialised */
+    TEST_SUCCESS(ITC_SerDes_deserialiseStamp(
+        &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp));
+    TEST_ASSERT_EQUAL(
+        pt_Stamp->u64_RebaseBaseId, pt_DeserialisedStamp->u64_RebaseBaseId);
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_DeserialisedStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_DeserialisedStamp));
+
+    /* Test a truncated base ID is rejected */
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0],
+            u32_BaseIdOffset + ITC_SERDES_STAMP_REBASE_BASE_ID_LEN - 1,
+            &pt_DeserialisedStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    /* Test a flagged `0` base ID is rejected */
+    for (uint32_t u32_I = 0;
+         u32_I < ITC_SERDES_STAMP_REBASE_BASE_ID_LEN;
+         u32_I++)
+    {
+        ru8_Buffer[u32_BaseIdOffset + u32_I] = 0;
+    }
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    /* Test deltas against a base with a different base ID are rejected */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampDelta(
+            pt_Base, pt_Stamp, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_MISMATCHED_STAMP_BASE);
+
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStampDelta(
+        pt_Base, pt_Base, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_FAILURE(
+        ITC_SerDes_applyStampDelta(
+            pt_Stamp, &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp),
+        ITC_STATUS_MISMATCHED_STAMP_BASE);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Stamp rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+}
+
+/* Test serialising and deserialising Stamps carries the Stamp epoch */
+void ITC_SerDes_Test_serialiseAndDeserialiseStampEpochSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_DeserialisedStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint8_t ru8_Buffer[64] = { 0 };
+    uint32_t u32_BufferSize;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_Base));
+
+    /* Test Stamps of the first epoch do not carry an epoch */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+        pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_FALSE(
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN] &
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK);
+
+    /* Reseed the Stamp */
+    TEST_SUCCESS(ITC_Stamp_reseedEpoch(pt_Stamp, 0x1234, 0, 1));
+
+    /* Test the epoch follows the Stamp extension header */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStamp(
+        pt_Stamp, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_ASSERT_TRUE(
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN] &
+        ITC_SERDES_STAMP_HAS_EXTENSION_MASK);
+    TEST_ASSERT_EQUAL(
+        2, ru8_Buffer[ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t)]);
+    TEST_ASSERT_EQUAL(
+        0x12,
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN + (2 * sizeof(ITC_SerDes_Header_t))]);
+    TEST_ASSERT_EQUAL(
+        0x34,
+        ru8_Buffer[ITC_VERSION_MAJOR_LEN + (3 * sizeof(ITC_SerDes_Header_t))]);
+
+    /* Test the epoch is deserialised */
+    TEST_SUCCESS(ITC_SerDes_deserialiseStamp(
+        &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp));
+    TEST_ASSERT_EQUAL(0x1234, pt_DeserialisedStamp->u32_Epoch);
+    TEST_SUCCESS(
+        ITC_Stamp_compare(pt_DeserialisedStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_DeserialisedStamp));
+
+    /* Test an empty extension header is rejected */
+    ru8_Buffer[ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t)] = 0;
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    /* Test an oversized epoch is rejected */
+    ru8_Buffer[ITC_VERSION_MAJOR_LEN + sizeof(ITC_SerDes_Header_t)] =
+        sizeof(uint32_t) + 1;
+    TEST_FAILURE(
+        ITC_SerDes_deserialiseStamp(
+            &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp),
+        ITC_STATUS_CORRUPT_STAMP);
+
+    /* Test deltas against a base of a different epoch are rejected */
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_FAILURE(
+        ITC_SerDes_serialiseStampDelta(
+            pt_Base, pt_Stamp, &ru8_Buffer[0], &u32_BufferSize),
+        ITC_STATUS_MISMATCHED_STAMP_EPOCH);
+
+    u32_BufferSize = sizeof(ru8_Buffer);
+    TEST_SUCCESS(ITC_SerDes_serialiseStampDelta(
+        pt_Base, pt_Base, &ru8_Buffer[0], &u32_BufferSize));
+    TEST_FAILURE(
+        ITC_SerDes_applyStampDelta(
+            pt_Stamp, &ru8_Buffer[0], u32_BufferSize, &pt_DeserialisedStamp),
+        ITC_STATUS_MISMATCHED_STAMP_EPOCH);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Stamp epochs are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+}
@@ -0,0 +1,360 @@
+/**
+ * @file ITC_StabilityTracker_Test.c
+ * @brief Unit tests for the Interval Tree Clock's causal stability tracker
+ *
+ * @copyright Copyright (c) 2024 libitc project. Released under AGPL-3.0
+ * license. Refer to the LICENSE file for details or visit:
+ * https://www.gnu.org/licenses/agpl-3.0.en.html
+ *
+ */
+#include "ITC_StabilityTracker.h"
+#include "ITC_StabilityTracker_Test.h"
+
+#include "ITC_Event_package.h"
+#include "ITC_Stamp.h"
+
+#include "ITC_Test_package.h"
+#include "ITC_TestUtil.h"
+#include "ITC_config.h"
+
+/******************************************************************************
+ *  Private functions
+ ******************************************************************************/
+
+/**
+ * @brief Check the stable frontier of a tracker is the meet of the given
+ * Stamps
+ *
+ * @param pt_Tracker The tracker
+ * @param ppt_Stamps The latest Stamp of each peer
+ * @param u32_StampsLength The number of peers
+ */
+static void checkFrontier(
+    const ITC_StabilityTracker_t *const pt_Tracker,
+    ITC_Stamp_t *const *const ppt_Stamps,
+    const uint32_t u32_StampsLength
+)
+{
+    const ITC_Event_t *rpt_Events[8];
+    ITC_Event_t *pt_MetEvent;
+    bool b_IsLeq;
+    uint32_t u32_I;
+
+    TEST_ASSERT_LESS_OR_EQUAL(ARRAY_COUNT(rpt_Events), u32_StampsLength);
+
+    for (u32_I = 0; u32_I < u32_StampsLength; u32_I++)
+    {
+        rpt_Events[u32_I] = ppt_Stamps[u32_I]->pt_Event;
+    }
+
+    TEST_SUCCESS(
+        ITC_Event_meetMany(rpt_Events, u32_StampsLength, &pt_MetEvent));
+
+    /* Test the frontier matches the meet computed from scratch */
+    TEST_SUCCESS(
+        ITC_Event_leq(pt_MetEvent, pt_Tracker->ppt_Nodes[1], &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+    TEST_SUCCESS(
+        ITC_Event_leq(pt_Tracker->ppt_Nodes[1], pt_MetEvent, &b_IsLeq));
+    TEST_ASSERT_TRUE(b_IsLeq);
+
+    TEST_SUCCESS(ITC_Event_destroy(&pt_MetEvent));
+}
+
+/******************************************************************************
+ *  Public functions
+ ******************************************************************************/
+
+/* Init test */
+void setUp(void) {}
+
+/* Fini test */
+void tearDown(void) {}
+
+/* Test creating a tracker fails with invalid param */
+void ITC_StabilityTracker_Test_newTrackerFailInvalidParam(void)
+{
+    ITC_StabilityTracker_t *pt_Tracker = NULL;
+
+    TEST_FAILURE(ITC_StabilityTracker_new(1, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_new(0, &pt_Tracker), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_new(
+            ITC_STABILITY_TRACKER_MAX_PEERS + 1, &pt_Tracker),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_NULL(pt_Tracker);
+}
+
+/* Test destroying a tracker fails with invalid param */
+void ITC_StabilityTracker_Test_destroyTrackerFailInvalidParam(void)
+{
+    TEST_FAILURE(ITC_StabilityTracker_destroy(NULL), ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test creating and destroying a tracker succeeds */
+void ITC_StabilityTracker_Test_newAndDestroyTrackerSucceeds(void)
+{
+    ITC_StabilityTracker_t *pt_Tracker = NULL;
+    uint32_t u32_PeersLength;
+
+    for (u32_PeersLength = 1; u32_PeersLength <= 9; u32_PeersLength++)
+    {
+        TEST_SUCCESS(ITC_StabilityTracker_new(u32_PeersLength, &pt_Tracker));
+        TEST_ASSERT_EQUAL(u32_PeersLength, pt_Tracker->u32_PeersLength);
+        TEST_ASSERT_GREATER_OR_EQUAL(
+            u32_PeersLength, pt_Tracker->u32_LeavesOffset);
+        TEST_ASSERT_LESS_THAN(
+            u32_PeersLength << 1U, pt_Tracker->u32_LeavesOffset);
+        /* Test the initial frontier is a `0` Event */
+        TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Tracker->ppt_Nodes[1], 0);
+        TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+        TEST_ASSERT_NULL(pt_Tracker);
+    }
+
+    /* Test destroying an already destroyed tracker succeeds */
+    TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+}
+
+/* Test updating a tracker fails with invalid param */
+void ITC_StabilityTracker_Test_updateTrackerFailInvalidParam(void)
+{
+    ITC_StabilityTracker_t *pt_Tracker;
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_StabilityTracker_new(3, &pt_Tracker));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_StabilityTracker_update(NULL, 0, pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_update(pt_Tracker, 3, pt_Stamp),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_update(pt_Tracker, 0, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+}
+
+/* Test checking the stability of a Stamp fails with invalid param */
+void ITC_StabilityTracker_Test_isStableFailInvalidParam(void)
+{
+    ITC_StabilityTracker_t *pt_Tracker;
+    ITC_Stamp_t *pt_Stamp;
+    bool b_IsStable;
+
+    TEST_SUCCESS(ITC_StabilityTracker_new(3, &pt_Tracker));
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_StabilityTracker_isStable(NULL, pt_Stamp, &b_IsStable),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_isStable(pt_Tracker, NULL, &b_IsStable),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_isStable(pt_Tracker, pt_Stamp, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+}
+
+/* Test getting the stable frontier fails with invalid param */
+void ITC_StabilityTracker_Test_getFrontierFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_StabilityTracker_t *pt_Tracker;
+    ITC_Event_t *pt_Frontier;
+
+    TEST_SUCCESS(ITC_StabilityTracker_new(3, &pt_Tracker));
+
+    TEST_FAILURE(
+        ITC_StabilityTracker_getFrontier(NULL, &pt_Frontier),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_StabilityTracker_getFrontier(pt_Tracker, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+#else
+    TEST_IGNORE_MESSAGE("Extended API support is disabled");
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+}
+
+/* Test a Stamp becomes stable once all peers have seen it */
+void ITC_StabilityTracker_Test_stampBecomesStableOnceSeenByAllPeers(void)
+{
+    ITC_StabilityTracker_t *pt_Tracker;
+    ITC_Stamp_t *rpt_Stamps[3];
+    ITC_Stamp_t *pt_StaleStamp;
+    ITC_Stamp_t *pt_PeekStamp;
+    bool b_IsStable;
+    uint32_t u32_I;
+
+    /* Fork a seed Stamp into 3 peers */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[1], &rpt_Stamps[2]));
+
+    TEST_SUCCESS(ITC_StabilityTracker_new(3, &pt_Tracker));
+
+    /* Test the seed history is stable */
+    TEST_SUCCESS(
+        ITC_StabilityTracker_isStable(pt_Tracker, rpt_Stamps[0], &b_IsStable));
+    TEST_ASSERT_TRUE(b_IsStable);
+
+    /* Add an event on the first peer */
+    TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[0], &pt_StaleStamp));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_StabilityTracker_update(pt_Tracker, 0, rpt_Stamps[0]));
+    checkFrontier(pt_Tracker, rpt_Stamps, 3);
+
+    TEST_SUCCESS(
+        ITC_StabilityTracker_isStable(pt_Tracker, rpt_Stamps[0], &b_IsStable));
+    TEST_ASSERT_FALSE(b_IsStable);
+
+    /* Deliver the event to the other peers one by one */
+    for (u32_I = 1; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_newPeek(rpt_Stamps[0], &pt_PeekStamp));
+        TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[u32_I], &pt_PeekStamp));
+
+        /* Test the event is not stable until the last peer has seen it */
+        TEST_SUCCESS(
+            ITC_StabilityTracker_isStable(
+                pt_Tracker, rpt_Stamps[0], &b_IsStable));
+        TEST_ASSERT_FALSE(b_IsStable);
+
+        TEST_SUCCESS(
+            ITC_StabilityTracker_update(pt_Tracker, u32_I, rpt_Stamps[u32_I]));
+        checkFrontier(pt_Tracker, rpt_Stamps, 3);
+    }
+
+    TEST_SUCCESS(
+        ITC_StabilityTracker_isStable(pt_Tracker, rpt_Stamps[0], &b_IsStable));
+    TEST_ASSERT_TRUE(b_IsStable);
+
+    /* Test a stale Stamp does not move the frontier back */
+    TEST_SUCCESS(ITC_StabilityTracker_update(pt_Tracker, 0, pt_StaleStamp));
+    checkFrontier(pt_Tracker, rpt_Stamps, 3);
+    TEST_SUCCESS(
+        ITC_StabilityTracker_isStable(pt_Tracker, rpt_Stamps[0], &b_IsStable));
+    TEST_ASSERT_TRUE(b_IsStable);
+
+    /* Test a concurrent event on another peer is not stable */
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_StabilityTracker_update(pt_Tracker, 2, rpt_Stamps[2]));
+    checkFrontier(pt_Tracker, rpt_Stamps, 3);
+    TEST_SUCCESS(
+        ITC_StabilityTracker_isStable(pt_Tracker, rpt_Stamps[2], &b_IsStable));
+    TEST_ASSERT_FALSE(b_IsStable);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_StaleStamp));
+
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+
+    TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+}
+
+/* Test the stable frontier always matches the meet of all peers */
+void ITC_StabilityTracker_Test_frontierMatchesMeetOfAllPeers(void)
+{
+    ITC_StabilityTracker_t *pt_Tracker;
+    ITC_Stamp_t *rpt_Stamps[5];
+    ITC_Stamp_t *pt_PeekStamp;
+    ITC_Stamp_t *pt_AllStamp;
+    bool b_IsStable;
+    uint32_t u32_Round;
+    uint32_t u32_Sender;
+    uint32_t u32_Receiver;
+    uint32_t u32_I;
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    ITC_Event_t *pt_Frontier;
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+
+    for (u32_I = 1; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Stamp_fork(&rpt_Stamps[u32_I - 1], &rpt_Stamps[u32_I]));
+    }
+
+    TEST_SUCCESS(
+        ITC_StabilityTracker_new(ARRAY_COUNT(rpt_Stamps), &pt_Tracker));
+
+    /* Every round a peer adds an event and gossips with another peer */
+    for (u32_Round = 0; u32_Round < 40; u32_Round++)
+    {
+        u32_Sender = (u32_Round * 3U) % ARRAY_COUNT(rpt_Stamps);
+        u32_Receiver = (u32_Round * 7U + 1U) % ARRAY_COUNT(rpt_Stamps);
+
+        TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[u32_Sender]));
+        TEST_SUCCESS(
+            ITC_StabilityTracker_update(
+                pt_Tracker, u32_Sender, rpt_Stamps[u32_Sender]));
+
+        if (u32_Receiver != u32_Sender)
+        {
+            TEST_SUCCESS(
+                ITC_Stamp_newPeek(rpt_Stamps[u32_Sender], &pt_PeekStamp));
+            TEST_SUCCESS(
+                ITC_Stamp_join(&rpt_Stamps[u32_Receiver], &pt_PeekStamp));
+            TEST_SUCCESS(
+                ITC_StabilityTracker_update(
+                    pt_Tracker, u32_Receiver, rpt_Stamps[u32_Receiver]));
+        }
+
+        checkFrontier(pt_Tracker, rpt_Stamps, ARRAY_COUNT(rpt_Stamps));
+    }
+
+    /* Let every peer see the history of every other peer */
+    TEST_SUCCESS(ITC_Stamp_newPeek(rpt_Stamps[0], &pt_AllStamp));
+
+    for (u32_I = 1; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_newPeek(rpt_Stamps[u32_I], &pt_PeekStamp));
+        TEST_SUCCESS(ITC_Stamp_join(&pt_AllStamp, &pt_PeekStamp));
+    }
+
+    for (u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_newPeek(pt_AllStamp, &pt_PeekStamp));
+        TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[u32_I], &pt_PeekStamp));
+        TEST_SUCCESS(
+            ITC_StabilityTracker_update(pt_Tracker, u32_I, rpt_Stamps[u32_I]));
+        checkFrontier(pt_Tracker, rpt_Stamps, ARRAY_COUNT(rpt_Stamps));
+    }
+
+    /* Test all the peer histories are now stable */
+    for (u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_StabilityTracker_isStable(
+                pt_Tracker, rpt_Stamps[u32_I], &b_IsStable));
+        TEST_ASSERT_TRUE(b_IsStable);
+    }
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_AllStamp));
+
+#if ITC_CONFIG_ENABLE_EXTENDED_API
+    TEST_SUCCESS(ITC_StabilityTracker_getFrontier(pt_Tracker, &pt_Frontier));
+    TEST_ASSERT_TRUE(pt_Frontier != pt_Tracker->ppt_Nodes[1]);
+    TEST_SUCCESS(ITC_Event_validate(pt_Frontier));
+    TEST_SUCCESS(ITC_Event_destroy(&pt_Frontier));
+#endif /* ITC_CONFIG_ENABLE_EXTENDED_API */
+
+    for (u32_I = 0; u32_I < ARRAY_COUNT(rpt_Stamps); u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[u32_I]));
+    }
+
+    TEST_SUCCESS(ITC_StabilityTracker_destroy(&pt_Tracker));
+}
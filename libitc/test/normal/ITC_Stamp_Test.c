@@ -10,6 +10,8 @@
 #include "ITC_Stamp.h"
 #include "ITC_Stamp_Test.h"
 
+#include "ITC_SerDes.h"
+
 #include "ITC_Event_package.h"
 #include "ITC_Id_package.h"
 #include "ITC_Port.h"
@@ -280,8 +282,14 @@ void ITC_Stamp_Test_cloneStampSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_newSeed(&pt_OriginalStamp));
     TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_ClonedStamp));
     TEST_ASSERT_TRUE(pt_OriginalStamp != pt_ClonedStamp);
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    /* The shared seed ID and leaf Event are not copied */
+    TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Id == pt_ClonedStamp->pt_Id);
+    TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Event == pt_ClonedStamp->pt_Event);
+#else
     TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Id != pt_ClonedStamp->pt_Id);
     TEST_ASSERT_TRUE(pt_OriginalStamp->pt_Event != pt_ClonedStamp->pt_Event);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
 
     /* Test the cloned Stamp has a Seed ID node with leaf Event with 0 events */
@@ -488,7 +496,12 @@ void ITC_Stamp_Test_forkStampSuccessful(void)
     /* Test the ID was cloned and split and the Event history was cloned */
     TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id);
     TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp->pt_Id);
+#if ITC_CONFIG_USE_SHARED_LEAF_NODES
+    /* The shared leaf Event is not copied */
+    TEST_ASSERT_TRUE(pt_Stamp->pt_Event == pt_OtherStamp->pt_Event);
+#else
     TEST_ASSERT_TRUE(pt_Stamp->pt_Event != pt_OtherStamp->pt_Event);
+#endif /* ITC_CONFIG_USE_SHARED_LEAF_NODES */
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
     TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherStamp->pt_Event, 0);
 
@@ -497,6 +510,150 @@ void ITC_Stamp_Test_forkStampSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
 }
 
+/* Test forking a Stamp with uneven shares fails with invalid param */
+void ITC_Stamp_Test_forkWeightedStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp = NULL;
+
+    TEST_FAILURE(
+        ITC_Stamp_forkWeighted(NULL, &pt_OtherStamp, 1, 2),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_Stamp_forkWeighted(&pt_Stamp, NULL, 1, 2),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkWeighted(&pt_Stamp, &pt_OtherStamp, 0, 2),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkWeighted(&pt_Stamp, &pt_OtherStamp, 1, 0),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ASSERT_NULL(pt_OtherStamp);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test forking a Stamp with uneven shares succeeds */
+void ITC_Stamp_Test_forkWeightedStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create a new Stamp with some history */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Fork off a quarter of the ID */
+    TEST_SUCCESS(ITC_Stamp_forkWeighted(&pt_Stamp, &pt_OtherStamp, 1, 2));
+
+    /* Test the ID was split into (1, (1, 0)) and (0, (0, 1)) */
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(pt_OtherStamp->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp->pt_Id->pt_Right);
+
+    /* Test the Event history was cloned */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherStamp->pt_Event, 1);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Test the Stamps join back together */
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test forking a Stamp into multiple Stamps fails with invalid param */
+void ITC_Stamp_Test_forkNStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_DummyStamp = NULL;
+    ITC_Stamp_t *rpt_OtherStamps[1];
+
+    TEST_FAILURE(
+        ITC_Stamp_forkN(NULL, 2, &rpt_OtherStamps[0]),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkN(&pt_DummyStamp, 2, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkN(&pt_DummyStamp, 0, &rpt_OtherStamps[0]),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_forkN(&pt_DummyStamp, 2, &rpt_OtherStamps[0]),
+        ITC_STATUS_INVALID_PARAM);
+}
+
+/* Test forking a Stamp into multiple Stamps succeeds */
+void ITC_Stamp_Test_forkNStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *rpt_OtherStamps[63];
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_I;
+
+    /* Create a new Stamp with some history */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Test forking into a single Stamp leaves it as it is */
+    TEST_SUCCESS(ITC_Stamp_forkN(&pt_Stamp, 1, &rpt_OtherStamps[0]));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 1);
+
+    /* Fork the Stamp into 5 Stamps */
+    TEST_SUCCESS(ITC_Stamp_forkN(&pt_Stamp, 5, &rpt_OtherStamps[0]));
+
+    /* Test the ID was split into:
+     * pt_Stamp           = (((1, 0), 0), 0)
+     * rpt_OtherStamps[0] = (((0, 1), 0), 0)
+     * rpt_OtherStamps[1] = ((0, 1), 0)
+     * rpt_OtherStamps[2] = (0, (1, 0))
+     * rpt_OtherStamps[3] = (0, (0, 1))
+     */
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id->pt_Left->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id->pt_Left->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(pt_Stamp->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_OtherStamps[0]->pt_Id->pt_Left->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_OtherStamps[0]->pt_Id->pt_Left->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_OtherStamps[0]->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_OtherStamps[1]->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_ID(rpt_OtherStamps[1]->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_OtherStamps[2]->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_OtherStamps[2]->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_OtherStamps[3]->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_OtherStamps[3]->pt_Id->pt_Right);
+
+    /* Test the Event history was cloned and the Stamps join back together */
+    for (u32_I = 0; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(
+            ITC_Stamp_compare(pt_Stamp, rpt_OtherStamps[u32_I], &t_Result));
+        TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+        TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &rpt_OtherStamps[u32_I]));
+    }
+
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    /* Test forking into many Stamps */
+    TEST_SUCCESS(ITC_Stamp_forkN(&pt_Stamp, 64, &rpt_OtherStamps[0]));
+
+    for (u32_I = 0; u32_I < 63; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_event(rpt_OtherStamps[u32_I]));
+        TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &rpt_OtherStamps[u32_I]));
+    }
+
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
 /* Test joining two Stamps fails with invalid param */
 void ITC_Stamp_Test_joinStampsFailInvalidParam(void)
 {
@@ -735,6 +892,9 @@ void ITC_Stamp_Test_eventStampSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
     TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
 
+    /* Test the shared Event of the copy was not modified */
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OriginalStamp->pt_Event, 0);
+
     /* Create a new peek Stamp */
     TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_PeekStamp));
 
@@ -752,7 +912,7 @@ void ITC_Stamp_Test_eventStampSuccessful(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
 
     /* Create a new Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* Retain a copy for comparison */
     TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OriginalStamp));
@@ -829,6 +989,225 @@ void ITC_Stamp_Test_compareStampFailWithCorruptStamp(void)
     }
 }
 
+/* Test inflating the Event of a Stamp with a grow policy fails with invalid
+ * param */
+void ITC_Stamp_Test_eventStampWithGrowPolicyFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(
+        ITC_Stamp_eventWithGrowPolicy(NULL, ITC_EVENT_GROW_POLICY_MIN_SIZE),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_eventWithGrowPolicy(
+            pt_Stamp,
+            (ITC_Event_GrowPolicy_t)(
+                ITC_EVENT_GROW_POLICY_PREFER_EXISTING_LEAVES + 1)),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test inflating the Event of a Stamp with a grow policy succeeds */
+void ITC_Stamp_Test_eventStampWithGrowPolicySuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+
+    /* Create a Stamp with a (1, (0, 1)) ID and a 0 Event */
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_Stamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_Stamp->pt_Id, NULL));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(&pt_Stamp->pt_Id->pt_Left, pt_Stamp->pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(&pt_Stamp->pt_Id->pt_Right, pt_Stamp->pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(
+            &pt_Stamp->pt_Id->pt_Right->pt_Left, pt_Stamp->pt_Id->pt_Right));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(
+            &pt_Stamp->pt_Id->pt_Right->pt_Right, pt_Stamp->pt_Id->pt_Right));
+
+    /* Test minimising the depth grows the shallowest owned leaf:
+     * (0, 1, 0) */
+    TEST_SUCCESS(
+        ITC_Stamp_eventWithGrowPolicy(
+            pt_Stamp, ITC_EVENT_GROW_POLICY_MIN_DEPTH));
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test compacting a Stamp fails with invalid param */
+void ITC_Stamp_Test_compactStampFailInvalidParam(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    bool b_WasCompacted;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    TEST_FAILURE(ITC_Stamp_compact(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compactIfOverBudget(NULL, 1, 1, &b_WasCompacted),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compactIfOverBudget(pt_Stamp, 1, 1, NULL),
+        ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+}
+
+/* Test compacting a Stamp succeeds */
+void ITC_Stamp_Test_compactStampSuccessful(void)
+{
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_OriginalStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    bool b_WasCompacted;
+#if ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET || ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+    bool b_OtherWasCompacted;
+#else
+    uint8_t ru8_Buffer[32];
+    uint32_t u32_Size;
+#endif /* ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET || ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+    uint32_t u32_I;
+
+    /* Create a Stamp with a (1, 0) ID and a (0, (0, 0, 2), 2) Event */
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_OriginalStamp));
+    TEST_SUCCESS(ITC_Id_destroy(&pt_OriginalStamp->pt_Id));
+    TEST_SUCCESS(ITC_TestUtil_newNullId(&pt_OriginalStamp->pt_Id, NULL));
+    TEST_SUCCESS(
+        ITC_TestUtil_newSeedId(
+            &pt_OriginalStamp->pt_Id->pt_Left, pt_OriginalStamp->pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newNullId(
+            &pt_OriginalStamp->pt_Id->pt_Right, pt_OriginalStamp->pt_Id));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OriginalStamp->pt_Event->pt_Left,
+            pt_OriginalStamp->pt_Event,
+            0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OriginalStamp->pt_Event->pt_Left->pt_Left,
+            pt_OriginalStamp->pt_Event->pt_Left,
+            0));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OriginalStamp->pt_Event->pt_Left->pt_Right,
+            pt_OriginalStamp->pt_Event->pt_Left,
+            2));
+    TEST_SUCCESS(
+        ITC_TestUtil_newEvent(
+            &pt_OriginalStamp->pt_Event->pt_Right,
+            pt_OriginalStamp->pt_Event,
+            2));
+
+    /* Test compacting collapses the Event into a leaf */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_compact(pt_Stamp));
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 2);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Test compacting a compacted Stamp does nothing */
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(pt_Stamp, 1, 1, &b_WasCompacted));
+    TEST_ASSERT_FALSE(b_WasCompacted);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+#if ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET || ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+    /* Test the configured budgets apply even if the caller sets bigger ones */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_Stamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(
+            pt_Stamp, UINT32_MAX, UINT32_MAX, &b_WasCompacted));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_OtherStamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(
+            pt_OtherStamp, 0, 0, &b_OtherWasCompacted));
+    TEST_ASSERT_EQUAL(b_OtherWasCompacted, b_WasCompacted);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    /* Test a Stamp within its budgets is left alone */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_Stamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(pt_Stamp, 5, 1024, &b_WasCompacted));
+    TEST_ASSERT_FALSE(b_WasCompacted);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OriginalStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Test the size budget is compared against the exact serialised size */
+    u32_Size = sizeof(ru8_Buffer);
+    TEST_SUCCESS(
+        ITC_SerDes_serialiseStamp(pt_OriginalStamp, &ru8_Buffer[0], &u32_Size));
+    for (u32_I = 0; u32_I < 2; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_Stamp));
+        TEST_SUCCESS(
+            ITC_Stamp_compactIfOverBudget(
+                pt_Stamp, 0, u32_Size - u32_I, &b_WasCompacted));
+        TEST_ASSERT_EQUAL(u32_I == 1, b_WasCompacted);
+        TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    }
+#endif /* ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET || ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+
+    /* Test a Stamp over either of its budgets is compacted */
+    for (u32_I = 0; u32_I < 2; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_Stamp));
+        TEST_SUCCESS(
+            ITC_Stamp_compactIfOverBudget(
+                pt_Stamp,
+                (u32_I == 0) ? 4 : 1024,
+                (u32_I == 1) ? 1 : 1024,
+                &b_WasCompacted));
+        TEST_ASSERT_TRUE(b_WasCompacted);
+        TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 2);
+        TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    }
+
+    /* Test compacting a peek Stamp does nothing */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_OriginalStamp, &pt_Stamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(pt_Stamp, 1, 1024, &b_WasCompacted));
+    TEST_ASSERT_FALSE(b_WasCompacted);
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    /* Test unset budgets fall back to the configured budgets */
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_Stamp));
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(pt_Stamp, 0, 0, &b_WasCompacted));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_OriginalStamp, &pt_OtherStamp));
+#if ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET || ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET
+    TEST_SUCCESS(
+        ITC_Stamp_compactIfOverBudget(
+            pt_OtherStamp,
+            ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET,
+            ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET,
+            &b_OtherWasCompacted));
+    TEST_ASSERT_EQUAL(b_OtherWasCompacted, b_WasCompacted);
+#else
+    /* Nothing is compacted without any budgets */
+    TEST_ASSERT_FALSE(b_WasCompacted);
+#endif /* ITC_CONFIG_STAMP_COMPACT_NODE_BUDGET || ITC_CONFIG_STAMP_COMPACT_SIZE_BUDGET */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OriginalStamp));
+}
+
 /* Test comparing a Stamp fails with corrupt Id or Event */
 void ITC_Stamp_Test_compareStampFailWithCorruptIdOrEvent(void)
 {
@@ -896,7 +1275,7 @@ void ITC_Stamp_Test_compareStampsSucceeds(void)
     ITC_Stamp_Comparison_t t_Result;
 
     /* Create the Stamps */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp1));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp1));
     TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp1, &pt_Stamp2));
 
     TEST_SUCCESS(
@@ -907,6 +1286,7 @@ void ITC_Stamp_Test_compareStampsSucceeds(void)
             &pt_Stamp1->pt_Event->pt_Right, pt_Stamp1->pt_Event, 3));
 
     pt_Stamp2->pt_Event->t_Count = 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Stamp2->pt_Event);
     TEST_SUCCESS(
         ITC_TestUtil_newEvent(
             &pt_Stamp2->pt_Event->pt_Left, pt_Stamp2->pt_Event, 0));
@@ -923,6 +1303,7 @@ void ITC_Stamp_Test_compareStampsSucceeds(void)
 
     /* Make the 2 Stamps concurrent */
     pt_Stamp2->pt_Event->pt_Right->t_Count -= 1;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Stamp2->pt_Event->pt_Right);
 
     /* Compare Stamps */
     TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp1, pt_Stamp2, &t_Result));
@@ -942,6 +1323,562 @@ void ITC_Stamp_Test_compareStampsSucceeds(void)
     TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp2));
 }
 
+/* Test batching a Stamp fails with invalid param */
+void ITC_Stamp_Test_batchStampFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_FAILURE(ITC_Stamp_beginBatch(NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Stamp_endBatch(NULL), ITC_STATUS_INVALID_PARAM);
+
+    /* Create a new Stamp */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+
+    /* Test a Stamp outside of a batch cannot leave it */
+    TEST_FAILURE(ITC_Stamp_endBatch(pt_Stamp), ITC_STATUS_INVALID_PARAM);
+
+    /* Test a batched Stamp cannot start another batch */
+    TEST_SUCCESS(ITC_Stamp_beginBatch(pt_Stamp));
+    TEST_FAILURE(ITC_Stamp_beginBatch(pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_endBatch(pt_Stamp));
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp batches are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+}
+
+/* Test batched Stamps are rejected by operations requiring normalised Stamps */
+void ITC_Stamp_Test_batchedStampFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_ForkedStamp = NULL;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create the Stamps */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_OtherStamp));
+
+    /* Start a batch */
+    TEST_SUCCESS(ITC_Stamp_beginBatch(pt_Stamp));
+
+    /* Test the batched Stamp is rejected */
+    TEST_FAILURE(
+        ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_compare(pt_OtherStamp, pt_Stamp, &t_Result),
+        ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_fork(&pt_Stamp, &pt_ForkedStamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Stamp_validate(pt_Stamp), ITC_STATUS_INVALID_PARAM);
+
+    /* Test the Stamp can be used again after the batch has ended */
+    TEST_SUCCESS(ITC_Stamp_endBatch(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp batches are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+}
+
+/* Test joining Stamps in a batch matches joining them one by one */
+void ITC_Stamp_Test_joinBatchedStampsSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    ITC_Stamp_t *rpt_Stamps[4];
+    ITC_Stamp_t *rpt_BatchedStamps[4];
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Split a seed Stamp into 4 Stamps with ((1, 0), 0), ((0, 1), 0),
+     * (0, (1, 0)) and (0, (0, 1)) IDs */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[2], &rpt_Stamps[3]));
+
+    /* Add a different number of events to each Stamp and clone them */
+    for (uint32_t u32_I = 0; u32_I < 4; u32_I++)
+    {
+        for (uint32_t u32_J = 0; u32_J <= u32_I; u32_J++)
+        {
+            TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[u32_I]));
+        }
+
+        TEST_SUCCESS(
+            ITC_Stamp_clone(rpt_Stamps[u32_I], &rpt_BatchedStamps[u32_I]));
+    }
+
+    /* Join the Stamps one by one */
+    for (uint32_t u32_I = 1; u32_I < 4; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[0], &rpt_Stamps[u32_I]));
+    }
+
+    /* Join the cloned Stamps in a batch */
+    TEST_SUCCESS(ITC_Stamp_beginBatch(rpt_BatchedStamps[0]));
+    TEST_SUCCESS(
+        ITC_Stamp_join(&rpt_BatchedStamps[0], &rpt_BatchedStamps[1]));
+    /* The batched Stamp can also be joined from the other side */
+    TEST_SUCCESS(
+        ITC_Stamp_join(&rpt_BatchedStamps[2], &rpt_BatchedStamps[0]));
+    TEST_SUCCESS(
+        ITC_Stamp_join(&rpt_BatchedStamps[2], &rpt_BatchedStamps[3]));
+    TEST_FAILURE(
+        ITC_Stamp_validate(rpt_BatchedStamps[2]), ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_endBatch(rpt_BatchedStamps[2]));
+
+    /* Test the results match */
+    TEST_ITC_ID_IS_SEED_ID(rpt_BatchedStamps[2]->pt_Id);
+    TEST_SUCCESS(
+        ITC_Stamp_compare(rpt_Stamps[0], rpt_BatchedStamps[2], &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_BatchedStamps[2]));
+#else
+    TEST_IGNORE_MESSAGE("Stamp batches are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+}
+
+/* Test inflating the Event of a batched Stamp succeeds */
+void ITC_Stamp_Test_eventBatchedStampSuccessful(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_BATCH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+
+    /* Create the Stamps */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+
+    /* Join the Stamps in a batch, leaving an unnormalised seed ID */
+    TEST_SUCCESS(ITC_Stamp_beginBatch(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+
+    /* Add an event while still in the batch */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_FAILURE(ITC_Stamp_validate(pt_Stamp), ITC_STATUS_INVALID_PARAM);
+
+    /* End the batch */
+    TEST_SUCCESS(ITC_Stamp_endBatch(pt_Stamp));
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 1);
+
+    /* Destroy the Stamp */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp batches are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_BATCH */
+}
+
+/* Test hashing a Stamp fails with invalid param */
+void ITC_Stamp_Test_hashStampFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+    ITC_Stamp_t *pt_Stamp;
+    uint64_t u64_Hash;
+
+    TEST_FAILURE(ITC_Stamp_hash(NULL, &u64_Hash), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(ITC_Stamp_hash(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Event hashes are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+}
+
+/* Test hashing Stamps succeeds and is used when comparing them */
+void ITC_Stamp_Test_hashStampSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_EVENT_HASH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint64_t u64_Hash;
+    uint64_t u64_OtherHash;
+
+    /* Create the Stamps */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+
+    /* Test different Events have different hashes, which get cached */
+    TEST_SUCCESS(ITC_Stamp_hash(pt_Stamp, &u64_Hash));
+    TEST_SUCCESS(ITC_Stamp_hash(pt_OtherStamp, &u64_OtherHash));
+    TEST_ASSERT_NOT_EQUAL(u64_Hash, u64_OtherHash);
+    TEST_ASSERT_TRUE(pt_Stamp->b_IsEventHashCached);
+    TEST_ASSERT_EQUAL(u64_Hash, pt_Stamp->u64_EventHash);
+
+    /* Test comparing with differing hashes still orders the Stamps */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+
+    /* Test adding an Event invalidates the cached hash */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_ASSERT_FALSE(pt_Stamp->b_IsEventHashCached);
+    TEST_SUCCESS(ITC_Stamp_hash(pt_Stamp, &u64_Hash));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_CONCURRENT, t_Result);
+
+    /* Test ordered Stamps with cached hashes */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_OtherStamp, &pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_hash(pt_Stamp, &u64_Hash));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_hash(pt_OtherStamp, &u64_OtherHash));
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_OtherStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Test equal hashes are trusted to mean equal Stamps */
+    pt_Stamp->u64_EventHash = u64_OtherHash;
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Destroy the Stamps */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+#else
+    TEST_IGNORE_MESSAGE("Event hashes are disabled");
+#endif /* ITC_CONFIG_ENABLE_EVENT_HASH */
+}
+
+/* Test rebasing a Stamp fails with invalid param */
+void ITC_Stamp_Test_rebaseStampFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(ITC_Stamp_rebase(NULL, pt_Stamp), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(ITC_Stamp_rebase(pt_Stamp, NULL), ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+}
+
+/* Test rebasing Stamps succeeds and mixed-base Stamps are detected */
+void ITC_Stamp_Test_rebaseStampSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_PeekStamp;
+    ITC_Stamp_Comparison_t t_Result;
+    uint64_t u64_RebaseBaseId;
+
+    /* Create the Stamps and their common base */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_Base));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+
+    /* Test a base which is not `<=` the Stamp is rejected */
+    TEST_FAILURE(
+        ITC_Stamp_rebase(pt_Base, pt_Stamp),
+        ITC_STATUS_EVENT_COUNTER_UNDERFLOW);
+    TEST_ASSERT_EQUAL(0, pt_Base->u64_RebaseBaseId);
+
+    /* Test the counters are rebased */
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_Base));
+    TEST_ASSERT_NOT_EQUAL(0, pt_Stamp->u64_RebaseBaseId);
+    u64_RebaseBaseId = pt_Stamp->u64_RebaseBaseId;
+    TEST_ITC_EVENT_IS_PARENT_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Left, 1);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event->pt_Right, 0);
+
+    /* Test rebased and not rebased Stamps cannot be compared or joined */
+    TEST_FAILURE(
+        ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result),
+        ITC_STATUS_MISMATCHED_STAMP_BASE);
+    TEST_FAILURE(
+        ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_MISMATCHED_STAMP_BASE);
+    TEST_FAILURE(
+        ITC_Stamp_rebase(pt_Stamp, pt_Base), ITC_STATUS_MISMATCHED_STAMP_BASE);
+
+    /* Test Stamps rebased against the same base are ordered as before */
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_OtherStamp, pt_Base));
+    TEST_ASSERT_EQUAL(u64_RebaseBaseId, pt_OtherStamp->u64_RebaseBaseId);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+
+    /* Test the rebase base ID is inherited by derived Stamps */
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_PeekStamp));
+    TEST_ASSERT_EQUAL(u64_RebaseBaseId, pt_PeekStamp->u64_RebaseBaseId);
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_PeekStamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_EQUAL(u64_RebaseBaseId, pt_Stamp->u64_RebaseBaseId);
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_EQUAL(u64_RebaseBaseId, pt_OtherStamp->u64_RebaseBaseId);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+
+    /* Test rebasing again chains the base IDs */
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_Base));
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_Base));
+    TEST_ASSERT_NOT_EQUAL(0, pt_Stamp->u64_RebaseBaseId);
+    TEST_ASSERT_NOT_EQUAL(u64_RebaseBaseId, pt_Stamp->u64_RebaseBaseId);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+#else
+    TEST_IGNORE_MESSAGE("Stamp rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+}
+
+/* Test Stamps rebased once against different bases cannot be compared */
+void ITC_Stamp_Test_rebaseStampsAgainstDifferentBasesFails(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_REBASE
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_Base;
+    ITC_Stamp_t *pt_OtherBase;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create two replicas with different stable frontiers */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_Stamp, &pt_Base));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_newPeek(pt_OtherStamp, &pt_OtherBase));
+
+    /* Rebase each replica once, against its own base */
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_Stamp, pt_Base));
+    TEST_SUCCESS(ITC_Stamp_rebase(pt_OtherStamp, pt_OtherBase));
+    TEST_ASSERT_NOT_EQUAL(0, pt_Stamp->u64_RebaseBaseId);
+    TEST_ASSERT_NOT_EQUAL(0, pt_OtherStamp->u64_RebaseBaseId);
+
+    /* Test the replicas cannot be compared or joined */
+    TEST_FAILURE(
+        ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result),
+        ITC_STATUS_MISMATCHED_STAMP_BASE);
+    TEST_FAILURE(
+        ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp),
+        ITC_STATUS_MISMATCHED_STAMP_BASE);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Base));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherBase));
+#else
+    TEST_IGNORE_MESSAGE("Stamp rebasing is disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_REBASE */
+}
+
+/* Test reseeding a Stamp fails with invalid param */
+void ITC_Stamp_Test_reseedStampEpochFailInvalidParam(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    ITC_Stamp_t *pt_Stamp;
+
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_FAILURE(
+        ITC_Stamp_reseedEpoch(NULL, 1, 0, 1), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_reseedEpoch(pt_Stamp, 0, 0, 1), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_reseedEpoch(pt_Stamp, 1, 1, 1), ITC_STATUS_INVALID_PARAM);
+
+    /* Test the Stamp is left untouched */
+    TEST_ASSERT_EQUAL(0, pt_Stamp->u32_Epoch);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp epochs are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+}
+
+/* Test reseeding Stamps succeeds and orders them across epochs */
+void ITC_Stamp_Test_reseedStampEpochSucceeds(void)
+{
+#if ITC_CONFIG_ENABLE_STAMP_EPOCH
+    ITC_Stamp_t *pt_Stamp;
+    ITC_Stamp_t *pt_OtherStamp;
+    ITC_Stamp_t *pt_OldStamp;
+    ITC_Stamp_Comparison_t t_Result;
+
+    /* Create some Stamps with history */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_event(pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_clone(pt_Stamp, &pt_OldStamp));
+
+    /* Reseed both Stamps into the next epoch */
+    TEST_SUCCESS(ITC_Stamp_reseedEpoch(pt_Stamp, 1, 0, 2));
+    TEST_SUCCESS(ITC_Stamp_reseedEpoch(pt_OtherStamp, 1, 1, 2));
+
+    /* Test the Stamps were reseeded with balanced IDs and `0` Events */
+    TEST_ASSERT_EQUAL(1, pt_Stamp->u32_Epoch);
+    TEST_ITC_ID_IS_SEED_NULL_ID(pt_Stamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_Stamp->pt_Event, 0);
+    TEST_ASSERT_EQUAL(1, pt_OtherStamp->u32_Epoch);
+    TEST_ITC_ID_IS_NULL_SEED_ID(pt_OtherStamp->pt_Id);
+    TEST_ITC_EVENT_IS_LEAF_N_EVENT(pt_OtherStamp->pt_Event, 0);
+
+    /* Test Stamps are ordered by epoch first */
+    TEST_SUCCESS(ITC_Stamp_compare(pt_OldStamp, pt_Stamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_LESS_THAN, t_Result);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OldStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_GREATER_THAN, t_Result);
+    TEST_SUCCESS(ITC_Stamp_compare(pt_Stamp, pt_OtherStamp, &t_Result));
+    TEST_ASSERT_EQUAL(ITC_STAMP_COMPARISON_EQUAL, t_Result);
+
+    /* Test Stamps of different epochs cannot be joined */
+    TEST_FAILURE(
+        ITC_Stamp_join(&pt_Stamp, &pt_OldStamp),
+        ITC_STATUS_MISMATCHED_STAMP_EPOCH);
+
+    /* Test the epoch is inherited by derived Stamps */
+    TEST_SUCCESS(ITC_Stamp_event(pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_join(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_EQUAL(1, pt_Stamp->u32_Epoch);
+    TEST_ITC_ID_IS_SEED_ID(pt_Stamp->pt_Id);
+    TEST_SUCCESS(ITC_Stamp_fork(&pt_Stamp, &pt_OtherStamp));
+    TEST_ASSERT_EQUAL(1, pt_OtherStamp->u32_Epoch);
+
+    /* Test epochs cannot move backwards */
+    TEST_FAILURE(
+        ITC_Stamp_reseedEpoch(pt_Stamp, 1, 0, 1), ITC_STATUS_INVALID_PARAM);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_Stamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OtherStamp));
+    TEST_SUCCESS(ITC_Stamp_destroy(&pt_OldStamp));
+#else
+    TEST_IGNORE_MESSAGE("Stamp epochs are disabled");
+#endif /* ITC_CONFIG_ENABLE_STAMP_EPOCH */
+}
+
+/* Test rebalancing Stamps fails with invalid param */
+void ITC_Stamp_Test_rebalanceStampsFailInvalidParam(void)
+{
+    ITC_Stamp_t *rpt_Stamps[2] = { NULL };
+
+    TEST_FAILURE(ITC_Stamp_rebalance(NULL, 1), ITC_STATUS_INVALID_PARAM);
+    TEST_FAILURE(
+        ITC_Stamp_rebalance(&rpt_Stamps[0], 0), ITC_STATUS_INVALID_PARAM);
+
+    /* Test a missing Stamp is rejected */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_FAILURE(
+        ITC_Stamp_rebalance(&rpt_Stamps[0], 2), ITC_STATUS_INVALID_PARAM);
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[0]));
+}
+
+/* Test rebalancing Stamps succeeds and preserves causality */
+void ITC_Stamp_Test_rebalanceStampsSucceeds(void)
+{
+    ITC_Stamp_t *rpt_Stamps[4];
+    ITC_Stamp_t *rpt_OldStamps[3];
+    ITC_Stamp_Comparison_t t_Result;
+    uint32_t u32_I;
+    uint32_t u32_J;
+
+    /* Fork the seed into quarters:
+     * rpt_Stamps[0] = ((1, 0), 0)
+     * rpt_Stamps[1] = (0, (1, 0))
+     * rpt_Stamps[2] = (0, (0, 1))
+     * rpt_Stamps[3] = ((0, 1), 0)
+     */
+    TEST_SUCCESS(ITC_Stamp_newSeed(&rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[0]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[1]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[1], &rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+    TEST_SUCCESS(ITC_Stamp_fork(&rpt_Stamps[0], &rpt_Stamps[3]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[3]));
+
+    /* Leave a fragmented half behind:
+     * rpt_Stamps[2] = ((0, 1), (0, 1))
+     */
+    TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[2], &rpt_Stamps[3]));
+    TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[2]));
+
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_clone(rpt_Stamps[u32_I], &rpt_OldStamps[u32_I]));
+    }
+
+    TEST_SUCCESS(ITC_Stamp_rebalance(&rpt_Stamps[0], 3));
+
+    /* Test the IDs keep their owned fractions in single subintervals:
+     * rpt_Stamps[0] = (0, (1, 0))
+     * rpt_Stamps[1] = (0, (0, 1))
+     * rpt_Stamps[2] = (1, 0)
+     */
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_ITC_ID_IS_NOT_LEAF_ID(rpt_Stamps[u32_I]->pt_Id);
+        TEST_SUCCESS(ITC_Event_validate(rpt_Stamps[u32_I]->pt_Event));
+    }
+
+    TEST_ITC_ID_IS_NULL_ID(rpt_Stamps[0]->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Stamps[0]->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_NULL_ID(rpt_Stamps[1]->pt_Id->pt_Left);
+    TEST_ITC_ID_IS_NULL_SEED_ID(rpt_Stamps[1]->pt_Id->pt_Right);
+    TEST_ITC_ID_IS_SEED_NULL_ID(rpt_Stamps[2]->pt_Id);
+
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        /* Test the Stamps did not move backwards */
+        TEST_SUCCESS(ITC_Stamp_compare(
+            rpt_OldStamps[u32_I], rpt_Stamps[u32_I], &t_Result));
+        TEST_ASSERT_TRUE(
+            t_Result &
+            (ITC_STAMP_COMPARISON_LESS_THAN | ITC_STAMP_COMPARISON_EQUAL));
+
+        /* Test new events are never ordered before any of the old ones */
+        TEST_SUCCESS(ITC_Stamp_event(rpt_Stamps[u32_I]));
+
+        for (u32_J = 0; u32_J < 3; u32_J++)
+        {
+            TEST_SUCCESS(ITC_Stamp_compare(
+                rpt_Stamps[u32_I], rpt_OldStamps[u32_J], &t_Result));
+            TEST_ASSERT_TRUE(
+                t_Result & (ITC_STAMP_COMPARISON_GREATER_THAN |
+                            ITC_STAMP_COMPARISON_CONCURRENT));
+        }
+    }
+
+    /* Test the Stamps still join back into a seed */
+    for (u32_I = 1; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_join(&rpt_Stamps[0], &rpt_Stamps[u32_I]));
+    }
+
+    TEST_ITC_ID_IS_SEED_ID(rpt_Stamps[0]->pt_Id);
+
+    TEST_SUCCESS(ITC_Stamp_destroy(&rpt_Stamps[0]));
+
+    for (u32_I = 0; u32_I < 3; u32_I++)
+    {
+        TEST_SUCCESS(ITC_Stamp_destroy(&rpt_OldStamps[u32_I]));
+    }
+}
+
 /* Test full Stamp lifecycle */
 void ITC_Stamp_Test_fullStampLifecycle(void)
 {
@@ -1523,7 +2460,7 @@ void ITC_Stamp_Test_getIdFromStampSuccessful(void)
     ITC_Id_t *pt_Id = NULL;
 
     /* Create the Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
 
     /* Get the ID */
     TEST_SUCCESS(ITC_Stamp_getId(pt_Stamp, &pt_Id));
@@ -1835,8 +2772,9 @@ void ITC_Stamp_Test_getEventFromStampSuccessful(void)
     ITC_Event_t *pt_Event = NULL;
 
     /* Create the Stamp */
-    TEST_SUCCESS(ITC_Stamp_newSeed(&pt_Stamp));
+    TEST_SUCCESS(ITC_TestUtil_newSeedStamp(&pt_Stamp));
     pt_Stamp->pt_Event->t_Count = 42;
+    ITC_TestUtil_updateEventSubtreeMax(pt_Stamp->pt_Event);
 
     /* Get the Event */
     TEST_SUCCESS(ITC_Stamp_getEvent(pt_Stamp, &pt_Event));